@@ -0,0 +1,1897 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
+#include <triggerfish.h>
+#include <seahorse.h>
+
+/*
+ * Benchmark driver for every seahorse container.
+ *
+ * Each (container, workload, count) case runs in a forked child whose peak
+ * resident set size is reported relative to the one it had right after the
+ * fork, so that memory inherited from the driver (e.g. the workload arrays)
+ * is not attributed to the case. The timed
+ * phases exclude the preparation of keys and values (e.g. creating the
+ * sea_turtle_string keys) so that only the container operations are measured.
+ *
+ * Workloads:
+ *  - sequential: keys are added in ascending order and looked up in the same
+ *    order.
+ *  - random: keys are added in a shuffled order and looked up uniformly at
+ *    random.
+ *  - zipfian: keys are added in a shuffled order and looked up following a
+ *    zipfian distribution (theta = 0.99) whose hot keys are scattered across
+ *    the key space.
+ */
+
+#define DEFAULT_COUNTS              "1000,10000,100000,1000000,10000000"
+#define DEFAULT_WORKLOADS           "sequential,random,zipfian"
+#define ZIPFIAN_THETA               0.99
+#define STRING_KEY_LENGTH           20
+#define PHASES_MAXIMUM              4
+
+#pragma mark allocation counting
+
+static uintmax_t allocations;
+
+#if defined(__GLIBC__)
+#define ALLOCATIONS_ARE_COUNTED     true
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void *pointer);
+
+void *malloc(const size_t size) {
+    allocations++;
+    return __libc_malloc(size);
+}
+
+void *calloc(const size_t count, const size_t size) {
+    allocations++;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *const pointer, const size_t size) {
+    allocations++;
+    return __libc_realloc(pointer, size);
+}
+
+int posix_memalign(void **const out, const size_t alignment,
+                   const size_t size) {
+    allocations++;
+    void *const pointer = __libc_memalign(alignment, size);
+    if (!pointer) {
+        return ENOMEM;
+    }
+    *out = pointer;
+    return 0;
+}
+
+void *aligned_alloc(const size_t alignment, const size_t size) {
+    allocations++;
+    return __libc_memalign(alignment, size);
+}
+
+void free(void *const pointer) {
+    __libc_free(pointer);
+}
+#else
+#define ALLOCATIONS_ARE_COUNTED     false
+#endif
+
+#pragma mark workloads
+
+struct workload {
+    const char *name;
+    uintmax_t count;
+    uintmax_t *keys;
+    uintmax_t *probes;
+};
+
+static uintmax_t random_state;
+
+static uintmax_t random_next(void) {
+    /* splitmix64 */
+    uint64_t z = (random_state += UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+
+static double random_unit(void) {
+    return (double) (random_next() >> 11) * 0x1.0p-53;
+}
+
+static void shuffle(uintmax_t *const values, const uintmax_t count) {
+    for (uintmax_t i = count - 1; i > 0; i--) {
+        const uintmax_t j = random_next() % (i + 1);
+        const uintmax_t swap = values[i];
+        values[i] = values[j];
+        values[j] = swap;
+    }
+}
+
+static void zipfian(uintmax_t *const out, const uintmax_t *const keys,
+                    const uintmax_t count) {
+    /* Gray et al., "Quickly Generating Billion-Record Synthetic Databases" */
+    double zeta_n = 0;
+    for (uintmax_t i = 1; i <= count; i++) {
+        zeta_n += 1.0 / pow((double) i, ZIPFIAN_THETA);
+    }
+    const double zeta_2 = 1.0 + pow(0.5, ZIPFIAN_THETA);
+    const double alpha = 1.0 / (1.0 - ZIPFIAN_THETA);
+    const double eta = (1.0 - pow(2.0 / (double) count, 1.0 - ZIPFIAN_THETA))
+                       / (1.0 - zeta_2 / zeta_n);
+    for (uintmax_t i = 0; i < count; i++) {
+        const double u = random_unit();
+        const double uz = u * zeta_n;
+        uintmax_t rank;
+        if (uz < 1.0) {
+            rank = 0;
+        } else if (uz < zeta_2) {
+            rank = 1;
+        } else {
+            rank = (uintmax_t) ((double) count
+                                * pow(eta * u - eta + 1.0, alpha));
+        }
+        if (rank >= count) {
+            rank = count - 1;
+        }
+        out[i] = keys[rank];
+    }
+}
+
+static void workload_init(struct workload *const object,
+                          const char *const name,
+                          const uintmax_t count) {
+    *object = (struct workload) {
+            .name = name,
+            .count = count
+    };
+    object->keys = malloc(count * sizeof(uintmax_t));
+    object->probes = malloc(count * sizeof(uintmax_t));
+    seagrass_required_true(object->keys && object->probes);
+    for (uintmax_t i = 0; i < count; i++) {
+        object->keys[i] = i;
+    }
+    if (!strcmp("sequential", name)) {
+        memcpy(object->probes, object->keys, count * sizeof(uintmax_t));
+    } else if (!strcmp("random", name)) {
+        shuffle(object->keys, count);
+        for (uintmax_t i = 0; i < count; i++) {
+            object->probes[i] = random_next() % count;
+        }
+    } else if (!strcmp("zipfian", name)) {
+        shuffle(object->keys, count);
+        zipfian(object->probes, object->keys, count);
+    } else {
+        seagrass_required_true(false);
+    }
+}
+
+static void workload_invalidate(struct workload *const object) {
+    free(object->keys);
+    free(object->probes);
+    *object = (struct workload) {0};
+}
+
+#pragma mark measurements
+
+struct phase {
+    char operation[16];
+    double nanoseconds;
+    double allocations;
+};
+
+struct report {
+    uintmax_t count;
+    struct phase phases[PHASES_MAXIMUM];
+    long peak_rss_delta;
+};
+
+struct stopwatch {
+    struct timespec start;
+    uintmax_t allocations;
+};
+
+static void stopwatch_start(struct stopwatch *const object) {
+    object->allocations = allocations;
+    seagrass_required_true(!clock_gettime(CLOCK_MONOTONIC, &object->start));
+}
+
+static void stopwatch_stop(const struct stopwatch *const object,
+                           struct report *const report,
+                           const char *const operation,
+                           const uintmax_t operations) {
+    struct timespec end;
+    seagrass_required_true(!clock_gettime(CLOCK_MONOTONIC, &end));
+    const uintmax_t delta = allocations - object->allocations;
+    seagrass_required_true(report->count < PHASES_MAXIMUM);
+    struct phase *const phase = &report->phases[report->count++];
+    snprintf(phase->operation, sizeof(phase->operation), "%s", operation);
+    const double nanoseconds = (double) (end.tv_sec - object->start.tv_sec)
+                               * 1e9
+                               + (double) (end.tv_nsec - object->start.tv_nsec);
+    phase->nanoseconds = nanoseconds / (double) operations;
+    phase->allocations = (double) delta / (double) operations;
+}
+
+#pragma mark helpers
+
+static struct sea_turtle_string *strings_of(const uintmax_t *const keys,
+                                            const uintmax_t count) {
+    struct sea_turtle_string *const out = malloc(
+            count * sizeof(struct sea_turtle_string));
+    seagrass_required_true(out);
+    for (uintmax_t i = 0; i < count; i++) {
+        char buffer[STRING_KEY_LENGTH + 1];
+        snprintf(buffer, sizeof(buffer), "%0*ju", STRING_KEY_LENGTH, keys[i]);
+        uintmax_t length;
+        seagrass_required_true(sea_turtle_string_init(
+                &out[i], buffer, STRING_KEY_LENGTH, &length));
+    }
+    return out;
+}
+
+static void strings_destroy(struct sea_turtle_string *const strings,
+                            const uintmax_t count) {
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(sea_turtle_string_invalidate(&strings[i]));
+    }
+    free(strings);
+}
+
+static struct sea_turtle_integer *integers_of(const uintmax_t *const keys,
+                                              const uintmax_t count) {
+    struct sea_turtle_integer *const out = malloc(
+            count * sizeof(struct sea_turtle_integer));
+    seagrass_required_true(out);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(sea_turtle_integer_init_uintmax_t(
+                &out[i], keys[i]));
+    }
+    return out;
+}
+
+static void integers_destroy(struct sea_turtle_integer *const integers,
+                             const uintmax_t count) {
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(sea_turtle_integer_invalidate(&integers[i]));
+    }
+    free(integers);
+}
+
+static void on_destroy_nothing(void *const instance) {
+    (void) instance;
+}
+
+static struct triggerfish_strong **strongs_of(const uintmax_t *const keys,
+                                              const uintmax_t count) {
+    struct triggerfish_strong **const out = malloc(
+            count * sizeof(struct triggerfish_strong *));
+    seagrass_required_true(out);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(triggerfish_strong_of(
+                (void *) (uintptr_t) (1 + keys[i]), on_destroy_nothing,
+                &out[i]));
+    }
+    return out;
+}
+
+static void strongs_destroy(struct triggerfish_strong **const strongs,
+                            const uintmax_t count) {
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(triggerfish_strong_release(strongs[i]));
+    }
+    free(strongs);
+}
+
+static int strong_compare(const struct triggerfish_strong **const first,
+                          const struct triggerfish_strong **const second) {
+    void *a;
+    seagrass_required_true(triggerfish_strong_instance(*first, &a));
+    void *b;
+    seagrass_required_true(triggerfish_strong_instance(*second, &b));
+    return seagrass_uintmax_t_compare((uintptr_t) a, (uintptr_t) b);
+}
+
+/* lookups use the position of the probed key within the insertion order */
+static uintmax_t *positions_of(const struct workload *const workload) {
+    uintmax_t *const index = malloc(workload->count * sizeof(uintmax_t));
+    uintmax_t *const out = malloc(workload->count * sizeof(uintmax_t));
+    seagrass_required_true(index && out);
+    for (uintmax_t i = 0; i < workload->count; i++) {
+        index[workload->keys[i]] = i;
+    }
+    for (uintmax_t i = 0; i < workload->count; i++) {
+        out[i] = index[workload->probes[i]];
+    }
+    free(index);
+    return out;
+}
+
+#pragma mark maps
+
+static void bench_btree_map_i_i(const struct workload *const workload,
+                                struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_integer *const keys = integers_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_btree_map_i_i object;
+    seagrass_required_true(seahorse_btree_map_i_i_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_btree_map_i_i_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct sea_turtle_integer *out;
+        seagrass_required_true(seahorse_btree_map_i_i_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_btree_map_i_i_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_btree_map_i_i_invalidate(&object));
+    free(positions);
+    integers_destroy(keys, count);
+}
+
+static void bench_btree_map_ni_ni(const struct workload *const workload,
+                                  struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_btree_map_ni_ni object;
+    seagrass_required_true(seahorse_btree_map_ni_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_btree_map_ni_ni_add(
+                &object, workload->keys[i], workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const uintmax_t *out;
+        seagrass_required_true(seahorse_btree_map_ni_ni_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_btree_map_ni_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_btree_map_ni_ni_invalidate(&object));
+}
+
+/* flat maps are built from a tree map since adding is linear in their count */
+static void bench_concurrent_hash_map_ni_ni(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    seagrass_required_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_concurrent_hash_map_ni_ni_add(
+                &object, workload->keys[i], workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_concurrent_hash_map_ni_ni_add_to(
+                &object, workload->probes[i], 1));
+    }
+    stopwatch_stop(&stopwatch, report, "add_to", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_concurrent_hash_map_ni_ni_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_concurrent_hash_map_ni_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_concurrent_hash_map_ni_ni_invalidate(
+            &object));
+}
+
+static void bench_concurrent_tree_map_s_p(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const keys = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_concurrent_tree_map_s_p object;
+    seagrass_required_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    seagrass_required_true(seahorse_concurrent_tree_map_s_p_register(
+            &object, &reader));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *out;
+        seagrass_required_true(seahorse_concurrent_tree_map_s_p_get(
+                &object, &reader, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_concurrent_tree_map_s_p_set(
+                &object, &keys[positions[i]], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "set", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_concurrent_tree_map_s_p_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_concurrent_tree_map_s_p_unregister(
+            &object, &reader));
+    seagrass_required_true(seahorse_concurrent_tree_map_s_p_invalidate(
+            &object, NULL));
+    free(positions);
+    strings_destroy(keys, count);
+}
+
+static void bench_flat_map_i_i(const struct workload *const workload,
+                               struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_integer *const keys = integers_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_red_black_tree_map_i_i tree;
+    seagrass_required_true(seahorse_red_black_tree_map_i_i_init(&tree));
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_add(
+                &tree, &keys[i], &keys[i]));
+    }
+    struct seahorse_flat_map_i_i object;
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_flat_map_i_i_init_red_black_tree_map_i_i(
+            &object, &tree));
+    stopwatch_stop(&stopwatch, report, "init", count);
+    seagrass_required_true(seahorse_red_black_tree_map_i_i_invalidate(&tree));
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct sea_turtle_integer *out;
+        seagrass_required_true(seahorse_flat_map_i_i_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    seagrass_required_true(seahorse_flat_map_i_i_invalidate(&object));
+    free(positions);
+    integers_destroy(keys, count);
+}
+
+static void bench_flat_map_ni_p(const struct workload *const workload,
+                                struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_red_black_tree_map_ni_p tree;
+    seagrass_required_true(seahorse_red_black_tree_map_ni_p_init(&tree));
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_p_add(
+                &tree, workload->keys[i], &workload->keys[i]));
+    }
+    struct seahorse_flat_map_ni_p object;
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_flat_map_ni_p_init_red_black_tree_map_ni_p(
+            &object, &tree));
+    stopwatch_stop(&stopwatch, report, "init", count);
+    seagrass_required_true(seahorse_red_black_tree_map_ni_p_invalidate(
+            &tree, NULL));
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *out;
+        seagrass_required_true(seahorse_flat_map_ni_p_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    seagrass_required_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+}
+
+static void bench_hash_map_ni_ni(const struct workload *const workload,
+                                 struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_hash_map_ni_ni object;
+    seagrass_required_true(seahorse_hash_map_ni_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_hash_map_ni_ni_add(
+                &object, workload->keys[i], workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const uintmax_t *out;
+        seagrass_required_true(seahorse_hash_map_ni_ni_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_hash_map_ni_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_hash_map_ni_ni_invalidate(&object));
+}
+
+static void bench_hash_map_s_p(const struct workload *const workload,
+                               struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const keys = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_hash_map_s_p object;
+    seagrass_required_true(seahorse_hash_map_s_p_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_hash_map_s_p_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *out;
+        seagrass_required_true(seahorse_hash_map_s_p_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_hash_map_s_p_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    free(positions);
+    strings_destroy(keys, count);
+}
+
+static void bench_hash_map_s_s(const struct workload *const workload,
+                               struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const keys = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_hash_map_s_s object;
+    seagrass_required_true(seahorse_hash_map_s_s_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_hash_map_s_s_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const struct sea_turtle_string *out;
+        seagrass_required_true(seahorse_hash_map_s_s_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_hash_map_s_s_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_hash_map_s_s_invalidate(&object));
+    free(positions);
+    strings_destroy(keys, count);
+}
+
+static void bench_persistent_tree_map_s_s(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const keys = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_persistent_tree_map_s_s object;
+    seagrass_required_true(seahorse_persistent_tree_map_s_s_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const struct sea_turtle_string *out;
+        seagrass_required_true(seahorse_persistent_tree_map_s_s_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    struct seahorse_persistent_tree_map_s_s snapshot;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_persistent_tree_map_s_s_snapshot(
+                &object, &snapshot));
+        seagrass_required_true(seahorse_persistent_tree_map_s_s_invalidate(
+                &snapshot));
+    }
+    stopwatch_stop(&stopwatch, report, "snapshot", count);
+    /* every set copies its path while a snapshot shares the tree */
+    seagrass_required_true(seahorse_persistent_tree_map_s_s_snapshot(
+            &object, &snapshot));
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_persistent_tree_map_s_s_set(
+                &object, &keys[positions[i]], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "set", count);
+    seagrass_required_true(seahorse_persistent_tree_map_s_s_invalidate(
+            &snapshot));
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_persistent_tree_map_s_s_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_persistent_tree_map_s_s_invalidate(
+            &object));
+    free(positions);
+    strings_destroy(keys, count);
+}
+
+static void bench_radix_map_ni_ni(const struct workload *const workload,
+                                  struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_radix_map_ni_ni object;
+    seagrass_required_true(seahorse_radix_map_ni_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_radix_map_ni_ni_add(
+                &object, workload->keys[i], workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const uintmax_t *out;
+        seagrass_required_true(seahorse_radix_map_ni_ni_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_radix_map_ni_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_radix_map_ni_ni_invalidate(&object));
+}
+
+static void bench_red_black_tree_map_i_i(const struct workload *const workload,
+                                         struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_integer *const keys = integers_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_red_black_tree_map_i_i object;
+    seagrass_required_true(seahorse_red_black_tree_map_i_i_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct sea_turtle_integer *out;
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_rank_of(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "rank_of", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const struct seahorse_red_black_tree_map_i_i_entry *out;
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_at_rank(
+                &object, positions[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "at_rank", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_i_i_invalidate(
+            &object));
+    free(positions);
+    integers_destroy(keys, count);
+}
+
+static void bench_red_black_tree_map_ni_i(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_integer *const values = integers_of(workload->keys,
+                                                          count);
+    struct seahorse_red_black_tree_map_ni_i object;
+    seagrass_required_true(seahorse_red_black_tree_map_ni_i_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_i_add(
+                &object, workload->keys[i], &values[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct sea_turtle_integer *out;
+        seagrass_required_true(seahorse_red_black_tree_map_ni_i_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_i_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_ni_i_invalidate(
+            &object));
+    integers_destroy(values, count);
+}
+
+static void bench_red_black_tree_map_ni_ni(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_red_black_tree_map_ni_ni object;
+    seagrass_required_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, workload->keys[i], workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const uintmax_t *out;
+        seagrass_required_true(seahorse_red_black_tree_map_ni_ni_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_ni_ni_invalidate(
+            &object));
+}
+
+static void bench_red_black_tree_map_ni_ni_pool(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_red_black_tree_pool pool;
+    seagrass_required_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_ni_ni object;
+    seagrass_required_true(seahorse_red_black_tree_map_ni_ni_init_pool(
+            &object, &pool));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, workload->keys[i], workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const uintmax_t *out;
+        seagrass_required_true(seahorse_red_black_tree_map_ni_ni_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_ni_ni_invalidate(
+            &object));
+    seagrass_required_true(seahorse_red_black_tree_pool_invalidate(&pool));
+}
+
+static void bench_red_black_tree_map_ni_p(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_red_black_tree_map_ni_p object;
+    seagrass_required_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, workload->keys[i], &workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *out;
+        seagrass_required_true(seahorse_red_black_tree_map_ni_p_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_ni_p_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_ni_p_invalidate(
+            &object, NULL));
+}
+
+static void bench_red_black_tree_map_p_p(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_red_black_tree_map_p_p object;
+    seagrass_required_true(seahorse_red_black_tree_map_p_p_init(
+            &object, seagrass_void_ptr_compare));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *const key = (void *) (uintptr_t) (1 + workload->keys[i]);
+        seagrass_required_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key, key));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *const key = (void *) (uintptr_t) (1 + workload->probes[i]);
+        const void *out;
+        seagrass_required_true(seahorse_red_black_tree_map_p_p_get(
+                &object, key, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *const key = (void *) (uintptr_t) (1 + workload->keys[i]);
+        seagrass_required_true(seahorse_red_black_tree_map_p_p_remove(
+                &object, key));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_p_p_invalidate(
+            &object, NULL));
+}
+
+static void bench_red_black_tree_map_s_p(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const keys = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_red_black_tree_map_s_p object;
+    seagrass_required_true(seahorse_red_black_tree_map_s_p_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const void *out;
+        seagrass_required_true(seahorse_red_black_tree_map_s_p_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_s_p_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_s_p_invalidate(
+            &object, NULL));
+    free(positions);
+    strings_destroy(keys, count);
+}
+
+static void bench_red_black_tree_map_s_s(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const keys = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_red_black_tree_map_s_s object;
+    seagrass_required_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &keys[i], &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct sea_turtle_string *out;
+        seagrass_required_true(seahorse_red_black_tree_map_s_s_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_s_s_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_s_s_invalidate(
+            &object));
+    free(positions);
+    strings_destroy(keys, count);
+}
+
+static void bench_red_black_tree_map_s_wr(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const keys = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct triggerfish_strong *strong;
+    seagrass_required_true(triggerfish_strong_of(
+            (void *) 1, on_destroy_nothing, &strong));
+    struct triggerfish_weak *weak;
+    seagrass_required_true(triggerfish_weak_of(strong, &weak));
+    struct seahorse_red_black_tree_map_s_wr object;
+    seagrass_required_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &keys[i], weak));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const struct triggerfish_weak *out;
+        seagrass_required_true(seahorse_red_black_tree_map_s_wr_get(
+                &object, &keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_s_wr_remove(
+                &object, &keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_s_wr_invalidate(
+            &object));
+    seagrass_required_true(triggerfish_weak_destroy(weak));
+    seagrass_required_true(triggerfish_strong_release(strong));
+    free(positions);
+    strings_destroy(keys, count);
+}
+
+static void bench_red_black_tree_map_sr_sr(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct triggerfish_strong **const keys = strongs_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_red_black_tree_map_sr_sr object;
+    seagrass_required_true(seahorse_red_black_tree_map_sr_sr_init(
+            &object, strong_compare));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, keys[i], keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct triggerfish_strong *out;
+        seagrass_required_true(seahorse_red_black_tree_map_sr_sr_get(
+                &object, keys[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_map_sr_sr_remove(
+                &object, keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_map_sr_sr_invalidate(
+            &object));
+    free(positions);
+    strongs_destroy(keys, count);
+}
+
+#pragma mark sets
+
+static void bench_bitmap_set_ni(const struct workload *const workload,
+                                struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_bitmap_set_ni object;
+    seagrass_required_true(seahorse_bitmap_set_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_bitmap_set_ni_add(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        bool out;
+        seagrass_required_true(seahorse_bitmap_set_ni_contains(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "contains", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_bitmap_set_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_bitmap_set_ni_invalidate(&object));
+}
+
+static void bench_linked_red_black_tree_set_ni(
+        const struct workload *const workload,
+        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_linked_red_black_tree_set_ni object;
+    seagrass_required_true(seahorse_linked_red_black_tree_set_ni_init(
+            &object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_linked_red_black_tree_set_ni_add(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        bool out;
+        seagrass_required_true(seahorse_linked_red_black_tree_set_ni_contains(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "contains", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_linked_red_black_tree_set_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_linked_red_black_tree_set_ni_invalidate(
+            &object));
+}
+
+static void bench_radix_set_ni(const struct workload *const workload,
+                               struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_radix_set_ni object;
+    seagrass_required_true(seahorse_radix_set_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_radix_set_ni_add(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        bool out;
+        seagrass_required_true(seahorse_radix_set_ni_contains(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "contains", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_radix_set_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_radix_set_ni_invalidate(&object));
+}
+
+static void bench_red_black_tree_set_i(const struct workload *const workload,
+                                       struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_integer *const values = integers_of(workload->keys,
+                                                          count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_red_black_tree_set_i object;
+    seagrass_required_true(seahorse_red_black_tree_set_i_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_set_i_add(
+                &object, &values[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        bool out;
+        seagrass_required_true(seahorse_red_black_tree_set_i_contains(
+                &object, &values[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "contains", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_set_i_remove(
+                &object, &values[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    free(positions);
+    integers_destroy(values, count);
+}
+
+static void bench_red_black_tree_set_ni(const struct workload *const workload,
+                                        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_red_black_tree_set_ni object;
+    seagrass_required_true(seahorse_red_black_tree_set_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_set_ni_add(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        bool out;
+        seagrass_required_true(seahorse_red_black_tree_set_ni_contains(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "contains", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_red_black_tree_set_ni_rank_of(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "rank_of", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        const uintmax_t *out;
+        seagrass_required_true(seahorse_red_black_tree_set_ni_at_rank(
+                &object, i, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "at_rank", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_set_ni_remove(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+}
+
+static void bench_red_black_tree_set_s(const struct workload *const workload,
+                                       struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_string *const values = strings_of(workload->keys, count);
+    uintmax_t *const positions = positions_of(workload);
+    struct seahorse_red_black_tree_set_s object;
+    seagrass_required_true(seahorse_red_black_tree_set_s_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_set_s_add(
+                &object, &values[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        bool out;
+        seagrass_required_true(seahorse_red_black_tree_set_s_contains(
+                &object, &values[positions[i]], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "contains", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_red_black_tree_set_s_remove(
+                &object, &values[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    free(positions);
+    strings_destroy(values, count);
+}
+
+#pragma mark lists
+
+static void bench_array_list_i(const struct workload *const workload,
+                               struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct sea_turtle_integer *const values = integers_of(workload->keys,
+                                                          count);
+    struct seahorse_array_list_i object;
+    seagrass_required_true(seahorse_array_list_i_init(&object, 0));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_array_list_i_add(
+                &object, &values[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct sea_turtle_integer *out;
+        seagrass_required_true(seahorse_array_list_i_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_array_list_i_remove_last(&object));
+    }
+    stopwatch_stop(&stopwatch, report, "remove_last", count);
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_array_list_i_add_all(
+            &object, count, values));
+    stopwatch_stop(&stopwatch, report, "add_all", count);
+    seagrass_required_true(seahorse_array_list_i_invalidate(&object));
+    integers_destroy(values, count);
+}
+
+static void bench_array_list_ni(const struct workload *const workload,
+                                struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_array_list_ni object;
+    seagrass_required_true(seahorse_array_list_ni_init(&object, 0));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_array_list_ni_add(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_array_list_ni_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_array_list_ni_remove_last(&object));
+    }
+    stopwatch_stop(&stopwatch, report, "remove_last", count);
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_array_list_ni_add_all(
+            &object, count, workload->keys));
+    stopwatch_stop(&stopwatch, report, "add_all", count);
+    seagrass_required_true(seahorse_array_list_ni_invalidate(&object));
+}
+
+static void bench_array_list_p(const struct workload *const workload,
+                               struct report *const report) {
+    const uintmax_t count = workload->count;
+    const void **const values = malloc(count * sizeof(void *));
+    seagrass_required_true(values);
+    for (uintmax_t i = 0; i < count; i++) {
+        values[i] = &workload->keys[i];
+    }
+    struct seahorse_array_list_p object;
+    seagrass_required_true(seahorse_array_list_p_init(&object, 0));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_array_list_p_add(
+                &object, values[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        void *out;
+        seagrass_required_true(seahorse_array_list_p_get(
+                &object, workload->probes[i], &out));
+    }
+    stopwatch_stop(&stopwatch, report, "get", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_array_list_p_remove_last(&object));
+    }
+    stopwatch_stop(&stopwatch, report, "remove_last", count);
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_array_list_p_add_all(
+            &object, count, values));
+    stopwatch_stop(&stopwatch, report, "add_all", count);
+    seagrass_required_true(seahorse_array_list_p_invalidate(&object));
+    free(values);
+}
+
+#pragma mark queues
+
+static void bench_linked_queue_ni(const struct workload *const workload,
+                                  struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_linked_queue_ni object;
+    seagrass_required_true(seahorse_linked_queue_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_linked_queue_ni_add(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_linked_queue_ni_remove(
+                &object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_linked_queue_ni_invalidate(&object));
+}
+
+static void bench_linked_queue_sr(const struct workload *const workload,
+                                  struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct triggerfish_strong **const items = strongs_of(workload->keys,
+                                                         count);
+    struct seahorse_linked_queue_sr object;
+    seagrass_required_true(seahorse_linked_queue_sr_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_linked_queue_sr_add(
+                &object, items[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct triggerfish_strong *out;
+        seagrass_required_true(seahorse_linked_queue_sr_remove(
+                &object, &out));
+        seagrass_required_true(triggerfish_strong_release(out));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    seagrass_required_true(seahorse_linked_queue_sr_invalidate(&object));
+    strongs_destroy(items, count);
+}
+
+static void bench_mpmc_queue_sr(const struct workload *const workload,
+                                struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct triggerfish_strong **const items = strongs_of(workload->keys,
+                                                         count);
+    struct seahorse_mpmc_queue_sr object;
+    seagrass_required_true(seahorse_mpmc_queue_sr_init(&object, count));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_mpmc_queue_sr_try_add(
+                &object, items[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "try_add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        struct triggerfish_strong *out;
+        seagrass_required_true(seahorse_mpmc_queue_sr_try_remove(
+                &object, &out));
+        seagrass_required_true(triggerfish_strong_release(out));
+    }
+    stopwatch_stop(&stopwatch, report, "try_remove", count);
+    seagrass_required_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    strongs_destroy(items, count);
+}
+
+static void bench_ring_queue_ni(const struct workload *const workload,
+                                struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_ring_queue_ni object;
+    seagrass_required_true(seahorse_ring_queue_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_ring_queue_ni_add(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "add", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_ring_queue_ni_remove(&object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "remove", count);
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_ring_queue_ni_add_all(
+            &object, count, workload->keys));
+    stopwatch_stop(&stopwatch, report, "add_all", count);
+    uintmax_t *const items = malloc(count * sizeof(uintmax_t));
+    seagrass_required_true(items);
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_ring_queue_ni_remove_all(
+            &object, count, items));
+    stopwatch_stop(&stopwatch, report, "remove_all", count);
+    seagrass_required_true(seahorse_ring_queue_ni_invalidate(&object));
+    free(items);
+}
+
+#pragma mark stacks
+
+static void bench_concurrent_stack_ni(const struct workload *const workload,
+                                      struct report *const report) {
+    const uintmax_t count = workload->count;
+    uintmax_t *const items = malloc(count * sizeof(uintmax_t));
+    seagrass_required_true(items);
+    struct seahorse_concurrent_stack_ni object;
+    seagrass_required_true(seahorse_concurrent_stack_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_concurrent_stack_ni_push(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "push", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "pop", count);
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_concurrent_stack_ni_push_all(
+            &object, count, workload->keys));
+    stopwatch_stop(&stopwatch, report, "push_all", count);
+    stopwatch_start(&stopwatch);
+    uintmax_t out;
+    seagrass_required_true(seahorse_concurrent_stack_ni_pop_all(
+            &object, count, items, &out));
+    stopwatch_stop(&stopwatch, report, "pop_all", count);
+    seagrass_required_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    free(items);
+}
+
+static void bench_linked_stack_ni(const struct workload *const workload,
+                                  struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_linked_stack_ni object;
+    seagrass_required_true(seahorse_linked_stack_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_linked_stack_ni_push(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "push", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_linked_stack_ni_pop(&object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "pop", count);
+    seagrass_required_true(seahorse_linked_stack_ni_invalidate(&object));
+}
+
+#pragma mark deques
+
+static void bench_work_stealing_deque_p(const struct workload *const workload,
+                                        struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_work_stealing_deque_p object;
+    seagrass_required_true(seahorse_work_stealing_deque_p_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_work_stealing_deque_p_push(
+                &object, &workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "push", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count / 2; i++) {
+        void *out;
+        seagrass_required_true(seahorse_work_stealing_deque_p_steal(
+                &object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "steal", count / 2);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = count / 2; i < count; i++) {
+        void *out;
+        seagrass_required_true(seahorse_work_stealing_deque_p_pop(
+                &object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "pop", count - count / 2);
+    seagrass_required_true(seahorse_work_stealing_deque_p_invalidate(&object));
+}
+
+#pragma mark heaps
+
+static void bench_heap_ni(const struct workload *const workload,
+                          struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_heap_ni object;
+    seagrass_required_true(seahorse_heap_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_heap_ni_push(
+                &object, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "push", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_heap_ni_pop(&object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "pop", count);
+    stopwatch_start(&stopwatch);
+    seagrass_required_true(seahorse_heap_ni_push_all(
+            &object, count, workload->keys));
+    stopwatch_stop(&stopwatch, report, "push_all", count);
+    seagrass_required_true(seahorse_heap_ni_invalidate(&object));
+}
+
+static void bench_heap_p(const struct workload *const workload,
+                         struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_heap_p object;
+    seagrass_required_true(seahorse_heap_p_init(
+            &object, seagrass_void_ptr_compare));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        void *const item = (void *) (uintptr_t) (1 + workload->keys[i]);
+        seagrass_required_true(seahorse_heap_p_push(&object, item));
+    }
+    stopwatch_stop(&stopwatch, report, "push", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        void *out;
+        seagrass_required_true(seahorse_heap_p_pop(&object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "pop", count);
+    seagrass_required_true(seahorse_heap_p_invalidate(&object, NULL));
+}
+
+static void bench_indexed_heap_ni(const struct workload *const workload,
+                                  struct report *const report) {
+    const uintmax_t count = workload->count;
+    struct seahorse_indexed_heap_ni object;
+    seagrass_required_true(seahorse_indexed_heap_ni_init(&object));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_indexed_heap_ni_push(
+                &object, i, workload->keys[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "push", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t priority;
+        seagrass_required_true(seahorse_indexed_heap_ni_get(
+                &object, i, &priority));
+        seagrass_required_true(seahorse_indexed_heap_ni_decrease(
+                &object, i, priority / 2));
+    }
+    stopwatch_stop(&stopwatch, report, "decrease", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        seagrass_required_true(seahorse_indexed_heap_ni_pop(&object, &out));
+    }
+    stopwatch_stop(&stopwatch, report, "pop", count);
+    seagrass_required_true(seahorse_indexed_heap_ni_invalidate(&object));
+}
+
+#pragma mark timers
+
+static void bench_timer_wheel_p(const struct workload *const workload,
+                                struct report *const report) {
+    const uintmax_t count = workload->count;
+    const struct seahorse_timer_wheel_p_entry **const entries = malloc(
+            count * sizeof(*entries));
+    seagrass_required_true(entries);
+    void *items[64];
+    struct seahorse_timer_wheel_p object;
+    seagrass_required_true(seahorse_timer_wheel_p_init(&object, 0));
+    struct stopwatch stopwatch;
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_timer_wheel_p_schedule(
+                &object, 1 + workload->keys[i], &workload->keys[i],
+                &entries[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "schedule", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(seahorse_timer_wheel_p_reschedule(
+                &object, entries[i], 1 + workload->probes[i]));
+    }
+    stopwatch_stop(&stopwatch, report, "reschedule", count);
+    stopwatch_start(&stopwatch);
+    for (uintmax_t i = 0; i < count; i++) {
+        uintmax_t out;
+        do {
+            seagrass_required_true(seahorse_timer_wheel_p_advance(
+                    &object, 1 + i, sizeof(items) / sizeof(items[0]), items,
+                    &out));
+        } while (out);
+    }
+    stopwatch_stop(&stopwatch, report, "advance", count);
+    seagrass_required_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    free(entries);
+}
+
+#pragma mark driver
+
+struct bench {
+    const char *name;
+    void (*run)(const struct workload *, struct report *);
+};
+
+static const struct bench benches[] = {
+        {"array_list_i",                  bench_array_list_i},
+        {"array_list_ni",                 bench_array_list_ni},
+        {"array_list_p",                  bench_array_list_p},
+        {"bitmap_set_ni",                 bench_bitmap_set_ni},
+        {"btree_map_i_i",                 bench_btree_map_i_i},
+        {"btree_map_ni_ni",               bench_btree_map_ni_ni},
+        {"concurrent_hash_map_ni_ni",     bench_concurrent_hash_map_ni_ni},
+        {"concurrent_stack_ni",           bench_concurrent_stack_ni},
+        {"concurrent_tree_map_s_p",       bench_concurrent_tree_map_s_p},
+        {"flat_map_i_i",                  bench_flat_map_i_i},
+        {"flat_map_ni_p",                 bench_flat_map_ni_p},
+        {"hash_map_ni_ni",                bench_hash_map_ni_ni},
+        {"hash_map_s_p",                  bench_hash_map_s_p},
+        {"hash_map_s_s",                  bench_hash_map_s_s},
+        {"heap_ni",                       bench_heap_ni},
+        {"heap_p",                        bench_heap_p},
+        {"indexed_heap_ni",               bench_indexed_heap_ni},
+        {"linked_queue_ni",               bench_linked_queue_ni},
+        {"linked_queue_sr",               bench_linked_queue_sr},
+        {"linked_red_black_tree_set_ni",  bench_linked_red_black_tree_set_ni},
+        {"linked_stack_ni",               bench_linked_stack_ni},
+        {"mpmc_queue_sr",                 bench_mpmc_queue_sr},
+        {"persistent_tree_map_s_s",       bench_persistent_tree_map_s_s},
+        {"radix_map_ni_ni",               bench_radix_map_ni_ni},
+        {"radix_set_ni",                  bench_radix_set_ni},
+        {"red_black_tree_map_i_i",        bench_red_black_tree_map_i_i},
+        {"red_black_tree_map_ni_i",       bench_red_black_tree_map_ni_i},
+        {"red_black_tree_map_ni_ni",      bench_red_black_tree_map_ni_ni},
+        {"red_black_tree_map_ni_ni_pool", bench_red_black_tree_map_ni_ni_pool},
+        {"red_black_tree_map_ni_p",       bench_red_black_tree_map_ni_p},
+        {"red_black_tree_map_p_p",        bench_red_black_tree_map_p_p},
+        {"red_black_tree_map_s_p",        bench_red_black_tree_map_s_p},
+        {"red_black_tree_map_s_s",        bench_red_black_tree_map_s_s},
+        {"red_black_tree_map_s_wr",       bench_red_black_tree_map_s_wr},
+        {"red_black_tree_map_sr_sr",      bench_red_black_tree_map_sr_sr},
+        {"red_black_tree_set_i",          bench_red_black_tree_set_i},
+        {"red_black_tree_set_ni",         bench_red_black_tree_set_ni},
+        {"red_black_tree_set_s",          bench_red_black_tree_set_s},
+        {"ring_queue_ni",                 bench_ring_queue_ni},
+        {"timer_wheel_p",                 bench_timer_wheel_p},
+        {"work_stealing_deque_p",         bench_work_stealing_deque_p},
+};
+
+enum format {
+    FORMAT_CSV,
+    FORMAT_JSON
+};
+
+static bool is_listed(const char *const list, const char *const name) {
+    if (!list) {
+        return true;
+    }
+    const size_t length = strlen(name);
+    for (const char *at = list; at; at = strchr(at, ',')) {
+        if (',' == *at) {
+            at++;
+        }
+        if (!strncmp(at, name, length)
+            && (',' == at[length] || !at[length])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool run(const struct bench *const bench,
+                const struct workload *const workload,
+                struct report *const out) {
+    int fd[2];
+    seagrass_required_true(!pipe(fd));
+    fflush(stdout);
+    const pid_t pid = fork();
+    seagrass_required_true(-1 != pid);
+    if (!pid) {
+        close(fd[0]);
+        struct rusage usage;
+        seagrass_required_true(!getrusage(RUSAGE_SELF, &usage));
+        const long baseline = usage.ru_maxrss;
+        struct report report = {0};
+        bench->run(workload, &report);
+        seagrass_required_true(!getrusage(RUSAGE_SELF, &usage));
+        report.peak_rss_delta = usage.ru_maxrss - baseline;
+#if defined(__APPLE__)
+        report.peak_rss_delta /= 1024;
+#endif
+        const bool result = sizeof(report)
+                            == write(fd[1], &report, sizeof(report));
+        close(fd[1]);
+        _exit(result ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    close(fd[1]);
+    const bool result = sizeof(*out) == read(fd[0], out, sizeof(*out));
+    close(fd[0]);
+    int status;
+    seagrass_required_true(pid == waitpid(pid, &status, 0));
+    return result && WIFEXITED(status) && !WEXITSTATUS(status);
+}
+
+static void print(const enum format format,
+                  const struct bench *const bench,
+                  const struct workload *const workload,
+                  const struct report *const report,
+                  bool *const first) {
+    for (uintmax_t i = 0; i < report->count; i++) {
+        const struct phase *const phase = &report->phases[i];
+        if (FORMAT_CSV == format) {
+            printf("%s,%s,%ju,%s,%.3f,", bench->name, workload->name,
+                   workload->count, phase->operation, phase->nanoseconds);
+            if (ALLOCATIONS_ARE_COUNTED) {
+                printf("%.3f", phase->allocations);
+            }
+            printf(",%ld\n", report->peak_rss_delta);
+        } else {
+            printf("%s\n  {\"container\": \"%s\", \"workload\": \"%s\", "
+                   "\"count\": %ju, \"operation\": \"%s\", "
+                   "\"ns_per_op\": %.3f, ",
+                   *first ? "" : ",", bench->name, workload->name,
+                   workload->count, phase->operation, phase->nanoseconds);
+            if (ALLOCATIONS_ARE_COUNTED) {
+                printf("\"allocations_per_op\": %.3f, ", phase->allocations);
+            } else {
+                printf("\"allocations_per_op\": null, ");
+            }
+            printf("\"peak_rss_delta_kb\": %ld}",
+                   report->peak_rss_delta);
+            *first = false;
+        }
+    }
+    fflush(stdout);
+}
+
+static void usage(const char *const program) {
+    fprintf(stderr,
+            "usage: %s [--format csv|json] [--count N[,N...]]\n"
+            "       [--workload sequential|random|zipfian[,...]]\n"
+            "       [--container NAME[,NAME...]] [--seed N] [--list]\n",
+            program);
+}
+
+int main(int argc, char *argv[]) {
+    enum format format = FORMAT_CSV;
+    const char *counts = DEFAULT_COUNTS;
+    const char *workloads = DEFAULT_WORKLOADS;
+    const char *containers = NULL;
+    uintmax_t seed = 0x5EA4025E;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp("--list", argv[i])) {
+            for (size_t j = 0; j < sizeof(benches) / sizeof(benches[0]); j++) {
+                printf("%s\n", benches[j].name);
+            }
+            return EXIT_SUCCESS;
+        }
+        if (i + 1 == argc) {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        const char *const value = argv[++i];
+        if (!strcmp("--format", argv[i - 1])) {
+            if (!strcmp("csv", value)) {
+                format = FORMAT_CSV;
+            } else if (!strcmp("json", value)) {
+                format = FORMAT_JSON;
+            } else {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        } else if (!strcmp("--count", argv[i - 1])) {
+            counts = value;
+        } else if (!strcmp("--workload", argv[i - 1])) {
+            workloads = value;
+        } else if (!strcmp("--container", argv[i - 1])) {
+            containers = value;
+        } else if (!strcmp("--seed", argv[i - 1])) {
+            seed = strtoumax(value, NULL, 0);
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (FORMAT_CSV == format) {
+        printf("container,workload,count,operation,ns_per_op,"
+               "allocations_per_op,peak_rss_delta_kb\n");
+    } else {
+        printf("[");
+    }
+    static const char *names[] = {"sequential", "random", "zipfian"};
+    bool first = true;
+    int result = EXIT_SUCCESS;
+    for (const char *at = counts; at && *at; at = strchr(at, ',')) {
+        if (',' == *at) {
+            at++;
+        }
+        const uintmax_t count = strtoumax(at, NULL, 10);
+        if (!count) {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        for (size_t w = 0; w < sizeof(names) / sizeof(names[0]); w++) {
+            if (!is_listed(workloads, names[w])) {
+                continue;
+            }
+            random_state = seed;
+            struct workload workload;
+            workload_init(&workload, names[w], count);
+            for (size_t b = 0; b < sizeof(benches) / sizeof(benches[0]);
+                 b++) {
+                if (!is_listed(containers, benches[b].name)) {
+                    continue;
+                }
+                struct report report;
+                if (!run(&benches[b], &workload, &report)) {
+                    fprintf(stderr, "%s/%s/%ju: failed\n",
+                            benches[b].name, workload.name, count);
+                    result = EXIT_FAILURE;
+                    continue;
+                }
+                print(format, &benches[b], &workload, &report, &first);
+            }
+            workload_invalidate(&workload);
+        }
+    }
+    if (FORMAT_JSON == format) {
+        printf("\n]\n");
+    }
+    return result;
+}
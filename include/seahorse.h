@@ -8,13 +8,33 @@
 #include <seahorse/array_list_i.h>
 #include <seahorse/array_list_ni.h>
 #include <seahorse/array_list_p.h>
+#include <seahorse/bitmap_set_ni.h>
+#include <seahorse/btree_map_i_i.h>
+#include <seahorse/btree_map_ni_ni.h>
 #include <seahorse/collection_i.h>
+#include <seahorse/concurrent_hash_map_ni_ni.h>
+#include <seahorse/concurrent_stack_ni.h>
+#include <seahorse/concurrent_tree_map_s_p.h>
 #include <seahorse/error.h>
+#include <seahorse/flat_map_i_i.h>
+#include <seahorse/flat_map_ni_p.h>
+#include <seahorse/hash_map_ni_ni.h>
+#include <seahorse/hash_map_s_p.h>
+#include <seahorse/hash_map_s_s.h>
+#include <seahorse/hash_table.h>
+#include <seahorse/heap_ni.h>
+#include <seahorse/heap_p.h>
+#include <seahorse/indexed_heap_ni.h>
 #include <seahorse/linked_queue_ni.h>
 #include <seahorse/linked_queue_sr.h>
 #include <seahorse/linked_red_black_tree_set_ni.h>
 #include <seahorse/linked_stack_ni.h>
+#include <seahorse/mpmc_queue_sr.h>
 #include <seahorse/ordered_set_i.h>
+#include <seahorse/persistent_tree_map_s_s.h>
+#include <seahorse/radix_map_ni_ni.h>
+#include <seahorse/radix_set_ni.h>
+#include <seahorse/red_black_tree.h>
 #include <seahorse/red_black_tree_map_i_i.h>
 #include <seahorse/red_black_tree_map_ni_i.h>
 #include <seahorse/red_black_tree_map_ni_ni.h>
@@ -27,8 +47,11 @@
 #include <seahorse/red_black_tree_set_i.h>
 #include <seahorse/red_black_tree_set_ni.h>
 #include <seahorse/red_black_tree_set_s.h>
+#include <seahorse/ring_queue_ni.h>
 #include <seahorse/set_i.h>
 #include <seahorse/sorted_set_i.h>
 #include <seahorse/stream_i.h>
+#include <seahorse/timer_wheel_p.h>
+#include <seahorse/work_stealing_deque_p.h>
 
 #endif /* _SEAHORSE_SEAHORSE_H_ */
@@ -117,6 +117,22 @@ bool seahorse_array_list_i_shrink(struct seahorse_array_list_i *object);
 bool seahorse_array_list_i_add(struct seahorse_array_list_i *object,
                                const struct sea_turtle_integer *value);
 
+/**
+ * @brief Add an item at the end taking ownership of it.
+ * @param [in] object array list instance.
+ * @param [in] value to add at the end of the array list.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_ARRAY_LIST_I_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_ARRAY_LIST_I_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_ARRAY_LIST_I_ERROR_MEMORY_ALLOCATION_FAILED if there is not
+ * enough memory to add another value.
+ * @note On success the contents of <b>value</b> are moved into the array
+ * list without being copied and it is reset, otherwise it remains owned by
+ * the caller.
+ */
+bool seahorse_array_list_i_add_take(struct seahorse_array_list_i *object,
+                                    struct sea_turtle_integer *value);
+
 /**
  * @brief Add all the items at the end.
  * @param [in] object array list instance.
@@ -160,6 +176,26 @@ bool seahorse_array_list_i_insert(struct seahorse_array_list_i *object,
                                   uintmax_t at,
                                   const struct sea_turtle_integer *value);
 
+/**
+ * @brief Insert an item at index taking ownership of it.
+ * @param [in] object array list instance.
+ * @param [in] at index where item is to be inserted.
+ * @param [in] value to be inserted.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_ARRAY_LIST_I_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_ARRAY_LIST_I_ERROR_VALUE_IS_NULL is value is <i>NULL</i>.
+ * @throws SEAHORSE_ARRAY_LIST_I_ERROR_INDEX_IS_OUT_OF_BOUNDS if at does not
+ * refer to an item contained within the array list.
+ * @throws SEAHORSE_ARRAY_LIST_I_ERROR_MEMORY_ALLOCATION_FAILED if there is not
+ * enough memory to add another item.
+ * @note On success the contents of <b>value</b> are moved into the array
+ * list without being copied and it is reset, otherwise it remains owned by
+ * the caller.
+ */
+bool seahorse_array_list_i_insert_take(struct seahorse_array_list_i *object,
+                                       uintmax_t at,
+                                       struct sea_turtle_integer *value);
+
 /**
  * @brief Insert all the values at index.
  * @param [in] object array list instance.
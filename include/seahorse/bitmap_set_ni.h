@@ -0,0 +1,266 @@
+#ifndef _SEAHORSE_BITMAP_SET_NI_H_
+#define _SEAHORSE_BITMAP_SET_NI_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL             1
+#define SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL                2
+#define SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED   3
+#define SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_ALREADY_EXISTS       4
+#define SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND            5
+#define SEAHORSE_BITMAP_SET_NI_ERROR_SET_IS_EMPTY               6
+#define SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE            7
+#define SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL              8
+
+struct seahorse_bitmap_set_ni {
+    uintmax_t count;
+    uintmax_t length;
+    uintmax_t capacity;
+    void *data;
+};
+
+/**
+ * @brief Initialize bitmap set.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note Values are grouped into chunks of 65536 consecutive values, each
+ * chunk being held as a sorted array while it is sparse and as a bitmap once
+ * it is dense, so that dense ranges of values cost a single bit each.
+ */
+bool seahorse_bitmap_set_ni_init(struct seahorse_bitmap_set_ni *object);
+
+/**
+ * @brief Copy initialize bitmap set.
+ * @param [in] object instance to be initialized.
+ * @param [in] other bitmap set to be copied.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to create a copy.
+ */
+bool seahorse_bitmap_set_ni_init_bitmap_set_ni(
+        struct seahorse_bitmap_set_ni *object,
+        const struct seahorse_bitmap_set_ni *other);
+
+/**
+ * @brief Invalidate bitmap set.
+ * <p>The actual <u>bitmap set instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_bitmap_set_ni_invalidate(struct seahorse_bitmap_set_ni *object);
+
+/**
+ * @brief Retrieve the count of values.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_bitmap_set_ni_count(const struct seahorse_bitmap_set_ni *object,
+                                  uintmax_t *out);
+
+/**
+ * @brief Add value to the bitmap set.
+ * @param [in] object bitmap set instance.
+ * @param [in] value to be added.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_ALREADY_EXISTS if value is
+ * already present in the bitmap set.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add value to the bitmap set.
+ */
+bool seahorse_bitmap_set_ni_add(struct seahorse_bitmap_set_ni *object,
+                                uintmax_t value);
+
+/**
+ * @brief Remove value from the bitmap set.
+ * @param [in] object bitmap set instance.
+ * @param [in] value to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND if value is not
+ * in the bitmap set instance.
+ */
+bool seahorse_bitmap_set_ni_remove(struct seahorse_bitmap_set_ni *object,
+                                   uintmax_t value);
+
+/**
+ * @brief Check if bitmap set contains the given value.
+ * @param [in] object bitmap set instance.
+ * @param [in] value to check if value is present.
+ * @param [out] out receive true if value is present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_bitmap_set_ni_contains(
+        const struct seahorse_bitmap_set_ni *object,
+        uintmax_t value,
+        bool *out);
+
+/**
+ * @brief Retrieve value or the next higher value.
+ * @param [in] object bitmap set instance.
+ * @param [in] value to find or its next higher.
+ * @param [out] out receive the value that was found.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND if neither value
+ * nor a higher value is present.
+ */
+bool seahorse_bitmap_set_ni_ceiling(
+        const struct seahorse_bitmap_set_ni *object,
+        uintmax_t value,
+        uintmax_t *out);
+
+/**
+ * @brief Retrieve value or the next lower value.
+ * @param [in] object bitmap set instance.
+ * @param [in] value to find or its next lower.
+ * @param [out] out receive the value that was found.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND if neither value
+ * nor a lower value is present.
+ */
+bool seahorse_bitmap_set_ni_floor(
+        const struct seahorse_bitmap_set_ni *object,
+        uintmax_t value,
+        uintmax_t *out);
+
+/**
+ * @brief First value of the bitmap set.
+ * @param [in] object bitmap set instance.
+ * @param [out] out receive the smallest value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_SET_IS_EMPTY if bitmap set is
+ * empty.
+ */
+bool seahorse_bitmap_set_ni_first(const struct seahorse_bitmap_set_ni *object,
+                                  uintmax_t *out);
+
+/**
+ * @brief Last value of the bitmap set.
+ * @param [in] object bitmap set instance.
+ * @param [out] out receive the largest value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_SET_IS_EMPTY if bitmap set is
+ * empty.
+ */
+bool seahorse_bitmap_set_ni_last(const struct seahorse_bitmap_set_ni *object,
+                                 uintmax_t *out);
+
+/**
+ * @brief Retrieve the next value.
+ * @param [in] object bitmap set instance.
+ * @param [in] value whose next higher value we are trying to find.
+ * @param [out] out receive the next value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE if there is no
+ * higher value.
+ * @note Value does not have to be present in the bitmap set.
+ */
+bool seahorse_bitmap_set_ni_next(const struct seahorse_bitmap_set_ni *object,
+                                 uintmax_t value,
+                                 uintmax_t *out);
+
+/**
+ * @brief Retrieve the previous value.
+ * @param [in] object bitmap set instance.
+ * @param [in] value whose next lower value we are trying to find.
+ * @param [out] out receive the previous value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE if there is no
+ * lower value.
+ * @note Value does not have to be present in the bitmap set.
+ */
+bool seahorse_bitmap_set_ni_prev(const struct seahorse_bitmap_set_ni *object,
+                                 uintmax_t value,
+                                 uintmax_t *out);
+
+/**
+ * @brief Add all values of other to the bitmap set.
+ * @param [in] object bitmap set instance.
+ * @param [in] other bitmap set whose values are to be added.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add the values, in which case the bitmap
+ * set is left unchanged.
+ */
+bool seahorse_bitmap_set_ni_union(struct seahorse_bitmap_set_ni *object,
+                                  const struct seahorse_bitmap_set_ni *other);
+
+/**
+ * @brief Retain only the values that are also present in other.
+ * @param [in] object bitmap set instance.
+ * @param [in] other bitmap set whose values are to be retained.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ */
+bool seahorse_bitmap_set_ni_intersection(
+        struct seahorse_bitmap_set_ni *object,
+        const struct seahorse_bitmap_set_ni *other);
+
+/**
+ * @brief Remove all values that are present in other.
+ * @param [in] object bitmap set instance.
+ * @param [in] other bitmap set whose values are to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ */
+bool seahorse_bitmap_set_ni_difference(
+        struct seahorse_bitmap_set_ni *object,
+        const struct seahorse_bitmap_set_ni *other);
+
+#endif /* _SEAHORSE_BITMAP_SET_NI_H_ */
@@ -0,0 +1,459 @@
+#ifndef _SEAHORSE_BTREE_MAP_I_I_H_
+#define _SEAHORSE_BTREE_MAP_I_I_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct sea_turtle_integer;
+
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL               1
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL                  2
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL                  3
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_VALUE_IS_NULL                4
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS           5
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED     6
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND                7
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY                 8
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL                9
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_END_OF_SEQUENCE              10
+#define SEAHORSE_BTREE_MAP_I_I_ERROR_OTHER_IS_NULL                11
+
+struct seahorse_btree_map_i_i_entry;
+
+/*
+ * Key-value associations are kept in the leaves, which are linked in key
+ * order, while the branches above them only hold separator keys. The root is
+ * a leaf while height is zero and a branch otherwise.
+ */
+struct seahorse_btree_map_i_i {
+    uintmax_t count;
+    uintmax_t height;
+    void *root;
+    void *first;
+    void *last;
+};
+
+/**
+ * @brief Initialize B-tree map.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No memory is allocated until the first key-value association is
+ * added.
+ */
+bool seahorse_btree_map_i_i_init(
+        struct seahorse_btree_map_i_i *object);
+
+/**
+ * @brief Copy initialize B-tree map.
+ * @param [in] object instance to be initialized.
+ * @param [in] other B-tree map to be copied.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to create a copy.
+ */
+bool seahorse_btree_map_i_i_init_btree_map_i_i(
+        struct seahorse_btree_map_i_i *object,
+        const struct seahorse_btree_map_i_i *other);
+
+/**
+ * @brief Invalidate B-tree map.
+ * <p>The actual <u>B-tree map instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_btree_map_i_i_invalidate(
+        struct seahorse_btree_map_i_i *object);
+
+/**
+ * @brief Retrieve the count of entries.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the entry count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_btree_map_i_i_count(
+        const struct seahorse_btree_map_i_i *object,
+        uintmax_t *out);
+
+/**
+ * @brief Add a key-value association.
+ * @param [in] object B-tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the B-tree map.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the B-tree map.
+ * @note Adding or removing a key-value association may move entries between
+ * nodes and invalidates all previously retrieved values and entries.
+ */
+bool seahorse_btree_map_i_i_add(
+        struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        const struct sea_turtle_integer *value);
+
+/**
+ * @brief Remove key-value association.
+ * @param [in] object B-tree map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @note Adding or removing a key-value association may move entries between
+ * nodes and invalidates all previously retrieved values and entries.
+ */
+bool seahorse_btree_map_i_i_remove(
+        struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key);
+
+/**
+ * @brief Check if B-tree map contains the given key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key to check if it is present.
+ * @param [out] out true if key is present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_btree_map_i_i_contains(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        bool *out);
+
+/**
+ * @brief Retrieve the value for the given key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key used to get the associated value.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_btree_map_i_i_get(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve the value for the given key or the next higher key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key to find or the next higher key.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a higher key
+ * is in the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_ceiling(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve the value for the given key or the next lower key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key to find or the next lower key.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a lower key
+ * is in the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_floor(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve the value for the next higher key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key whose next higher key we are trying to find.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no higher key is in
+ * the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_higher(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve the value for the next lower key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key whose next lower key we are trying to find.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no lower key is in
+ * the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_lower(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve value of first entry.
+ * @param [in] object B-tree map instance.
+ * @param [out] out receive the <u>address of</u> the first entry's value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY if tree map is empty.
+ */
+bool seahorse_btree_map_i_i_first(
+        const struct seahorse_btree_map_i_i *object,
+        struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve value of last entry.
+ * @param [in] object B-tree map instance.
+ * @param [out] out receive the <u>address of</u> the last entry's value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY if tree map is empty.
+ */
+bool seahorse_btree_map_i_i_last(
+        const struct seahorse_btree_map_i_i *object,
+        struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve entry for the given key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key of the entry we are looking for.
+ * @param [out] out receive the <u>address of</u> entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_btree_map_i_i_get_entry(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve entry for the given key or the next higher key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key to find or the next higher key.
+ * @param [out] out receive the <u>address of</u> entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a higher key
+ * is in the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_ceiling_entry(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve entry for the given key or the next lower key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key to find or the next lower key.
+ * @param [out] out receive the <u>address of</u> entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a lower key
+ * is in the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_floor_entry(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve entry for the next higher key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key whose next higher key we are trying to find.
+ * @param [out] out receive the <u>address of</u> entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no higher key is in
+ * the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_higher_entry(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve entry for the next lower key.
+ * @param [in] object B-tree map instance.
+ * @param [in] key whose next lower key we are trying to find.
+ * @param [out] out receive the <u>address of</u> entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no lower key is in
+ * the B-tree map instance.
+ */
+bool seahorse_btree_map_i_i_lower_entry(
+        const struct seahorse_btree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve the first entry.
+ * @param [in] object B-tree map instance.
+ * @param [out] out receive the <u>address of</u> the first entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY if tree map is empty.
+ */
+bool seahorse_btree_map_i_i_first_entry(
+        const struct seahorse_btree_map_i_i *object,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve the last entry.
+ * @param [in] object B-tree map instance.
+ * @param [out] out receive the <u>address of</u> the last entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY if tree map is empty.
+ */
+bool seahorse_btree_map_i_i_last_entry(
+        const struct seahorse_btree_map_i_i *object,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Remove entry.
+ * @param [in] object B-tree map instance.
+ * @param [in] entry <u>address of</u> entry to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @note Adding or removing a key-value association may move entries between
+ * nodes and invalidates all previously retrieved values and entries.
+ */
+bool seahorse_btree_map_i_i_remove_entry(
+        struct seahorse_btree_map_i_i *object,
+        const struct seahorse_btree_map_i_i_entry *entry);
+
+/**
+ * @brief Retrieve the next entry.
+ * @param [in] entry <u>address of</u> current entry.
+ * @param [out] out receive the <u>address of</u> the next entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_END_OF_SEQUENCE if there is no next
+ * entry.
+ * @note Leaves are linked in key order, so walking the entries only reads the
+ * leaves themselves.
+ */
+bool seahorse_btree_map_i_i_next_entry(
+        const struct seahorse_btree_map_i_i_entry *entry,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve the previous entry.
+ * @param [in] entry <u>address of</u> current entry.
+ * @param [out] out receive the <u>address of</u> the previous entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_END_OF_SEQUENCE if there is no
+ * previous entry.
+ */
+bool seahorse_btree_map_i_i_prev_entry(
+        const struct seahorse_btree_map_i_i_entry *entry,
+        const struct seahorse_btree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve the entry's key.
+ * @param [in] object B-tree map instance.
+ * @param [in] entry <u>address of</u> entry contained within the B-tree map
+ * instance.
+ * @param [out] out receive the <u>address of</u> the entry's key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_btree_map_i_i_entry_key(
+        const struct seahorse_btree_map_i_i *object,
+        const struct seahorse_btree_map_i_i_entry *entry,
+        const struct sea_turtle_integer **out);
+
+/**
+ * @brief Retrieve the entry's value.
+ * @param [in] object B-tree map instance.
+ * @param [in] entry <u>address of</u> entry contained within the B-tree map
+ * instance.
+ * @param [out] out receive the <u>address of</u> the entry's value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_btree_map_i_i_entry_value(
+        const struct seahorse_btree_map_i_i *object,
+        const struct seahorse_btree_map_i_i_entry *entry,
+        struct sea_turtle_integer **out);
+
+#endif /* _SEAHORSE_BTREE_MAP_I_I_H_ */
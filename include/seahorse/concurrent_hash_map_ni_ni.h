@@ -0,0 +1,189 @@
+#ifndef _SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_H_
+#define _SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL             1
+#define SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL                2
+#define SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS         3
+#define SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED   4
+#define SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND              5
+#define SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_RESULT_IS_INCONSISTENT     6
+
+/*
+ * A hash map which may be updated by many threads at once. Keys are spread
+ * over a fixed number of shards, each being a hash map guarded by its own
+ * lock and placed on its own cache lines, so that threads only contend when
+ * they touch keys which land in the same shard.
+ */
+struct seahorse_concurrent_hash_map_ni_ni {
+    void *data;
+};
+
+/**
+ * @brief Initialize concurrent hash map.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to initialize the hash map.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_init(
+        struct seahorse_concurrent_hash_map_ni_ni *object);
+
+/**
+ * @brief Invalidate concurrent hash map.
+ * <p>The actual <u>hash map instance is not deallocated</u> since it may have
+ * been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No other thread may be using the hash map.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_invalidate(
+        struct seahorse_concurrent_hash_map_ni_ni *object);
+
+/**
+ * @brief Retrieve the count of entries.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the entry count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Shards are counted one after the other, hence while other threads
+ * are adding or removing entries the count is only an estimate.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_count(
+        const struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t *out);
+
+/**
+ * @brief Add a key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the hash map.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the hash map.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_add(
+        struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t key,
+        uintmax_t value);
+
+/**
+ * @brief Atomically add delta to the value associated with key.
+ * @param [in] object hash map instance.
+ * @param [in] key whose value is to be incremented.
+ * @param [in] delta to be added to the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_RESULT_IS_INCONSISTENT if
+ * adding delta would overflow the value.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the hash map.
+ * @note If key is not present it is added with delta as its value.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_add_to(
+        struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t key,
+        uintmax_t delta);
+
+/**
+ * @brief Retrieve the value for key or add it if it is not present.
+ * @param [in] object hash map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value to be associated with key if it is not present.
+ * @param [out] out receive the value associated with key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the hash map.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_get_or_add(
+        struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t key,
+        uintmax_t value,
+        uintmax_t *out);
+
+/**
+ * @brief Set value for the key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key used for which value is to be changed.
+ * @param [in] value of new association with given key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_set(
+        struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t key,
+        uintmax_t value);
+
+/**
+ * @brief Remove key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_remove(
+        struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t key);
+
+/**
+ * @brief Check if hash map contains the given key.
+ * @param [in] object hash map instance.
+ * @param [in] key to check for.
+ * @param [out] out receive true if key present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_contains(
+        const struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t key,
+        bool *out);
+
+/**
+ * @brief Retrieve value for the key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key used to retrieve the value.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @note Unlike the other maps the value is copied into out since its address
+ * would not remain valid once the shard is unlocked.
+ */
+bool seahorse_concurrent_hash_map_ni_ni_get(
+        const struct seahorse_concurrent_hash_map_ni_ni *object,
+        uintmax_t key,
+        uintmax_t *out);
+
+#endif /* _SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_H_ */
@@ -0,0 +1,147 @@
+#ifndef _SEAHORSE_CONCURRENT_STACK_NI_H_
+#define _SEAHORSE_CONCURRENT_STACK_NI_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL               1
+#define SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL                  2
+#define SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED     3
+#define SEAHORSE_CONCURRENT_STACK_NI_ERROR_STACK_IS_EMPTY               4
+#define SEAHORSE_CONCURRENT_STACK_NI_ERROR_COUNT_IS_ZERO                5
+#define SEAHORSE_CONCURRENT_STACK_NI_ERROR_VALUES_IS_NULL               6
+#define SEAHORSE_CONCURRENT_STACK_NI_ERROR_ITEMS_IS_NULL                7
+
+/*
+ * A Treiber stack which any number of threads may push onto and pop from
+ * without taking a lock. Nodes are referred to by index and every change to
+ * the top of the stack bumps a tag stored alongside the index, so a thread
+ * whose view of the top is stale always fails its compare-and-swap even if
+ * the same node has since made its way back to the top. Popped nodes are
+ * kept on a free list to be reused and are only deallocated when the stack
+ * is invalidated.
+ */
+struct seahorse_concurrent_stack_ni {
+    void *data;
+};
+
+/**
+ * @brief Initialize concurrent stack.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to initialize the stack.
+ */
+bool seahorse_concurrent_stack_ni_init(
+        struct seahorse_concurrent_stack_ni *object);
+
+/**
+ * @brief Invalidate concurrent stack.
+ * <p>The actual <u>stack instance is not deallocated</u> since it may have
+ * been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No other thread may be using the stack.
+ */
+bool seahorse_concurrent_stack_ni_invalidate(
+        struct seahorse_concurrent_stack_ni *object);
+
+/**
+ * @brief Retrieve the count of items.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note While other threads are pushing or popping items the count is only
+ * an estimate.
+ */
+bool seahorse_concurrent_stack_ni_count(
+        const struct seahorse_concurrent_stack_ni *object,
+        uintmax_t *out);
+
+/**
+ * @brief Push item onto the concurrent stack.
+ * @param [in] object concurrent stack instance.
+ * @param [in] item to be pushed onto the stack.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to push item onto the stack.
+ */
+bool seahorse_concurrent_stack_ni_push(
+        struct seahorse_concurrent_stack_ni *object,
+        uintmax_t item);
+
+/**
+ * @brief Push all the values onto the concurrent stack at once.
+ * @param [in] object concurrent stack instance.
+ * @param [in] count number of values.
+ * @param [in] values all of which we would like to push onto the stack, the
+ * last value ending up on top.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to push all the values onto the stack.
+ * @note The values are linked up privately and then published with a single
+ * compare-and-swap, so other threads see either all of them or none.
+ */
+bool seahorse_concurrent_stack_ni_push_all(
+        struct seahorse_concurrent_stack_ni *object,
+        uintmax_t count,
+        const uintmax_t *values);
+
+/**
+ * @brief Pop item from the concurrent stack.
+ * @param [in] object concurrent stack instance.
+ * @param [out] out receive the item on top of the stack.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_STACK_IS_EMPTY if the stack is
+ * empty.
+ */
+bool seahorse_concurrent_stack_ni_pop(
+        struct seahorse_concurrent_stack_ni *object,
+        uintmax_t *out);
+
+/**
+ * @brief Pop up to count items from the concurrent stack at once.
+ * @param [in] object concurrent stack instance.
+ * @param [in] count maximum number of items to pop.
+ * @param [out] items receive the popped items starting with the one that
+ * was on top, it must have room for at least count items.
+ * @param [out] out receive the number of items popped.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_ITEMS_IS_NULL if items is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_STACK_NI_ERROR_STACK_IS_EMPTY if the stack is
+ * empty.
+ * @note The popped items are detached with a single compare-and-swap.
+ */
+bool seahorse_concurrent_stack_ni_pop_all(
+        struct seahorse_concurrent_stack_ni *object,
+        uintmax_t count,
+        uintmax_t *items,
+        uintmax_t *out);
+
+#endif /* _SEAHORSE_CONCURRENT_STACK_NI_H_ */
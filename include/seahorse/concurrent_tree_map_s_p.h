@@ -0,0 +1,220 @@
+#ifndef _SEAHORSE_CONCURRENT_TREE_MAP_S_P_H_
+#define _SEAHORSE_CONCURRENT_TREE_MAP_S_P_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct sea_turtle_string;
+
+#define SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL               1
+#define SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL               2
+#define SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL                  3
+#define SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL                  4
+#define SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS           5
+#define SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED     6
+#define SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND                7
+
+/*
+ * A read-mostly ordered map where writers copy the path they modify and then
+ * publish the new root, while readers search whichever root they loaded
+ * without taking a lock or writing to any shared cache line. Nodes replaced
+ * by a writer are only deallocated once every reader that could still be
+ * looking at them has finished, which is tracked with per-reader epochs.
+ */
+struct seahorse_concurrent_tree_map_s_p {
+    void *data;
+};
+
+/*
+ * Registration of a thread which reads from the concurrent tree map.
+ */
+struct seahorse_concurrent_tree_map_s_p_reader {
+    void *data;
+};
+
+/**
+ * @brief Initialize concurrent tree map.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to initialize the tree map.
+ */
+bool seahorse_concurrent_tree_map_s_p_init(
+        struct seahorse_concurrent_tree_map_s_p *object);
+
+/**
+ * @brief Invalidate concurrent tree map.
+ * <p>All the entries contained within the tree map will have the given <i>on
+ * destroy</i> callback invoked upon itself. The actual <u>tree map instance
+ * is not deallocated</u> since it may have been embedded in a larger
+ * structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @param [in] on_destroy called just before the entry is to be destroyed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note Every reader must have been unregistered and no other thread may be
+ * using the tree map.
+ */
+bool seahorse_concurrent_tree_map_s_p_invalidate(
+        struct seahorse_concurrent_tree_map_s_p *object,
+        void (*on_destroy)(void *value));
+
+/**
+ * @brief Register a reader of the concurrent tree map.
+ * @param [in] object tree map instance.
+ * @param [out] out reader instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to register the reader.
+ * @note A reader must only be used by one thread at a time, the usual
+ * arrangement being one reader per reading thread.
+ */
+bool seahorse_concurrent_tree_map_s_p_register(
+        struct seahorse_concurrent_tree_map_s_p *object,
+        struct seahorse_concurrent_tree_map_s_p_reader *out);
+
+/**
+ * @brief Unregister a reader of the concurrent tree map.
+ * @param [in] object tree map instance.
+ * @param [in] reader instance to be unregistered.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL if reader is
+ * <i>NULL</i>.
+ */
+bool seahorse_concurrent_tree_map_s_p_unregister(
+        struct seahorse_concurrent_tree_map_s_p *object,
+        struct seahorse_concurrent_tree_map_s_p_reader *reader);
+
+/**
+ * @brief Retrieve the count of entries.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the entry count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_concurrent_tree_map_s_p_count(
+        const struct seahorse_concurrent_tree_map_s_p *object,
+        uintmax_t *out);
+
+/**
+ * @brief Add a key-value association.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the tree map.
+ * @note <b>key</b> is copied and then placed into the map. Writers are
+ * serialized with each other but never wait for readers.
+ */
+bool seahorse_concurrent_tree_map_s_p_add(
+        struct seahorse_concurrent_tree_map_s_p *object,
+        const struct sea_turtle_string *key,
+        const void *value);
+
+/**
+ * @brief Set the value for the given key.
+ * @param [in] object tree map instance.
+ * @param [in] key used for which value is to be changed.
+ * @param [in] value of new association with given key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to copy the nodes on the path to key.
+ */
+bool seahorse_concurrent_tree_map_s_p_set(
+        struct seahorse_concurrent_tree_map_s_p *object,
+        const struct sea_turtle_string *key,
+        const void *value);
+
+/**
+ * @brief Remove key-value association.
+ * @param [in] object tree map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to copy the nodes on the path to key.
+ */
+bool seahorse_concurrent_tree_map_s_p_remove(
+        struct seahorse_concurrent_tree_map_s_p *object,
+        const struct sea_turtle_string *key);
+
+/**
+ * @brief Check if tree map contains the given key.
+ * @param [in] object tree map instance.
+ * @param [in] reader registered by the calling thread.
+ * @param [in] key to check if it is present.
+ * @param [out] out true if key is present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL if reader is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Wait-free, it neither takes a lock nor waits for writers.
+ */
+bool seahorse_concurrent_tree_map_s_p_contains(
+        const struct seahorse_concurrent_tree_map_s_p *object,
+        struct seahorse_concurrent_tree_map_s_p_reader *reader,
+        const struct sea_turtle_string *key,
+        bool *out);
+
+/**
+ * @brief Retrieve the value for the given key.
+ * @param [in] object tree map instance.
+ * @param [in] reader registered by the calling thread.
+ * @param [in] key used to get the associated value.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL if reader is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @note Wait-free, it neither takes a lock nor waits for writers.
+ */
+bool seahorse_concurrent_tree_map_s_p_get(
+        const struct seahorse_concurrent_tree_map_s_p *object,
+        struct seahorse_concurrent_tree_map_s_p_reader *reader,
+        const struct sea_turtle_string *key,
+        const void **out);
+
+#endif /* _SEAHORSE_CONCURRENT_TREE_MAP_S_P_H_ */
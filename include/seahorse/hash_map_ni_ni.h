@@ -0,0 +1,295 @@
+#ifndef _SEAHORSE_HASH_MAP_NI_NI_H_
+#define _SEAHORSE_HASH_MAP_NI_NI_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "hash_table.h"
+
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL                1
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL                   2
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS            3
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED      4
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND                 5
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_MAP_IS_EMPTY                  6
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL                 7
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_END_OF_SEQUENCE               8
+#define SEAHORSE_HASH_MAP_NI_NI_ERROR_OTHER_IS_NULL                 9
+
+struct seahorse_hash_map_ni_ni_entry;
+
+struct seahorse_hash_map_ni_ni {
+    struct seahorse_hash_table table;
+};
+
+/**
+ * @brief Initialize hash map.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No memory is allocated until the first key-value association is
+ * added.
+ */
+bool seahorse_hash_map_ni_ni_init(struct seahorse_hash_map_ni_ni *object);
+
+/**
+ * @brief Copy initialize hash map.
+ * @param [in] object instance to be initialized.
+ * @param [in] other hash map to be copied.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to create a copy.
+ */
+bool seahorse_hash_map_ni_ni_init_hash_map_ni_ni(
+        struct seahorse_hash_map_ni_ni *object,
+        const struct seahorse_hash_map_ni_ni *other);
+
+/**
+ * @brief Invalidate hash map.
+ * <p>The actual <u>hash map instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_hash_map_ni_ni_invalidate(
+        struct seahorse_hash_map_ni_ni *object);
+
+/**
+ * @brief Retrieve the count of entries.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the entry count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_ni_ni_count(
+        const struct seahorse_hash_map_ni_ni *object,
+        uintmax_t *out);
+
+/**
+ * @brief Add a key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_ni_ni_add(struct seahorse_hash_map_ni_ni *object,
+                                 uintmax_t key,
+                                 uintmax_t value);
+
+/**
+ * @brief Add a key-value association or retrieve the existing entry.
+ * @param [in] object hash map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note If key is already present, out receives the <u>address of</u> the
+ * existing entry.
+ */
+bool seahorse_hash_map_ni_ni_try_add(
+        struct seahorse_hash_map_ni_ni *object,
+        uintmax_t key,
+        uintmax_t value,
+        const struct seahorse_hash_map_ni_ni_entry **out);
+
+/**
+ * @brief Remove key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_ni_ni_remove(struct seahorse_hash_map_ni_ni *object,
+                                    uintmax_t key);
+
+/**
+ * @brief Check if hash map contains the given key.
+ * @param [in] object hash map instance.
+ * @param [in] key to check for.
+ * @param [out] out receive true if key present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_ni_ni_contains(
+        const struct seahorse_hash_map_ni_ni *object,
+        uintmax_t key,
+        bool *out);
+
+/**
+ * @brief Set value for the key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key to find the key-value association.
+ * @param [in] value to be set for the key-value association.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_ni_ni_set(struct seahorse_hash_map_ni_ni *object,
+                                 uintmax_t key,
+                                 uintmax_t value);
+
+/**
+ * @brief Retrieve value for the key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key to find the key-value association.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_ni_ni_get(const struct seahorse_hash_map_ni_ni *object,
+                                 uintmax_t key,
+                                 const uintmax_t **out);
+
+/**
+ * @brief Retrieve entry for the key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key to find the key-value association.
+ * @param [out] out receive the <u>address of</u> the entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_ni_ni_get_entry(
+        const struct seahorse_hash_map_ni_ni *object,
+        uintmax_t key,
+        const struct seahorse_hash_map_ni_ni_entry **out);
+
+/**
+ * @brief Retrieve the first entry.
+ * @param [in] object hash map instance.
+ * @param [out] out receive the <u>address of</u> the first entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_MAP_IS_EMPTY if hash map is empty.
+ * @note Entries are visited in an unspecified order.
+ */
+bool seahorse_hash_map_ni_ni_first_entry(
+        const struct seahorse_hash_map_ni_ni *object,
+        const struct seahorse_hash_map_ni_ni_entry **out);
+
+/**
+ * @brief Retrieve the next entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry current entry.
+ * @param [out] out receive the <u>address of</u> the next entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_END_OF_SEQUENCE if there is no next
+ * entry.
+ */
+bool seahorse_hash_map_ni_ni_next_entry(
+        const struct seahorse_hash_map_ni_ni *object,
+        const struct seahorse_hash_map_ni_ni_entry *entry,
+        const struct seahorse_hash_map_ni_ni_entry **out);
+
+/**
+ * @brief Remove entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @note Removing an entry does not move any of the other entries, so
+ * iteration may continue from the removed entry with next entry.
+ */
+bool seahorse_hash_map_ni_ni_remove_entry(
+        struct seahorse_hash_map_ni_ni *object,
+        const struct seahorse_hash_map_ni_ni_entry *entry);
+
+/**
+ * @brief Retrieve key from entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry instance.
+ * @param [out] out receive the <u>address of</u> the key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_ni_ni_entry_key(
+        const struct seahorse_hash_map_ni_ni *object,
+        const struct seahorse_hash_map_ni_ni_entry *entry,
+        const uintmax_t **out);
+
+/**
+ * @brief Retrieve value from entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry instance.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_ni_ni_entry_get_value(
+        const struct seahorse_hash_map_ni_ni *object,
+        const struct seahorse_hash_map_ni_ni_entry *entry,
+        const uintmax_t **out);
+
+/**
+ * @brief Set value for entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry instance.
+ * @param [in] value to be set.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ */
+bool seahorse_hash_map_ni_ni_entry_set_value(
+        const struct seahorse_hash_map_ni_ni *object,
+        const struct seahorse_hash_map_ni_ni_entry *entry,
+        uintmax_t value);
+
+#endif /* _SEAHORSE_HASH_MAP_NI_NI_H_ */
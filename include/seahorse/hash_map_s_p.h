@@ -0,0 +1,391 @@
+#ifndef _SEAHORSE_HASH_MAP_S_P_H_
+#define _SEAHORSE_HASH_MAP_S_P_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "hash_table.h"
+
+struct sea_turtle_string;
+
+#define SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL                1
+#define SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL                   2
+#define SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL                   3
+#define SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS            4
+#define SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED      5
+#define SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND                 6
+#define SEAHORSE_HASH_MAP_S_P_ERROR_MAP_IS_EMPTY                  7
+#define SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL                 8
+#define SEAHORSE_HASH_MAP_S_P_ERROR_END_OF_SEQUENCE               9
+#define SEAHORSE_HASH_MAP_S_P_ERROR_OTHER_IS_NULL                 10
+
+struct seahorse_hash_map_s_p_entry;
+
+struct seahorse_hash_map_s_p {
+    struct seahorse_hash_table table;
+};
+
+/**
+ * @brief Initialize hash map.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No memory is allocated until the first key-value association is
+ * added.
+ */
+bool seahorse_hash_map_s_p_init(
+        struct seahorse_hash_map_s_p *object);
+
+/**
+ * @brief Copy initialize hash map.
+ * @param [in] object instance to be initialized.
+ * @param [in] other hash map to be copied.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to create a copy.
+ */
+bool seahorse_hash_map_s_p_init_hash_map_s_p(
+        struct seahorse_hash_map_s_p *object,
+        const struct seahorse_hash_map_s_p *other);
+
+/**
+ * @brief Invalidate hash map.
+ * <p>The actual <u>hash map instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @param [in] on_destroy called just before the value is to be destroyed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_p_invalidate(
+        struct seahorse_hash_map_s_p *object,
+        void (*on_destroy)(void *value));
+
+/**
+ * @brief Retrieve the count of entries.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the entry count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_p_count(
+        const struct seahorse_hash_map_s_p *object,
+        uintmax_t *out);
+
+/**
+ * @brief Add a key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key a copy of which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_s_p_add(
+        struct seahorse_hash_map_s_p *object,
+        const struct sea_turtle_string *key,
+        const void *value);
+
+/**
+ * @brief Add a key-value association or retrieve the existing entry.
+ * @param [in] object hash map instance.
+ * @param [in] key a copy of which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note If key is already present, out receives the <u>address of</u> the
+ * existing entry.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_s_p_try_add(
+        struct seahorse_hash_map_s_p *object,
+        const struct sea_turtle_string *key,
+        const void *value,
+        const struct seahorse_hash_map_s_p_entry **out);
+
+/**
+ * @brief Add a key-value association by taking ownership of the key.
+ * @param [in] object hash map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note On success <b>key</b> is reset and must not be invalidated by the
+ * caller.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_s_p_add_take(
+        struct seahorse_hash_map_s_p *object,
+        struct sea_turtle_string *key,
+        const void *value);
+
+/**
+ * @brief Remove key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_s_p_remove(
+        struct seahorse_hash_map_s_p *object,
+        const struct sea_turtle_string *key);
+
+/**
+ * @brief Remove key-value association given as raw bytes.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @param [in] size of key in bytes.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @note <b>key</b> is hashed and compared directly against the stored
+ * strings so no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_hash_map_s_p_remove_chars(
+        struct seahorse_hash_map_s_p *object,
+        const char *key,
+        size_t size);
+
+/**
+ * @brief Check if hash map contains the given key.
+ * @param [in] object hash map instance.
+ * @param [in] key to check for.
+ * @param [out] out receive true if key present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_p_contains(
+        const struct seahorse_hash_map_s_p *object,
+        const struct sea_turtle_string *key,
+        bool *out);
+
+/**
+ * @brief Check if hash map contains the given key in raw bytes.
+ * @param [in] object hash map instance.
+ * @param [in] key to check for.
+ * @param [in] size of key in bytes.
+ * @param [out] out receive true if key present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note <b>key</b> is hashed and compared directly against the stored
+ * strings so no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_hash_map_s_p_contains_chars(
+        const struct seahorse_hash_map_s_p *object,
+        const char *key,
+        size_t size,
+        bool *out);
+
+/**
+ * @brief Set value for key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to set the value.
+ * @param [in] value that we would like to associate with key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_s_p_set(
+        struct seahorse_hash_map_s_p *object,
+        const struct sea_turtle_string *key,
+        const void *value);
+
+/**
+ * @brief Get value for key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to get the value.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_s_p_get(
+        const struct seahorse_hash_map_s_p *object,
+        const struct sea_turtle_string *key,
+        const void **out);
+
+/**
+ * @brief Get value for key-value association given as raw bytes.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to get the value.
+ * @param [in] size of key in bytes.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @note <b>key</b> is hashed and compared directly against the stored
+ * strings so no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_hash_map_s_p_get_chars(
+        const struct seahorse_hash_map_s_p *object,
+        const char *key,
+        size_t size,
+        const void **out);
+
+/**
+ * @brief Retrieve entry for key.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to retrieve the entry.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_s_p_get_entry(
+        const struct seahorse_hash_map_s_p *object,
+        const struct sea_turtle_string *key,
+        const struct seahorse_hash_map_s_p_entry **out);
+
+/**
+ * @brief First entry of the hash map.
+ * @param [in] object hash map instance.
+ * @param [out] out receive the <u>address of</u> the first entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_MAP_IS_EMPTY if the hash map is empty.
+ * @note Entries are iterated in slot order which is unrelated to the order
+ * of their keys.
+ */
+bool seahorse_hash_map_s_p_first_entry(
+        const struct seahorse_hash_map_s_p *object,
+        const struct seahorse_hash_map_s_p_entry **out);
+
+/**
+ * @brief Retrieve next entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry current entry.
+ * @param [out] out receive the <u>address of</u> the next entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_END_OF_SEQUENCE if there is no next
+ * entry.
+ */
+bool seahorse_hash_map_s_p_next_entry(
+        const struct seahorse_hash_map_s_p *object,
+        const struct seahorse_hash_map_s_p_entry *entry,
+        const struct seahorse_hash_map_s_p_entry **out);
+
+/**
+ * @brief Remove entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_p_remove_entry(
+        struct seahorse_hash_map_s_p *object,
+        const struct seahorse_hash_map_s_p_entry *entry);
+
+/**
+ * @brief Retrieve key from entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry whose key we are to retrieve.
+ * @param [out] out receive the <u>address of</u> the key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_p_entry_key(
+        const struct seahorse_hash_map_s_p *object,
+        const struct seahorse_hash_map_s_p_entry *entry,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Retrieve value from entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry whose value we are to retrieve.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_p_entry_get_value(
+        const struct seahorse_hash_map_s_p *object,
+        const struct seahorse_hash_map_s_p_entry *entry,
+        const void **out);
+
+/**
+ * @brief Set value of entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry whose value we are to set.
+ * @param [in] value to be set.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_p_entry_set_value(
+        const struct seahorse_hash_map_s_p *object,
+        const struct seahorse_hash_map_s_p_entry *entry,
+        const void *value);
+
+#endif /* _SEAHORSE_HASH_MAP_S_P_H_ */
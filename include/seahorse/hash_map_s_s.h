@@ -0,0 +1,421 @@
+#ifndef _SEAHORSE_HASH_MAP_S_S_H_
+#define _SEAHORSE_HASH_MAP_S_S_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "hash_table.h"
+
+struct sea_turtle_string;
+
+#define SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL                1
+#define SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL                   2
+#define SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL                   3
+#define SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL                 4
+#define SEAHORSE_HASH_MAP_S_S_ERROR_KEY_ALREADY_EXISTS            5
+#define SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED      6
+#define SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND                 7
+#define SEAHORSE_HASH_MAP_S_S_ERROR_MAP_IS_EMPTY                  8
+#define SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL                 9
+#define SEAHORSE_HASH_MAP_S_S_ERROR_END_OF_SEQUENCE               10
+#define SEAHORSE_HASH_MAP_S_S_ERROR_OTHER_IS_NULL                 11
+
+struct seahorse_hash_map_s_s_entry;
+
+struct seahorse_hash_map_s_s {
+    struct seahorse_hash_table table;
+};
+
+/**
+ * @brief Initialize hash map.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No memory is allocated until the first key-value association is
+ * added.
+ */
+bool seahorse_hash_map_s_s_init(
+        struct seahorse_hash_map_s_s *object);
+
+/**
+ * @brief Copy initialize hash map.
+ * @param [in] object instance to be initialized.
+ * @param [in] other hash map to be copied.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to create a copy.
+ */
+bool seahorse_hash_map_s_s_init_hash_map_s_s(
+        struct seahorse_hash_map_s_s *object,
+        const struct seahorse_hash_map_s_s *other);
+
+/**
+ * @brief Invalidate hash map.
+ * <p>The actual <u>hash map instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_s_invalidate(
+        struct seahorse_hash_map_s_s *object);
+
+/**
+ * @brief Retrieve the count of entries.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the entry count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_s_count(
+        const struct seahorse_hash_map_s_s *object,
+        uintmax_t *out);
+
+/**
+ * @brief Add a key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key a copy of which the value will be associated with.
+ * @param [in] value a copy of which will be returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_s_s_add(
+        struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string *value);
+
+/**
+ * @brief Add a key-value association or retrieve the existing entry.
+ * @param [in] object hash map instance.
+ * @param [in] key a copy of which the value will be associated with.
+ * @param [in] value a copy of which will be returned from a lookup of key.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note If key is already present, out receives the <u>address of</u> the
+ * existing entry.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_s_s_try_add(
+        struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string *value,
+        const struct seahorse_hash_map_s_s_entry **out);
+
+/**
+ * @brief Add a key-value association by taking ownership of both strings.
+ * @param [in] object hash map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will be returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_ALREADY_EXISTS if the key is
+ * already present in the hash map.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add key-value association to the hash map.
+ * @note On success <b>key</b> and <b>value</b> are reset and must not be
+ * invalidated by the caller.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_s_s_add_take(
+        struct seahorse_hash_map_s_s *object,
+        struct sea_turtle_string *key,
+        struct sea_turtle_string *value);
+
+/**
+ * @brief Remove key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_s_s_remove(
+        struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key);
+
+/**
+ * @brief Remove key-value association given as raw bytes.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @param [in] size of key in bytes.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @note <b>key</b> is hashed and compared directly against the stored
+ * strings so no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_hash_map_s_s_remove_chars(
+        struct seahorse_hash_map_s_s *object,
+        const char *key,
+        size_t size);
+
+/**
+ * @brief Check if hash map contains the given key.
+ * @param [in] object hash map instance.
+ * @param [in] key to check for.
+ * @param [out] out receive true if key present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_s_contains(
+        const struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key,
+        bool *out);
+
+/**
+ * @brief Check if hash map contains the given key in raw bytes.
+ * @param [in] object hash map instance.
+ * @param [in] key to check for.
+ * @param [in] size of key in bytes.
+ * @param [out] out receive true if key present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note <b>key</b> is hashed and compared directly against the stored
+ * strings so no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_hash_map_s_s_contains_chars(
+        const struct seahorse_hash_map_s_s *object,
+        const char *key,
+        size_t size,
+        bool *out);
+
+/**
+ * @brief Set value for key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to set the value.
+ * @param [in] value a copy of which we would like to associate with key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to copy the value.
+ */
+bool seahorse_hash_map_s_s_set(
+        struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string *value);
+
+/**
+ * @brief Set value for key-value association by taking ownership of it.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to set the value.
+ * @param [in] value that we would like to associate with key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @note On success <b>value</b> is reset and must not be invalidated by the
+ * caller.
+ */
+bool seahorse_hash_map_s_s_set_take(
+        struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key,
+        struct sea_turtle_string *value);
+
+/**
+ * @brief Get value for key-value association.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to get the value.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @note Adding may grow the hash map which invalidates all previously
+ * retrieved values and entries.
+ */
+bool seahorse_hash_map_s_s_get(
+        const struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Get value for key-value association given as raw bytes.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to get the value.
+ * @param [in] size of key in bytes.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ * @note <b>key</b> is hashed and compared directly against the stored
+ * strings so no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_hash_map_s_s_get_chars(
+        const struct seahorse_hash_map_s_s *object,
+        const char *key,
+        size_t size,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Retrieve entry for key.
+ * @param [in] object hash map instance.
+ * @param [in] key for which we would like to retrieve the entry.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL if key is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND if key could not be
+ * found.
+ */
+bool seahorse_hash_map_s_s_get_entry(
+        const struct seahorse_hash_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct seahorse_hash_map_s_s_entry **out);
+
+/**
+ * @brief First entry of the hash map.
+ * @param [in] object hash map instance.
+ * @param [out] out receive the <u>address of</u> the first entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_MAP_IS_EMPTY if the hash map is empty.
+ * @note Entries are iterated in slot order which is unrelated to the order
+ * of their keys.
+ */
+bool seahorse_hash_map_s_s_first_entry(
+        const struct seahorse_hash_map_s_s *object,
+        const struct seahorse_hash_map_s_s_entry **out);
+
+/**
+ * @brief Retrieve next entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry current entry.
+ * @param [out] out receive the <u>address of</u> the next entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_END_OF_SEQUENCE if there is no next
+ * entry.
+ */
+bool seahorse_hash_map_s_s_next_entry(
+        const struct seahorse_hash_map_s_s *object,
+        const struct seahorse_hash_map_s_s_entry *entry,
+        const struct seahorse_hash_map_s_s_entry **out);
+
+/**
+ * @brief Remove entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_s_remove_entry(
+        struct seahorse_hash_map_s_s *object,
+        const struct seahorse_hash_map_s_s_entry *entry);
+
+/**
+ * @brief Retrieve key from entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry whose key we are to retrieve.
+ * @param [out] out receive the <u>address of</u> the key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_s_entry_key(
+        const struct seahorse_hash_map_s_s *object,
+        const struct seahorse_hash_map_s_s_entry *entry,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Retrieve value from entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry whose value we are to retrieve.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_hash_map_s_s_entry_get_value(
+        const struct seahorse_hash_map_s_s *object,
+        const struct seahorse_hash_map_s_s_entry *entry,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Set value of entry.
+ * @param [in] object hash map instance.
+ * @param [in] entry whose value we are to set.
+ * @param [in] value a copy of which is to be set.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL if entry is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL if value is <i>NULL</i>.
+ * @throws SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to copy the value.
+ */
+bool seahorse_hash_map_s_s_entry_set_value(
+        const struct seahorse_hash_map_s_s *object,
+        const struct seahorse_hash_map_s_s_entry *entry,
+        const struct sea_turtle_string *value);
+
+#endif /* _SEAHORSE_HASH_MAP_S_S_H_ */
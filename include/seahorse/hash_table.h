@@ -0,0 +1,23 @@
+#ifndef _SEAHORSE_HASH_TABLE_H_
+#define _SEAHORSE_HASH_TABLE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Storage shared by the hash maps, an open addressing table of entries that
+ * are size bytes each and whose hash is retrieved with hash when the table is
+ * rehashed.
+ */
+struct seahorse_hash_table {
+    uintmax_t count;
+    uintmax_t capacity;
+    uintmax_t growth;
+    uint8_t *controls;
+    void *entries;
+    size_t size;
+    uint64_t (*hash)(const void *entry);
+};
+
+#endif /* _SEAHORSE_HASH_TABLE_H_ */
@@ -0,0 +1,108 @@
+#ifndef _SEAHORSE_HEAP_NI_H_
+#define _SEAHORSE_HEAP_NI_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL                       1
+#define SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL                          2
+#define SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED             3
+#define SEAHORSE_HEAP_NI_ERROR_HEAP_IS_EMPTY                        4
+#define SEAHORSE_HEAP_NI_ERROR_COUNT_IS_ZERO                        5
+#define SEAHORSE_HEAP_NI_ERROR_VALUES_IS_NULL                       6
+
+/*
+ * A min-heap laid out in a single array where each item has up to four
+ * children, which halves the depth of a binary heap and keeps the children
+ * of an item next to each other in memory.
+ */
+struct seahorse_heap_ni {
+    uintmax_t count;
+    uintmax_t capacity;
+    uintmax_t *items;
+};
+
+/**
+ * @brief Initialize heap.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @note No memory is allocated until the first item is pushed.
+ */
+bool seahorse_heap_ni_init(struct seahorse_heap_ni *object);
+
+/**
+ * @brief Invalidate heap.
+ * <p>The actual <u>heap instance is not deallocated</u> since it may have
+ * been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ */
+bool seahorse_heap_ni_invalidate(struct seahorse_heap_ni *object);
+
+/**
+ * @brief Retrieve the count of items.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_heap_ni_count(const struct seahorse_heap_ni *object,
+                            uintmax_t *out);
+
+/**
+ * @brief Push item onto the heap.
+ * @param [in] object heap instance.
+ * @param [in] item to be pushed onto the heap.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to push item onto the heap.
+ */
+bool seahorse_heap_ni_push(struct seahorse_heap_ni *object, uintmax_t item);
+
+/**
+ * @brief Push all the values onto the heap.
+ * @param [in] object heap instance.
+ * @param [in] count number of values.
+ * @param [in] values all of which we would like to push onto the heap.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAHORSE_HEAP_NI_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to push all the values onto the heap.
+ * @note When at least as many values are pushed as there already are items
+ * the heap is rebuilt bottom up, which takes time linear in its new count.
+ */
+bool seahorse_heap_ni_push_all(struct seahorse_heap_ni *object,
+                               uintmax_t count,
+                               const uintmax_t *values);
+
+/**
+ * @brief Pop the least item from the heap.
+ * @param [in] object heap instance.
+ * @param [out] out receive the least item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_HEAP_IS_EMPTY if heap is empty.
+ */
+bool seahorse_heap_ni_pop(struct seahorse_heap_ni *object, uintmax_t *out);
+
+/**
+ * @brief Retrieve the least item without popping it from the heap.
+ * @param [in] object heap instance.
+ * @param [out] out receive the least item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_NI_ERROR_HEAP_IS_EMPTY if heap is empty.
+ */
+bool seahorse_heap_ni_peek(const struct seahorse_heap_ni *object,
+                           uintmax_t *out);
+
+#endif /* _SEAHORSE_HEAP_NI_H_ */
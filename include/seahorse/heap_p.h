@@ -0,0 +1,120 @@
+#ifndef _SEAHORSE_HEAP_P_H_
+#define _SEAHORSE_HEAP_P_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL                        1
+#define SEAHORSE_HEAP_P_ERROR_COMPARE_IS_NULL                       2
+#define SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL                           3
+#define SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED              4
+#define SEAHORSE_HEAP_P_ERROR_HEAP_IS_EMPTY                         5
+#define SEAHORSE_HEAP_P_ERROR_COUNT_IS_ZERO                         6
+#define SEAHORSE_HEAP_P_ERROR_VALUES_IS_NULL                        7
+
+/*
+ * A min-heap of pointers ordered by the compare function, laid out in a
+ * single array where each item has up to four children.
+ */
+struct seahorse_heap_p {
+    uintmax_t count;
+    uintmax_t capacity;
+    void **items;
+    int (*compare)(const void *first, const void *second);
+};
+
+/**
+ * @brief Initialize heap.
+ * @param [in] object instance to be initialized.
+ * @param [in] compare comparison which must return an integer less than,
+ * equal to, or greater than zero if the <u>first item</u> is considered
+ * to be respectively less than, equal to, or greater than the <u>second
+ * item</u>.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_COMPARE_IS_NULL if compare is <i>NULL</i>.
+ * @note compare receives pointers to where the items are stored rather than
+ * the items themselves.
+ */
+bool seahorse_heap_p_init(struct seahorse_heap_p *object,
+                          int (*compare)(const void *first,
+                                         const void *second));
+
+/**
+ * @brief Invalidate heap.
+ * <p>All the items contained within the heap will have the given <i>on
+ * destroy</i> callback invoked upon itself. The actual <u>heap instance is
+ * not deallocated</u> since it may have been embedded in a larger
+ * structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @param [in] on_destroy called just before the item is to be destroyed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ */
+bool seahorse_heap_p_invalidate(struct seahorse_heap_p *object,
+                                void (*on_destroy)(void *item));
+
+/**
+ * @brief Retrieve the count of items.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_heap_p_count(const struct seahorse_heap_p *object,
+                           uintmax_t *out);
+
+/**
+ * @brief Push item onto the heap.
+ * @param [in] object heap instance.
+ * @param [in] item to be pushed onto the heap.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to push item onto the heap.
+ */
+bool seahorse_heap_p_push(struct seahorse_heap_p *object, void *item);
+
+/**
+ * @brief Push all the values onto the heap.
+ * @param [in] object heap instance.
+ * @param [in] count number of values.
+ * @param [in] values all of which we would like to push onto the heap.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAHORSE_HEAP_P_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to push all the values onto the heap.
+ * @note When at least as many values are pushed as there already are items
+ * the heap is rebuilt bottom up, which takes time linear in its new count.
+ */
+bool seahorse_heap_p_push_all(struct seahorse_heap_p *object,
+                              uintmax_t count,
+                              void *const *values);
+
+/**
+ * @brief Pop the least item from the heap.
+ * @param [in] object heap instance.
+ * @param [out] out receive the least item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_HEAP_IS_EMPTY if heap is empty.
+ */
+bool seahorse_heap_p_pop(struct seahorse_heap_p *object, void **out);
+
+/**
+ * @brief Retrieve the least item without popping it from the heap.
+ * @param [in] object heap instance.
+ * @param [out] out receive the least item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_HEAP_P_ERROR_HEAP_IS_EMPTY if heap is empty.
+ */
+bool seahorse_heap_p_peek(const struct seahorse_heap_p *object, void **out);
+
+#endif /* _SEAHORSE_HEAP_P_H_ */
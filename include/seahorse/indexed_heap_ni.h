@@ -0,0 +1,181 @@
+#ifndef _SEAHORSE_INDEXED_HEAP_NI_H_
+#define _SEAHORSE_INDEXED_HEAP_NI_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL               1
+#define SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL                  2
+#define SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_ALREADY_EXISTS           3
+#define SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED     4
+#define SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND                5
+#define SEAHORSE_INDEXED_HEAP_NI_ERROR_HEAP_IS_EMPTY                6
+#define SEAHORSE_INDEXED_HEAP_NI_ERROR_PRIORITY_IS_OUT_OF_BOUNDS    7
+
+/*
+ * A min-heap of keys ordered by their priority, with each key's position
+ * in the heap recorded so that it can be found in constant time to have
+ * its priority decreased or to be removed. Keys and priorities are kept in
+ * parallel arrays laid out as a heap where each key has up to four children,
+ * while positions is indexed by key and so is meant for small dense keys
+ * such as the vertices of a graph.
+ */
+struct seahorse_indexed_heap_ni {
+    uintmax_t count;
+    uintmax_t capacity;
+    uintmax_t limit;
+    uintmax_t *keys;
+    uintmax_t *priorities;
+    uintmax_t *positions;
+};
+
+/**
+ * @brief Initialize indexed heap.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No memory is allocated until the first key is pushed.
+ */
+bool seahorse_indexed_heap_ni_init(struct seahorse_indexed_heap_ni *object);
+
+/**
+ * @brief Invalidate indexed heap.
+ * <p>The actual <u>indexed heap instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_indexed_heap_ni_invalidate(
+        struct seahorse_indexed_heap_ni *object);
+
+/**
+ * @brief Retrieve the count of keys.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_indexed_heap_ni_count(
+        const struct seahorse_indexed_heap_ni *object,
+        uintmax_t *out);
+
+/**
+ * @brief Push key with the given priority onto the indexed heap.
+ * @param [in] object indexed heap instance.
+ * @param [in] key to be pushed onto the heap.
+ * @param [in] priority of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_ALREADY_EXISTS if key is
+ * already in the heap.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED if there
+ * is insufficient memory to push key onto the heap.
+ * @note Room is made for positions of every key up to and including key.
+ */
+bool seahorse_indexed_heap_ni_push(struct seahorse_indexed_heap_ni *object,
+                                   uintmax_t key,
+                                   uintmax_t priority);
+
+/**
+ * @brief Pop the key with the least priority from the indexed heap.
+ * @param [in] object indexed heap instance.
+ * @param [out] out receive the key with the least priority.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_HEAP_IS_EMPTY if heap is empty.
+ */
+bool seahorse_indexed_heap_ni_pop(struct seahorse_indexed_heap_ni *object,
+                                  uintmax_t *out);
+
+/**
+ * @brief Retrieve the key with the least priority without popping it.
+ * @param [in] object indexed heap instance.
+ * @param [out] out receive the key with the least priority.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_HEAP_IS_EMPTY if heap is empty.
+ */
+bool seahorse_indexed_heap_ni_peek(
+        const struct seahorse_indexed_heap_ni *object,
+        uintmax_t *out);
+
+/**
+ * @brief Check if indexed heap contains the given key.
+ * @param [in] object indexed heap instance.
+ * @param [in] key to look for.
+ * @param [out] out receive true if key is in the heap, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_indexed_heap_ni_contains(
+        const struct seahorse_indexed_heap_ni *object,
+        uintmax_t key,
+        bool *out);
+
+/**
+ * @brief Retrieve the priority of key.
+ * @param [in] object indexed heap instance.
+ * @param [in] key whose priority we are to retrieve.
+ * @param [out] out receive the priority of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND if key is not in
+ * the heap.
+ */
+bool seahorse_indexed_heap_ni_get(
+        const struct seahorse_indexed_heap_ni *object,
+        uintmax_t key,
+        uintmax_t *out);
+
+/**
+ * @brief Decrease the priority of key.
+ * @param [in] object indexed heap instance.
+ * @param [in] key whose priority is to be decreased.
+ * @param [in] priority new priority of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND if key is not in
+ * the heap.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_PRIORITY_IS_OUT_OF_BOUNDS if
+ * priority is greater than the current priority of key.
+ */
+bool seahorse_indexed_heap_ni_decrease(
+        struct seahorse_indexed_heap_ni *object,
+        uintmax_t key,
+        uintmax_t priority);
+
+/**
+ * @brief Remove key from the indexed heap.
+ * @param [in] object indexed heap instance.
+ * @param [in] key to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND if key is not in
+ * the heap.
+ */
+bool seahorse_indexed_heap_ni_remove(struct seahorse_indexed_heap_ni *object,
+                                     uintmax_t key);
+
+#endif /* _SEAHORSE_INDEXED_HEAP_NI_H_ */
@@ -0,0 +1,147 @@
+#ifndef _SEAHORSE_MPMC_QUEUE_SR_H_
+#define _SEAHORSE_MPMC_QUEUE_SR_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct triggerfish_strong;
+
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL                 1
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL                    2
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_NULL                   3
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_INVALID                4
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED       5
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_EMPTY                 6
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_FULL                  7
+#define SEAHORSE_MPMC_QUEUE_SR_ERROR_CAPACITY_IS_ZERO               8
+
+/*
+ * A bounded queue which any number of threads may add to and remove from
+ * without taking a lock. Items live in a ring of slots, each with a sequence
+ * number telling whether it is ready to be written to or read from, hence a
+ * producer and a consumer only ever contend on the slot they both claim.
+ */
+struct seahorse_mpmc_queue_sr {
+    void *data;
+};
+
+/**
+ * @brief Initialize mpmc queue.
+ * @param [in] object instance to be initialized.
+ * @param [in] capacity maximum number of items the queue can hold.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_CAPACITY_IS_ZERO if capacity is zero.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to initialize the queue.
+ * @note capacity is rounded up to the next power of two, with two being the
+ * smallest possible capacity.
+ */
+bool seahorse_mpmc_queue_sr_init(struct seahorse_mpmc_queue_sr *object,
+                                 uintmax_t capacity);
+
+/**
+ * @brief Invalidate mpmc queue.
+ * <p>All the items still contained within the queue are released. The actual
+ * <u>mpmc queue instance is not deallocated</u> since it may have been
+ * embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No other thread may be using or waiting on the queue.
+ */
+bool seahorse_mpmc_queue_sr_invalidate(struct seahorse_mpmc_queue_sr *object);
+
+/**
+ * @brief Retrieve the capacity.
+ * @param [in] object instance whose capacity we are to retrieve.
+ * @param [out] out receive the capacity.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_mpmc_queue_sr_capacity(
+        const struct seahorse_mpmc_queue_sr *object,
+        uintmax_t *out);
+
+/**
+ * @brief Retrieve the count of items.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note While other threads are adding or removing items the count is only
+ * an estimate.
+ */
+bool seahorse_mpmc_queue_sr_count(const struct seahorse_mpmc_queue_sr *object,
+                                  uintmax_t *out);
+
+/**
+ * @brief Add item to the end of the mpmc queue if there is room for it.
+ * @param [in] object mpmc queue instance.
+ * @param [in] item to add to the end of the queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_NULL if item is <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_INVALID if the strong
+ * reference of item has been invalidated.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_FULL if the queue holds as
+ * many items as its capacity.
+ * @note <b>item</b> is retained and then it is inserted.
+ */
+bool seahorse_mpmc_queue_sr_try_add(struct seahorse_mpmc_queue_sr *object,
+                                    struct triggerfish_strong *item);
+
+/**
+ * @brief Add item to the end of the mpmc queue, waiting for room if needed.
+ * @param [in] object mpmc queue instance.
+ * @param [in] item to add to the end of the queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_NULL if item is <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_INVALID if the strong
+ * reference of item has been invalidated.
+ * @note <b>item</b> is retained and then it is inserted.
+ */
+bool seahorse_mpmc_queue_sr_add(struct seahorse_mpmc_queue_sr *object,
+                                struct triggerfish_strong *item);
+
+/**
+ * @brief Remove item from the front of the mpmc queue if there is one.
+ * @param [in] object mpmc queue instance.
+ * @param [out] out receive the item in the front of the queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_EMPTY if the queue is empty.
+ * @note The caller takes over the strong reference held by the queue and
+ * must release it once it is done with the item.
+ */
+bool seahorse_mpmc_queue_sr_try_remove(struct seahorse_mpmc_queue_sr *object,
+                                       struct triggerfish_strong **out);
+
+/**
+ * @brief Remove item from the front of the mpmc queue, waiting for one if
+ * needed.
+ * @param [in] object mpmc queue instance.
+ * @param [out] out receive the item in the front of the queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note The caller takes over the strong reference held by the queue and
+ * must release it once it is done with the item.
+ */
+bool seahorse_mpmc_queue_sr_remove(struct seahorse_mpmc_queue_sr *object,
+                                   struct triggerfish_strong **out);
+
+#endif /* _SEAHORSE_MPMC_QUEUE_SR_H_ */
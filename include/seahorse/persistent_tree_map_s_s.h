@@ -0,0 +1,262 @@
+#ifndef _SEAHORSE_PERSISTENT_TREE_MAP_S_S_H_
+#define _SEAHORSE_PERSISTENT_TREE_MAP_S_S_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct sea_turtle_string;
+
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL               1
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL                  2
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL                  3
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_VALUE_IS_NULL                4
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_ALREADY_EXISTS           5
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED     6
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND                7
+#define SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MAP_IS_EMPTY                 8
+
+/*
+ * A weight balanced binary search tree whose nodes are never modified once
+ * they are reachable. Writes copy the path from the root to the nodes they
+ * touch and share every other node, which is reference counted, with the
+ * previous version of the tree. Taking a snapshot is therefore O(1) and each
+ * write afterwards only costs the O(log n) nodes that it copies.
+ */
+struct seahorse_persistent_tree_map_s_s {
+    void *root;
+};
+
+/**
+ * @brief Initialize persistent tree map.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_persistent_tree_map_s_s_init(
+        struct seahorse_persistent_tree_map_s_s *object);
+
+/**
+ * @brief Invalidate persistent tree map.
+ * <p>The actual <u>tree map instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note Only the nodes which are not shared with a snapshot are deallocated.
+ */
+bool seahorse_persistent_tree_map_s_s_invalidate(
+        struct seahorse_persistent_tree_map_s_s *object);
+
+/**
+ * @brief Initialize a snapshot of the persistent tree map.
+ * @param [in] object tree map instance.
+ * @param [out] out instance to be initialized with the current contents of
+ * the tree map.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Runs in O(1) time. The snapshot is an independent tree map which is
+ * not affected by later writes to object, and vice versa.
+ * @note Taking a snapshot must not race with writes to object, but once taken
+ * the snapshot may be read and invalidated by another thread while object is
+ * being written to.
+ */
+bool seahorse_persistent_tree_map_s_s_snapshot(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        struct seahorse_persistent_tree_map_s_s *out);
+
+/**
+ * @brief Retrieve the count of entries.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the entry count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_persistent_tree_map_s_s_count(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        uintmax_t *out);
+
+/**
+ * @brief Add a key-value association.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the tree map.
+ * @note <b>key</b> and <b>value</b> are copied and then placed into the map.
+ */
+bool seahorse_persistent_tree_map_s_s_add(
+        struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string *value);
+
+/**
+ * @brief Set the value for the given key.
+ * @param [in] object tree map instance.
+ * @param [in] key used for which value is to be changed.
+ * @param [in] value of new association with given key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is not enough memory to set the entry's value.
+ * @note <b>value</b> is copied and then placed into the map.
+ */
+bool seahorse_persistent_tree_map_s_s_set(
+        struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string *value);
+
+/**
+ * @brief Remove key-value association.
+ * @param [in] object tree map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to copy the nodes on the path to key.
+ */
+bool seahorse_persistent_tree_map_s_s_remove(
+        struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string *key);
+
+/**
+ * @brief Check if tree map contains the given key.
+ * @param [in] object tree map instance.
+ * @param [in] key to check if it is present.
+ * @param [out] out true if key is present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ */
+bool seahorse_persistent_tree_map_s_s_contains(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string *key,
+        bool *out);
+
+/**
+ * @brief Retrieve the value for the given key.
+ * @param [in] object tree map instance.
+ * @param [in] key used to get the associated value.
+ * @param [out] out receive the <u>address of</u> the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @note The value may be shared with snapshots and must not be modified.
+ */
+bool seahorse_persistent_tree_map_s_s_get(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Retrieve the first key.
+ * @param [in] object tree map instance.
+ * @param [out] out receive the <u>address of</u> the first key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MAP_IS_EMPTY if tree map is
+ * empty.
+ */
+bool seahorse_persistent_tree_map_s_s_first(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Retrieve the last key.
+ * @param [in] object tree map instance.
+ * @param [out] out receive the <u>address of</u> the last key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MAP_IS_EMPTY if tree map is
+ * empty.
+ */
+bool seahorse_persistent_tree_map_s_s_last(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Retrieve the next higher key.
+ * @param [in] object tree map instance.
+ * @param [in] key whose next higher key we are trying to find.
+ * @param [out] out receive the <u>address of</u> the higher key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND if no higher
+ * key is in the tree map instance.
+ */
+bool seahorse_persistent_tree_map_s_s_higher(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string **out);
+
+/**
+ * @brief Retrieve the next lower key.
+ * @param [in] object tree map instance.
+ * @param [in] key whose next lower key we are trying to find.
+ * @param [out] out receive the <u>address of</u> the lower key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND if no lower
+ * key is in the tree map instance.
+ */
+bool seahorse_persistent_tree_map_s_s_lower(
+        const struct seahorse_persistent_tree_map_s_s *object,
+        const struct sea_turtle_string *key,
+        const struct sea_turtle_string **out);
+
+#endif /* _SEAHORSE_PERSISTENT_TREE_MAP_S_S_H_ */
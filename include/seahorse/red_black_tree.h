@@ -0,0 +1,60 @@
+#ifndef _SEAHORSE_RED_BLACK_TREE_H_
+#define _SEAHORSE_RED_BLACK_TREE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_RED_BLACK_TREE_POOL_ERROR_OBJECT_IS_NULL               1
+#define SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE               2
+
+/*
+ * Node storage that may be shared by any number of red black tree maps and
+ * sets. Nodes are carved out of chunks, one list of chunks per node size, and
+ * released nodes are kept for reuse instead of being returned to the heap.
+ */
+struct seahorse_red_black_tree_pool {
+    void *slabs;
+    uintmax_t count;
+};
+
+/*
+ * Storage shared by the red black tree maps and sets, where every node also
+ * carries the count of its subtree so that ranges can be counted, split off
+ * and joined back in logarithmic time.
+ */
+struct seahorse_red_black_tree {
+    void *root;
+    struct seahorse_red_black_tree_pool *pool;
+    int (*compare)(const void *first, const void *second);
+    uintmax_t count;
+    size_t size;
+};
+
+/**
+ * @brief Initialize red black tree pool.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_POOL_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note The pool is not thread-safe, every container sharing a pool must
+ * be used from the same thread.
+ */
+bool seahorse_red_black_tree_pool_init(
+        struct seahorse_red_black_tree_pool *object);
+
+/**
+ * @brief Invalidate red black tree pool.
+ * <p>The actual <u>pool instance is not deallocated</u> since it may have
+ * been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_POOL_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE if a container
+ * initialized with the pool has not yet been invalidated.
+ */
+bool seahorse_red_black_tree_pool_invalidate(
+        struct seahorse_red_black_tree_pool *object);
+
+#endif /* _SEAHORSE_RED_BLACK_TREE_H_ */
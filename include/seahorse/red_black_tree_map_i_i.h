@@ -4,7 +4,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <coral.h>
+#include "red_black_tree.h"
 
 struct sea_turtle_integer;
 
@@ -19,9 +19,12 @@ struct sea_turtle_integer;
 #define SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_ENTRY_IS_NULL                 9
 #define SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_END_OF_SEQUENCE               10
 #define SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OTHER_IS_NULL                 11
+#define SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_POOL_IS_NULL                  12
+#define SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEYS_OVERLAP                  13
+#define SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_RANK_IS_OUT_OF_BOUNDS         14
 
 struct seahorse_red_black_tree_map_i_i {
-    struct coral_red_black_tree_map map;
+    struct seahorse_red_black_tree tree;
 };
 
 struct seahorse_red_black_tree_map_i_i_entry;
@@ -36,6 +39,23 @@ struct seahorse_red_black_tree_map_i_i_entry;
 bool seahorse_red_black_tree_map_i_i_init(
         struct seahorse_red_black_tree_map_i_i *object);
 
+/**
+ * @brief Initialize red black tree map with nodes from a pool.
+ * @param [in] object instance to be initialized.
+ * @param [in] pool from which the nodes of the tree map are allocated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_POOL_IS_NULL if pool is
+ * <i>NULL</i>.
+ * @note The pool must outlive the tree map, as well as its copies and the
+ * tree maps it is split into, which all allocate their nodes from the same
+ * pool.
+ */
+bool seahorse_red_black_tree_map_i_i_init_pool(
+        struct seahorse_red_black_tree_map_i_i *object,
+        struct seahorse_red_black_tree_pool *pool);
+
 /**
  * @brief Copy initialize red black tree map.
  * @param [in] object instance to be initialized.
@@ -101,6 +121,60 @@ bool seahorse_red_black_tree_map_i_i_add(
         const struct sea_turtle_integer *key,
         const struct sea_turtle_integer *value);
 
+/**
+ * @brief Add a key-value association or retrieve the existing entry.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL if key is
+ * <i>NULL<i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is not insufficient to add key-value association to the tree map.
+ * @note <b>key</b> and <b>value</b> are copied and then placed into the map.
+ * @note If key is already present, out receives the <u>address of</u> the
+ * existing entry.
+ */
+bool seahorse_red_black_tree_map_i_i_try_add(
+        struct seahorse_red_black_tree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        const struct sea_turtle_integer *value,
+        const struct seahorse_red_black_tree_map_i_i_entry **out);
+
+/**
+ * @brief Add a key-value association taking ownership of key and value.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL if key is
+ * <i>NULL<i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is not insufficient to add key-value association to the tree map.
+ * @note On success the contents of <b>key</b> and <b>value</b> are moved
+ * into the map without being copied and both are reset, otherwise they
+ * remain owned by the caller.
+ */
+bool seahorse_red_black_tree_map_i_i_add_take(
+        struct seahorse_red_black_tree_map_i_i *object,
+        struct sea_turtle_integer *key,
+        struct sea_turtle_integer *value);
+
 /**
  * @brief Remove key-value association.
  * @param [in] object tree map instance.
@@ -112,8 +186,6 @@ bool seahorse_red_black_tree_map_i_i_add(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_remove(
         struct seahorse_red_black_tree_map_i_i *object,
@@ -131,8 +203,6 @@ bool seahorse_red_black_tree_map_i_i_remove(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL if out is
  * <i>NULL</i>.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_contains(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -153,8 +223,6 @@ bool seahorse_red_black_tree_map_i_i_contains(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_get(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -175,8 +243,6 @@ bool seahorse_red_black_tree_map_i_i_get(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_ceiling(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -197,8 +263,6 @@ bool seahorse_red_black_tree_map_i_i_ceiling(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_floor(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -219,8 +283,6 @@ bool seahorse_red_black_tree_map_i_i_floor(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_higher(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -241,8 +303,6 @@ bool seahorse_red_black_tree_map_i_i_higher(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no lower
  * value for key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_lower(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -295,8 +355,6 @@ bool seahorse_red_black_tree_map_i_i_last(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_get_entry(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -317,8 +375,6 @@ bool seahorse_red_black_tree_map_i_i_get_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_ceiling_entry(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -339,8 +395,6 @@ bool seahorse_red_black_tree_map_i_i_ceiling_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_floor_entry(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -361,8 +415,6 @@ bool seahorse_red_black_tree_map_i_i_floor_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_higher_entry(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -383,8 +435,6 @@ bool seahorse_red_black_tree_map_i_i_higher_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND if no lower
  * value for item is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_i_i_lower_entry(
         const struct seahorse_red_black_tree_map_i_i *object,
@@ -507,4 +557,133 @@ bool seahorse_red_black_tree_map_i_i_entry_value(
         const struct seahorse_red_black_tree_map_i_i_entry *entry,
         struct sea_turtle_integer **out);
 
+/**
+ * @brief Remove all the key-value associations whose keys are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The range is cut out of the tree map with two splits
+ * and a join, so that what remains is rebalanced only once.
+ */
+bool seahorse_red_black_tree_map_i_i_remove_range(
+        struct seahorse_red_black_tree_map_i_i *object,
+        const struct sea_turtle_integer *low,
+        const struct sea_turtle_integer *high);
+
+/**
+ * @brief Count the keys which are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @param [out] out receive the count of keys within the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The count follows from the positions of the ends of
+ * the range, which are found in logarithmic time.
+ */
+bool seahorse_red_black_tree_map_i_i_count_range(
+        const struct seahorse_red_black_tree_map_i_i *object,
+        const struct sea_turtle_integer *low,
+        const struct sea_turtle_integer *high,
+        uintmax_t *out);
+
+/**
+ * @brief Retrieve the entry with the given rank.
+ * @param [in] object tree map instance.
+ * @param [in] rank zero based position of the entry in ascending key order.
+ * @param [out] out receive the <u>address of</u> entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_RANK_IS_OUT_OF_BOUNDS if rank
+ * is not less than the count of entries.
+ * @note The entry is found by descending on the counts of the subtrees in
+ * logarithmic time.
+ */
+bool seahorse_red_black_tree_map_i_i_at_rank(
+        const struct seahorse_red_black_tree_map_i_i *object,
+        uintmax_t rank,
+        const struct seahorse_red_black_tree_map_i_i_entry **out);
+
+/**
+ * @brief Retrieve the rank of the given key.
+ * @param [in] object tree map instance.
+ * @param [in] key whose rank we are to retrieve.
+ * @param [out] out receive the count of keys less than key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Key does not need to be present in the tree map, and the rank is
+ * found in logarithmic time.
+ */
+bool seahorse_red_black_tree_map_i_i_rank_of(
+        const struct seahorse_red_black_tree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        uintmax_t *out);
+
+/**
+ * @brief Move the key-value associations whose keys are not less than key into
+ * another tree map.
+ * @param [in] object tree map instance.
+ * @param [in] key at which the tree map is split.
+ * @param [out] out tree map instance to be initialized with the key-value
+ * associations that were moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Keys and values are moved by relinking the entries that hold them in
+ * logarithmic time, so that previously retrieved entries of the moved key-value
+ * associations remain valid and now belong to out. Unless an argument is
+ * <i>NULL</i> out is always initialized and must be invalidated.
+ */
+bool seahorse_red_black_tree_map_i_i_split_at(
+        struct seahorse_red_black_tree_map_i_i *object,
+        const struct sea_turtle_integer *key,
+        struct seahorse_red_black_tree_map_i_i *out);
+
+/**
+ * @brief Move all the key-value associations of other into the tree map.
+ * @param [in] object tree map instance.
+ * @param [in] other tree map instance whose key-value associations are moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEYS_OVERLAP if the last key of
+ * the tree map is not less than the first key of other.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED if
+ * other does not share the pool of the tree map and there is insufficient
+ * memory to move its key-value associations.
+ * @note Keys and values are moved rather than copied and other is left empty.
+ * If both share a pool the entries of other are relinked in logarithmic time
+ * and remain valid, otherwise they are moved into new entries. On failure
+ * neither tree map is changed.
+ */
+bool seahorse_red_black_tree_map_i_i_join(
+        struct seahorse_red_black_tree_map_i_i *object,
+        struct seahorse_red_black_tree_map_i_i *other);
+
 #endif /* _SEAHORSE_RED_BLACK_TREE_MAP_I_I_H_ */
@@ -4,7 +4,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <coral.h>
+#include "red_black_tree.h"
 
 #define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL               1
 #define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL                  2
@@ -15,9 +15,15 @@
 #define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_ENTRY_IS_NULL                7
 #define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_END_OF_SEQUENCE              8
 #define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OTHER_IS_NULL                9
+#define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_COUNT_IS_ZERO                10
+#define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_IS_NULL                 11
+#define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_VALUES_IS_NULL               12
+#define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_ARE_NOT_SORTED          13
+#define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_POOL_IS_NULL                 14
+#define SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_OVERLAP                 15
 
 struct seahorse_red_black_tree_map_ni_p {
-    struct coral_red_black_tree_map map;
+    struct seahorse_red_black_tree tree;
 };
 
 struct seahorse_red_black_tree_map_ni_p_entry;
@@ -32,6 +38,23 @@ struct seahorse_red_black_tree_map_ni_p_entry;
 bool seahorse_red_black_tree_map_ni_p_init(
         struct seahorse_red_black_tree_map_ni_p *object);
 
+/**
+ * @brief Initialize red black tree map with nodes from a pool.
+ * @param [in] object instance to be initialized.
+ * @param [in] pool from which the nodes of the tree map are allocated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_POOL_IS_NULL if pool is
+ * <i>NULL</i>.
+ * @note The pool must outlive the tree map, as well as its copies and the
+ * tree maps it is split into, which all allocate their nodes from the same
+ * pool.
+ */
+bool seahorse_red_black_tree_map_ni_p_init_pool(
+        struct seahorse_red_black_tree_map_ni_p *object,
+        struct seahorse_red_black_tree_pool *pool);
+
 /**
  * @brief Copy initialize red black tree map.
  * @param [in] object instance to be initialized.
@@ -48,6 +71,34 @@ bool seahorse_red_black_tree_map_ni_p_init_red_black_tree_map_ni_p(
         struct seahorse_red_black_tree_map_ni_p *object,
         const struct seahorse_red_black_tree_map_ni_p *other);
 
+/**
+ * @brief Initialize red black tree map from sorted key-value associations.
+ * @param [in] object instance to be initialized.
+ * @param [in] count number of key-value associations.
+ * @param [in] keys in strictly ascending order.
+ * @param [in] values associated with the key at the same index.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL if object
+ * is <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_COUNT_IS_ZERO if count is
+ * zero.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_IS_NULL if keys is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_ARE_NOT_SORTED if keys
+ * are not in strictly ascending order.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to initialize the tree map.
+ * @note The ordering of keys is verified with a single pass, after which the
+ * tree map is built from them in linear time without any further comparisons.
+ */
+bool seahorse_red_black_tree_map_ni_p_init_sorted(
+        struct seahorse_red_black_tree_map_ni_p *object,
+        uintmax_t count,
+        const uintmax_t *keys,
+        const void **values);
+
 /**
  * @brief Invalidate red black tree map.
  * <p>All the entries contained within the tree map will have the given <i>on
@@ -96,6 +147,30 @@ bool seahorse_red_black_tree_map_ni_p_add(
         uintmax_t key,
         const void *value);
 
+/**
+ * @brief Add a key-value association or retrieve the existing entry.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL if object
+ * is <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
+ * if there is insufficient memory to add key-value association to the tree map.
+ * @note If key is already present, out receives the <u>address of</u> the
+ * existing entry.
+ */
+bool seahorse_red_black_tree_map_ni_p_try_add(
+        struct seahorse_red_black_tree_map_ni_p *object,
+        uintmax_t key,
+        const void *value,
+        const struct seahorse_red_black_tree_map_ni_p_entry **out);
+
 /**
  * @brief Remove key-value association.
  * @param [in] object tree map instance.
@@ -105,8 +180,6 @@ bool seahorse_red_black_tree_map_ni_p_add(
  * is <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_remove(
         struct seahorse_red_black_tree_map_ni_p *object,
@@ -122,8 +195,6 @@ bool seahorse_red_black_tree_map_ni_p_remove(
  * is <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL if out is
  * <i>NULL</i>.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_contains(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -140,8 +211,6 @@ bool seahorse_red_black_tree_map_ni_p_contains(
  * is <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_set(
         struct seahorse_red_black_tree_map_ni_p *object,
@@ -160,8 +229,6 @@ bool seahorse_red_black_tree_map_ni_p_set(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_get(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -180,8 +247,6 @@ bool seahorse_red_black_tree_map_ni_p_get(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_ceiling(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -200,8 +265,6 @@ bool seahorse_red_black_tree_map_ni_p_ceiling(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_floor(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -220,8 +283,6 @@ bool seahorse_red_black_tree_map_ni_p_floor(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_higher(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -240,8 +301,6 @@ bool seahorse_red_black_tree_map_ni_p_higher(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if no lower
  * value for key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_lower(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -292,8 +351,6 @@ bool seahorse_red_black_tree_map_ni_p_last(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_get_entry(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -312,8 +369,6 @@ bool seahorse_red_black_tree_map_ni_p_get_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_ceiling_entry(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -332,8 +387,6 @@ bool seahorse_red_black_tree_map_ni_p_ceiling_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_floor_entry(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -352,8 +405,6 @@ bool seahorse_red_black_tree_map_ni_p_floor_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_higher_entry(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -372,8 +423,6 @@ bool seahorse_red_black_tree_map_ni_p_higher_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_NOT_FOUND if no lower
  * value for item is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED
- * if there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_ni_p_lower_entry(
         const struct seahorse_red_black_tree_map_ni_p *object,
@@ -513,4 +562,87 @@ bool seahorse_red_black_tree_map_ni_p_entry_set_value(
         const struct seahorse_red_black_tree_map_ni_p_entry *entry,
         const void *value);
 
+/**
+ * @brief Remove all the key-value associations whose keys are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The range is cut out of the tree map with two splits
+ * and a join, so that what remains is rebalanced only once.
+ */
+bool seahorse_red_black_tree_map_ni_p_remove_range(
+        struct seahorse_red_black_tree_map_ni_p *object,
+        uintmax_t low,
+        uintmax_t high);
+
+/**
+ * @brief Count the keys which are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @param [out] out receive the count of keys within the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The count follows from the positions of the ends of
+ * the range, which are found in logarithmic time.
+ */
+bool seahorse_red_black_tree_map_ni_p_count_range(
+        const struct seahorse_red_black_tree_map_ni_p *object,
+        uintmax_t low,
+        uintmax_t high,
+        uintmax_t *out);
+
+/**
+ * @brief Move the key-value associations whose keys are not less than key into
+ * another tree map.
+ * @param [in] object tree map instance.
+ * @param [in] key at which the tree map is split.
+ * @param [out] out tree map instance to be initialized with the key-value
+ * associations that were moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Keys and values are moved by relinking the entries that hold them in
+ * logarithmic time, so that previously retrieved entries of the moved key-value
+ * associations remain valid and now belong to out. Unless an argument is
+ * <i>NULL</i> out is always initialized and must be invalidated.
+ */
+bool seahorse_red_black_tree_map_ni_p_split_at(
+        struct seahorse_red_black_tree_map_ni_p *object,
+        uintmax_t key,
+        struct seahorse_red_black_tree_map_ni_p *out);
+
+/**
+ * @brief Move all the key-value associations of other into the tree map.
+ * @param [in] object tree map instance.
+ * @param [in] other tree map instance whose key-value associations are moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_OVERLAP if the last key
+ * of the tree map is not less than the first key of other.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * other does not share the pool of the tree map and there is insufficient
+ * memory to move its key-value associations.
+ * @note Keys and values are moved rather than copied and other is left empty.
+ * If both share a pool the entries of other are relinked in logarithmic time
+ * and remain valid, otherwise they are moved into new entries. On failure
+ * neither tree map is changed.
+ */
+bool seahorse_red_black_tree_map_ni_p_join(
+        struct seahorse_red_black_tree_map_ni_p *object,
+        struct seahorse_red_black_tree_map_ni_p *other);
+
 #endif /* _SEAHORSE_RED_BLACK_TREE_MAP_NI_P_H_ */
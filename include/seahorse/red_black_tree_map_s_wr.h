@@ -4,7 +4,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <coral.h>
+#include "red_black_tree.h"
 
 struct sea_turtle_string;
 struct triggerfish_weak;
@@ -20,9 +20,11 @@ struct triggerfish_weak;
 #define SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_ENTRY_IS_NULL                9
 #define SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_END_OF_SEQUENCE              10
 #define SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OTHER_IS_NULL                11
+#define SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_POOL_IS_NULL                 12
+#define SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEYS_OVERLAP                 13
 
 struct seahorse_red_black_tree_map_s_wr {
-    struct coral_red_black_tree_map map;
+    struct seahorse_red_black_tree tree;
 };
 
 struct seahorse_red_black_tree_map_s_wr_entry;
@@ -37,6 +39,23 @@ struct seahorse_red_black_tree_map_s_wr_entry;
 bool seahorse_red_black_tree_map_s_wr_init(
         struct seahorse_red_black_tree_map_s_wr *object);
 
+/**
+ * @brief Initialize red black tree map with nodes from a pool.
+ * @param [in] object instance to be initialized.
+ * @param [in] pool from which the nodes of the tree map are allocated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_POOL_IS_NULL if pool is
+ * <i>NULL</i>.
+ * @note The pool must outlive the tree map, as well as its copies and the
+ * tree maps it is split into, which all allocate their nodes from the same
+ * pool.
+ */
+bool seahorse_red_black_tree_map_s_wr_init_pool(
+        struct seahorse_red_black_tree_map_s_wr *object,
+        struct seahorse_red_black_tree_pool *pool);
+
 /**
  * @brief Copy initialize red black tree map.
  * @param [in] object instance to be initialized.
@@ -102,6 +121,60 @@ bool seahorse_red_black_tree_map_s_wr_add(
         const struct sea_turtle_string *key,
         const struct triggerfish_weak *value);
 
+/**
+ * @brief Add a key-value association or retrieve the existing entry.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL<i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the tree map.
+ * @note <b>key</b> and <b>value</b> are copied and then placed into the map.
+ * @note If key is already present, out receives the <u>address of</u> the
+ * existing entry.
+ */
+bool seahorse_red_black_tree_map_s_wr_try_add(
+        struct seahorse_red_black_tree_map_s_wr *object,
+        const struct sea_turtle_string *key,
+        const struct triggerfish_weak *value,
+        const struct seahorse_red_black_tree_map_s_wr_entry **out);
+
+/**
+ * @brief Add a key-value association taking ownership of key.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL<i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the tree map.
+ * @note On success the contents of <b>key</b> are moved into the map
+ * without being copied and it is reset, otherwise it remains owned by the
+ * caller. <b>value</b> is copied and then placed into the map.
+ */
+bool seahorse_red_black_tree_map_s_wr_add_take(
+        struct seahorse_red_black_tree_map_s_wr *object,
+        struct sea_turtle_string *key,
+        const struct triggerfish_weak *value);
+
 /**
  * @brief Remove key-value association.
  * @param [in] object tree map instance.
@@ -113,13 +186,31 @@ bool seahorse_red_black_tree_map_s_wr_add(
  * <i>NULL<i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_remove(
         struct seahorse_red_black_tree_map_s_wr *object,
         const struct sea_turtle_string *key);
 
+/**
+ * @brief Remove key-value association given as raw bytes.
+ * @param [in] object tree map instance.
+ * @param [in] key for which we would like the key-value association removed.
+ * @param [in] size of key in bytes.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL<i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @note <b>key</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_map_s_wr_remove_chars(
+        struct seahorse_red_black_tree_map_s_wr *object,
+        const char *key,
+        size_t size);
+
 /**
  * @brief Check if tree map contains the given key.
  * @param [in] object tree map instance.
@@ -132,14 +223,34 @@ bool seahorse_red_black_tree_map_s_wr_remove(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
  * <i>NULL</i>.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_contains(
         const struct seahorse_red_black_tree_map_s_wr *object,
         const struct sea_turtle_string *key,
         bool *out);
 
+/**
+ * @brief Check if tree map contains the given key in raw bytes.
+ * @param [in] object tree map instance.
+ * @param [in] key to check if it is present.
+ * @param [in] size of key in bytes.
+ * @param [out] out true if key is present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object
+ * is <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note <b>key</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_map_s_wr_contains_chars(
+        const struct seahorse_red_black_tree_map_s_wr *object,
+        const char *key,
+        size_t size,
+        bool *out);
+
 /**
  * @brief Set the value for the given key.
  * @param [in] object tree map instance.
@@ -177,14 +288,36 @@ bool seahorse_red_black_tree_map_s_wr_set(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_get(
         const struct seahorse_red_black_tree_map_s_wr *object,
         const struct sea_turtle_string *key,
         const struct triggerfish_weak **out);
 
+/**
+ * @brief Retrieve the value for the given key in raw bytes.
+ * @param [in] object tree map instance.
+ * @param [in] key used to get the associated value.
+ * @param [in] size of key in bytes.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key could
+ * not be found.
+ * @note <b>key</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_map_s_wr_get_chars(
+        const struct seahorse_red_black_tree_map_s_wr *object,
+        const char *key,
+        size_t size,
+        const struct triggerfish_weak **out);
+
 /**
  * @brief Retrieve the value for the given key or the next higher key.
  * @param [in] object tree map instance.
@@ -199,14 +332,37 @@ bool seahorse_red_black_tree_map_s_wr_get(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_ceiling(
         const struct seahorse_red_black_tree_map_s_wr *object,
         const struct sea_turtle_string *key,
         const struct triggerfish_weak **out);
 
+/**
+ * @brief Retrieve the value for the given key or the next higher key in raw
+ * bytes.
+ * @param [in] object tree map instance.
+ * @param [in] key to find or the next higher key.
+ * @param [in] size of key in bytes.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key nor a
+ * higher key is in the tree map instance.
+ * @note <b>key</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_map_s_wr_ceiling_chars(
+        const struct seahorse_red_black_tree_map_s_wr *object,
+        const char *key,
+        size_t size,
+        const struct triggerfish_weak **out);
+
 /**
  * @brief Retrieve the value for the given key or the next lower key.
  * @param [in] object tree map instance.
@@ -221,14 +377,37 @@ bool seahorse_red_black_tree_map_s_wr_ceiling(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_floor(
         const struct seahorse_red_black_tree_map_s_wr *object,
         const struct sea_turtle_string *key,
         const struct triggerfish_weak **out);
 
+/**
+ * @brief Retrieve the value for the given key or the next lower key in raw
+ * bytes.
+ * @param [in] object tree map instance.
+ * @param [in] key to find or the next lower key.
+ * @param [in] size of key in bytes.
+ * @param [out] out receive the value.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key nor a
+ * lower key is in the tree map instance.
+ * @note <b>key</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_map_s_wr_floor_chars(
+        const struct seahorse_red_black_tree_map_s_wr *object,
+        const char *key,
+        size_t size,
+        const struct triggerfish_weak **out);
+
 /**
  * @brief Retrieve the value for the next higher key.
  * @param [in] object tree map instance.
@@ -243,8 +422,6 @@ bool seahorse_red_black_tree_map_s_wr_floor(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_higher(
         const struct seahorse_red_black_tree_map_s_wr *object,
@@ -265,8 +442,6 @@ bool seahorse_red_black_tree_map_s_wr_higher(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if no lower
  * value for key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_lower(
         const struct seahorse_red_black_tree_map_s_wr *object,
@@ -319,8 +494,6 @@ bool seahorse_red_black_tree_map_s_wr_last(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_get_entry(
         const struct seahorse_red_black_tree_map_s_wr *object,
@@ -341,8 +514,6 @@ bool seahorse_red_black_tree_map_s_wr_get_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_ceiling_entry(
         const struct seahorse_red_black_tree_map_s_wr *object,
@@ -363,8 +534,6 @@ bool seahorse_red_black_tree_map_s_wr_ceiling_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_floor_entry(
         const struct seahorse_red_black_tree_map_s_wr *object,
@@ -385,8 +554,6 @@ bool seahorse_red_black_tree_map_s_wr_floor_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_higher_entry(
         const struct seahorse_red_black_tree_map_s_wr *object,
@@ -407,8 +574,6 @@ bool seahorse_red_black_tree_map_s_wr_higher_entry(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND if no lower
  * value for item is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_s_wr_lower_entry(
         const struct seahorse_red_black_tree_map_s_wr *object,
@@ -553,4 +718,93 @@ bool seahorse_red_black_tree_map_s_wr_entry_set_value(
         const struct seahorse_red_black_tree_map_s_wr_entry *entry,
         const struct triggerfish_weak *value);
 
+/**
+ * @brief Remove all the key-value associations whose keys are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The range is cut out of the tree map with two splits
+ * and a join, so that what remains is rebalanced only once.
+ */
+bool seahorse_red_black_tree_map_s_wr_remove_range(
+        struct seahorse_red_black_tree_map_s_wr *object,
+        const struct sea_turtle_string *low,
+        const struct sea_turtle_string *high);
+
+/**
+ * @brief Count the keys which are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @param [out] out receive the count of keys within the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The count follows from the positions of the ends of
+ * the range, which are found in logarithmic time.
+ */
+bool seahorse_red_black_tree_map_s_wr_count_range(
+        const struct seahorse_red_black_tree_map_s_wr *object,
+        const struct sea_turtle_string *low,
+        const struct sea_turtle_string *high,
+        uintmax_t *out);
+
+/**
+ * @brief Move the key-value associations whose keys are not less than key into
+ * another tree map.
+ * @param [in] object tree map instance.
+ * @param [in] key at which the tree map is split.
+ * @param [out] out tree map instance to be initialized with the key-value
+ * associations that were moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Keys and values are moved by relinking the entries that hold them in
+ * logarithmic time, so that previously retrieved entries of the moved key-value
+ * associations remain valid and now belong to out. Unless an argument is
+ * <i>NULL</i> out is always initialized and must be invalidated.
+ */
+bool seahorse_red_black_tree_map_s_wr_split_at(
+        struct seahorse_red_black_tree_map_s_wr *object,
+        const struct sea_turtle_string *key,
+        struct seahorse_red_black_tree_map_s_wr *out);
+
+/**
+ * @brief Move all the key-value associations of other into the tree map.
+ * @param [in] object tree map instance.
+ * @param [in] other tree map instance whose key-value associations are moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEYS_OVERLAP if the last key
+ * of the tree map is not less than the first key of other.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED if
+ * other does not share the pool of the tree map and there is insufficient
+ * memory to move its key-value associations.
+ * @note Keys and values are moved rather than copied and other is left empty.
+ * If both share a pool the entries of other are relinked in logarithmic time
+ * and remain valid, otherwise they are moved into new entries. On failure
+ * neither tree map is changed.
+ */
+bool seahorse_red_black_tree_map_s_wr_join(
+        struct seahorse_red_black_tree_map_s_wr *object,
+        struct seahorse_red_black_tree_map_s_wr *other);
+
 #endif /* _SEAHORSE_RED_BLACK_TREE_MAP_S_WR_H_ */
@@ -4,7 +4,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <coral.h>
+#include "red_black_tree.h"
 
 struct triggerfish_strong;
 
@@ -21,9 +21,11 @@ struct triggerfish_strong;
 #define SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_ENTRY_IS_NULL               11
 #define SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_END_OF_SEQUENCE             12
 #define SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OTHER_IS_NULL               13
+#define SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_POOL_IS_NULL                14
+#define SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEYS_OVERLAP                15
 
 struct seahorse_red_black_tree_map_sr_sr {
-    struct coral_red_black_tree_map map;
+    struct seahorse_red_black_tree tree;
 };
 
 struct seahorse_red_black_tree_map_sr_sr_entry;
@@ -46,6 +48,31 @@ bool seahorse_red_black_tree_map_sr_sr_init(
         int (*compare)(const struct triggerfish_strong **first,
                        const struct triggerfish_strong **second));
 
+/**
+ * @brief Initialize red black tree map with nodes from a pool.
+ * @param [in] object instance to be initialized.
+ * @param [in] compare comparison which must return an integer less than,
+ * equal to, or greater than zero if the <u>first key</u> is considered
+ * to be respectively less than, equal to, or greater than the <u>second
+ * key</u>.
+ * @param [in] pool from which the nodes of the tree map are allocated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_COMPARE_IS_NULL if compare
+ * is <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_POOL_IS_NULL if pool is
+ * <i>NULL</i>.
+ * @note The pool must outlive the tree map, as well as its copies and the
+ * tree maps it is split into, which all allocate their nodes from the same
+ * pool.
+ */
+bool seahorse_red_black_tree_map_sr_sr_init_pool(
+        struct seahorse_red_black_tree_map_sr_sr *object,
+        int (*compare)(const struct triggerfish_strong **first,
+                       const struct triggerfish_strong **second),
+        struct seahorse_red_black_tree_pool *pool);
+
 /**
  * @brief Copy initialize red black tree map.
  * @param [in] object instance to be initialized.
@@ -113,6 +140,37 @@ bool seahorse_red_black_tree_map_sr_sr_add(
         struct triggerfish_strong *key,
         struct triggerfish_strong *value);
 
+/**
+ * @brief Add a key-value association or retrieve the existing entry.
+ * @param [in] object tree map instance.
+ * @param [in] key to which the value will be associated with.
+ * @param [in] value that will returned from a lookup of key.
+ * @param [out] out receive the <u>address of</u> the entry for key.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL<i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID if the
+ * key's reference has been invalidated.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_VALUE_IS_INVALID if the
+ * value's reference has been invalidated.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_ALREADY_EXISTS if the
+ * key is already present in the tree map.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add key-value association to the tree map.
+ * @note <b>key</b> and <b>value</b> are retained and then inserted.
+ * @note If key is already present, out receives the <u>address of</u> the
+ * existing entry.
+ */
+bool seahorse_red_black_tree_map_sr_sr_try_add(
+        struct seahorse_red_black_tree_map_sr_sr *object,
+        struct triggerfish_strong *key,
+        struct triggerfish_strong *value,
+        const struct seahorse_red_black_tree_map_sr_sr_entry **out);
+
 /**
  * @brief Remove key-value association.
  * @param [in] object tree map instance.
@@ -126,8 +184,6 @@ bool seahorse_red_black_tree_map_sr_sr_add(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  */
 bool seahorse_red_black_tree_map_sr_sr_remove(
         struct seahorse_red_black_tree_map_sr_sr *object,
@@ -147,8 +203,6 @@ bool seahorse_red_black_tree_map_sr_sr_remove(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID if the
  * key's reference has been invalidated.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  */
 bool seahorse_red_black_tree_map_sr_sr_contains(
         const struct seahorse_red_black_tree_map_sr_sr *object,
@@ -171,8 +225,6 @@ bool seahorse_red_black_tree_map_sr_sr_contains(
  * value's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  * @note <b>value</b> is retained and then it is inserted.
  */
 bool seahorse_red_black_tree_map_sr_sr_set(
@@ -196,8 +248,6 @@ bool seahorse_red_black_tree_map_sr_sr_set(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  * @note <b>out</b> must be released once done with it.
  */
 bool seahorse_red_black_tree_map_sr_sr_get(
@@ -221,8 +271,6 @@ bool seahorse_red_black_tree_map_sr_sr_get(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  * @note <b>out</b> must be released once done with it.
  */
 bool seahorse_red_black_tree_map_sr_sr_ceiling(
@@ -246,8 +294,6 @@ bool seahorse_red_black_tree_map_sr_sr_ceiling(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  * @note <b>out</b> must be released once done with it.
  */
 bool seahorse_red_black_tree_map_sr_sr_floor(
@@ -271,8 +317,6 @@ bool seahorse_red_black_tree_map_sr_sr_floor(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  * @note <b>out</b> must be released once done with it.
  */
 bool seahorse_red_black_tree_map_sr_sr_higher(
@@ -296,8 +340,6 @@ bool seahorse_red_black_tree_map_sr_sr_higher(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if no lower
  * value for key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find key-value association.
  * @note <b>out</b> must be released once done with it.
  */
 bool seahorse_red_black_tree_map_sr_sr_lower(
@@ -387,8 +429,6 @@ bool seahorse_red_black_tree_map_sr_sr_prev_entry(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if key could
  * not be found.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_sr_sr_get_entry(
         const struct seahorse_red_black_tree_map_sr_sr *object,
@@ -411,8 +451,6 @@ bool seahorse_red_black_tree_map_sr_sr_get_entry(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if key nor a
  * higher key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_sr_sr_ceiling_entry(
         const struct seahorse_red_black_tree_map_sr_sr *object,
@@ -435,8 +473,6 @@ bool seahorse_red_black_tree_map_sr_sr_ceiling_entry(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND  if key nor a
  * lower key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_sr_sr_floor_entry(
         const struct seahorse_red_black_tree_map_sr_sr *object,
@@ -459,8 +495,6 @@ bool seahorse_red_black_tree_map_sr_sr_floor_entry(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if no higher
  * key is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_sr_sr_higher_entry(
         const struct seahorse_red_black_tree_map_sr_sr *object,
@@ -483,8 +517,6 @@ bool seahorse_red_black_tree_map_sr_sr_higher_entry(
  * key's reference has been invalidated.
  * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND if no lower
  * value for item is in the tree map instance.
- * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the key-value association.
  */
 bool seahorse_red_black_tree_map_sr_sr_lower_entry(
         const struct seahorse_red_black_tree_map_sr_sr *object,
@@ -598,4 +630,102 @@ bool seahorse_red_black_tree_map_sr_sr_entry_set_value(
         const struct seahorse_red_black_tree_map_sr_sr_entry *entry,
         struct triggerfish_strong *value);
 
+/**
+ * @brief Remove all the key-value associations whose keys are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID if either
+ * low's or high's reference has been invalidated.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The range is cut out of the tree map with two splits
+ * and a join, so that what remains is rebalanced only once.
+ */
+bool seahorse_red_black_tree_map_sr_sr_remove_range(
+        struct seahorse_red_black_tree_map_sr_sr *object,
+        struct triggerfish_strong *low,
+        struct triggerfish_strong *high);
+
+/**
+ * @brief Count the keys which are within a range.
+ * @param [in] object tree map instance.
+ * @param [in] low smallest key of the range.
+ * @param [in] high largest key of the range.
+ * @param [out] out receive the count of keys within the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID if either
+ * low's or high's reference has been invalidated.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The count follows from the positions of the ends of
+ * the range, which are found in logarithmic time.
+ */
+bool seahorse_red_black_tree_map_sr_sr_count_range(
+        const struct seahorse_red_black_tree_map_sr_sr *object,
+        struct triggerfish_strong *low,
+        struct triggerfish_strong *high,
+        uintmax_t *out);
+
+/**
+ * @brief Move the key-value associations whose keys are not less than key into
+ * another tree map.
+ * @param [in] object tree map instance.
+ * @param [in] key at which the tree map is split.
+ * @param [out] out tree map instance to be initialized with the key-value
+ * associations that were moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL if key is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID if key's
+ * reference has been invalidated.
+ * @note Keys and values are moved by relinking the entries that hold them in
+ * logarithmic time, so that previously retrieved entries of the moved key-value
+ * associations remain valid and now belong to out. Unless an argument is
+ * <i>NULL</i> out is always initialized and must be invalidated.
+ * @note out is initialized with the compare function of object.
+ */
+bool seahorse_red_black_tree_map_sr_sr_split_at(
+        struct seahorse_red_black_tree_map_sr_sr *object,
+        struct triggerfish_strong *key,
+        struct seahorse_red_black_tree_map_sr_sr *out);
+
+/**
+ * @brief Move all the key-value associations of other into the tree map.
+ * @param [in] object tree map instance.
+ * @param [in] other tree map instance whose key-value associations are moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEYS_OVERLAP if the last key
+ * of the tree map is not less than the first key of other.
+ * @throws SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED if
+ * other does not share the pool of the tree map and there is insufficient
+ * memory to move its key-value associations.
+ * @note Keys and values are moved rather than copied and other is left empty.
+ * If both share a pool the entries of other are relinked in logarithmic time
+ * and remain valid, otherwise they are moved into new entries. On failure
+ * neither tree map is changed.
+ * @note Both tree maps must have been initialized with the same compare
+ * function.
+ */
+bool seahorse_red_black_tree_map_sr_sr_join(
+        struct seahorse_red_black_tree_map_sr_sr *object,
+        struct seahorse_red_black_tree_map_sr_sr *other);
+
 #endif /* _SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_H_ */
@@ -4,7 +4,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <coral.h>
+#include "red_black_tree.h"
 
 #include "sorted_set_i.h"
 
@@ -30,11 +30,19 @@ struct sea_turtle_integer;
     SEAHORSE_SORTED_SET_I_ERROR_VALUE_NOT_FOUND
 #define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND \
     SEAHORSE_SORTED_SET_I_ERROR_ITEM_NOT_FOUND
-#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL               11
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL \
+    SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_COUNT_IS_ZERO               12
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_IS_NULL              13
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_ARE_NOT_SORTED       14
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL                15
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL               16
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_POOL_IS_NULL                17
+#define SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_OVERLAP              18
 
 struct seahorse_red_black_tree_set_i {
     const struct seahorse_sorted_set_i *sorted_set_i;
-    struct coral_red_black_tree_set set;
+    struct seahorse_red_black_tree tree;
 };
 
 /**
@@ -47,6 +55,23 @@ struct seahorse_red_black_tree_set_i {
 bool seahorse_red_black_tree_set_i_init(
         struct seahorse_red_black_tree_set_i *object);
 
+/**
+ * @brief Initialize red black tree set with nodes from a pool.
+ * @param [in] object instance to be initialized.
+ * @param [in] pool from which the nodes of the tree set are allocated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_POOL_IS_NULL if pool is
+ * <i>NULL</i>.
+ * @note The pool must outlive the tree set, as well as its copies and the
+ * tree sets it is split into, which all allocate their nodes from the same
+ * pool.
+ */
+bool seahorse_red_black_tree_set_i_init_pool(
+        struct seahorse_red_black_tree_set_i *object,
+        struct seahorse_red_black_tree_pool *pool);
+
 /**
  * @brief Copy-initialize red black tree set.
  * @param [in] object instance to be initialized.
@@ -64,6 +89,31 @@ bool seahorse_red_black_tree_set_i_init_set_i(
         struct seahorse_red_black_tree_set_i *object,
         const struct seahorse_stream_i *other);
 
+/**
+ * @brief Initialize red black tree set from sorted values.
+ * @param [in] object instance to be initialized.
+ * @param [in] count number of values.
+ * @param [in] values in strictly ascending order.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_COUNT_IS_ZERO if count is
+ * zero.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_ARE_NOT_SORTED if
+ * values are not in strictly ascending order.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to initialize the tree set.
+ * @note The ordering of values is verified with a single pass, after which the
+ * tree set is built from them in linear time without any further comparisons.
+ * <p>Each <b>value</b> is copied and then placed into the set.</p>
+ */
+bool seahorse_red_black_tree_set_i_init_sorted(
+        struct seahorse_red_black_tree_set_i *object,
+        uintmax_t count,
+        const struct sea_turtle_integer *values);
+
 /**
  * @brief Invalidate red black tree set.
  * <p>The actual <u>tree set instance is not deallocated</u> since it may
@@ -109,6 +159,27 @@ bool seahorse_red_black_tree_set_i_add(
         struct seahorse_red_black_tree_set_i *object,
         const struct sea_turtle_integer *value);
 
+/**
+ * @brief Add value to the tree set taking ownership of it.
+ * @param [in] object tree set instance.
+ * @param [in] value to be added.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_ALREADY_EXISTS if value is
+ * already present in the tree set.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add value to the tree set.
+ * @note On success the contents of <b>value</b> are moved into the set
+ * without being copied and it is reset, otherwise it remains owned by
+ * the caller.
+ */
+bool seahorse_red_black_tree_set_i_add_take(
+        struct seahorse_red_black_tree_set_i *object,
+        struct sea_turtle_integer *value);
+
 /**
  * @brief Remove value from the tree set.
  * @param [in] object tree set instance.
@@ -120,8 +191,6 @@ bool seahorse_red_black_tree_set_i_add(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_NOT_FOUND if value is not
  * in the tree set instance.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_i_remove(
         struct seahorse_red_black_tree_set_i *object,
@@ -139,8 +208,6 @@ bool seahorse_red_black_tree_set_i_remove(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL if out is
  * <i>NULL</i>.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_i_contains(
         const struct seahorse_red_black_tree_set_i *object,
@@ -161,8 +228,6 @@ bool seahorse_red_black_tree_set_i_contains(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND if there is no
  * item that matched value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_i_get(
         const struct seahorse_red_black_tree_set_i *object,
@@ -183,8 +248,6 @@ bool seahorse_red_black_tree_set_i_get(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND if no item
  * matched value or a higher value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_i_ceiling(
         const struct seahorse_red_black_tree_set_i *object,
@@ -205,8 +268,6 @@ bool seahorse_red_black_tree_set_i_ceiling(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND if no item
  * matched value or a lower value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_i_floor(
         const struct seahorse_red_black_tree_set_i *object,
@@ -227,8 +288,6 @@ bool seahorse_red_black_tree_set_i_floor(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND if there is no
  * greater value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_i_higher(
         const struct seahorse_red_black_tree_set_i *object,
@@ -249,8 +308,6 @@ bool seahorse_red_black_tree_set_i_higher(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND if there is no
  * lower value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_i_lower(
         const struct seahorse_red_black_tree_set_i *object,
@@ -335,4 +392,182 @@ bool seahorse_red_black_tree_set_i_prev(
         const struct sea_turtle_integer *item,
         const struct sea_turtle_integer **out);
 
+/**
+ * @brief Initialize red black tree set with the union of two tree sets.
+ * @param [in] object instance to be initialized.
+ * @param [in] left tree set whose values are to be included.
+ * @param [in] right tree set whose values are to be included.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL if left is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL if right is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if there
+ * is insufficient memory to initialize the tree set.
+ * @note left and right are walked in order side by side to count the values
+ * and then to build the tree set from them, which takes O(n + m) in total.
+ */
+bool seahorse_red_black_tree_set_i_init_union(
+        struct seahorse_red_black_tree_set_i *object,
+        const struct seahorse_red_black_tree_set_i *left,
+        const struct seahorse_red_black_tree_set_i *right);
+
+/**
+ * @brief Initialize red black tree set with the intersection of two tree sets.
+ * @param [in] object instance to be initialized.
+ * @param [in] left tree set whose values are to be included if present in
+ * right.
+ * @param [in] right tree set whose values are to be included if present in
+ * left.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL if left is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL if right is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if there
+ * is insufficient memory to initialize the tree set.
+ * @note left and right are walked in order side by side to count the values
+ * and then to build the tree set from them, which takes O(n + m) in total.
+ */
+bool seahorse_red_black_tree_set_i_init_intersection(
+        struct seahorse_red_black_tree_set_i *object,
+        const struct seahorse_red_black_tree_set_i *left,
+        const struct seahorse_red_black_tree_set_i *right);
+
+/**
+ * @brief Initialize red black tree set with the difference of two tree sets.
+ * @param [in] object instance to be initialized.
+ * @param [in] left tree set whose values are to be included unless present in
+ * right.
+ * @param [in] right tree set whose values are to be excluded.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL if left is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL if right is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if there
+ * is insufficient memory to initialize the tree set.
+ * @note left and right are walked in order side by side to count the values
+ * and then to build the tree set from them, which takes O(n + m) in total.
+ */
+bool seahorse_red_black_tree_set_i_init_difference(
+        struct seahorse_red_black_tree_set_i *object,
+        const struct seahorse_red_black_tree_set_i *left,
+        const struct seahorse_red_black_tree_set_i *right);
+
+/**
+ * @brief Check if every value of the tree set is present in other.
+ * @param [in] object tree set instance.
+ * @param [in] other tree set to check against.
+ * @param [out] out receive true if object is a subset of other, otherwise
+ * false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both tree sets are walked in order side by side, so the check takes
+ * O(n + m).
+ */
+bool seahorse_red_black_tree_set_i_is_subset(
+        const struct seahorse_red_black_tree_set_i *object,
+        const struct seahorse_red_black_tree_set_i *other,
+        bool *out);
+
+/**
+ * @brief Remove all the values which are within a range.
+ * @param [in] object tree set instance.
+ * @param [in] low smallest value of the range.
+ * @param [in] high largest value of the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The range is cut out of the tree set with two splits
+ * and a join, so that what remains is rebalanced only once.
+ */
+bool seahorse_red_black_tree_set_i_remove_range(
+        struct seahorse_red_black_tree_set_i *object,
+        const struct sea_turtle_integer *low,
+        const struct sea_turtle_integer *high);
+
+/**
+ * @brief Count the values which are within a range.
+ * @param [in] object tree set instance.
+ * @param [in] low smallest value of the range.
+ * @param [in] high largest value of the range.
+ * @param [out] out receive the count of values within the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The count follows from the positions of the ends of
+ * the range, which are found in logarithmic time.
+ */
+bool seahorse_red_black_tree_set_i_count_range(
+        const struct seahorse_red_black_tree_set_i *object,
+        const struct sea_turtle_integer *low,
+        const struct sea_turtle_integer *high,
+        uintmax_t *out);
+
+/**
+ * @brief Move the values which are not less than value into another tree set.
+ * @param [in] object tree set instance.
+ * @param [in] value at which the tree set is split.
+ * @param [out] out tree set instance to be initialized with the values that
+ * were moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Values are moved by relinking the items that hold them in logarithmic
+ * time, so that previously retrieved items of the moved values remain valid and
+ * now belong to out. Unless an argument is <i>NULL</i> out is always
+ * initialized and must be invalidated.
+ */
+bool seahorse_red_black_tree_set_i_split_at(
+        struct seahorse_red_black_tree_set_i *object,
+        const struct sea_turtle_integer *value,
+        struct seahorse_red_black_tree_set_i *out);
+
+/**
+ * @brief Move all the values of other into the tree set.
+ * @param [in] object tree set instance.
+ * @param [in] other tree set instance whose values are moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_OVERLAP if the last value
+ * of the tree set is not less than the first value of other.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if other
+ * does not share the pool of the tree set and there is insufficient memory to
+ * move its values.
+ * @note Values are moved rather than copied and other is left empty. If both
+ * share a pool the items of other are relinked in logarithmic time and remain
+ * valid, otherwise they are moved into new items. On failure neither tree set
+ * is changed.
+ */
+bool seahorse_red_black_tree_set_i_join(
+        struct seahorse_red_black_tree_set_i *object,
+        struct seahorse_red_black_tree_set_i *other);
+
 #endif /* _SEAHORSE_RED_BLACK_TREE_SET_I_H_ */
@@ -4,7 +4,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <coral.h>
+#include "red_black_tree.h"
 
 struct sea_turtle_string;
 
@@ -19,9 +19,13 @@ struct sea_turtle_string;
 #define SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_IS_NULL                9
 #define SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_END_OF_SEQUENCE             10
 #define SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL               11
+#define SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL                12
+#define SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL               13
+#define SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_POOL_IS_NULL                14
+#define SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUES_OVERLAP              15
 
 struct seahorse_red_black_tree_set_s {
-    struct coral_red_black_tree_set set;
+    struct seahorse_red_black_tree tree;
 };
 
 /**
@@ -34,6 +38,23 @@ struct seahorse_red_black_tree_set_s {
 bool seahorse_red_black_tree_set_s_init(
         struct seahorse_red_black_tree_set_s *object);
 
+/**
+ * @brief Initialize red black tree set with nodes from a pool.
+ * @param [in] object instance to be initialized.
+ * @param [in] pool from which the nodes of the tree set are allocated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object
+ * is <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_POOL_IS_NULL if pool is
+ * <i>NULL</i>.
+ * @note The pool must outlive the tree set, as well as its copies and the
+ * tree sets it is split into, which all allocate their nodes from the same
+ * pool.
+ */
+bool seahorse_red_black_tree_set_s_init_pool(
+        struct seahorse_red_black_tree_set_s *object,
+        struct seahorse_red_black_tree_pool *pool);
+
 /**
  * @brief Copy initialize red black tree set.
  * @param [in] object instance to be initialized.
@@ -95,6 +116,27 @@ bool seahorse_red_black_tree_set_s_add(
         struct seahorse_red_black_tree_set_s *object,
         const struct sea_turtle_string *value);
 
+/**
+ * @brief Add value to the tree set taking ownership of it.
+ * @param [in] object tree set instance.
+ * @param [in] value to be added.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_ALREADY_EXISTS if value is
+ * already present in the tree set.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to add value to the tree set.
+ * @note On success the contents of <b>value</b> are moved into the set
+ * without being copied and it is reset, otherwise it remains owned by
+ * the caller.
+ */
+bool seahorse_red_black_tree_set_s_add_take(
+        struct seahorse_red_black_tree_set_s *object,
+        struct sea_turtle_string *value);
+
 /**
  * @brief Remove value from the tree set.
  * @param [in] object tree set instance.
@@ -106,13 +148,31 @@ bool seahorse_red_black_tree_set_s_add(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_NOT_FOUND if value is not
  * in the tree set instance.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_s_remove(
         struct seahorse_red_black_tree_set_s *object,
         const struct sea_turtle_string *value);
 
+/**
+ * @brief Remove value from the tree set given as raw bytes.
+ * @param [in] object tree set instance.
+ * @param [in] value to be removed.
+ * @param [in] size of value in bytes.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_NOT_FOUND if value is not
+ * in the tree set instance.
+ * @note <b>value</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_set_s_remove_chars(
+        struct seahorse_red_black_tree_set_s *object,
+        const char *value,
+        size_t size);
+
 /**
  * @brief Check if tree set contains the given value.
  * @param [in] object tree set instance.
@@ -125,14 +185,34 @@ bool seahorse_red_black_tree_set_s_remove(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
  * <i>NULL</i>.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_s_contains(
         const struct seahorse_red_black_tree_set_s *object,
         const struct sea_turtle_string *value,
         bool *out);
 
+/**
+ * @brief Check if tree set contains the given value in raw bytes.
+ * @param [in] object tree set instance.
+ * @param [in] value to check if value is present.
+ * @param [in] size of value in bytes.
+ * @param [out] out receive true if value is present, otherwise false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note <b>value</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_set_s_contains_chars(
+        const struct seahorse_red_black_tree_set_s *object,
+        const char *value,
+        size_t size,
+        bool *out);
+
 /**
  * @brief Retrieve item for value.
  * @param [in] object tree set instance.
@@ -147,14 +227,36 @@ bool seahorse_red_black_tree_set_s_contains(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if there is no
  * item that matched value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_s_get(
         const struct seahorse_red_black_tree_set_s *object,
         const struct sea_turtle_string *value,
         const struct sea_turtle_string **out);
 
+/**
+ * @brief Retrieve item for value given as raw bytes.
+ * @param [in] object tree set instance.
+ * @param [in] value to find.
+ * @param [in] size of value in bytes.
+ * @param [out] out receive the <u>address of</u> item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if there is no
+ * item that matched value.
+ * @note <b>value</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_set_s_get_chars(
+        const struct seahorse_red_black_tree_set_s *object,
+        const char *value,
+        size_t size,
+        const struct sea_turtle_string **out);
+
 /**
  * @brief Retrieve item for value or the next higher value.
  * @param [in] object tree set instance.
@@ -169,14 +271,36 @@ bool seahorse_red_black_tree_set_s_get(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if no item
  * matched value or a higher value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_s_ceiling(
         const struct seahorse_red_black_tree_set_s *object,
         const struct sea_turtle_string *value,
         const struct sea_turtle_string **out);
 
+/**
+ * @brief Retrieve item for value or the next higher value given as raw bytes.
+ * @param [in] object tree set instance.
+ * @param [in] value to find or its next higher.
+ * @param [in] size of value in bytes.
+ * @param [out] out receive the <u>address of</u> item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if no item
+ * matched value or a higher value.
+ * @note <b>value</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_set_s_ceiling_chars(
+        const struct seahorse_red_black_tree_set_s *object,
+        const char *value,
+        size_t size,
+        const struct sea_turtle_string **out);
+
 /**
  * @brief Retrieve item for value or the next lower value.
  * @param [in] object tree set instance.
@@ -191,14 +315,36 @@ bool seahorse_red_black_tree_set_s_ceiling(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if no item
  * matched value or a lower value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_s_floor(
         const struct seahorse_red_black_tree_set_s *object,
         const struct sea_turtle_string *value,
         const struct sea_turtle_string **out);
 
+/**
+ * @brief Retrieve item for value or the next lower value given as raw bytes.
+ * @param [in] object tree set instance.
+ * @param [in] value to find or its next lower.
+ * @param [in] size of value in bytes.
+ * @param [out] out receive the <u>address of</u> item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if no item
+ * matched value or a lower value.
+ * @note <b>value</b> is compared directly against the stored strings so
+ * no sea_turtle_string has to be created for the lookup.
+ */
+bool seahorse_red_black_tree_set_s_floor_chars(
+        const struct seahorse_red_black_tree_set_s *object,
+        const char *value,
+        size_t size,
+        const struct sea_turtle_string **out);
+
 /**
  * @brief Retrieve item for next higher value.
  * @param [in] object tree set instance.
@@ -213,8 +359,6 @@ bool seahorse_red_black_tree_set_s_floor(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if there is no
  * greater value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_s_higher(
         const struct seahorse_red_black_tree_set_s *object,
@@ -235,8 +379,6 @@ bool seahorse_red_black_tree_set_s_higher(
  * <i>NULL</i>.
  * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND if there is no
  * lower value.
- * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if
- * there is insufficient memory to find the item.
  */
 bool seahorse_red_black_tree_set_s_lower(
         const struct seahorse_red_black_tree_set_s *object,
@@ -319,4 +461,182 @@ bool seahorse_red_black_tree_set_s_next(const struct sea_turtle_string *item,
 bool seahorse_red_black_tree_set_s_prev(const struct sea_turtle_string *item,
                                         const struct sea_turtle_string **out);
 
+/**
+ * @brief Initialize red black tree set with the union of two tree sets.
+ * @param [in] object instance to be initialized.
+ * @param [in] left tree set whose values are to be included.
+ * @param [in] right tree set whose values are to be included.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL if left is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL if right is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if there
+ * is insufficient memory to initialize the tree set.
+ * @note left and right are walked in order side by side to count the values
+ * and then to build the tree set from them, which takes O(n + m) in total.
+ */
+bool seahorse_red_black_tree_set_s_init_union(
+        struct seahorse_red_black_tree_set_s *object,
+        const struct seahorse_red_black_tree_set_s *left,
+        const struct seahorse_red_black_tree_set_s *right);
+
+/**
+ * @brief Initialize red black tree set with the intersection of two tree sets.
+ * @param [in] object instance to be initialized.
+ * @param [in] left tree set whose values are to be included if present in
+ * right.
+ * @param [in] right tree set whose values are to be included if present in
+ * left.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL if left is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL if right is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if there
+ * is insufficient memory to initialize the tree set.
+ * @note left and right are walked in order side by side to count the values
+ * and then to build the tree set from them, which takes O(n + m) in total.
+ */
+bool seahorse_red_black_tree_set_s_init_intersection(
+        struct seahorse_red_black_tree_set_s *object,
+        const struct seahorse_red_black_tree_set_s *left,
+        const struct seahorse_red_black_tree_set_s *right);
+
+/**
+ * @brief Initialize red black tree set with the difference of two tree sets.
+ * @param [in] object instance to be initialized.
+ * @param [in] left tree set whose values are to be included unless present in
+ * right.
+ * @param [in] right tree set whose values are to be excluded.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL if left is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL if right is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if there
+ * is insufficient memory to initialize the tree set.
+ * @note left and right are walked in order side by side to count the values
+ * and then to build the tree set from them, which takes O(n + m) in total.
+ */
+bool seahorse_red_black_tree_set_s_init_difference(
+        struct seahorse_red_black_tree_set_s *object,
+        const struct seahorse_red_black_tree_set_s *left,
+        const struct seahorse_red_black_tree_set_s *right);
+
+/**
+ * @brief Check if every value of the tree set is present in other.
+ * @param [in] object tree set instance.
+ * @param [in] other tree set to check against.
+ * @param [out] out receive true if object is a subset of other, otherwise
+ * false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both tree sets are walked in order side by side, so the check takes
+ * O(n + m).
+ */
+bool seahorse_red_black_tree_set_s_is_subset(
+        const struct seahorse_red_black_tree_set_s *object,
+        const struct seahorse_red_black_tree_set_s *other,
+        bool *out);
+
+/**
+ * @brief Remove all the values which are within a range.
+ * @param [in] object tree set instance.
+ * @param [in] low smallest value of the range.
+ * @param [in] high largest value of the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The range is cut out of the tree set with two splits
+ * and a join, so that what remains is rebalanced only once.
+ */
+bool seahorse_red_black_tree_set_s_remove_range(
+        struct seahorse_red_black_tree_set_s *object,
+        const struct sea_turtle_string *low,
+        const struct sea_turtle_string *high);
+
+/**
+ * @brief Count the values which are within a range.
+ * @param [in] object tree set instance.
+ * @param [in] low smallest value of the range.
+ * @param [in] high largest value of the range.
+ * @param [out] out receive the count of values within the range.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if low or high is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Both low and high are part of the range, which is empty if low is
+ * greater than high. The count follows from the positions of the ends of
+ * the range, which are found in logarithmic time.
+ */
+bool seahorse_red_black_tree_set_s_count_range(
+        const struct seahorse_red_black_tree_set_s *object,
+        const struct sea_turtle_string *low,
+        const struct sea_turtle_string *high,
+        uintmax_t *out);
+
+/**
+ * @brief Move the values which are not less than value into another tree set.
+ * @param [in] object tree set instance.
+ * @param [in] value at which the tree set is split.
+ * @param [out] out tree set instance to be initialized with the values that
+ * were moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL if value is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note Values are moved by relinking the items that hold them in logarithmic
+ * time, so that previously retrieved items of the moved values remain valid and
+ * now belong to out. Unless an argument is <i>NULL</i> out is always
+ * initialized and must be invalidated.
+ */
+bool seahorse_red_black_tree_set_s_split_at(
+        struct seahorse_red_black_tree_set_s *object,
+        const struct sea_turtle_string *value,
+        struct seahorse_red_black_tree_set_s *out);
+
+/**
+ * @brief Move all the values of other into the tree set.
+ * @param [in] object tree set instance.
+ * @param [in] other tree set instance whose values are moved.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUES_OVERLAP if the last value
+ * of the tree set is not less than the first value of other.
+ * @throws SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED if other
+ * does not share the pool of the tree set and there is insufficient memory to
+ * move its values.
+ * @note Values are moved rather than copied and other is left empty. If both
+ * share a pool the items of other are relinked in logarithmic time and remain
+ * valid, otherwise they are moved into new items. On failure neither tree set
+ * is changed.
+ */
+bool seahorse_red_black_tree_set_s_join(
+        struct seahorse_red_black_tree_set_s *object,
+        struct seahorse_red_black_tree_set_s *other);
+
 #endif /* _SEAHORSE_RED_BLACK_TREE_SET_S_H_ */
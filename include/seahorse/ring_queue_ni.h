@@ -0,0 +1,140 @@
+#ifndef _SEAHORSE_RING_QUEUE_NI_H_
+#define _SEAHORSE_RING_QUEUE_NI_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL                 1
+#define SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL                    2
+#define SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED       3
+#define SEAHORSE_RING_QUEUE_NI_ERROR_QUEUE_IS_EMPTY                 4
+#define SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_ZERO                  5
+#define SEAHORSE_RING_QUEUE_NI_ERROR_VALUES_IS_NULL                 6
+#define SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_OUT_OF_BOUNDS         7
+
+/*
+ * A queue stored in a circular buffer whose capacity is a power of two so
+ * that positions wrap around with a mask. The buffer only ever grows, hence
+ * once it is large enough adding and removing never allocate.
+ */
+struct seahorse_ring_queue_ni {
+    uintmax_t count;
+    uintmax_t capacity;
+    uintmax_t head;
+    uintmax_t *items;
+};
+
+/**
+ * @brief Initialize ring queue.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No memory is allocated until the first item is added.
+ */
+bool seahorse_ring_queue_ni_init(struct seahorse_ring_queue_ni *object);
+
+/**
+ * @brief Invalidate ring queue.
+ * <p>The actual <u>ring queue instance is not deallocated</u> since it may
+ * have been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_ring_queue_ni_invalidate(struct seahorse_ring_queue_ni *object);
+
+/**
+ * @brief Retrieve the count of items.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_ring_queue_ni_count(const struct seahorse_ring_queue_ni *object,
+                                  uintmax_t *out);
+
+/**
+ * @brief Add item to the end of the ring queue.
+ * @param [in] object ring queue instance.
+ * @param [in] item to add to the end of the queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add item to ring queue.
+ */
+bool seahorse_ring_queue_ni_add(struct seahorse_ring_queue_ni *object,
+                                uintmax_t item);
+
+/**
+ * @brief Add all the values to the end of the ring queue.
+ * @param [in] object ring queue instance.
+ * @param [in] count number of values.
+ * @param [in] values all of which we would like to add in order to the end
+ * of the ring queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add all the values to ring queue.
+ * @note Either all the values are added or none of them are.
+ */
+bool seahorse_ring_queue_ni_add_all(struct seahorse_ring_queue_ni *object,
+                                    uintmax_t count,
+                                    const uintmax_t *values);
+
+/**
+ * @brief Remove item from the front of the ring queue.
+ * @param [in] object ring queue instance.
+ * @param [out] out receive the item in the front of the ring queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_QUEUE_IS_EMPTY if ring queue is
+ * empty.
+ */
+bool seahorse_ring_queue_ni_remove(struct seahorse_ring_queue_ni *object,
+                                   uintmax_t *out);
+
+/**
+ * @brief Remove count items from the front of the ring queue.
+ * @param [in] object ring queue instance.
+ * @param [in] count number of items to remove.
+ * @param [out] out receive the removed items in order, it must have room for
+ * at least count items.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_OUT_OF_BOUNDS if count is
+ * greater than the number of items in the ring queue.
+ */
+bool seahorse_ring_queue_ni_remove_all(struct seahorse_ring_queue_ni *object,
+                                       uintmax_t count,
+                                       uintmax_t *out);
+
+/**
+ * @brief Retrieve the item from the front of the queue without removing it.
+ * @param [in] object ring queue instance.
+ * @param [out] out receive the item in the front of the ring queue.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_RING_QUEUE_NI_ERROR_QUEUE_IS_EMPTY if ring queue is
+ * empty.
+ */
+bool seahorse_ring_queue_ni_peek(const struct seahorse_ring_queue_ni *object,
+                                 uintmax_t *out);
+
+#endif /* _SEAHORSE_RING_QUEUE_NI_H_ */
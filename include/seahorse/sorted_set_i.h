@@ -30,6 +30,7 @@ struct sea_turtle_integer;
     SEAHORSE_ORDERED_SET_I_ERROR_VALUE_NOT_FOUND
 #define SEAHORSE_SORTED_SET_I_ERROR_ITEM_NOT_FOUND \
     SEAHORSE_ORDERED_SET_I_ERROR_ITEM_NOT_FOUND
+#define SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL                       11
 
 struct seahorse_sorted_set_i;
 
@@ -262,4 +263,64 @@ bool seahorse_sorted_set_i_lower(
         const struct sea_turtle_integer *value,
         const struct sea_turtle_integer **out);
 
+/**
+ * @brief Add all the values of other that are not already present.
+ * @param [in] object sorted set instance.
+ * @param [in] other sorted set whose values are to be added.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to add a value.
+ * @note Both sorted sets are walked in order side by side so that each value
+ * is visited once. On failure the values added so far are kept.
+ */
+bool seahorse_sorted_set_i_add_all(
+        struct seahorse_sorted_set_i *object,
+        const struct seahorse_sorted_set_i *other);
+
+/**
+ * @brief Remove all the values that are not present in other.
+ * @param [in] object sorted set instance.
+ * @param [in] other sorted set whose values are to be retained.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @note Both sorted sets are walked in order side by side so that each value
+ * is visited once.
+ */
+bool seahorse_sorted_set_i_retain_all(
+        struct seahorse_sorted_set_i *object,
+        const struct seahorse_sorted_set_i *other);
+
+/**
+ * @brief Remove all the values that are present in other.
+ * @param [in] object sorted set instance.
+ * @param [in] other sorted set whose values are to be removed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @note Both sorted sets are walked in order side by side so that each value
+ * is visited once.
+ */
+bool seahorse_sorted_set_i_remove_all(
+        struct seahorse_sorted_set_i *object,
+        const struct seahorse_sorted_set_i *other);
+
+/**
+ * @brief Check if all the values are present in other.
+ * @param [in] object sorted set instance.
+ * @param [in] other sorted set which may contain all the values.
+ * @param [out] out receive true if object is a subset of other, otherwise
+ * false.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAHORSE_SORTED_SET_I_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_sorted_set_i_is_subset(
+        const struct seahorse_sorted_set_i *object,
+        const struct seahorse_sorted_set_i *other,
+        bool *out);
+
 #endif /* _SEAHORSE_SORTED_SET_I_H_ */
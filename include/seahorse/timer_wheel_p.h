@@ -0,0 +1,206 @@
+#ifndef _SEAHORSE_TIMER_WHEEL_P_H_
+#define _SEAHORSE_TIMER_WHEEL_P_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL                 1
+#define SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL                    2
+#define SEAHORSE_TIMER_WHEEL_P_ERROR_MEMORY_ALLOCATION_FAILED       3
+#define SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL                  4
+#define SEAHORSE_TIMER_WHEEL_P_ERROR_COUNT_IS_ZERO                  5
+#define SEAHORSE_TIMER_WHEEL_P_ERROR_ITEMS_IS_NULL                  6
+#define SEAHORSE_TIMER_WHEEL_P_ERROR_NOW_IS_OUT_OF_BOUNDS           7
+
+/*
+ * A hierarchical timing wheel of items, each due at a deadline given in
+ * ticks of whatever clock the caller advances it with. Every level has 64
+ * slots, each covering 64 times as many ticks as a slot of the level below,
+ * and an item is placed at the lowest level whose slots still tell its
+ * deadline apart from the current time. Scheduling, cancelling and
+ * rescheduling only link or unlink the item's entry, while advancing cascades
+ * the items of the slots that time has passed down towards the lowest level
+ * until they are due.
+ */
+struct seahorse_timer_wheel_p {
+    uintmax_t count;
+    uintmax_t now;
+    void *data;
+};
+
+struct seahorse_timer_wheel_p_entry;
+
+/**
+ * @brief Initialize timer wheel.
+ * @param [in] object instance to be initialized.
+ * @param [in] now current time of the timer wheel.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to initialize the timer wheel.
+ */
+bool seahorse_timer_wheel_p_init(struct seahorse_timer_wheel_p *object,
+                                 uintmax_t now);
+
+/**
+ * @brief Invalidate timer wheel.
+ * <p>All the items still scheduled will have the given <i>on destroy</i>
+ * callback invoked upon them. The actual <u>timer wheel instance is not
+ * deallocated</u> since it may have been embedded in a larger
+ * structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @param [in] on_destroy called just before the item is to be destroyed.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ */
+bool seahorse_timer_wheel_p_invalidate(struct seahorse_timer_wheel_p *object,
+                                       void (*on_destroy)(void *item));
+
+/**
+ * @brief Retrieve the count of scheduled items.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note Items that are due but have yet to be handed out by advance are
+ * counted.
+ */
+bool seahorse_timer_wheel_p_count(const struct seahorse_timer_wheel_p *object,
+                                  uintmax_t *out);
+
+/**
+ * @brief Retrieve the current time.
+ * @param [in] object timer wheel instance.
+ * @param [out] out receive the time the timer wheel was last advanced to.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_timer_wheel_p_now(const struct seahorse_timer_wheel_p *object,
+                                uintmax_t *out);
+
+/**
+ * @brief Schedule item to be due at deadline.
+ * @param [in] object timer wheel instance.
+ * @param [in] deadline time at which item is due.
+ * @param [in] item to be scheduled.
+ * @param [out] out receive the <u>address of</u> the item's entry.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to schedule item.
+ * @note A deadline that is not after the current time makes item due on
+ * the next advance.
+ */
+bool seahorse_timer_wheel_p_schedule(
+        struct seahorse_timer_wheel_p *object,
+        uintmax_t deadline,
+        void *item,
+        const struct seahorse_timer_wheel_p_entry **out);
+
+/**
+ * @brief Cancel entry so that its item is never due.
+ * @param [in] object timer wheel instance.
+ * @param [in] entry <u>address of</u> entry to be cancelled.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @note The entry is deallocated and must not be used afterwards.
+ */
+bool seahorse_timer_wheel_p_cancel(
+        struct seahorse_timer_wheel_p *object,
+        const struct seahorse_timer_wheel_p_entry *entry);
+
+/**
+ * @brief Move the deadline of entry.
+ * @param [in] object timer wheel instance.
+ * @param [in] entry <u>address of</u> entry to be rescheduled.
+ * @param [in] deadline new time at which the entry's item is due.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @note The entry is reused so rescheduling never allocates, and an entry
+ * whose item was due but not yet handed out by advance is pulled back.
+ */
+bool seahorse_timer_wheel_p_reschedule(
+        struct seahorse_timer_wheel_p *object,
+        const struct seahorse_timer_wheel_p_entry *entry,
+        uintmax_t deadline);
+
+/**
+ * @brief Advance the current time and hand out items that are due.
+ * @param [in] object timer wheel instance.
+ * @param [in] now time to advance to.
+ * @param [in] count maximum number of items to hand out.
+ * @param [out] items receive the items that are due, it must have room for
+ * at least count items.
+ * @param [out] out receive the number of items handed out.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_ITEMS_IS_NULL if items is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_NOW_IS_OUT_OF_BOUNDS if now is
+ * before the current time.
+ * @note When more than count items are due the rest are handed out by the
+ * next calls, which may pass the same now until out receives zero. Items
+ * are not handed out in order of their deadlines and the entries of items
+ * handed out are deallocated.
+ */
+bool seahorse_timer_wheel_p_advance(struct seahorse_timer_wheel_p *object,
+                                    uintmax_t now,
+                                    uintmax_t count,
+                                    void **items,
+                                    uintmax_t *out);
+
+/**
+ * @brief Retrieve the entry's deadline.
+ * @param [in] object timer wheel instance.
+ * @param [in] entry <u>address of</u> entry contained within the timer
+ * wheel instance.
+ * @param [out] out receive the entry's deadline.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_timer_wheel_p_entry_deadline(
+        const struct seahorse_timer_wheel_p *object,
+        const struct seahorse_timer_wheel_p_entry *entry,
+        uintmax_t *out);
+
+/**
+ * @brief Retrieve the entry's item.
+ * @param [in] object timer wheel instance.
+ * @param [in] entry <u>address of</u> entry contained within the timer
+ * wheel instance.
+ * @param [out] out receive the entry's item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL if entry is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+bool seahorse_timer_wheel_p_entry_item(
+        const struct seahorse_timer_wheel_p *object,
+        const struct seahorse_timer_wheel_p_entry *entry,
+        void **out);
+
+#endif /* _SEAHORSE_TIMER_WHEEL_P_H_ */
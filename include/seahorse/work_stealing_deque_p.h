@@ -0,0 +1,116 @@
+#ifndef _SEAHORSE_WORK_STEALING_DEQUE_P_H_
+#define _SEAHORSE_WORK_STEALING_DEQUE_P_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL             1
+#define SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL                2
+#define SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED   3
+#define SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY             4
+
+/*
+ * A Chase-Lev deque where a single owner thread pushes and pops items at the
+ * bottom while any number of other threads steal items from the top. The
+ * owner only synchronizes with thieves when the deque is about to become
+ * empty, and thieves only contend with each other on the top index.
+ */
+struct seahorse_work_stealing_deque_p {
+    void *data;
+};
+
+/**
+ * @brief Initialize work stealing deque.
+ * @param [in] object instance to be initialized.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to initialize the deque.
+ */
+bool seahorse_work_stealing_deque_p_init(
+        struct seahorse_work_stealing_deque_p *object);
+
+/**
+ * @brief Invalidate work stealing deque.
+ * <p>The actual <u>deque instance is not deallocated</u> since it may have
+ * been embedded in a larger structure.</p>
+ * @param [in] object instance to be invalidated.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note No other thread may be using the deque.
+ */
+bool seahorse_work_stealing_deque_p_invalidate(
+        struct seahorse_work_stealing_deque_p *object);
+
+/**
+ * @brief Retrieve the count of items.
+ * @param [in] object instance whose count we are to retrieve.
+ * @param [out] out receive the count.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @note While other threads are stealing items the count is only an
+ * estimate.
+ */
+bool seahorse_work_stealing_deque_p_count(
+        const struct seahorse_work_stealing_deque_p *object,
+        uintmax_t *out);
+
+/**
+ * @brief Push item onto the bottom of the deque.
+ * @param [in] object deque instance.
+ * @param [in] item to push onto the bottom of the deque.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED if
+ * there is insufficient memory to grow the deque.
+ * @note Must only be called by the owner of the deque. Growing leaves the
+ * old array around until the deque is invalidated as thieves may still be
+ * reading from it.
+ */
+bool seahorse_work_stealing_deque_p_push(
+        struct seahorse_work_stealing_deque_p *object,
+        void *item);
+
+/**
+ * @brief Pop item from the bottom of the deque.
+ * @param [in] object deque instance.
+ * @param [out] out receive the most recently pushed item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY if the deque
+ * is empty or its last item was stolen.
+ * @note Must only be called by the owner of the deque.
+ */
+bool seahorse_work_stealing_deque_p_pop(
+        struct seahorse_work_stealing_deque_p *object,
+        void **out);
+
+/**
+ * @brief Steal item from the top of the deque.
+ * @param [in] object deque instance.
+ * @param [out] out receive the least recently pushed item.
+ * @return On success true, otherwise false if an error has occurred.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i>.
+ * @throws SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY if the deque
+ * is empty.
+ * @note May be called by any thread. Lock-free, losing a race to another
+ * thief or to the owner just means trying again with the next item.
+ */
+bool seahorse_work_stealing_deque_p_steal(
+        struct seahorse_work_stealing_deque_p *object,
+        void **out);
+
+#endif /* _SEAHORSE_WORK_STEALING_DEQUE_P_H_ */
@@ -183,6 +183,27 @@ bool seahorse_array_list_i_add(struct seahorse_array_list_i *const object,
     return result;
 }
 
+bool seahorse_array_list_i_add_take(
+        struct seahorse_array_list_i *const object,
+        struct sea_turtle_integer *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_ARRAY_LIST_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_ARRAY_LIST_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    if (!coral_array_list_add(&object->list, value)) {
+        seagrass_required_true(CORAL_ARRAY_LIST_ERROR_MEMORY_ALLOCATION_FAILED
+                               == coral_error);
+        seahorse_error = SEAHORSE_ARRAY_LIST_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    *value = (struct sea_turtle_integer) {0};
+    return true;
+}
+
 bool seahorse_array_list_i_add_all(
         struct seahorse_array_list_i *const object,
         const uintmax_t count,
@@ -301,6 +322,39 @@ bool seahorse_array_list_i_insert(
     return result;
 }
 
+bool seahorse_array_list_i_insert_take(
+        struct seahorse_array_list_i *const object,
+        const uintmax_t at,
+        struct sea_turtle_integer *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_ARRAY_LIST_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_ARRAY_LIST_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    if (!coral_array_list_insert(&object->list, at, value)) {
+        switch (coral_error) {
+            default: {
+                seagrass_required_true(false);
+            }
+            case CORAL_ARRAY_LIST_ERROR_INDEX_IS_OUT_OF_BOUNDS: {
+                seahorse_error = SEAHORSE_ARRAY_LIST_I_ERROR_INDEX_IS_OUT_OF_BOUNDS;
+                break;
+            }
+            case CORAL_ARRAY_LIST_ERROR_MEMORY_ALLOCATION_FAILED: {
+                seahorse_error =
+                        SEAHORSE_ARRAY_LIST_I_ERROR_MEMORY_ALLOCATION_FAILED;
+                break;
+            }
+        }
+        return false;
+    }
+    *value = (struct sea_turtle_integer) {0};
+    return true;
+}
+
 bool seahorse_array_list_i_insert_all(
         struct seahorse_array_list_i *const object,
         const uintmax_t at,
@@ -0,0 +1,1030 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/*
+ * Roaring bitmap where values are split into a key, their upper bits, and
+ * their lowest 16 bits. Values sharing a key are kept in a chunk and the
+ * chunks are kept in an array sorted by key. A chunk holds its values in a
+ * sorted array of 16-bit values while there are at most 4096 of them and in a
+ * bitmap of 65536 bits once there are more, which is the point at which the
+ * bitmap becomes the smaller of the two. A bitmap chunk is only turned back
+ * into an array chunk once half of that count is reached so that values going
+ * back and forth around the threshold do not flip the representation on
+ * every change, a bitmap chunk may also hold fewer values whenever there was
+ * not enough memory to turn it into an array chunk.
+ */
+#define LOW_BITS                        16
+#define WORDS                           1024
+#define WORD_BITS                       64
+#define ARRAY_MINIMUM                   4
+#define ARRAY_MAXIMUM                   4096
+#define ARRAY                           0
+#define BITMAP                          1
+
+struct chunk {
+    uintmax_t key;
+    uint32_t count;
+    uint16_t capacity;
+    uint8_t type;
+    union {
+        uint16_t *values;
+        uint64_t *words;
+    };
+};
+
+static uintmax_t key_of(const uintmax_t value) {
+    return value >> LOW_BITS;
+}
+
+static uint16_t low_of(const uintmax_t value) {
+    return (uint16_t) value;
+}
+
+static uintmax_t value_of(const uintmax_t key, const uint16_t low) {
+    return key << LOW_BITS | low;
+}
+
+static uint64_t bit_of(const uint16_t low) {
+    return (uint64_t) 1 << (low % WORD_BITS);
+}
+
+/*
+ * Number of set bits in word.
+ */
+static uint32_t popcount(const uint64_t word) {
+#if defined(__GNUC__)
+    return (uint32_t) __builtin_popcountll(word);
+#else
+    uint32_t result = 0;
+    for (uint64_t i = word; i; i &= i - 1) {
+        result++;
+    }
+    return result;
+#endif
+}
+
+/*
+ * Position of the lowest set bit of word, which must not be zero.
+ */
+static uint32_t lowest(const uint64_t word) {
+    assert(word);
+#if defined(__GNUC__)
+    return (uint32_t) __builtin_ctzll(word);
+#else
+    uint32_t result = 0;
+    for (uint64_t i = word; !(i & 1); i >>= 1) {
+        result++;
+    }
+    return result;
+#endif
+}
+
+/*
+ * Position of the highest set bit of word, which must not be zero.
+ */
+static uint32_t highest(const uint64_t word) {
+    assert(word);
+#if defined(__GNUC__)
+    return WORD_BITS - 1 - (uint32_t) __builtin_clzll(word);
+#else
+    uint32_t result = 0;
+    for (uint64_t i = word >> 1; i; i >>= 1) {
+        result++;
+    }
+    return result;
+#endif
+}
+
+static uint32_t cardinality(const uint64_t *const words) {
+    assert(words);
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < WORDS; i++) {
+        count += popcount(words[i]);
+    }
+    return count;
+}
+
+/*
+ * Index of the first value that is not less than bound.
+ */
+static uint32_t lower_bound(const struct chunk *const chunk,
+                            const uint32_t bound) {
+    assert(chunk);
+    assert(ARRAY == chunk->type);
+    uint32_t lo = 0;
+    uint32_t hi = chunk->count;
+    while (lo < hi) {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        if (chunk->values[mid] < bound) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/*
+ * Index of the chunk for key if there is one, otherwise the index at which a
+ * chunk for key would have to be inserted.
+ */
+static bool find_chunk(const struct seahorse_bitmap_set_ni *const object,
+                       const uintmax_t key,
+                       uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    const struct chunk *const chunks = object->data;
+    uintmax_t lo = 0;
+    uintmax_t hi = object->length;
+    while (lo < hi) {
+        const uintmax_t mid = lo + (hi - lo) / 2;
+        if (chunks[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    *out = lo;
+    return lo < object->length && chunks[lo].key == key;
+}
+
+static bool chunk_contains(const struct chunk *const chunk,
+                           const uint16_t low) {
+    assert(chunk);
+    if (BITMAP == chunk->type) {
+        return chunk->words[low / WORD_BITS] & bit_of(low);
+    }
+    const uint32_t i = lower_bound(chunk, low);
+    return i < chunk->count && chunk->values[i] == low;
+}
+
+static bool chunk_ceiling(const struct chunk *const chunk,
+                          const uint16_t low,
+                          uint16_t *const out) {
+    assert(chunk);
+    assert(out);
+    if (ARRAY == chunk->type) {
+        const uint32_t i = lower_bound(chunk, low);
+        if (i == chunk->count) {
+            return false;
+        }
+        *out = chunk->values[i];
+        return true;
+    }
+    uint32_t i = low / WORD_BITS;
+    uint64_t word = chunk->words[i] & (UINT64_MAX << (low % WORD_BITS));
+    while (!word) {
+        if (WORDS == ++i) {
+            return false;
+        }
+        word = chunk->words[i];
+    }
+    *out = (uint16_t) (i * WORD_BITS + lowest(word));
+    return true;
+}
+
+static bool chunk_floor(const struct chunk *const chunk,
+                        const uint16_t low,
+                        uint16_t *const out) {
+    assert(chunk);
+    assert(out);
+    if (ARRAY == chunk->type) {
+        const uint32_t i = lower_bound(chunk, 1 + (uint32_t) low);
+        if (!i) {
+            return false;
+        }
+        *out = chunk->values[i - 1];
+        return true;
+    }
+    uint32_t i = low / WORD_BITS;
+    uint64_t word = chunk->words[i]
+                    & (UINT64_MAX >> (WORD_BITS - 1 - low % WORD_BITS));
+    while (!word) {
+        if (!i) {
+            return false;
+        }
+        word = chunk->words[--i];
+    }
+    *out = (uint16_t) (i * WORD_BITS + highest(word));
+    return true;
+}
+
+static uint16_t chunk_first(const struct chunk *const chunk) {
+    assert(chunk);
+    assert(chunk->count);
+    uint16_t out;
+    const bool result = chunk_ceiling(chunk, 0, &out);
+    assert(result);
+    (void) result;
+    return out;
+}
+
+static uint16_t chunk_last(const struct chunk *const chunk) {
+    assert(chunk);
+    assert(chunk->count);
+    uint16_t out;
+    const bool result = chunk_floor(chunk, UINT16_MAX, &out);
+    assert(result);
+    (void) result;
+    return out;
+}
+
+static bool to_bitmap(struct chunk *const chunk) {
+    assert(chunk);
+    assert(ARRAY == chunk->type);
+    uint64_t *const words = calloc(WORDS, sizeof(*words));
+    if (!words) {
+        return false;
+    }
+    for (uint32_t i = 0; i < chunk->count; i++) {
+        words[chunk->values[i] / WORD_BITS] |= bit_of(chunk->values[i]);
+    }
+    free(chunk->values);
+    chunk->words = words;
+    chunk->capacity = 0;
+    chunk->type = BITMAP;
+    return true;
+}
+
+static bool to_array(struct chunk *const chunk) {
+    assert(chunk);
+    assert(BITMAP == chunk->type);
+    assert(chunk->count && chunk->count <= ARRAY_MAXIMUM);
+    uint16_t *const values = malloc(chunk->count * sizeof(*values));
+    if (!values) {
+        return false;
+    }
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < WORDS; i++) {
+        for (uint64_t word = chunk->words[i]; word; word &= word - 1) {
+            values[n++] = (uint16_t) (i * WORD_BITS + lowest(word));
+        }
+    }
+    assert(n == chunk->count);
+    free(chunk->words);
+    chunk->values = values;
+    chunk->capacity = (uint16_t) chunk->count;
+    chunk->type = ARRAY;
+    return true;
+}
+
+/*
+ * Turns a bitmap chunk that has become sparse into an array chunk, a chunk
+ * that cannot be turned into an array chunk only costs space.
+ */
+static void compact(struct chunk *const chunk) {
+    assert(chunk);
+    if (BITMAP == chunk->type && chunk->count
+        && chunk->count <= ARRAY_MAXIMUM / 2) {
+        (void) to_array(chunk);
+    }
+}
+
+static bool copy_chunk(struct chunk *const chunk,
+                       const struct chunk *const other) {
+    assert(chunk);
+    assert(other);
+    const size_t size = BITMAP == other->type
+                        ? WORDS * sizeof(uint64_t)
+                        : other->count * sizeof(uint16_t);
+    void *const data = malloc(size);
+    if (!data) {
+        return false;
+    }
+    memcpy(data, other->values, size);
+    *chunk = *other;
+    chunk->values = data;
+    if (ARRAY == chunk->type) {
+        chunk->capacity = (uint16_t) chunk->count;
+    }
+    return true;
+}
+
+static void init(struct seahorse_bitmap_set_ni *const object) {
+    assert(object);
+    *object = (struct seahorse_bitmap_set_ni) {0};
+}
+
+bool seahorse_bitmap_set_ni_init(struct seahorse_bitmap_set_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+static void invalidate(struct seahorse_bitmap_set_ni *const object) {
+    assert(object);
+    struct chunk *const chunks = object->data;
+    for (uintmax_t i = 0; i < object->length; i++) {
+        free(chunks[i].values);
+    }
+    free(chunks);
+    *object = (struct seahorse_bitmap_set_ni) {0};
+}
+
+bool seahorse_bitmap_set_ni_init_bitmap_set_ni(
+        struct seahorse_bitmap_set_ni *const object,
+        const struct seahorse_bitmap_set_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    if (!other->length) {
+        return true;
+    }
+    struct chunk *const chunks = malloc(other->length * sizeof(*chunks));
+    if (!chunks) {
+        seahorse_error =
+                SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->data = chunks;
+    object->capacity = other->length;
+    const struct chunk *const others = other->data;
+    for (uintmax_t i = 0; i < other->length; i++) {
+        if (!copy_chunk(&chunks[i], &others[i])) {
+            invalidate(object);
+            seahorse_error =
+                    SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        object->length += 1;
+    }
+    object->count = other->count;
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_invalidate(
+        struct seahorse_bitmap_set_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    invalidate(object);
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_count(
+        const struct seahorse_bitmap_set_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Inserts a chunk holding only low for key at index, the chunk array is grown
+ * before anything else is changed.
+ */
+static bool insert_chunk(struct seahorse_bitmap_set_ni *const object,
+                         const uintmax_t index,
+                         const uintmax_t key,
+                         const uint16_t low) {
+    assert(object);
+    assert(index <= object->length);
+    if (object->length == object->capacity) {
+        const uintmax_t capacity = object->capacity
+                                   ? 2 * object->capacity
+                                   : ARRAY_MINIMUM;
+        if (capacity > SIZE_MAX / sizeof(struct chunk)) {
+            return false;
+        }
+        void *const data = realloc(object->data,
+                                   capacity * sizeof(struct chunk));
+        if (!data) {
+            return false;
+        }
+        object->data = data;
+        object->capacity = capacity;
+    }
+    uint16_t *const values = malloc(ARRAY_MINIMUM * sizeof(*values));
+    if (!values) {
+        return false;
+    }
+    values[0] = low;
+    struct chunk *const chunks = object->data;
+    memmove(&chunks[index + 1], &chunks[index],
+            (object->length - index) * sizeof(*chunks));
+    chunks[index] = (struct chunk) {
+            .key = key,
+            .count = 1,
+            .capacity = ARRAY_MINIMUM,
+            .type = ARRAY,
+            .values = values
+    };
+    object->length += 1;
+    return true;
+}
+
+static void remove_chunk(struct seahorse_bitmap_set_ni *const object,
+                         const uintmax_t index) {
+    assert(object);
+    assert(index < object->length);
+    struct chunk *const chunks = object->data;
+    free(chunks[index].values);
+    object->length -= 1;
+    memmove(&chunks[index], &chunks[index + 1],
+            (object->length - index) * sizeof(*chunks));
+}
+
+bool seahorse_bitmap_set_ni_add(struct seahorse_bitmap_set_ni *const object,
+                                const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    const uintmax_t key = key_of(value);
+    const uint16_t low = low_of(value);
+    uintmax_t index;
+    if (!find_chunk(object, key, &index)) {
+        if (!insert_chunk(object, index, key, low)) {
+            seahorse_error =
+                    SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        object->count += 1;
+        return true;
+    }
+    struct chunk *const chunk = &((struct chunk *) object->data)[index];
+    if (chunk_contains(chunk, low)) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_ALREADY_EXISTS;
+        return false;
+    }
+    if (ARRAY == chunk->type && chunk->count == chunk->capacity) {
+        bool result;
+        if (ARRAY_MAXIMUM == chunk->capacity) {
+            result = to_bitmap(chunk);
+        } else {
+            uint32_t capacity = 2 * chunk->capacity;
+            if (capacity > ARRAY_MAXIMUM) {
+                capacity = ARRAY_MAXIMUM;
+            }
+            uint16_t *const values = realloc(
+                    chunk->values, capacity * sizeof(*values));
+            if ((result = values)) {
+                chunk->values = values;
+                chunk->capacity = (uint16_t) capacity;
+            }
+        }
+        if (!result) {
+            seahorse_error =
+                    SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+    }
+    if (BITMAP == chunk->type) {
+        chunk->words[low / WORD_BITS] |= bit_of(low);
+    } else {
+        const uint32_t i = lower_bound(chunk, low);
+        memmove(&chunk->values[i + 1], &chunk->values[i],
+                (chunk->count - i) * sizeof(*chunk->values));
+        chunk->values[i] = low;
+    }
+    chunk->count += 1;
+    object->count += 1;
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_remove(
+        struct seahorse_bitmap_set_ni *const object,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    const uint16_t low = low_of(value);
+    uintmax_t index;
+    if (!find_chunk(object, key_of(value), &index)) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND;
+        return false;
+    }
+    struct chunk *const chunk = &((struct chunk *) object->data)[index];
+    if (!chunk_contains(chunk, low)) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND;
+        return false;
+    }
+    if (BITMAP == chunk->type) {
+        chunk->words[low / WORD_BITS] &= ~bit_of(low);
+    } else {
+        const uint32_t i = lower_bound(chunk, low);
+        memmove(&chunk->values[i], &chunk->values[i + 1],
+                (chunk->count - i - 1) * sizeof(*chunk->values));
+    }
+    chunk->count -= 1;
+    object->count -= 1;
+    if (!chunk->count) {
+        remove_chunk(object, index);
+    } else {
+        compact(chunk);
+    }
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_contains(
+        const struct seahorse_bitmap_set_ni *const object,
+        const uintmax_t value,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    *out = find_chunk(object, key_of(value), &index)
+           && chunk_contains(&((struct chunk *) object->data)[index],
+                             low_of(value));
+    return true;
+}
+
+static bool find_ceiling(const struct seahorse_bitmap_set_ni *const object,
+                         const uintmax_t value,
+                         uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    const struct chunk *const chunks = object->data;
+    const uintmax_t key = key_of(value);
+    uintmax_t index;
+    if (find_chunk(object, key, &index)) {
+        uint16_t low;
+        if (chunk_ceiling(&chunks[index], low_of(value), &low)) {
+            *out = value_of(key, low);
+            return true;
+        }
+        index += 1;
+    }
+    if (index == object->length) {
+        return false;
+    }
+    *out = value_of(chunks[index].key, chunk_first(&chunks[index]));
+    return true;
+}
+
+static bool find_floor(const struct seahorse_bitmap_set_ni *const object,
+                       const uintmax_t value,
+                       uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    const struct chunk *const chunks = object->data;
+    const uintmax_t key = key_of(value);
+    uintmax_t index;
+    if (find_chunk(object, key, &index)) {
+        uint16_t low;
+        if (chunk_floor(&chunks[index], low_of(value), &low)) {
+            *out = value_of(key, low);
+            return true;
+        }
+    }
+    if (!index) {
+        return false;
+    }
+    index -= 1;
+    *out = value_of(chunks[index].key, chunk_last(&chunks[index]));
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_ceiling(
+        const struct seahorse_bitmap_set_ni *const object,
+        const uintmax_t value,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!find_ceiling(object, value, out)) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_floor(
+        const struct seahorse_bitmap_set_ni *const object,
+        const uintmax_t value,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!find_floor(object, value, out)) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_first(
+        const struct seahorse_bitmap_set_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->length) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_SET_IS_EMPTY;
+        return false;
+    }
+    const struct chunk *const chunk = object->data;
+    *out = value_of(chunk->key, chunk_first(chunk));
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_last(
+        const struct seahorse_bitmap_set_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->length) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_SET_IS_EMPTY;
+        return false;
+    }
+    const struct chunk *const chunk =
+            &((struct chunk *) object->data)[object->length - 1];
+    *out = value_of(chunk->key, chunk_last(chunk));
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_next(
+        const struct seahorse_bitmap_set_ni *const object,
+        const uintmax_t value,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (UINTMAX_MAX == value || !find_ceiling(object, 1 + value, out)) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_prev(
+        const struct seahorse_bitmap_set_ni *const object,
+        const uintmax_t value,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!value || !find_floor(object, value - 1, out)) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * The bitmap kernels below work a whole chunk at a time over a fixed number
+ * of words and fold the cardinality into the same pass, which keeps them in
+ * a shape that compilers vectorise.
+ */
+static bool union_chunk(struct chunk *const chunk,
+                        const struct chunk *const a,
+                        const struct chunk *const b) {
+    assert(chunk);
+    assert(a);
+    assert(b);
+    if (ARRAY == a->type && ARRAY == b->type
+        && a->count + b->count <= ARRAY_MAXIMUM) {
+        const uint32_t capacity = a->count + b->count;
+        uint16_t *const values = malloc(capacity * sizeof(*values));
+        if (!values) {
+            return false;
+        }
+        uint32_t i = 0, j = 0, n = 0;
+        while (i < a->count && j < b->count) {
+            if (a->values[i] < b->values[j]) {
+                values[n++] = a->values[i++];
+            } else if (b->values[j] < a->values[i]) {
+                values[n++] = b->values[j++];
+            } else {
+                values[n++] = a->values[i++];
+                j++;
+            }
+        }
+        while (i < a->count) {
+            values[n++] = a->values[i++];
+        }
+        while (j < b->count) {
+            values[n++] = b->values[j++];
+        }
+        *chunk = (struct chunk) {
+                .key = a->key,
+                .count = n,
+                .capacity = (uint16_t) capacity,
+                .type = ARRAY,
+                .values = values
+        };
+        return true;
+    }
+    uint64_t *const words = malloc(WORDS * sizeof(*words));
+    if (!words) {
+        return false;
+    }
+    uint32_t count = 0;
+    if (BITMAP == a->type && BITMAP == b->type) {
+        for (uint32_t i = 0; i < WORDS; i++) {
+            words[i] = a->words[i] | b->words[i];
+            count += popcount(words[i]);
+        }
+    } else {
+        /* exactly one of them holds its values in an array */
+        const struct chunk *const bitmap = BITMAP == a->type ? a : b;
+        const struct chunk *const array = BITMAP == a->type ? b : a;
+        memcpy(words, bitmap->words, WORDS * sizeof(*words));
+        for (uint32_t i = 0; i < array->count; i++) {
+            words[array->values[i] / WORD_BITS] |= bit_of(array->values[i]);
+        }
+        count = cardinality(words);
+    }
+    *chunk = (struct chunk) {
+            .key = a->key,
+            .count = count,
+            .type = BITMAP,
+            .words = words
+    };
+    return true;
+}
+
+bool seahorse_bitmap_set_ni_union(
+        struct seahorse_bitmap_set_ni *const object,
+        const struct seahorse_bitmap_set_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (object == other || !other->length) {
+        return true;
+    }
+    const uintmax_t capacity = object->length + other->length;
+    if (capacity > SIZE_MAX / sizeof(struct chunk)) {
+        seahorse_error =
+                SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct chunk *const chunks = malloc(capacity * sizeof(*chunks));
+    if (!chunks) {
+        seahorse_error =
+                SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    /*
+     * Chunks only present in object are moved over while the others are
+     * created anew, so object is left untouched until all of them exist.
+     */
+    const struct chunk *const a = object->data;
+    const struct chunk *const b = other->data;
+    uintmax_t i = 0, j = 0, n = 0, count = 0;
+    while (j < other->length) {
+        bool result = true;
+        if (i < object->length && a[i].key < b[j].key) {
+            chunks[n] = a[i++];
+        } else if (i < object->length && a[i].key == b[j].key) {
+            result = union_chunk(&chunks[n], &a[i++], &b[j++]);
+        } else {
+            result = copy_chunk(&chunks[n], &b[j++]);
+        }
+        if (!result) {
+            for (uintmax_t k = 0, l = 0; k < n; k++) {
+                while (l < other->length && b[l].key < chunks[k].key) {
+                    l++;
+                }
+                if (l < other->length && b[l].key == chunks[k].key) {
+                    free(chunks[k].values);
+                }
+            }
+            free(chunks);
+            seahorse_error =
+                    SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        count += chunks[n++].count;
+    }
+    while (i < object->length) {
+        count += a[i].count;
+        chunks[n++] = a[i++];
+    }
+    for (uintmax_t k = 0, l = 0; k < object->length; k++) {
+        while (l < other->length && b[l].key < a[k].key) {
+            l++;
+        }
+        if (l < other->length && b[l].key == a[k].key) {
+            free(a[k].values);
+        }
+    }
+    free(object->data);
+    object->data = chunks;
+    object->length = n;
+    object->capacity = capacity;
+    object->count = count;
+    return true;
+}
+
+static void intersect_chunk(struct chunk *const chunk,
+                            const struct chunk *const other) {
+    assert(chunk);
+    assert(other);
+    uint32_t n = 0;
+    if (ARRAY == chunk->type && ARRAY == other->type) {
+        for (uint32_t i = 0, j = 0; i < chunk->count && j < other->count;) {
+            if (chunk->values[i] < other->values[j]) {
+                i++;
+            } else if (other->values[j] < chunk->values[i]) {
+                j++;
+            } else {
+                chunk->values[n++] = chunk->values[i++];
+                j++;
+            }
+        }
+    } else if (ARRAY == chunk->type) {
+        for (uint32_t i = 0; i < chunk->count; i++) {
+            if (chunk_contains(other, chunk->values[i])) {
+                chunk->values[n++] = chunk->values[i];
+            }
+        }
+    } else if (BITMAP == other->type) {
+        for (uint32_t i = 0; i < WORDS; i++) {
+            chunk->words[i] &= other->words[i];
+            n += popcount(chunk->words[i]);
+        }
+    } else {
+        for (uint32_t i = 0, j = 0; i < WORDS; i++) {
+            uint64_t mask = 0;
+            for (; j < other->count && other->values[j] / WORD_BITS == i; j++) {
+                mask |= bit_of(other->values[j]);
+            }
+            chunk->words[i] &= mask;
+            n += popcount(chunk->words[i]);
+        }
+    }
+    chunk->count = n;
+    compact(chunk);
+}
+
+bool seahorse_bitmap_set_ni_intersection(
+        struct seahorse_bitmap_set_ni *const object,
+        const struct seahorse_bitmap_set_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (object == other) {
+        return true;
+    }
+    struct chunk *const chunks = object->data;
+    const struct chunk *const others = other->data;
+    uintmax_t n = 0, count = 0;
+    for (uintmax_t i = 0, j = 0; i < object->length; i++) {
+        while (j < other->length && others[j].key < chunks[i].key) {
+            j++;
+        }
+        if (j < other->length && others[j].key == chunks[i].key) {
+            intersect_chunk(&chunks[i], &others[j]);
+        } else {
+            chunks[i].count = 0;
+        }
+        if (!chunks[i].count) {
+            free(chunks[i].values);
+            continue;
+        }
+        count += chunks[i].count;
+        chunks[n++] = chunks[i];
+    }
+    object->length = n;
+    object->count = count;
+    return true;
+}
+
+static void subtract_chunk(struct chunk *const chunk,
+                           const struct chunk *const other) {
+    assert(chunk);
+    assert(other);
+    uint32_t n = 0;
+    if (ARRAY == chunk->type && ARRAY == other->type) {
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < chunk->count; i++) {
+            while (j < other->count && other->values[j] < chunk->values[i]) {
+                j++;
+            }
+            if (j == other->count || other->values[j] != chunk->values[i]) {
+                chunk->values[n++] = chunk->values[i];
+            }
+        }
+    } else if (ARRAY == chunk->type) {
+        for (uint32_t i = 0; i < chunk->count; i++) {
+            if (!chunk_contains(other, chunk->values[i])) {
+                chunk->values[n++] = chunk->values[i];
+            }
+        }
+    } else if (BITMAP == other->type) {
+        for (uint32_t i = 0; i < WORDS; i++) {
+            chunk->words[i] &= ~other->words[i];
+            n += popcount(chunk->words[i]);
+        }
+    } else {
+        n = chunk->count;
+        for (uint32_t j = 0; j < other->count; j++) {
+            uint64_t *const word = &chunk->words[other->values[j] / WORD_BITS];
+            const uint64_t bit = bit_of(other->values[j]);
+            n -= (*word & bit) != 0;
+            *word &= ~bit;
+        }
+    }
+    chunk->count = n;
+    compact(chunk);
+}
+
+bool seahorse_bitmap_set_ni_difference(
+        struct seahorse_bitmap_set_ni *const object,
+        const struct seahorse_bitmap_set_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (object == other) {
+        invalidate(object);
+        return true;
+    }
+    struct chunk *const chunks = object->data;
+    const struct chunk *const others = other->data;
+    uintmax_t n = 0, count = 0;
+    for (uintmax_t i = 0, j = 0; i < object->length; i++) {
+        while (j < other->length && others[j].key < chunks[i].key) {
+            j++;
+        }
+        if (j < other->length && others[j].key == chunks[i].key) {
+            subtract_chunk(&chunks[i], &others[j]);
+        }
+        if (!chunks[i].count) {
+            free(chunks[i].values);
+            continue;
+        }
+        count += chunks[i].count;
+        chunks[n++] = chunks[i];
+    }
+    object->length = n;
+    object->count = count;
+    return true;
+}
@@ -0,0 +1,1274 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/*
+ * Every node takes up NODE_SIZE bytes aligned on NODE_SIZE, which is eight
+ * cache lines. A leaf keeps its keys apart from its values so that searching
+ * a node only reads the lines holding keys. An entry is the address of its
+ * key in a leaf, hence the leaf is found again by masking that address.
+ * Branches own a copy of each of their separator keys.
+ */
+#define NODE_SIZE                       512
+#define LEAF_ORDER                      \
+        ((NODE_SIZE - sizeof(uintmax_t) - 2 * sizeof(void *)) \
+         / (2 * sizeof(struct sea_turtle_integer)))
+#define LEAF_MINIMUM                    (LEAF_ORDER / 2)
+#define BRANCH_ORDER                    \
+        ((NODE_SIZE - sizeof(uintmax_t) - sizeof(void *)) \
+         / (sizeof(struct sea_turtle_integer) + sizeof(void *)))
+#define BRANCH_MINIMUM                  (BRANCH_ORDER / 2)
+/* nodes other than the root have at least BRANCH_MINIMUM + 1 children */
+#define MAXIMUM_HEIGHT                  64
+
+struct leaf {
+    uintmax_t count;
+    struct leaf *prev;
+    struct leaf *next;
+    struct sea_turtle_integer keys[LEAF_ORDER];
+    struct sea_turtle_integer values[LEAF_ORDER];
+};
+
+struct branch {
+    uintmax_t count;
+    struct sea_turtle_integer keys[BRANCH_ORDER];
+    void *children[BRANCH_ORDER + 1];
+};
+
+struct path {
+    struct branch *branches[MAXIMUM_HEIGHT];
+    uintmax_t indexes[MAXIMUM_HEIGHT];
+};
+
+_Static_assert(sizeof(struct leaf) <= NODE_SIZE, "leaf must fit in a node");
+_Static_assert(sizeof(struct branch) <= NODE_SIZE,
+               "branch must fit in a node");
+_Static_assert(LEAF_ORDER >= 4 && BRANCH_ORDER >= 4,
+               "nodes must hold at least four keys");
+
+static int compare(const struct sea_turtle_integer *const a,
+                   const struct sea_turtle_integer *const b) {
+    assert(a);
+    assert(b);
+    return sea_turtle_integer_compare(a, b);
+}
+
+/*
+ * Binary search without a data dependent branch in the loop, the comparison
+ * only selects the next base.
+ */
+static uintmax_t count_less(const struct sea_turtle_integer *const keys,
+                            const uintmax_t count,
+                            const struct sea_turtle_integer *const key) {
+    assert(keys);
+    assert(key);
+    if (!count) {
+        return 0;
+    }
+    const struct sea_turtle_integer *base = keys;
+    for (uintmax_t i = count; i > 1;) {
+        const uintmax_t half = i / 2;
+        base = compare(&base[half], key) < 0 ? base + half : base;
+        i -= half;
+    }
+    return (base - keys) + (compare(&base[0], key) < 0);
+}
+
+static uintmax_t count_less_or_equal(
+        const struct sea_turtle_integer *const keys,
+        const uintmax_t count,
+        const struct sea_turtle_integer *const key) {
+    assert(keys);
+    assert(key);
+    if (!count) {
+        return 0;
+    }
+    const struct sea_turtle_integer *base = keys;
+    for (uintmax_t i = count; i > 1;) {
+        const uintmax_t half = i / 2;
+        base = compare(&base[half], key) <= 0 ? base + half : base;
+        i -= half;
+    }
+    return (base - keys) + (compare(&base[0], key) <= 0);
+}
+
+static bool copy_of(struct sea_turtle_integer *const object,
+                    const struct sea_turtle_integer *const other) {
+    assert(object);
+    assert(other);
+    if (!sea_turtle_integer_init_integer(object, other)) {
+        seagrass_required_true(SEA_TURTLE_INTEGER_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
+
+static bool node_of(void **const out) {
+    assert(out);
+    if (posix_memalign(out, NODE_SIZE, NODE_SIZE)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
+
+static struct leaf *leaf_of(
+        const struct seahorse_btree_map_i_i_entry *const entry) {
+    assert(entry);
+    return (struct leaf *) ((uintptr_t) entry & ~(uintptr_t) (NODE_SIZE - 1));
+}
+
+static uintmax_t index_of(const struct leaf *const node,
+                          const struct seahorse_btree_map_i_i_entry *const
+                          entry) {
+    assert(node);
+    assert(entry);
+    const uintmax_t index =
+            (const struct sea_turtle_integer *) entry - node->keys;
+    assert(index < node->count);
+    return index;
+}
+
+static const struct seahorse_btree_map_i_i_entry *entry_of(
+        const struct leaf *const node,
+        const uintmax_t index) {
+    assert(node);
+    assert(index < node->count);
+    return (const struct seahorse_btree_map_i_i_entry *) &node->keys[index];
+}
+
+static void destroy(void *const node, const uintmax_t height) {
+    assert(node);
+    if (height) {
+        struct branch *const branch = node;
+        for (uintmax_t i = 0; i < branch->count; i++) {
+            seagrass_required_true(sea_turtle_integer_invalidate(
+                    &branch->keys[i]));
+        }
+        for (uintmax_t i = 0; i <= branch->count; i++) {
+            destroy(branch->children[i], height - 1);
+        }
+    } else {
+        struct leaf *const leaf = node;
+        for (uintmax_t i = 0; i < leaf->count; i++) {
+            seagrass_required_true(sea_turtle_integer_invalidate(
+                    &leaf->keys[i]));
+            seagrass_required_true(sea_turtle_integer_invalidate(
+                    &leaf->values[i]));
+        }
+    }
+    free(node);
+}
+
+static void init(struct seahorse_btree_map_i_i *const object) {
+    assert(object);
+    *object = (struct seahorse_btree_map_i_i) {0};
+}
+
+bool seahorse_btree_map_i_i_init(struct seahorse_btree_map_i_i *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+static void invalidate(struct seahorse_btree_map_i_i *const object) {
+    assert(object);
+    if (object->root) {
+        destroy(object->root, object->height);
+    }
+    *object = (struct seahorse_btree_map_i_i) {0};
+}
+
+bool seahorse_btree_map_i_i_invalidate(
+        struct seahorse_btree_map_i_i *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    invalidate(object);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_count(
+        const struct seahorse_btree_map_i_i *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Separator keys[i] of a branch is greater than every key below children[i]
+ * and not greater than any key below children[i + 1].
+ */
+static struct leaf *descend(const struct seahorse_btree_map_i_i *const object,
+                            const struct sea_turtle_integer *const key,
+                            struct path *const path) {
+    assert(object);
+    assert(object->root);
+    assert(key);
+    assert(object->height <= MAXIMUM_HEIGHT);
+    void *node = object->root;
+    for (uintmax_t i = 0; i < object->height; i++) {
+        struct branch *const branch = node;
+        const uintmax_t index = count_less_or_equal(
+                branch->keys, branch->count, key);
+        if (path) {
+            path->branches[i] = branch;
+            path->indexes[i] = index;
+        }
+        node = branch->children[index];
+    }
+    return node;
+}
+
+static void leaf_insert(struct leaf *const node,
+                        const uintmax_t index,
+                        const struct sea_turtle_integer *const key,
+                        const struct sea_turtle_integer *const value) {
+    assert(node);
+    assert(node->count < LEAF_ORDER);
+    assert(index <= node->count);
+    const uintmax_t tail = node->count - index;
+    memmove(&node->keys[index + 1], &node->keys[index],
+            tail * sizeof(*node->keys));
+    memmove(&node->values[index + 1], &node->values[index],
+            tail * sizeof(*node->values));
+    node->keys[index] = *key;
+    node->values[index] = *value;
+    node->count += 1;
+}
+
+/*
+ * Splits the full leaf while inserting the key-value association, the new
+ * right sibling receives the upper half.
+ */
+static struct sea_turtle_integer *leaf_split(
+        struct seahorse_btree_map_i_i *const object,
+        struct leaf *const node,
+        struct leaf *const right,
+        const uintmax_t index,
+        const struct sea_turtle_integer *const key,
+        const struct sea_turtle_integer *const value) {
+    assert(object);
+    assert(node);
+    assert(right);
+    assert(LEAF_ORDER == node->count);
+    struct sea_turtle_integer keys[LEAF_ORDER + 1];
+    struct sea_turtle_integer values[LEAF_ORDER + 1];
+    memcpy(keys, node->keys, index * sizeof(*keys));
+    memcpy(values, node->values, index * sizeof(*values));
+    keys[index] = *key;
+    values[index] = *value;
+    memcpy(&keys[index + 1], &node->keys[index],
+           (LEAF_ORDER - index) * sizeof(*keys));
+    memcpy(&values[index + 1], &node->values[index],
+           (LEAF_ORDER - index) * sizeof(*values));
+    const uintmax_t count = (LEAF_ORDER + 1) / 2;
+    node->count = count;
+    memcpy(node->keys, keys, count * sizeof(*keys));
+    memcpy(node->values, values, count * sizeof(*values));
+    right->count = LEAF_ORDER + 1 - count;
+    memcpy(right->keys, &keys[count], right->count * sizeof(*keys));
+    memcpy(right->values, &values[count], right->count * sizeof(*values));
+    right->prev = node;
+    right->next = node->next;
+    if (node->next) {
+        node->next->prev = right;
+    } else {
+        object->last = right;
+    }
+    node->next = right;
+    return index < count
+           ? &node->keys[index]
+           : &right->keys[index - count];
+}
+
+static void branch_insert(struct branch *const node,
+                          const uintmax_t index,
+                          const struct sea_turtle_integer *const key,
+                          void *const child) {
+    assert(node);
+    assert(node->count < BRANCH_ORDER);
+    assert(index <= node->count);
+    const uintmax_t tail = node->count - index;
+    memmove(&node->keys[index + 1], &node->keys[index],
+            tail * sizeof(*node->keys));
+    memmove(&node->children[index + 2], &node->children[index + 1],
+            tail * sizeof(*node->children));
+    node->keys[index] = *key;
+    node->children[index + 1] = child;
+    node->count += 1;
+}
+
+/*
+ * Splits the full branch while inserting the separator key and its right
+ * child, the middle key is moved up into key.
+ */
+static void branch_split(struct branch *const node,
+                         struct branch *const right,
+                         const uintmax_t index,
+                         struct sea_turtle_integer *const key,
+                         void *const child) {
+    assert(node);
+    assert(right);
+    assert(key);
+    assert(BRANCH_ORDER == node->count);
+    struct sea_turtle_integer keys[BRANCH_ORDER + 1];
+    void *children[BRANCH_ORDER + 2];
+    memcpy(keys, node->keys, index * sizeof(*keys));
+    keys[index] = *key;
+    memcpy(&keys[index + 1], &node->keys[index],
+           (BRANCH_ORDER - index) * sizeof(*keys));
+    memcpy(children, node->children, (index + 1) * sizeof(*children));
+    children[index + 1] = child;
+    memcpy(&children[index + 2], &node->children[index + 1],
+           (BRANCH_ORDER - index) * sizeof(*children));
+    const uintmax_t count = (BRANCH_ORDER + 1) / 2;
+    node->count = count;
+    memcpy(node->keys, keys, count * sizeof(*keys));
+    memcpy(node->children, children, (count + 1) * sizeof(*children));
+    *key = keys[count];
+    right->count = BRANCH_ORDER - count;
+    memcpy(right->keys, &keys[count + 1], right->count * sizeof(*keys));
+    memcpy(right->children, &children[count + 1],
+           (right->count + 1) * sizeof(*children));
+}
+
+/*
+ * Returns the key that becomes the first key of the right leaf when the
+ * full leaf is split while inserting key at index.
+ */
+static const struct sea_turtle_integer *split_key(
+        const struct leaf *const node,
+        const uintmax_t index,
+        const struct sea_turtle_integer *const key) {
+    assert(node);
+    assert(key);
+    const uintmax_t count = (LEAF_ORDER + 1) / 2;
+    if (index == count) {
+        return key;
+    }
+    return index < count ? &node->keys[count - 1] : &node->keys[count];
+}
+
+/*
+ * The copies of key and value, all nodes that a split may need and the
+ * separator for a split leaf are allocated before the tree is changed, so
+ * that running out of memory leaves the tree as it was.
+ */
+static bool insert(struct seahorse_btree_map_i_i *const object,
+                   const struct sea_turtle_integer *const key,
+                   const struct sea_turtle_integer *const value) {
+    assert(object);
+    assert(key);
+    assert(value);
+    if (!object->root) {
+        struct leaf *node;
+        if (!node_of((void **) &node)) {
+            return false;
+        }
+        *node = (struct leaf) {0};
+        object->root = object->first = object->last = node;
+    }
+    struct path path;
+    struct leaf *const node = descend(object, key, &path);
+    const uintmax_t index = count_less(node->keys, node->count, key);
+    if (index < node->count && !compare(&node->keys[index], key)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    struct sea_turtle_integer copies[3];
+    if (!copy_of(&copies[0], key)) {
+        return false;
+    }
+    if (!copy_of(&copies[1], value)) {
+        seagrass_required_true(sea_turtle_integer_invalidate(&copies[0]));
+        return false;
+    }
+    if (node->count < LEAF_ORDER) {
+        leaf_insert(node, index, &copies[0], &copies[1]);
+        object->count += 1;
+        return true;
+    }
+    void *spares[MAXIMUM_HEIGHT + 2];
+    uintmax_t needed = 2;
+    for (uintmax_t i = object->height; i > 0; i--) {
+        if (BRANCH_ORDER != path.branches[i - 1]->count) {
+            needed -= 1;
+            break;
+        }
+        needed += 1;
+    }
+    for (uintmax_t i = 0; i < needed; i++) {
+        if (!node_of(&spares[i])) {
+            for (uintmax_t j = 0; j < i; j++) {
+                free(spares[j]);
+            }
+            seagrass_required_true(sea_turtle_integer_invalidate(&copies[0]));
+            seagrass_required_true(sea_turtle_integer_invalidate(&copies[1]));
+            return false;
+        }
+    }
+    if (!copy_of(&copies[2], split_key(node, index, key))) {
+        for (uintmax_t i = 0; i < needed; i++) {
+            free(spares[i]);
+        }
+        seagrass_required_true(sea_turtle_integer_invalidate(&copies[0]));
+        seagrass_required_true(sea_turtle_integer_invalidate(&copies[1]));
+        return false;
+    }
+    leaf_split(object, node, spares[--needed], index, &copies[0], &copies[1]);
+    object->count += 1;
+    struct sea_turtle_integer separator = copies[2];
+    void *child = node->next;
+    for (uintmax_t i = object->height; i > 0; i--) {
+        struct branch *const branch = path.branches[i - 1];
+        if (branch->count < BRANCH_ORDER) {
+            branch_insert(branch, path.indexes[i - 1], &separator, child);
+            assert(!needed);
+            return true;
+        }
+        struct branch *const right = spares[--needed];
+        branch_split(branch, right, path.indexes[i - 1], &separator, child);
+        child = right;
+    }
+    struct branch *const root = spares[--needed];
+    assert(!needed);
+    root->count = 1;
+    root->keys[0] = separator;
+    root->children[0] = object->root;
+    root->children[1] = child;
+    object->root = root;
+    object->height += 1;
+    return true;
+}
+
+/*
+ * Copy key-value associations in order, since each is added after the
+ * largest key the copy ends up with the leaves filled to the split point.
+ */
+bool seahorse_btree_map_i_i_init_btree_map_i_i(
+        struct seahorse_btree_map_i_i *const object,
+        const struct seahorse_btree_map_i_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    for (const struct leaf *node = other->first; node; node = node->next) {
+        for (uintmax_t i = 0; i < node->count; i++) {
+            if (!insert(object, &node->keys[i], &node->values[i])) {
+                invalidate(object);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool seahorse_btree_map_i_i_add(
+        struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct sea_turtle_integer *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    return insert(object, key, value);
+}
+
+/*
+ * Removes the key-value association at index without invalidating it.
+ */
+static void leaf_erase(struct leaf *const node, const uintmax_t index) {
+    assert(node);
+    assert(index < node->count);
+    const uintmax_t tail = node->count - index - 1;
+    memmove(&node->keys[index], &node->keys[index + 1],
+            tail * sizeof(*node->keys));
+    memmove(&node->values[index], &node->values[index + 1],
+            tail * sizeof(*node->values));
+    node->count -= 1;
+}
+
+/*
+ * Removes the separator key at index together with the child to its right,
+ * without invalidating the separator key.
+ */
+static void branch_erase(struct branch *const node, const uintmax_t index) {
+    assert(node);
+    assert(index < node->count);
+    const uintmax_t tail = node->count - index - 1;
+    memmove(&node->keys[index], &node->keys[index + 1],
+            tail * sizeof(*node->keys));
+    memmove(&node->children[index + 1], &node->children[index + 2],
+            tail * sizeof(*node->children));
+    node->count -= 1;
+}
+
+/*
+ * Moves all key-value associations of right into node and releases right.
+ */
+static void leaf_merge(struct seahorse_btree_map_i_i *const object,
+                       struct leaf *const node,
+                       struct leaf *const right) {
+    assert(object);
+    assert(node);
+    assert(right);
+    assert(node->count + right->count <= LEAF_ORDER);
+    memcpy(&node->keys[node->count], right->keys,
+           right->count * sizeof(*right->keys));
+    memcpy(&node->values[node->count], right->values,
+           right->count * sizeof(*right->values));
+    node->count += right->count;
+    node->next = right->next;
+    if (right->next) {
+        right->next->prev = node;
+    } else {
+        object->last = node;
+    }
+    free(right);
+}
+
+/*
+ * Replaces separator keys[index] of parent with a copy of key, the
+ * separator is left as it was if there is insufficient memory.
+ */
+static bool separator_set(struct branch *const parent,
+                          const uintmax_t index,
+                          const struct sea_turtle_integer *const key) {
+    assert(parent);
+    assert(key);
+    struct sea_turtle_integer copy;
+    if (!copy_of(&copy, key)) {
+        return false;
+    }
+    seagrass_required_true(sea_turtle_integer_invalidate(
+            &parent->keys[index]));
+    parent->keys[index] = copy;
+    return true;
+}
+
+/*
+ * Refills the leaf at index of parent which fell below its minimum by taking
+ * from a sibling, or merges the leaf with a sibling when neither can spare a
+ * key-value association. Taking from a sibling needs a copy of the new
+ * separator key, if that copy cannot be made the leaf is merged if it fits
+ * or otherwise left below its minimum which only costs space.
+ */
+static void leaf_rebalance(struct seahorse_btree_map_i_i *const object,
+                           struct branch *const parent,
+                           const uintmax_t index) {
+    assert(object);
+    assert(parent);
+    struct leaf *const node = parent->children[index];
+    struct leaf *const left = index ? parent->children[index - 1] : NULL;
+    struct leaf *const right = index < parent->count
+                               ? parent->children[index + 1] : NULL;
+    if (left && left->count > LEAF_MINIMUM
+        && separator_set(parent, index - 1,
+                         &left->keys[left->count - 1])) {
+        left->count -= 1;
+        leaf_insert(node, 0, &left->keys[left->count],
+                    &left->values[left->count]);
+    } else if (right && right->count > LEAF_MINIMUM
+               && separator_set(parent, index, &right->keys[1])) {
+        leaf_insert(node, node->count, &right->keys[0], &right->values[0]);
+        leaf_erase(right, 0);
+    } else if (left && left->count + node->count <= LEAF_ORDER) {
+        seagrass_required_true(sea_turtle_integer_invalidate(
+                &parent->keys[index - 1]));
+        leaf_merge(object, left, node);
+        branch_erase(parent, index - 1);
+    } else if (right && node->count + right->count <= LEAF_ORDER) {
+        seagrass_required_true(sea_turtle_integer_invalidate(
+                &parent->keys[index]));
+        leaf_merge(object, node, right);
+        branch_erase(parent, index);
+    }
+}
+
+static void branch_merge(struct branch *const parent,
+                         const uintmax_t index) {
+    assert(parent);
+    struct branch *const node = parent->children[index];
+    struct branch *const right = parent->children[index + 1];
+    assert(node->count + 1 + right->count <= BRANCH_ORDER);
+    node->keys[node->count] = parent->keys[index];
+    memcpy(&node->keys[node->count + 1], right->keys,
+           right->count * sizeof(*right->keys));
+    memcpy(&node->children[node->count + 1], right->children,
+           (right->count + 1) * sizeof(*right->children));
+    node->count += 1 + right->count;
+    free(right);
+    branch_erase(parent, index);
+}
+
+/*
+ * Separator keys are rotated through the parent, so no copies are needed.
+ */
+static void branch_rebalance(struct branch *const parent,
+                             const uintmax_t index) {
+    assert(parent);
+    struct branch *const node = parent->children[index];
+    struct branch *const left = index ? parent->children[index - 1] : NULL;
+    struct branch *const right = index < parent->count
+                                 ? parent->children[index + 1] : NULL;
+    if (left && left->count > BRANCH_MINIMUM) {
+        memmove(&node->keys[1], node->keys,
+                node->count * sizeof(*node->keys));
+        memmove(&node->children[1], node->children,
+                (node->count + 1) * sizeof(*node->children));
+        node->keys[0] = parent->keys[index - 1];
+        node->children[0] = left->children[left->count];
+        node->count += 1;
+        parent->keys[index - 1] = left->keys[left->count - 1];
+        left->count -= 1;
+    } else if (right && right->count > BRANCH_MINIMUM) {
+        node->keys[node->count] = parent->keys[index];
+        node->children[node->count + 1] = right->children[0];
+        node->count += 1;
+        parent->keys[index] = right->keys[0];
+        memmove(right->keys, &right->keys[1],
+                (right->count - 1) * sizeof(*right->keys));
+        memmove(right->children, &right->children[1],
+                right->count * sizeof(*right->children));
+        right->count -= 1;
+    } else if (left) {
+        branch_merge(parent, index - 1);
+    } else {
+        assert(right);
+        branch_merge(parent, index);
+    }
+}
+
+static void erase(struct seahorse_btree_map_i_i *const object,
+                  const struct path *const path,
+                  struct leaf *const node,
+                  const uintmax_t index) {
+    assert(object);
+    assert(path);
+    assert(node);
+    seagrass_required_true(sea_turtle_integer_invalidate(&node->keys[index]));
+    seagrass_required_true(sea_turtle_integer_invalidate(
+            &node->values[index]));
+    leaf_erase(node, index);
+    object->count -= 1;
+    if (!object->height) {
+        if (!node->count) {
+            free(node);
+            object->root = object->first = object->last = NULL;
+        }
+        return;
+    }
+    if (node->count >= LEAF_MINIMUM) {
+        return;
+    }
+    uintmax_t i = object->height - 1;
+    leaf_rebalance(object, path->branches[i], path->indexes[i]);
+    for (; i > 0 && path->branches[i]->count < BRANCH_MINIMUM; i--) {
+        branch_rebalance(path->branches[i - 1], path->indexes[i - 1]);
+    }
+    struct branch *const root = object->root;
+    if (!root->count) {
+        object->root = root->children[0];
+        object->height -= 1;
+        free(root);
+    }
+}
+
+static bool find(const struct seahorse_btree_map_i_i *const object,
+                 const struct sea_turtle_integer *const key,
+                 struct path *const path,
+                 struct leaf **const node,
+                 uintmax_t *const index) {
+    assert(object);
+    assert(key);
+    assert(node);
+    assert(index);
+    if (!object->root) {
+        return false;
+    }
+    *node = descend(object, key, path);
+    *index = count_less((*node)->keys, (*node)->count, key);
+    return *index < (*node)->count && !compare(&(*node)->keys[*index], key);
+}
+
+bool seahorse_btree_map_i_i_remove(
+        struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    struct path path;
+    struct leaf *node;
+    uintmax_t index;
+    if (!find(object, key, &path, &node, &index)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    erase(object, &path, node, index);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_contains(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct leaf *node;
+    uintmax_t index;
+    *out = find(object, key, NULL, &node, &index);
+    return true;
+}
+
+/*
+ * The leaf that descend selects for key holds every key of the map between
+ * its neighbouring separators, so a missing ceiling, floor, higher or lower
+ * key can only be the first key of the next leaf or the last key of the
+ * previous one.
+ */
+static const struct seahorse_btree_map_i_i_entry *find_ceiling(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const bool inclusive) {
+    assert(object);
+    assert(key);
+    if (!object->root) {
+        return NULL;
+    }
+    const struct leaf *node = descend(object, key, NULL);
+    const uintmax_t index = inclusive
+                            ? count_less(node->keys, node->count, key)
+                            : count_less_or_equal(node->keys, node->count, key);
+    if (index < node->count) {
+        return entry_of(node, index);
+    }
+    node = node->next;
+    return node ? entry_of(node, 0) : NULL;
+}
+
+static const struct seahorse_btree_map_i_i_entry *find_floor(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const bool inclusive) {
+    assert(object);
+    assert(key);
+    if (!object->root) {
+        return NULL;
+    }
+    const struct leaf *node = descend(object, key, NULL);
+    const uintmax_t index = inclusive
+                            ? count_less_or_equal(node->keys, node->count, key)
+                            : count_less(node->keys, node->count, key);
+    if (index) {
+        return entry_of(node, index - 1);
+    }
+    node = node->prev;
+    return node ? entry_of(node, node->count - 1) : NULL;
+}
+
+static struct sea_turtle_integer *value_of(
+        const struct seahorse_btree_map_i_i_entry *const entry) {
+    assert(entry);
+    struct leaf *const node = leaf_of(entry);
+    return &node->values[index_of(node, entry)];
+}
+
+bool seahorse_btree_map_i_i_get(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct leaf *node;
+    uintmax_t index;
+    if (!find(object, key, NULL, &node, &index)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &node->values[index];
+    return true;
+}
+
+bool seahorse_btree_map_i_i_ceiling(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_ceiling(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_floor(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_floor(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_higher(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_ceiling(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_lower(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_floor(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_first(
+        const struct seahorse_btree_map_i_i *const object,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    struct leaf *const node = object->first;
+    *out = &node->values[0];
+    return true;
+}
+
+bool seahorse_btree_map_i_i_last(
+        const struct seahorse_btree_map_i_i *const object,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    struct leaf *const node = object->last;
+    *out = &node->values[node->count - 1];
+    return true;
+}
+
+bool seahorse_btree_map_i_i_get_entry(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct leaf *node;
+    uintmax_t index;
+    if (!find(object, key, NULL, &node, &index)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(node, index);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_ceiling_entry(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_ceiling(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_i_i_floor_entry(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_floor(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_i_i_higher_entry(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_ceiling(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_i_i_lower_entry(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_i_i_entry *const entry
+            = find_floor(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_i_i_first_entry(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = entry_of(object->first, 0);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_last_entry(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    const struct leaf *const node = object->last;
+    *out = entry_of(node, node->count - 1);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_remove_entry(
+        struct seahorse_btree_map_i_i *const object,
+        const struct seahorse_btree_map_i_i_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    /* the path from the root is needed to rebalance the tree */
+    struct path path;
+    struct leaf *node;
+    uintmax_t index;
+    seagrass_required_true(find(object,
+                                (const struct sea_turtle_integer *) entry,
+                                &path, &node, &index));
+    assert(entry_of(node, index) == entry);
+    erase(object, &path, node, index);
+    return true;
+}
+
+bool seahorse_btree_map_i_i_next_entry(
+        const struct seahorse_btree_map_i_i_entry *const entry,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct leaf *const node = leaf_of(entry);
+    const uintmax_t index = 1 + index_of(node, entry);
+    if (index < node->count) {
+        *out = entry_of(node, index);
+    } else if (node->next) {
+        *out = entry_of(node->next, 0);
+    } else {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_btree_map_i_i_prev_entry(
+        const struct seahorse_btree_map_i_i_entry *const entry,
+        const struct seahorse_btree_map_i_i_entry **const out) {
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct leaf *const node = leaf_of(entry);
+    const uintmax_t index = index_of(node, entry);
+    if (index) {
+        *out = entry_of(node, index - 1);
+    } else if (node->prev) {
+        *out = entry_of(node->prev, node->prev->count - 1);
+    } else {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_btree_map_i_i_entry_key(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct seahorse_btree_map_i_i_entry *const entry,
+        const struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = (const struct sea_turtle_integer *) entry;
+    return true;
+}
+
+bool seahorse_btree_map_i_i_entry_value(
+        const struct seahorse_btree_map_i_i *const object,
+        const struct seahorse_btree_map_i_i_entry *const entry,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
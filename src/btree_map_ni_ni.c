@@ -0,0 +1,1294 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) \
+    && UINTMAX_MAX == UINT64_MAX
+#include <immintrin.h>
+#define AVX2                            __attribute__((target("avx2")))
+#endif
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/*
+ * Every node takes up NODE_SIZE bytes aligned on NODE_SIZE, which is eight
+ * cache lines. A leaf keeps its keys apart from its values so that searching
+ * a node only reads the lines holding keys. An entry is the address of its
+ * key in a leaf, hence the leaf is found again by masking that address.
+ */
+#define NODE_SIZE                       512
+#define LEAF_ORDER                      \
+        ((NODE_SIZE - sizeof(uintmax_t) - 2 * sizeof(void *)) \
+         / (2 * sizeof(uintmax_t)))
+#define LEAF_MINIMUM                    (LEAF_ORDER / 2)
+#define BRANCH_ORDER                    \
+        ((NODE_SIZE - sizeof(uintmax_t) - sizeof(void *)) \
+         / (sizeof(uintmax_t) + sizeof(void *)))
+#define BRANCH_MINIMUM                  (BRANCH_ORDER / 2)
+/* nodes other than the root have at least BRANCH_MINIMUM + 1 children */
+#define MAXIMUM_HEIGHT                  32
+
+struct leaf {
+    uintmax_t count;
+    struct leaf *prev;
+    struct leaf *next;
+    uintmax_t keys[LEAF_ORDER];
+    uintmax_t values[LEAF_ORDER];
+};
+
+struct branch {
+    uintmax_t count;
+    uintmax_t keys[BRANCH_ORDER];
+    void *children[BRANCH_ORDER + 1];
+};
+
+struct path {
+    struct branch *branches[MAXIMUM_HEIGHT];
+    uintmax_t indexes[MAXIMUM_HEIGHT];
+};
+
+_Static_assert(sizeof(struct leaf) <= NODE_SIZE, "leaf must fit in a node");
+_Static_assert(sizeof(struct branch) <= NODE_SIZE,
+               "branch must fit in a node");
+
+/*
+ * Counting the smaller keys without branching on the outcome of each
+ * comparison allows the compiler to vectorize the loop.
+ */
+static uintmax_t count_less_scalar(const uintmax_t *const keys,
+                                   const uintmax_t count,
+                                   const uintmax_t key) {
+    assert(keys);
+    uintmax_t result = 0;
+    for (uintmax_t i = 0; i < count; i++) {
+        result += keys[i] < key;
+    }
+    return result;
+}
+
+static uintmax_t count_less_or_equal_scalar(const uintmax_t *const keys,
+                                            const uintmax_t count,
+                                            const uintmax_t key) {
+    assert(keys);
+    uintmax_t result = 0;
+    for (uintmax_t i = 0; i < count; i++) {
+        result += keys[i] <= key;
+    }
+    return result;
+}
+
+#ifdef TEST
+bool avx2_is_overridden;
+#endif
+
+#if defined(AVX2)
+/*
+ * Keys are compared four at a time. AVX2 only compares signed 64-bit
+ * integers so the sign bit of both operands is flipped first. The last load
+ * may read past count, which stays within the node, and those lanes are
+ * masked off. These are compiled for AVX2 regardless of the flags of the
+ * build and are only called once the processor is known to support it.
+ */
+AVX2 static __m256i key_load(const uintmax_t *const keys) {
+    return _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) keys),
+                            _mm256_set1_epi64x(INT64_MIN));
+}
+
+AVX2 static uintmax_t lanes(const __m256i mask, const uintmax_t remaining) {
+    unsigned int result = (unsigned int) _mm256_movemask_pd(
+            _mm256_castsi256_pd(mask));
+    if (remaining < 4) {
+        result &= (1u << remaining) - 1;
+    }
+    return (uintmax_t) __builtin_popcount(result);
+}
+
+AVX2 static uintmax_t count_less_avx2(const uintmax_t *const keys,
+                                      const uintmax_t count,
+                                      const uintmax_t key) {
+    assert(keys);
+    const __m256i needle = _mm256_xor_si256(
+            _mm256_set1_epi64x((long long) key),
+            _mm256_set1_epi64x(INT64_MIN));
+    uintmax_t result = 0;
+    for (uintmax_t i = 0; i < count; i += 4) {
+        result += lanes(_mm256_cmpgt_epi64(needle, key_load(&keys[i])),
+                        count - i);
+    }
+    return result;
+}
+
+AVX2 static uintmax_t count_less_or_equal_avx2(
+        const uintmax_t *const keys,
+        const uintmax_t count,
+        const uintmax_t key) {
+    assert(keys);
+    const __m256i needle = _mm256_xor_si256(
+            _mm256_set1_epi64x((long long) key),
+            _mm256_set1_epi64x(INT64_MIN));
+    uintmax_t result = 0;
+    for (uintmax_t i = 0; i < count; i += 4) {
+        result += lanes(_mm256_cmpgt_epi64(key_load(&keys[i]), needle),
+                        count - i);
+    }
+    return count - result;
+}
+
+static bool avx2_is_supported(void) {
+#ifdef TEST
+    if (avx2_is_overridden) {
+        return false;
+    }
+#endif
+#if defined(__AVX2__)
+    return true;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+static uintmax_t count_less(const uintmax_t *const keys,
+                            const uintmax_t count,
+                            const uintmax_t key) {
+#if defined(AVX2)
+    if (avx2_is_supported()) {
+        return count_less_avx2(keys, count, key);
+    }
+#endif
+    return count_less_scalar(keys, count, key);
+}
+
+static uintmax_t count_less_or_equal(const uintmax_t *const keys,
+                                     const uintmax_t count,
+                                     const uintmax_t key) {
+#if defined(AVX2)
+    if (avx2_is_supported()) {
+        return count_less_or_equal_avx2(keys, count, key);
+    }
+#endif
+    return count_less_or_equal_scalar(keys, count, key);
+}
+
+static bool node_of(void **const out) {
+    assert(out);
+    if (posix_memalign(out, NODE_SIZE, NODE_SIZE)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
+
+static struct leaf *leaf_of(
+        const struct seahorse_btree_map_ni_ni_entry *const entry) {
+    assert(entry);
+    return (struct leaf *) ((uintptr_t) entry & ~(uintptr_t) (NODE_SIZE - 1));
+}
+
+static uintmax_t index_of(const struct leaf *const node,
+                          const struct seahorse_btree_map_ni_ni_entry *const
+                          entry) {
+    assert(node);
+    assert(entry);
+    const uintmax_t index = (const uintmax_t *) entry - node->keys;
+    assert(index < node->count);
+    return index;
+}
+
+static const struct seahorse_btree_map_ni_ni_entry *entry_of(
+        const struct leaf *const node,
+        const uintmax_t index) {
+    assert(node);
+    assert(index < node->count);
+    return (const struct seahorse_btree_map_ni_ni_entry *) &node->keys[index];
+}
+
+static void destroy(void *const node, const uintmax_t height) {
+    assert(node);
+    if (height) {
+        struct branch *const branch = node;
+        for (uintmax_t i = 0; i <= branch->count; i++) {
+            destroy(branch->children[i], height - 1);
+        }
+    }
+    free(node);
+}
+
+static void init(struct seahorse_btree_map_ni_ni *const object) {
+    assert(object);
+    *object = (struct seahorse_btree_map_ni_ni) {0};
+}
+
+bool seahorse_btree_map_ni_ni_init(
+        struct seahorse_btree_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+static void invalidate(struct seahorse_btree_map_ni_ni *const object) {
+    assert(object);
+    if (object->root) {
+        destroy(object->root, object->height);
+    }
+    *object = (struct seahorse_btree_map_ni_ni) {0};
+}
+
+bool seahorse_btree_map_ni_ni_invalidate(
+        struct seahorse_btree_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    invalidate(object);
+    return true;
+}
+
+/*
+ * Copies the subtree below node and appends the copied leaves to the chain
+ * ending at last, in key order.
+ */
+static void *copy(const void *const node,
+                  const uintmax_t height,
+                  struct leaf **const last) {
+    assert(node);
+    assert(last);
+    void *result;
+    if (!node_of(&result)) {
+        return NULL;
+    }
+    if (!height) {
+        struct leaf *const copied = result;
+        *copied = *(const struct leaf *) node;
+        copied->prev = *last;
+        copied->next = NULL;
+        if (*last) {
+            (*last)->next = copied;
+        }
+        *last = copied;
+        return copied;
+    }
+    const struct branch *const branch = node;
+    struct branch *const copied = result;
+    *copied = *branch;
+    for (uintmax_t i = 0; i <= branch->count; i++) {
+        copied->children[i] = copy(branch->children[i], height - 1, last);
+        if (!copied->children[i]) {
+            for (uintmax_t j = 0; j < i; j++) {
+                destroy(copied->children[j], height - 1);
+            }
+            free(copied);
+            return NULL;
+        }
+    }
+    return copied;
+}
+
+bool seahorse_btree_map_ni_ni_init_btree_map_ni_ni(
+        struct seahorse_btree_map_ni_ni *const object,
+        const struct seahorse_btree_map_ni_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    if (!other->root) {
+        return true;
+    }
+    struct leaf *last = NULL;
+    void *const root = copy(other->root, other->height, &last);
+    if (!root) {
+        return false;
+    }
+    object->count = other->count;
+    object->height = other->height;
+    object->root = root;
+    object->last = last;
+    void *node = root;
+    for (uintmax_t i = 0; i < object->height; i++) {
+        node = ((struct branch *) node)->children[0];
+    }
+    object->first = node;
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_count(
+        const struct seahorse_btree_map_ni_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Separator keys[i] of a branch is greater than every key below children[i]
+ * and not greater than any key below children[i + 1].
+ */
+static struct leaf *descend(const struct seahorse_btree_map_ni_ni *const object,
+                            const uintmax_t key,
+                            struct path *const path) {
+    assert(object);
+    assert(object->root);
+    assert(object->height <= MAXIMUM_HEIGHT);
+    void *node = object->root;
+    for (uintmax_t i = 0; i < object->height; i++) {
+        struct branch *const branch = node;
+        const uintmax_t index = count_less_or_equal(
+                branch->keys, branch->count, key);
+        if (path) {
+            path->branches[i] = branch;
+            path->indexes[i] = index;
+        }
+        node = branch->children[index];
+    }
+    return node;
+}
+
+static void leaf_insert(struct leaf *const node,
+                        const uintmax_t index,
+                        const uintmax_t key,
+                        const uintmax_t value) {
+    assert(node);
+    assert(node->count < LEAF_ORDER);
+    assert(index <= node->count);
+    const uintmax_t tail = node->count - index;
+    memmove(&node->keys[index + 1], &node->keys[index],
+            tail * sizeof(*node->keys));
+    memmove(&node->values[index + 1], &node->values[index],
+            tail * sizeof(*node->values));
+    node->keys[index] = key;
+    node->values[index] = value;
+    node->count += 1;
+}
+
+/*
+ * Splits the full leaf while inserting the key-value association, the new
+ * right sibling receives the upper half.
+ */
+static uintmax_t *leaf_split(struct seahorse_btree_map_ni_ni *const object,
+                             struct leaf *const node,
+                             struct leaf *const right,
+                             const uintmax_t index,
+                             const uintmax_t key,
+                             const uintmax_t value) {
+    assert(object);
+    assert(node);
+    assert(right);
+    assert(LEAF_ORDER == node->count);
+    uintmax_t keys[LEAF_ORDER + 1];
+    uintmax_t values[LEAF_ORDER + 1];
+    memcpy(keys, node->keys, index * sizeof(*keys));
+    memcpy(values, node->values, index * sizeof(*values));
+    keys[index] = key;
+    values[index] = value;
+    memcpy(&keys[index + 1], &node->keys[index],
+           (LEAF_ORDER - index) * sizeof(*keys));
+    memcpy(&values[index + 1], &node->values[index],
+           (LEAF_ORDER - index) * sizeof(*values));
+    const uintmax_t count = (LEAF_ORDER + 1) / 2;
+    node->count = count;
+    memcpy(node->keys, keys, count * sizeof(*keys));
+    memcpy(node->values, values, count * sizeof(*values));
+    right->count = LEAF_ORDER + 1 - count;
+    memcpy(right->keys, &keys[count], right->count * sizeof(*keys));
+    memcpy(right->values, &values[count], right->count * sizeof(*values));
+    right->prev = node;
+    right->next = node->next;
+    if (node->next) {
+        node->next->prev = right;
+    } else {
+        object->last = right;
+    }
+    node->next = right;
+    return index < count
+           ? &node->keys[index]
+           : &right->keys[index - count];
+}
+
+static void branch_insert(struct branch *const node,
+                          const uintmax_t index,
+                          const uintmax_t key,
+                          void *const child) {
+    assert(node);
+    assert(node->count < BRANCH_ORDER);
+    assert(index <= node->count);
+    const uintmax_t tail = node->count - index;
+    memmove(&node->keys[index + 1], &node->keys[index],
+            tail * sizeof(*node->keys));
+    memmove(&node->children[index + 2], &node->children[index + 1],
+            tail * sizeof(*node->children));
+    node->keys[index] = key;
+    node->children[index + 1] = child;
+    node->count += 1;
+}
+
+/*
+ * Splits the full branch while inserting the separator key and its right
+ * child, the middle key is moved up into key.
+ */
+static void branch_split(struct branch *const node,
+                         struct branch *const right,
+                         const uintmax_t index,
+                         uintmax_t *const key,
+                         void *const child) {
+    assert(node);
+    assert(right);
+    assert(key);
+    assert(BRANCH_ORDER == node->count);
+    uintmax_t keys[BRANCH_ORDER + 1];
+    void *children[BRANCH_ORDER + 2];
+    memcpy(keys, node->keys, index * sizeof(*keys));
+    keys[index] = *key;
+    memcpy(&keys[index + 1], &node->keys[index],
+           (BRANCH_ORDER - index) * sizeof(*keys));
+    memcpy(children, node->children, (index + 1) * sizeof(*children));
+    children[index + 1] = child;
+    memcpy(&children[index + 2], &node->children[index + 1],
+           (BRANCH_ORDER - index) * sizeof(*children));
+    const uintmax_t count = (BRANCH_ORDER + 1) / 2;
+    node->count = count;
+    memcpy(node->keys, keys, count * sizeof(*keys));
+    memcpy(node->children, children, (count + 1) * sizeof(*children));
+    *key = keys[count];
+    right->count = BRANCH_ORDER - count;
+    memcpy(right->keys, &keys[count + 1], right->count * sizeof(*keys));
+    memcpy(right->children, &children[count + 1],
+           (right->count + 1) * sizeof(*children));
+}
+
+/*
+ * All nodes that a split may need are allocated before the tree is changed,
+ * so that running out of memory leaves the tree as it was.
+ */
+static bool insert(struct seahorse_btree_map_ni_ni *const object,
+                   const uintmax_t key,
+                   const uintmax_t value,
+                   const uintmax_t **const out) {
+    assert(object);
+    assert(out);
+    if (!object->root) {
+        struct leaf *node;
+        if (!node_of((void **) &node)) {
+            return false;
+        }
+        *node = (struct leaf) {0};
+        object->root = object->first = object->last = node;
+    }
+    struct path path;
+    struct leaf *const node = descend(object, key, &path);
+    const uintmax_t index = count_less(node->keys, node->count, key);
+    if (index < node->count && key == node->keys[index]) {
+        *out = &node->keys[index];
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    if (node->count < LEAF_ORDER) {
+        leaf_insert(node, index, key, value);
+        *out = &node->keys[index];
+        object->count += 1;
+        return true;
+    }
+    void *spares[MAXIMUM_HEIGHT + 2];
+    uintmax_t needed = 2;
+    for (uintmax_t i = object->height; i > 0; i--) {
+        if (BRANCH_ORDER != path.branches[i - 1]->count) {
+            needed -= 1;
+            break;
+        }
+        needed += 1;
+    }
+    for (uintmax_t i = 0; i < needed; i++) {
+        if (!node_of(&spares[i])) {
+            for (uintmax_t j = 0; j < i; j++) {
+                free(spares[j]);
+            }
+            return false;
+        }
+    }
+    *out = leaf_split(object, node, spares[--needed], index, key, value);
+    object->count += 1;
+    uintmax_t separator = ((struct leaf *) node->next)->keys[0];
+    void *child = node->next;
+    for (uintmax_t i = object->height; i > 0; i--) {
+        struct branch *const branch = path.branches[i - 1];
+        if (branch->count < BRANCH_ORDER) {
+            branch_insert(branch, path.indexes[i - 1], separator, child);
+            assert(!needed);
+            return true;
+        }
+        struct branch *const right = spares[--needed];
+        branch_split(branch, right, path.indexes[i - 1], &separator, child);
+        child = right;
+    }
+    struct branch *const root = spares[--needed];
+    assert(!needed);
+    root->count = 1;
+    root->keys[0] = separator;
+    root->children[0] = object->root;
+    root->children[1] = child;
+    object->root = root;
+    object->height += 1;
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_add(
+        struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    const uintmax_t *out;
+    return insert(object, key, value, &out);
+}
+
+bool seahorse_btree_map_ni_ni_try_add(
+        struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t *entry = NULL;
+    const bool result = insert(object, key, value, &entry);
+    if (entry) {
+        *out = (const struct seahorse_btree_map_ni_ni_entry *) entry;
+    }
+    return result;
+}
+
+static void leaf_erase(struct leaf *const node, const uintmax_t index) {
+    assert(node);
+    assert(index < node->count);
+    const uintmax_t tail = node->count - index - 1;
+    memmove(&node->keys[index], &node->keys[index + 1],
+            tail * sizeof(*node->keys));
+    memmove(&node->values[index], &node->values[index + 1],
+            tail * sizeof(*node->values));
+    node->count -= 1;
+}
+
+/*
+ * Removes the separator key at index together with the child to its right.
+ */
+static void branch_erase(struct branch *const node, const uintmax_t index) {
+    assert(node);
+    assert(index < node->count);
+    const uintmax_t tail = node->count - index - 1;
+    memmove(&node->keys[index], &node->keys[index + 1],
+            tail * sizeof(*node->keys));
+    memmove(&node->children[index + 1], &node->children[index + 2],
+            tail * sizeof(*node->children));
+    node->count -= 1;
+}
+
+/*
+ * Moves all key-value associations of right into node and releases right.
+ */
+static void leaf_merge(struct seahorse_btree_map_ni_ni *const object,
+                       struct leaf *const node,
+                       struct leaf *const right) {
+    assert(object);
+    assert(node);
+    assert(right);
+    assert(node->count + right->count <= LEAF_ORDER);
+    memcpy(&node->keys[node->count], right->keys,
+           right->count * sizeof(*right->keys));
+    memcpy(&node->values[node->count], right->values,
+           right->count * sizeof(*right->values));
+    node->count += right->count;
+    node->next = right->next;
+    if (right->next) {
+        right->next->prev = node;
+    } else {
+        object->last = node;
+    }
+    free(right);
+}
+
+/*
+ * Refills the leaf at index of parent which fell below its minimum by taking
+ * from a sibling, or merges the leaf with a sibling when neither can spare a
+ * key-value association.
+ */
+static void leaf_rebalance(struct seahorse_btree_map_ni_ni *const object,
+                           struct branch *const parent,
+                           const uintmax_t index) {
+    assert(object);
+    assert(parent);
+    struct leaf *const node = parent->children[index];
+    struct leaf *const left = index ? parent->children[index - 1] : NULL;
+    struct leaf *const right = index < parent->count
+                        ? parent->children[index + 1] : NULL;
+    if (left && left->count > LEAF_MINIMUM) {
+        left->count -= 1;
+        leaf_insert(node, 0, left->keys[left->count],
+                    left->values[left->count]);
+        parent->keys[index - 1] = node->keys[0];
+    } else if (right && right->count > LEAF_MINIMUM) {
+        leaf_insert(node, node->count, right->keys[0], right->values[0]);
+        leaf_erase(right, 0);
+        parent->keys[index] = right->keys[0];
+    } else if (left) {
+        leaf_merge(object, left, node);
+        branch_erase(parent, index - 1);
+    } else {
+        assert(right);
+        leaf_merge(object, node, right);
+        branch_erase(parent, index);
+    }
+}
+
+static void branch_merge(struct branch *const parent,
+                         const uintmax_t index) {
+    assert(parent);
+    struct branch *const node = parent->children[index];
+    struct branch *const right = parent->children[index + 1];
+    assert(node->count + 1 + right->count <= BRANCH_ORDER);
+    node->keys[node->count] = parent->keys[index];
+    memcpy(&node->keys[node->count + 1], right->keys,
+           right->count * sizeof(*right->keys));
+    memcpy(&node->children[node->count + 1], right->children,
+           (right->count + 1) * sizeof(*right->children));
+    node->count += 1 + right->count;
+    free(right);
+    branch_erase(parent, index);
+}
+
+static void branch_rebalance(struct branch *const parent,
+                             const uintmax_t index) {
+    assert(parent);
+    struct branch *const node = parent->children[index];
+    struct branch *const left = index ? parent->children[index - 1] : NULL;
+    struct branch *const right = index < parent->count
+                                 ? parent->children[index + 1] : NULL;
+    if (left && left->count > BRANCH_MINIMUM) {
+        memmove(&node->keys[1], node->keys,
+                node->count * sizeof(*node->keys));
+        memmove(&node->children[1], node->children,
+                (node->count + 1) * sizeof(*node->children));
+        node->keys[0] = parent->keys[index - 1];
+        node->children[0] = left->children[left->count];
+        node->count += 1;
+        parent->keys[index - 1] = left->keys[left->count - 1];
+        left->count -= 1;
+    } else if (right && right->count > BRANCH_MINIMUM) {
+        node->keys[node->count] = parent->keys[index];
+        node->children[node->count + 1] = right->children[0];
+        node->count += 1;
+        parent->keys[index] = right->keys[0];
+        memmove(right->keys, &right->keys[1],
+                (right->count - 1) * sizeof(*right->keys));
+        memmove(right->children, &right->children[1],
+                right->count * sizeof(*right->children));
+        right->count -= 1;
+    } else if (left) {
+        branch_merge(parent, index - 1);
+    } else {
+        assert(right);
+        branch_merge(parent, index);
+    }
+}
+
+static void erase(struct seahorse_btree_map_ni_ni *const object,
+                  const struct path *const path,
+                  struct leaf *const node,
+                  const uintmax_t index) {
+    assert(object);
+    assert(path);
+    assert(node);
+    leaf_erase(node, index);
+    object->count -= 1;
+    if (!object->height) {
+        if (!node->count) {
+            free(node);
+            object->root = object->first = object->last = NULL;
+        }
+        return;
+    }
+    if (node->count >= LEAF_MINIMUM) {
+        return;
+    }
+    uintmax_t i = object->height - 1;
+    leaf_rebalance(object, path->branches[i], path->indexes[i]);
+    for (; i > 0 && path->branches[i]->count < BRANCH_MINIMUM; i--) {
+        branch_rebalance(path->branches[i - 1], path->indexes[i - 1]);
+    }
+    struct branch *const root = object->root;
+    if (!root->count) {
+        object->root = root->children[0];
+        object->height -= 1;
+        free(root);
+    }
+}
+
+static bool find(const struct seahorse_btree_map_ni_ni *const object,
+                 const uintmax_t key,
+                 struct path *const path,
+                 struct leaf **const node,
+                 uintmax_t *const index) {
+    assert(object);
+    assert(node);
+    assert(index);
+    if (!object->root) {
+        return false;
+    }
+    *node = descend(object, key, path);
+    *index = count_less((*node)->keys, (*node)->count, key);
+    return *index < (*node)->count && key == (*node)->keys[*index];
+}
+
+bool seahorse_btree_map_ni_ni_remove(
+        struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct path path;
+    struct leaf *node;
+    uintmax_t index;
+    if (!find(object, key, &path, &node, &index)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    erase(object, &path, node, index);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_contains(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct leaf *node;
+    uintmax_t index;
+    *out = find(object, key, NULL, &node, &index);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_set(
+        struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct leaf *node;
+    uintmax_t index;
+    if (!find(object, key, NULL, &node, &index)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    node->values[index] = value;
+    return true;
+}
+
+/*
+ * The leaf that descend selects for key holds every key of the map between
+ * its neighbouring separators, so a missing ceiling, floor, higher or lower
+ * key can only be the first key of the next leaf or the last key of the
+ * previous one.
+ */
+static const struct seahorse_btree_map_ni_ni_entry *find_ceiling(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const bool inclusive) {
+    assert(object);
+    if (!object->root) {
+        return NULL;
+    }
+    const struct leaf *node = descend(object, key, NULL);
+    const uintmax_t index = inclusive
+                            ? count_less(node->keys, node->count, key)
+                            : count_less_or_equal(node->keys, node->count, key);
+    if (index < node->count) {
+        return entry_of(node, index);
+    }
+    node = node->next;
+    return node ? entry_of(node, 0) : NULL;
+}
+
+static const struct seahorse_btree_map_ni_ni_entry *find_floor(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const bool inclusive) {
+    assert(object);
+    if (!object->root) {
+        return NULL;
+    }
+    const struct leaf *node = descend(object, key, NULL);
+    const uintmax_t index = inclusive
+                            ? count_less_or_equal(node->keys, node->count, key)
+                            : count_less(node->keys, node->count, key);
+    if (index) {
+        return entry_of(node, index - 1);
+    }
+    node = node->prev;
+    return node ? entry_of(node, node->count - 1) : NULL;
+}
+
+static const uintmax_t *value_of(
+        const struct seahorse_btree_map_ni_ni_entry *const entry) {
+    assert(entry);
+    const struct leaf *const node = leaf_of(entry);
+    return &node->values[index_of(node, entry)];
+}
+
+bool seahorse_btree_map_ni_ni_get(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct leaf *node;
+    uintmax_t index;
+    if (!find(object, key, NULL, &node, &index)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &node->values[index];
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_ceiling(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_ceiling(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_floor(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_floor(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_higher(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_ceiling(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_lower(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_floor(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_first(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    const struct leaf *const node = object->first;
+    *out = &node->values[0];
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_last(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    const struct leaf *const node = object->last;
+    *out = &node->values[node->count - 1];
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_get_entry(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct leaf *node;
+    uintmax_t index;
+    if (!find(object, key, NULL, &node, &index)) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(node, index);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_ceiling_entry(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_ceiling(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_floor_entry(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_floor(object, key, true);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_higher_entry(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_ceiling(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_lower_entry(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_btree_map_ni_ni_entry *const entry
+            = find_floor(object, key, false);
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_first_entry(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = entry_of(object->first, 0);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_last_entry(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    const struct leaf *const node = object->last;
+    *out = entry_of(node, node->count - 1);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_remove_entry(
+        struct seahorse_btree_map_ni_ni *const object,
+        const struct seahorse_btree_map_ni_ni_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    /* the path from the root is needed to rebalance the tree */
+    struct path path;
+    struct leaf *node;
+    uintmax_t index;
+    seagrass_required_true(find(object, *(const uintmax_t *) entry,
+                                &path, &node, &index));
+    assert(entry_of(node, index) == entry);
+    erase(object, &path, node, index);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_next_entry(
+        const struct seahorse_btree_map_ni_ni_entry *const entry,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct leaf *const node = leaf_of(entry);
+    const uintmax_t index = 1 + index_of(node, entry);
+    if (index < node->count) {
+        *out = entry_of(node, index);
+    } else if (node->next) {
+        *out = entry_of(node->next, 0);
+    } else {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_prev_entry(
+        const struct seahorse_btree_map_ni_ni_entry *const entry,
+        const struct seahorse_btree_map_ni_ni_entry **const out) {
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct leaf *const node = leaf_of(entry);
+    const uintmax_t index = index_of(node, entry);
+    if (index) {
+        *out = entry_of(node, index - 1);
+    } else if (node->prev) {
+        *out = entry_of(node->prev, node->prev->count - 1);
+    } else {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_entry_key(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const struct seahorse_btree_map_ni_ni_entry *const entry,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = (const uintmax_t *) entry;
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_entry_get_value(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const struct seahorse_btree_map_ni_ni_entry *const entry,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = value_of(entry);
+    return true;
+}
+
+bool seahorse_btree_map_ni_ni_entry_set_value(
+        const struct seahorse_btree_map_ni_ni *const object,
+        const struct seahorse_btree_map_ni_ni_entry *const entry,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    *(uintmax_t *) value_of(entry) = value;
+    return true;
+}
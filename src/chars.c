@@ -0,0 +1,28 @@
+#include <string.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
+
+#include "private/chars.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+int seahorse_chars_compare_string(const void *const first,
+                                  const void *const second) {
+    return sea_turtle_string_compare(first, second);
+}
+
+int seahorse_chars_compare(const void *const key, const void *const data) {
+    const struct seahorse_chars *const A = key;
+    uintmax_t size;
+    seagrass_required_true(sea_turtle_string_size(data, &size));
+    const char *chars;
+    seagrass_required_true(sea_turtle_string_char(data, &chars));
+    const size_t min = A->size < size ? A->size : size;
+    const int result = min ? memcmp(A->data, chars, min) : 0;
+    if (result) {
+        return result;
+    }
+    return (A->size > size) - (A->size < size);
+}
@@ -0,0 +1,318 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define CACHE_LINE                      64
+#define SHARD_BITS                      6
+#define SHARDS                          ((uintmax_t) 1 << SHARD_BITS)
+
+/*
+ * Each shard starts on a cache line of its own so that threads working on
+ * different shards never write to the same line.
+ */
+struct shard {
+    _Alignas(CACHE_LINE) pthread_mutex_t lock;
+    struct seahorse_hash_map_ni_ni map;
+};
+
+static uintmax_t shard_of(const uintmax_t key) {
+    /* murmur3 finalizer, unrelated to the hash used within each shard */
+    uint64_t result = (uint64_t) key;
+    result = (result ^ (result >> 33)) * UINT64_C(0xFF51AFD7ED558CCD);
+    result = (result ^ (result >> 33)) * UINT64_C(0xC4CEB9FE1A85EC53);
+    result ^= result >> 33;
+    return (uintmax_t) (result >> (64 - SHARD_BITS));
+}
+
+static struct shard *lock(
+        const struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key) {
+    assert(object);
+    struct shard *const shard = &((struct shard *) object->data)[
+            shard_of(key)];
+    seagrass_required_true(!pthread_mutex_lock(&shard->lock));
+    return shard;
+}
+
+static void unlock(struct shard *const shard) {
+    assert(shard);
+    seagrass_required_true(!pthread_mutex_unlock(&shard->lock));
+}
+
+static void destroy(struct shard *const shards, const uintmax_t count) {
+    assert(shards);
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_required_true(!pthread_mutex_destroy(&shards[i].lock));
+        seagrass_required_true(seahorse_hash_map_ni_ni_invalidate(
+                &shards[i].map));
+    }
+    free(shards);
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_init(
+        struct seahorse_concurrent_hash_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    void *data;
+    if (posix_memalign(&data, CACHE_LINE, SHARDS * sizeof(struct shard))) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct shard *const shards = data;
+    for (uintmax_t i = 0; i < SHARDS; i++) {
+        if (pthread_mutex_init(&shards[i].lock, NULL)) {
+            destroy(shards, i);
+            seahorse_error =
+                    SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        seagrass_required_true(seahorse_hash_map_ni_ni_init(&shards[i].map));
+    }
+    *object = (struct seahorse_concurrent_hash_map_ni_ni) {
+            .data = shards
+    };
+    return true;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_invalidate(
+        struct seahorse_concurrent_hash_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (object->data) {
+        destroy(object->data, SHARDS);
+    }
+    *object = (struct seahorse_concurrent_hash_map_ni_ni) {0};
+    return true;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_count(
+        const struct seahorse_concurrent_hash_map_ni_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct shard *const shards = object->data;
+    uintmax_t result = 0;
+    for (uintmax_t i = 0; i < SHARDS; i++) {
+        uintmax_t count;
+        seagrass_required_true(!pthread_mutex_lock(&shards[i].lock));
+        seagrass_required_true(seahorse_hash_map_ni_ni_count(
+                &shards[i].map, &count));
+        unlock(&shards[i]);
+        result += count;
+    }
+    *out = result;
+    return true;
+}
+
+/*
+ * Add key to the locked shard, or retrieve its entry if it is already
+ * present, in which case false is returned with out set to that entry.
+ */
+static bool try_add(struct shard *const shard,
+                    const uintmax_t key,
+                    const uintmax_t value,
+                    const struct seahorse_hash_map_ni_ni_entry **const out) {
+    assert(shard);
+    assert(out);
+    if (seahorse_hash_map_ni_ni_try_add(&shard->map, key, value, out)) {
+        return true;
+    }
+    if (SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS == seahorse_error) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS;
+    } else {
+        seagrass_required_true(
+                SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED
+                == seahorse_error);
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        *out = NULL;
+    }
+    return false;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_add(
+        struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct shard *const shard = lock(object, key);
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    const bool result = try_add(shard, key, value, &entry);
+    unlock(shard);
+    return result;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_add_to(
+        struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t delta) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct shard *const shard = lock(object, key);
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    bool result = try_add(shard, key, delta, &entry);
+    if (!result && entry) {
+        const uintmax_t *value;
+        seagrass_required_true(seahorse_hash_map_ni_ni_entry_get_value(
+                &shard->map, entry, &value));
+        uintmax_t sum;
+        if (!seagrass_uintmax_t_add(*value, delta, &sum)) {
+            seagrass_required_true(
+                    SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                    == seagrass_error);
+            seahorse_error =
+                    SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_RESULT_IS_INCONSISTENT;
+        } else {
+            seagrass_required_true(seahorse_hash_map_ni_ni_entry_set_value(
+                    &shard->map, entry, sum));
+            result = true;
+        }
+    }
+    unlock(shard);
+    return result;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_get_or_add(
+        struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct shard *const shard = lock(object, key);
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    bool result = try_add(shard, key, value, &entry);
+    if (result) {
+        *out = value;
+    } else if (entry) {
+        const uintmax_t *existing;
+        seagrass_required_true(seahorse_hash_map_ni_ni_entry_get_value(
+                &shard->map, entry, &existing));
+        *out = *existing;
+        result = true;
+    }
+    unlock(shard);
+    return result;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_set(
+        struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct shard *const shard = lock(object, key);
+    const bool result = seahorse_hash_map_ni_ni_set(&shard->map, key, value);
+    unlock(shard);
+    if (!result) {
+        seagrass_required_true(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND
+                               == seahorse_error);
+        seahorse_error = SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+    }
+    return result;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_remove(
+        struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct shard *const shard = lock(object, key);
+    const bool result = seahorse_hash_map_ni_ni_remove(&shard->map, key);
+    unlock(shard);
+    if (!result) {
+        seagrass_required_true(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND
+                               == seahorse_error);
+        seahorse_error = SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+    }
+    return result;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_contains(
+        const struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct shard *const shard = lock(object, key);
+    seagrass_required_true(seahorse_hash_map_ni_ni_contains(
+            &shard->map, key, out));
+    unlock(shard);
+    return true;
+}
+
+bool seahorse_concurrent_hash_map_ni_ni_get(
+        const struct seahorse_concurrent_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct shard *const shard = lock(object, key);
+    const uintmax_t *value;
+    const bool result = seahorse_hash_map_ni_ni_get(&shard->map, key, &value);
+    if (result) {
+        *out = *value;
+    }
+    unlock(shard);
+    if (!result) {
+        seagrass_required_true(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND
+                               == seahorse_error);
+        seahorse_error = SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+    }
+    return result;
+}
@@ -0,0 +1,415 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define CACHE_LINE                      64
+#define FIRST_CHUNK_SHIFT               6
+#define CHUNKS                          27
+#define NONE                            UINT32_MAX
+
+/*
+ * Nodes are handed out from chunks that double in size, chunk k holding
+ * 64 << k nodes, which lets a node be found from its 32-bit index without
+ * locking while the pool grows. Chunks are never moved nor deallocated
+ * before the stack is invalidated, so a thread holding a stale index can
+ * still safely read the node's next index.
+ */
+struct node {
+    uintmax_t item;
+    atomic_uint_least32_t next;
+};
+
+/*
+ * Both the stack and the free list of unused nodes are linked lists whose
+ * head is a 32-bit node index paired with a 32-bit tag, the tag being
+ * bumped on every successful compare-and-swap of the head.
+ */
+struct state {
+    _Alignas(CACHE_LINE) atomic_uint_least64_t top;
+    _Alignas(CACHE_LINE) atomic_uint_least64_t free;
+    _Alignas(CACHE_LINE) atomic_uint_least32_t fresh;
+    atomic_intmax_t count;
+    _Atomic(struct node *) chunks[CHUNKS];
+};
+
+static uint64_t tagged(const uint64_t head, const uint32_t index) {
+    return ((head >> 32) + 1) << 32 | index;
+}
+
+static uint32_t index_of(const uint64_t head) {
+    return (uint32_t) head;
+}
+
+static unsigned chunk_of(const uint32_t index, uintmax_t *const offset) {
+    assert(NONE != index);
+    assert(offset);
+    const uint64_t position = (uint64_t) index + (1 << FIRST_CHUNK_SHIFT);
+#if defined(__GNUC__)
+    const unsigned msb = 63 - (unsigned) __builtin_clzll(position);
+#else
+    unsigned msb = 0;
+    for (uint64_t i = position >> 1; i; i >>= 1) {
+        msb++;
+    }
+#endif
+    *offset = position - ((uint64_t) 1 << msb);
+    return msb - FIRST_CHUNK_SHIFT;
+}
+
+static struct node *node_at(struct state *const state, const uint32_t index) {
+    assert(state);
+    uintmax_t offset;
+    const unsigned chunk = chunk_of(index, &offset);
+    struct node *const nodes = atomic_load_explicit(&state->chunks[chunk],
+                                                    memory_order_acquire);
+    assert(nodes);
+    return &nodes[offset];
+}
+
+bool seahorse_concurrent_stack_ni_init(
+        struct seahorse_concurrent_stack_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    void *data;
+    if (posix_memalign(&data, CACHE_LINE, sizeof(struct state))) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct state *const state = data;
+    atomic_init(&state->top, NONE);
+    atomic_init(&state->free, NONE);
+    atomic_init(&state->fresh, 0);
+    atomic_init(&state->count, 0);
+    for (unsigned i = 0; i < CHUNKS; i++) {
+        atomic_init(&state->chunks[i], NULL);
+    }
+    *object = (struct seahorse_concurrent_stack_ni) {
+            .data = state
+    };
+    return true;
+}
+
+bool seahorse_concurrent_stack_ni_invalidate(
+        struct seahorse_concurrent_stack_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    if (state) {
+        for (unsigned i = 0; i < CHUNKS; i++) {
+            free(atomic_load(&state->chunks[i]));
+        }
+        free(state);
+    }
+    *object = (struct seahorse_concurrent_stack_ni) {0};
+    return true;
+}
+
+bool seahorse_concurrent_stack_ni_count(
+        const struct seahorse_concurrent_stack_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    /* a pop may be counted before the push it raced with */
+    const intmax_t count = atomic_load_explicit(&state->count,
+                                                memory_order_relaxed);
+    *out = count > 0 ? (uintmax_t) count : 0;
+    return true;
+}
+
+/*
+ * Put the privately linked nodes first to last in front of list.
+ */
+static void attach(struct state *const state,
+                   atomic_uint_least64_t *const list,
+                   const uint32_t first,
+                   const uint32_t last) {
+    assert(state);
+    assert(list);
+    struct node *const node = node_at(state, last);
+    uint64_t head = atomic_load_explicit(list, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&node->next, index_of(head),
+                              memory_order_release);
+    } while (!atomic_compare_exchange_weak_explicit(
+            list, &head, tagged(head, first),
+            memory_order_release, memory_order_relaxed));
+}
+
+/*
+ * Take up to count nodes from the front of list, out receiving the index of
+ * the first of them. The walk may follow nodes that other threads are
+ * concurrently taking and putting back, in which case the tag of the head
+ * will have changed and the compare-and-swap fails.
+ */
+static uintmax_t detach(struct state *const state,
+                        atomic_uint_least64_t *const list,
+                        const uintmax_t count,
+                        uint32_t *const out) {
+    assert(state);
+    assert(list);
+    assert(count);
+    assert(out);
+    uint64_t head = atomic_load_explicit(list, memory_order_acquire);
+    for (;;) {
+        const uint32_t first = index_of(head);
+        if (NONE == first) {
+            return 0;
+        }
+        uintmax_t result = 1;
+        uint32_t next = atomic_load_explicit(&node_at(state, first)->next,
+                                             memory_order_acquire);
+        for (; result < count && NONE != next; result++) {
+            next = atomic_load_explicit(&node_at(state, next)->next,
+                                        memory_order_acquire);
+        }
+        if (atomic_compare_exchange_weak_explicit(
+                list, &head, tagged(head, next),
+                memory_order_acquire, memory_order_acquire)) {
+            *out = first;
+            return result;
+        }
+    }
+}
+
+/*
+ * Create a chunk unless another thread has beaten us to it.
+ */
+static bool install(struct state *const state, const unsigned chunk) {
+    assert(state);
+    assert(chunk < CHUNKS);
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(
+            (uintmax_t) 1 << (chunk + FIRST_CHUNK_SHIFT),
+            sizeof(struct node), &size)
+        || size > SIZE_MAX) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct node *const nodes = malloc(size);
+    if (!nodes) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct node *expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(
+            &state->chunks[chunk], &expected, nodes,
+            memory_order_release, memory_order_relaxed)) {
+        free(nodes);
+    }
+    return true;
+}
+
+/*
+ * Claim a node that has never been used, its chunk being created first so
+ * that no index is lost if that fails.
+ */
+static bool fresh(struct state *const state, uint32_t *const out) {
+    assert(state);
+    assert(out);
+    uint32_t index = atomic_load_explicit(&state->fresh, memory_order_relaxed);
+    for (;;) {
+        if (NONE == index) {
+            seahorse_error =
+                    SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        uintmax_t offset;
+        const unsigned chunk = chunk_of(index, &offset);
+        if (!atomic_load_explicit(&state->chunks[chunk], memory_order_acquire)
+            && !install(state, chunk)) {
+            return false;
+        }
+        if (atomic_compare_exchange_weak_explicit(
+                &state->fresh, &index, index + 1,
+                memory_order_relaxed, memory_order_relaxed)) {
+            *out = index;
+            return true;
+        }
+    }
+}
+
+/*
+ * Obtain count privately linked nodes, reusing nodes from the free list
+ * before claiming fresh ones.
+ */
+static bool reserve(struct state *const state,
+                    const uintmax_t count,
+                    uint32_t *const first,
+                    uint32_t *const last) {
+    assert(state);
+    assert(count);
+    assert(first);
+    assert(last);
+    uint32_t head = NONE;
+    uint32_t tail = NONE;
+    uintmax_t i = detach(state, &state->free, count, &head);
+    if (i) {
+        tail = head;
+        for (uintmax_t j = 1; j < i; j++) {
+            tail = atomic_load_explicit(&node_at(state, tail)->next,
+                                        memory_order_relaxed);
+        }
+    }
+    for (; i < count; i++) {
+        uint32_t index;
+        if (!fresh(state, &index)) {
+            if (NONE != head) {
+                attach(state, &state->free, head, tail);
+            }
+            return false;
+        }
+        atomic_store_explicit(&node_at(state, index)->next, head,
+                              memory_order_release);
+        if (NONE == tail) {
+            tail = index;
+        }
+        head = index;
+    }
+    *first = head;
+    *last = tail;
+    return true;
+}
+
+bool seahorse_concurrent_stack_ni_push(
+        struct seahorse_concurrent_stack_ni *const object,
+        const uintmax_t item) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    uint32_t index;
+    if (!reserve(state, 1, &index, &index)) {
+        return false;
+    }
+    node_at(state, index)->item = item;
+    attach(state, &state->top, index, index);
+    atomic_fetch_add_explicit(&state->count, 1, memory_order_relaxed);
+    return true;
+}
+
+bool seahorse_concurrent_stack_ni_push_all(
+        struct seahorse_concurrent_stack_ni *const object,
+        const uintmax_t count,
+        const uintmax_t *const values) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!values) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_VALUES_IS_NULL;
+        return false;
+    }
+    if (count > INTMAX_MAX) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct state *const state = object->data;
+    uint32_t first;
+    uint32_t last;
+    if (!reserve(state, count, &first, &last)) {
+        return false;
+    }
+    /* the first node will be on top so it receives the last value */
+    uint32_t index = first;
+    for (uintmax_t i = count; i; i--) {
+        struct node *const node = node_at(state, index);
+        node->item = values[i - 1];
+        index = atomic_load_explicit(&node->next, memory_order_relaxed);
+    }
+    attach(state, &state->top, first, last);
+    atomic_fetch_add_explicit(&state->count, (intmax_t) count,
+                              memory_order_relaxed);
+    return true;
+}
+
+bool seahorse_concurrent_stack_ni_pop(
+        struct seahorse_concurrent_stack_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    uint32_t index;
+    if (!detach(state, &state->top, 1, &index)) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_STACK_IS_EMPTY;
+        return false;
+    }
+    *out = node_at(state, index)->item;
+    attach(state, &state->free, index, index);
+    atomic_fetch_sub_explicit(&state->count, 1, memory_order_relaxed);
+    return true;
+}
+
+bool seahorse_concurrent_stack_ni_pop_all(
+        struct seahorse_concurrent_stack_ni *const object,
+        const uintmax_t count,
+        uintmax_t *const items,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!items) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_ITEMS_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    uint32_t first;
+    const uintmax_t result = detach(state, &state->top, count, &first);
+    if (!result) {
+        seahorse_error = SEAHORSE_CONCURRENT_STACK_NI_ERROR_STACK_IS_EMPTY;
+        return false;
+    }
+    uint32_t last = first;
+    for (uintmax_t i = 0; i < result; i++) {
+        struct node *const node = node_at(state, last);
+        items[i] = node->item;
+        if (i + 1 < result) {
+            last = atomic_load_explicit(&node->next, memory_order_relaxed);
+        }
+    }
+    attach(state, &state->free, first, last);
+    atomic_fetch_sub_explicit(&state->count, (intmax_t) result,
+                              memory_order_relaxed);
+    *out = result;
+    return true;
+}
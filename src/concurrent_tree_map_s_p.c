@@ -0,0 +1,764 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include "private/weight_balanced_tree.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define CACHE_LINE                      64
+
+/*
+ * Key shared by every copy of the node that holds it, so that copying a path
+ * never copies the string.
+ */
+struct item {
+    uintmax_t references;
+    struct item *next;
+    uintmax_t epoch;
+    struct sea_turtle_string key;
+};
+
+/*
+ * Readers only ever look at left, right, item and value, which are not
+ * modified once the node has been published. The reference count and the
+ * links to the pool or to the retired list belong to the writer.
+ */
+struct node {
+    uintmax_t references;
+    struct node *next;
+    uintmax_t epoch;
+    struct node *left;
+    struct node *right;
+    uintmax_t size;
+    struct item *item;
+    const void *value;
+};
+
+/*
+ * Epoch that the reader observed when it began searching, or zero while it
+ * is not searching. Each record starts on a cache line of its own so that
+ * readers entering and leaving never write to the same line.
+ */
+struct record {
+    _Alignas(CACHE_LINE) atomic_uintmax_t epoch;
+    struct record *next;
+};
+
+struct state {
+    _Atomic(struct node *) root;
+    atomic_uintmax_t epoch;
+    atomic_uintmax_t count;
+    pthread_mutex_t lock;
+    struct record *readers;
+    struct node *pool;
+    struct node *nodes;
+    struct item *items;
+};
+
+/*
+ * Nodes and keys that are no longer reachable from the root are put aside
+ * together with the current epoch, and only deallocated once every reader is
+ * either idle or has started searching in a later epoch.
+ */
+static void release_item(struct state *const state, struct item *const item) {
+    assert(state);
+    assert(item);
+    assert(item->references);
+    if (--item->references) {
+        return;
+    }
+    item->epoch = atomic_load_explicit(&state->epoch, memory_order_relaxed);
+    item->next = state->items;
+    state->items = item;
+}
+
+static struct node *retain(struct node *const node) {
+    if (node) {
+        node->references++;
+    }
+    return node;
+}
+
+static void release(struct state *const state, struct node *const node) {
+    assert(state);
+    if (!node) {
+        return;
+    }
+    assert(node->references);
+    if (--node->references) {
+        return;
+    }
+    release_item(state, node->item);
+    release(state, node->left);
+    release(state, node->right);
+    node->epoch = atomic_load_explicit(&state->epoch, memory_order_relaxed);
+    node->next = state->nodes;
+    state->nodes = node;
+}
+
+static void reclaim(struct state *const state) {
+    assert(state);
+    uintmax_t epoch = UINTMAX_MAX;
+    for (struct record *record = state->readers; record;
+         record = record->next) {
+        const uintmax_t value = atomic_load(&record->epoch);
+        if (value && value < epoch) {
+            epoch = value;
+        }
+    }
+    /* retired lists are ordered from the latest epoch to the earliest */
+    struct node **nodes = &state->nodes;
+    while (*nodes && (*nodes)->epoch >= epoch) {
+        nodes = &(*nodes)->next;
+    }
+    for (struct node *node = *nodes, *next; node; node = next) {
+        next = node->next;
+        free(node);
+    }
+    *nodes = NULL;
+    struct item **items = &state->items;
+    while (*items && (*items)->epoch >= epoch) {
+        items = &(*items)->next;
+    }
+    for (struct item *item = *items, *next; item; item = next) {
+        next = item->next;
+        seagrass_required_true(sea_turtle_string_invalidate(&item->key));
+        free(item);
+    }
+    *items = NULL;
+}
+
+static void drain(struct state *const state) {
+    assert(state);
+    while (state->pool) {
+        struct node *const node = state->pool;
+        state->pool = node->next;
+        free(node);
+    }
+}
+
+/*
+ * Nodes are reserved before a write begins so that copying the path can not
+ * fail halfway through, which would leave a partially built tree behind.
+ */
+static bool fill(struct state *const state, uintmax_t count) {
+    assert(state);
+    assert(!state->pool);
+    for (; count; count--) {
+        struct node *const node = malloc(sizeof(*node));
+        if (!node) {
+            drain(state);
+            return false;
+        }
+        node->next = state->pool;
+        state->pool = node;
+    }
+    return true;
+}
+
+static uintmax_t size_of(const struct node *const node) {
+    return node ? node->size : 0;
+}
+
+static uintmax_t weight_of(const struct node *const node) {
+    return 1 + size_of(node);
+}
+
+/*
+ * Takes ownership of left and right.
+ */
+static struct node *make(struct state *const state,
+                         struct item *const item,
+                         const void *const value,
+                         struct node *const left,
+                         struct node *const right) {
+    assert(state);
+    assert(state->pool);
+    assert(item);
+    struct node *const node = state->pool;
+    state->pool = node->next;
+    *node = (struct node) {
+            .references = 1,
+            .left = left,
+            .right = right,
+            .size = 1 + size_of(left) + size_of(right),
+            .item = item,
+            .value = value
+    };
+    item->references++;
+    return node;
+}
+
+/*
+ * Builds a balanced node out of item, value, left and right, copying at most
+ * three nodes to rotate. Takes ownership of left and right.
+ */
+static struct node *balance(struct state *const state,
+                            struct item *const item,
+                            const void *const value,
+                            struct node *const left,
+                            struct node *const right) {
+    assert(state);
+    assert(item);
+    struct node *result;
+    if (weight_of(right) > DELTA * weight_of(left)) {
+        if (weight_of(right->left) >= RATIO * weight_of(right->right)) {
+            struct node *const middle = right->left;
+            result = make(
+                    state, middle->item, middle->value,
+                    make(state, item, value, left, retain(middle->left)),
+                    make(state, right->item, right->value,
+                         retain(middle->right), retain(right->right)));
+        } else {
+            result = make(
+                    state, right->item, right->value,
+                    make(state, item, value, left, retain(right->left)),
+                    retain(right->right));
+        }
+        release(state, right);
+    } else if (weight_of(left) > DELTA * weight_of(right)) {
+        if (weight_of(left->right) >= RATIO * weight_of(left->left)) {
+            struct node *const middle = left->right;
+            result = make(
+                    state, middle->item, middle->value,
+                    make(state, left->item, left->value,
+                         retain(left->left), retain(middle->left)),
+                    make(state, item, value, retain(middle->right), right));
+        } else {
+            result = make(
+                    state, left->item, left->value,
+                    retain(left->left),
+                    make(state, item, value, retain(left->right), right));
+        }
+        release(state, left);
+    } else {
+        result = make(state, item, value, left, right);
+    }
+    return result;
+}
+
+/*
+ * Replaces the root, retires whatever is no longer reachable from it and
+ * then advances the epoch so that readers starting from now on are known to
+ * have seen the new root.
+ */
+static void publish(struct state *const state, struct node *const root) {
+    assert(state);
+    struct node *const previous = atomic_load_explicit(
+            &state->root, memory_order_relaxed);
+    atomic_store(&state->root, root);
+    release(state, previous);
+    atomic_fetch_add(&state->epoch, 1);
+    reclaim(state);
+    drain(state);
+}
+
+/*
+ * Retrieve the node holding key, if any, along with the count of nodes on
+ * the path from the root to it. Must only be called by the writer.
+ */
+static struct node *find(const struct state *const state,
+                         const struct sea_turtle_string *const key,
+                         uintmax_t *const depth) {
+    assert(state);
+    assert(key);
+    assert(depth);
+    uintmax_t count = 0;
+    struct node *node = atomic_load_explicit(&state->root,
+                                             memory_order_relaxed);
+    while (node) {
+        count++;
+        const int result = sea_turtle_string_compare(key, &node->item->key);
+        if (!result) {
+            break;
+        }
+        node = result < 0 ? node->left : node->right;
+    }
+    *depth = count;
+    return node;
+}
+
+static void destroy(struct node *const node,
+                    void (*const on_destroy)(void *)) {
+    if (!node) {
+        return;
+    }
+    destroy(node->left, on_destroy);
+    destroy(node->right, on_destroy);
+    if (on_destroy) {
+        on_destroy((void *) node->value);
+    }
+    seagrass_required_true(sea_turtle_string_invalidate(&node->item->key));
+    free(node->item);
+    free(node);
+}
+
+bool seahorse_concurrent_tree_map_s_p_init(
+        struct seahorse_concurrent_tree_map_s_p *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = calloc(1, sizeof(*state));
+    if (!state) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (pthread_mutex_init(&state->lock, NULL)) {
+        free(state);
+        seahorse_error =
+                SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    atomic_init(&state->root, NULL);
+    atomic_init(&state->epoch, 1);
+    atomic_init(&state->count, 0);
+    *object = (struct seahorse_concurrent_tree_map_s_p) {
+            .data = state
+    };
+    return true;
+}
+
+bool seahorse_concurrent_tree_map_s_p_invalidate(
+        struct seahorse_concurrent_tree_map_s_p *const object,
+        void (*const on_destroy)(void *value)) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    if (state) {
+        assert(!state->readers);
+        reclaim(state);
+        destroy(atomic_load(&state->root), on_destroy);
+        seagrass_required_true(!pthread_mutex_destroy(&state->lock));
+        free(state);
+    }
+    *object = (struct seahorse_concurrent_tree_map_s_p) {0};
+    return true;
+}
+
+bool seahorse_concurrent_tree_map_s_p_register(
+        struct seahorse_concurrent_tree_map_s_p *const object,
+        struct seahorse_concurrent_tree_map_s_p_reader *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    void *data;
+    if (posix_memalign(&data, CACHE_LINE, sizeof(struct record))) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct record *const record = data;
+    atomic_init(&record->epoch, 0);
+    struct state *const state = object->data;
+    seagrass_required_true(!pthread_mutex_lock(&state->lock));
+    record->next = state->readers;
+    state->readers = record;
+    seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+    *out = (struct seahorse_concurrent_tree_map_s_p_reader) {
+            .data = record
+    };
+    return true;
+}
+
+bool seahorse_concurrent_tree_map_s_p_unregister(
+        struct seahorse_concurrent_tree_map_s_p *const object,
+        struct seahorse_concurrent_tree_map_s_p_reader *const reader) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!reader) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL;
+        return false;
+    }
+    struct record *const record = reader->data;
+    struct state *const state = object->data;
+    seagrass_required_true(!pthread_mutex_lock(&state->lock));
+    struct record **next = &state->readers;
+    while (*next != record) {
+        assert(*next);
+        next = &(*next)->next;
+    }
+    *next = record->next;
+    reclaim(state);
+    seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+    free(record);
+    *reader = (struct seahorse_concurrent_tree_map_s_p_reader) {0};
+    return true;
+}
+
+bool seahorse_concurrent_tree_map_s_p_count(
+        const struct seahorse_concurrent_tree_map_s_p *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    *out = atomic_load_explicit(&state->count, memory_order_relaxed);
+    return true;
+}
+
+/*
+ * Key of item must not be present in the subtree rooted at node.
+ */
+static struct node *insert(struct state *const state,
+                           struct node *const node,
+                           struct item *const item,
+                           const void *const value) {
+    assert(state);
+    assert(item);
+    if (!node) {
+        return make(state, item, value, NULL, NULL);
+    }
+    const int result = sea_turtle_string_compare(&item->key,
+                                                 &node->item->key);
+    assert(result);
+    if (result < 0) {
+        return balance(state, node->item, node->value,
+                       insert(state, node->left, item, value),
+                       retain(node->right));
+    }
+    return balance(state, node->item, node->value,
+                   retain(node->left),
+                   insert(state, node->right, item, value));
+}
+
+bool seahorse_concurrent_tree_map_s_p_add(
+        struct seahorse_concurrent_tree_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    seagrass_required_true(!pthread_mutex_lock(&state->lock));
+    uintmax_t depth;
+    bool result = false;
+    struct item *item = NULL;
+    if (find(state, key, &depth)) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS;
+    } else if (!(item = calloc(1, sizeof(*item)))
+               || !sea_turtle_string_init_string(&item->key, key)
+               || !fill(state, 1 + 3 * depth)) {
+        if (item) {
+            seagrass_required_true(sea_turtle_string_invalidate(&item->key));
+            free(item);
+        }
+        seahorse_error =
+                SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+    } else {
+        struct node *const root = atomic_load_explicit(
+                &state->root, memory_order_relaxed);
+        publish(state, insert(state, root, item, value));
+        atomic_fetch_add_explicit(&state->count, 1, memory_order_relaxed);
+        result = true;
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+    return result;
+}
+
+/*
+ * Key must be present in the subtree rooted at node.
+ */
+static struct node *update(struct state *const state,
+                           struct node *const node,
+                           const struct sea_turtle_string *const key,
+                           const void *const value) {
+    assert(state);
+    assert(node);
+    assert(key);
+    const int result = sea_turtle_string_compare(key, &node->item->key);
+    if (result < 0) {
+        return make(state, node->item, node->value,
+                    update(state, node->left, key, value),
+                    retain(node->right));
+    }
+    if (result > 0) {
+        return make(state, node->item, node->value,
+                    retain(node->left),
+                    update(state, node->right, key, value));
+    }
+    return make(state, node->item, value,
+                retain(node->left), retain(node->right));
+}
+
+bool seahorse_concurrent_tree_map_s_p_set(
+        struct seahorse_concurrent_tree_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    seagrass_required_true(!pthread_mutex_lock(&state->lock));
+    uintmax_t depth;
+    bool result = false;
+    if (!find(state, key, &depth)) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
+    } else if (!fill(state, depth)) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+    } else {
+        struct node *const root = atomic_load_explicit(
+                &state->root, memory_order_relaxed);
+        publish(state, update(state, root, key, value));
+        result = true;
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+    return result;
+}
+
+static struct node *detach_first(struct state *const state,
+                                 struct node *const node,
+                                 struct node **const out) {
+    assert(state);
+    assert(node);
+    assert(out);
+    if (!node->left) {
+        *out = node;
+        return retain(node->right);
+    }
+    return balance(state, node->item, node->value,
+                   detach_first(state, node->left, out),
+                   retain(node->right));
+}
+
+static struct node *detach_last(struct state *const state,
+                                struct node *const node,
+                                struct node **const out) {
+    assert(state);
+    assert(node);
+    assert(out);
+    if (!node->right) {
+        *out = node;
+        return retain(node->left);
+    }
+    return balance(state, node->item, node->value,
+                   retain(node->left),
+                   detach_last(state, node->right, out));
+}
+
+/*
+ * Count of nodes that glue will walk through in the heavier child.
+ */
+static uintmax_t glue_depth(const struct node *const left,
+                            const struct node *const right) {
+    if (!left || !right) {
+        return 0;
+    }
+    uintmax_t depth = 0;
+    if (left->size > right->size) {
+        for (const struct node *node = left; node; node = node->right) {
+            depth++;
+        }
+    } else {
+        for (const struct node *node = right; node; node = node->left) {
+            depth++;
+        }
+    }
+    return depth;
+}
+
+/*
+ * Joins the children of a removed node by lifting the neighbouring
+ * association out of the heavier child.
+ */
+static struct node *glue(struct state *const state,
+                         struct node *const left,
+                         struct node *const right) {
+    assert(state);
+    if (!left) {
+        return retain(right);
+    }
+    if (!right) {
+        return retain(left);
+    }
+    struct node *node;
+    if (left->size > right->size) {
+        struct node *const rest = detach_last(state, left, &node);
+        return balance(state, node->item, node->value, rest, retain(right));
+    }
+    struct node *const rest = detach_first(state, right, &node);
+    return balance(state, node->item, node->value, retain(left), rest);
+}
+
+/*
+ * Key must be present in the subtree rooted at node.
+ */
+static struct node *erase(struct state *const state,
+                          struct node *const node,
+                          const struct sea_turtle_string *const key) {
+    assert(state);
+    assert(node);
+    assert(key);
+    const int result = sea_turtle_string_compare(key, &node->item->key);
+    if (result < 0) {
+        return balance(state, node->item, node->value,
+                       erase(state, node->left, key),
+                       retain(node->right));
+    }
+    if (result > 0) {
+        return balance(state, node->item, node->value,
+                       retain(node->left),
+                       erase(state, node->right, key));
+    }
+    return glue(state, node->left, node->right);
+}
+
+bool seahorse_concurrent_tree_map_s_p_remove(
+        struct seahorse_concurrent_tree_map_s_p *const object,
+        const struct sea_turtle_string *const key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    seagrass_required_true(!pthread_mutex_lock(&state->lock));
+    uintmax_t depth;
+    bool result = false;
+    const struct node *const node = find(state, key, &depth);
+    if (node) {
+        depth += glue_depth(node->left, node->right);
+    }
+    if (!node) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
+    } else if (!fill(state, 3 * depth)) {
+        seahorse_error =
+                SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+    } else {
+        struct node *const root = atomic_load_explicit(
+                &state->root, memory_order_relaxed);
+        publish(state, erase(state, root, key));
+        atomic_fetch_sub_explicit(&state->count, 1, memory_order_relaxed);
+        result = true;
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+    return result;
+}
+
+/*
+ * Announce the epoch before loading the root, so that the writer that
+ * retires the nodes of this root can not deallocate them until we leave.
+ */
+static const struct node *enter(struct state *const state,
+                                struct record *const record) {
+    assert(state);
+    assert(record);
+    atomic_store(&record->epoch, atomic_load(&state->epoch));
+    return atomic_load(&state->root);
+}
+
+static void leave(struct record *const record) {
+    assert(record);
+    atomic_store_explicit(&record->epoch, 0, memory_order_release);
+}
+
+static const struct node *lookup(const struct node *node,
+                                 const struct sea_turtle_string *const key) {
+    assert(key);
+    while (node) {
+        const int result = sea_turtle_string_compare(key, &node->item->key);
+        if (!result) {
+            break;
+        }
+        node = result < 0 ? node->left : node->right;
+    }
+    return node;
+}
+
+bool seahorse_concurrent_tree_map_s_p_contains(
+        const struct seahorse_concurrent_tree_map_s_p *const object,
+        struct seahorse_concurrent_tree_map_s_p_reader *const reader,
+        const struct sea_turtle_string *const key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!reader) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct record *const record = reader->data;
+    *out = NULL != lookup(enter(object->data, record), key);
+    leave(record);
+    return true;
+}
+
+bool seahorse_concurrent_tree_map_s_p_get(
+        const struct seahorse_concurrent_tree_map_s_p *const object,
+        struct seahorse_concurrent_tree_map_s_p_reader *const reader,
+        const struct sea_turtle_string *const key,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!reader) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct record *const record = reader->data;
+    const struct node *const node = lookup(enter(object->data, record), key);
+    if (node) {
+        *out = node->value;
+    }
+    leave(record);
+    if (!node) {
+        seahorse_error = SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,841 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+static int compare(const struct sea_turtle_integer *const a,
+                   const struct sea_turtle_integer *const b) {
+    assert(a);
+    assert(b);
+    return sea_turtle_integer_compare(a, b);
+}
+
+static void init(struct seahorse_flat_map_i_i *const object) {
+    assert(object);
+    *object = (struct seahorse_flat_map_i_i) {0};
+}
+
+bool seahorse_flat_map_i_i_init(struct seahorse_flat_map_i_i *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+static void invalidate(struct seahorse_flat_map_i_i *const object) {
+    assert(object);
+    for (uintmax_t i = 0; i < object->count; i++) {
+        seagrass_required_true(sea_turtle_integer_invalidate(
+                &object->keys[i]));
+        seagrass_required_true(sea_turtle_integer_invalidate(
+                &object->values[i]));
+    }
+    free(object->keys);
+    free(object->values);
+    *object = (struct seahorse_flat_map_i_i) {0};
+}
+
+bool seahorse_flat_map_i_i_invalidate(
+        struct seahorse_flat_map_i_i *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    invalidate(object);
+    return true;
+}
+
+static bool reserve(struct seahorse_flat_map_i_i *const object,
+                    const uintmax_t capacity) {
+    assert(object);
+    if (capacity <= object->capacity) {
+        return true;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, sizeof(*object->keys), &size)
+        || size > SIZE_MAX) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error || size > SIZE_MAX);
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    void *keys = realloc(object->keys, size);
+    if (!keys) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->keys = keys;
+    seagrass_required_true(seagrass_uintmax_t_multiply(
+            capacity, sizeof(*object->values), &size));
+    void *values = realloc(object->values, size);
+    if (!values) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->values = values;
+    object->capacity = capacity;
+    return true;
+}
+
+static bool grow(struct seahorse_flat_map_i_i *const object) {
+    assert(object);
+    if (object->count < object->capacity) {
+        return true;
+    }
+    uintmax_t capacity = 8;
+    if (object->capacity
+        && !seagrass_uintmax_t_multiply(object->capacity, 2, &capacity)) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error);
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return reserve(object, capacity);
+}
+
+static bool append(struct seahorse_flat_map_i_i *const object,
+                   const struct sea_turtle_integer *const key,
+                   const struct sea_turtle_integer *const value) {
+    assert(object);
+    assert(key);
+    assert(value);
+    assert(object->count < object->capacity);
+    struct sea_turtle_integer *const k = &object->keys[object->count];
+    struct sea_turtle_integer *const v = &object->values[object->count];
+    if (!sea_turtle_integer_init_integer(k, key)) {
+        seagrass_required_true(SEA_TURTLE_INTEGER_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (!sea_turtle_integer_init_integer(v, value)) {
+        seagrass_required_true(SEA_TURTLE_INTEGER_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        seagrass_required_true(sea_turtle_integer_invalidate(k));
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->count += 1;
+    return true;
+}
+
+bool seahorse_flat_map_i_i_init_flat_map_i_i(
+        struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    if (!reserve(object, other->count)) {
+        return false;
+    }
+    for (uintmax_t i = 0; i < other->count; i++) {
+        if (!append(object, &other->keys[i], &other->values[i])) {
+            invalidate(object);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool seahorse_flat_map_i_i_init_red_black_tree_map_i_i(
+        struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_red_black_tree_map_i_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    uintmax_t count;
+    seagrass_required_true(seahorse_red_black_tree_map_i_i_count(
+            other, &count));
+    if (!count) {
+        return true;
+    }
+    if (!reserve(object, count)) {
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_i_i_entry *entry;
+    seagrass_required_true(seahorse_red_black_tree_map_i_i_first_entry(
+            other, &entry));
+    do {
+        const struct sea_turtle_integer *key;
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_entry_key(
+                other, entry, &key));
+        struct sea_turtle_integer *value;
+        seagrass_required_true(seahorse_red_black_tree_map_i_i_entry_value(
+                other, entry, &value));
+        if (!append(object, key, value)) {
+            invalidate(object);
+            return false;
+        }
+    } while (seahorse_red_black_tree_map_i_i_next_entry(entry, &entry));
+    return true;
+}
+
+bool seahorse_flat_map_i_i_count(
+        const struct seahorse_flat_map_i_i *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Binary search without a data dependent branch in the loop, the comparison
+ * only selects the next base, so that the number of iterations depends on
+ * the count alone and no misprediction stalls the loop.
+ */
+static uintmax_t lower_bound(const struct seahorse_flat_map_i_i *const object,
+                             const struct sea_turtle_integer *const key) {
+    assert(object);
+    if (!object->count) {
+        return 0;
+    }
+    const struct sea_turtle_integer *base = object->keys;
+    for (uintmax_t i = object->count; i > 1;) {
+        const uintmax_t half = i / 2;
+        base = compare(&base[half], key) < 0 ? base + half : base;
+        i -= half;
+    }
+    return (base - object->keys) + (compare(&base[0], key) < 0);
+}
+
+static uintmax_t upper_bound(const struct seahorse_flat_map_i_i *const object,
+                             const struct sea_turtle_integer *const key) {
+    assert(object);
+    if (!object->count) {
+        return 0;
+    }
+    const struct sea_turtle_integer *base = object->keys;
+    for (uintmax_t i = object->count; i > 1;) {
+        const uintmax_t half = i / 2;
+        base = compare(&base[half], key) <= 0 ? base + half : base;
+        i -= half;
+    }
+    return (base - object->keys) + (compare(&base[0], key) <= 0);
+}
+
+static bool find(const struct seahorse_flat_map_i_i *const object,
+                 const struct sea_turtle_integer *const key,
+                 uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = lower_bound(object, key);
+    return *out < object->count
+           && !compare(&object->keys[*out], key);
+}
+
+static bool find_ceiling(const struct seahorse_flat_map_i_i *const object,
+                         const struct sea_turtle_integer *const key,
+                         uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = lower_bound(object, key);
+    return *out < object->count;
+}
+
+static bool find_floor(const struct seahorse_flat_map_i_i *const object,
+                       const struct sea_turtle_integer *const key,
+                       uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = upper_bound(object, key);
+    return (*out)-- > 0;
+}
+
+static bool find_higher(const struct seahorse_flat_map_i_i *const object,
+                        const struct sea_turtle_integer *const key,
+                        uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = upper_bound(object, key);
+    return *out < object->count;
+}
+
+static bool find_lower(const struct seahorse_flat_map_i_i *const object,
+                       const struct sea_turtle_integer *const key,
+                       uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = lower_bound(object, key);
+    return (*out)-- > 0;
+}
+
+static void erase(struct seahorse_flat_map_i_i *const object,
+                  const uintmax_t index) {
+    assert(object);
+    assert(index < object->count);
+    seagrass_required_true(sea_turtle_integer_invalidate(
+            &object->keys[index]));
+    seagrass_required_true(sea_turtle_integer_invalidate(
+            &object->values[index]));
+    const uintmax_t tail = object->count - index - 1;
+    memmove(&object->keys[index], &object->keys[index + 1],
+            tail * sizeof(*object->keys));
+    memmove(&object->values[index], &object->values[index + 1],
+            tail * sizeof(*object->values));
+    object->count -= 1;
+}
+
+bool seahorse_flat_map_i_i_add(struct seahorse_flat_map_i_i *const object,
+                               const struct sea_turtle_integer *const key,
+                               const struct sea_turtle_integer *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    if (!grow(object)) {
+        return false;
+    }
+    const uintmax_t tail = object->count - index;
+    struct sea_turtle_integer copy[2];
+    if (!sea_turtle_integer_init_integer(&copy[0], key)) {
+        seagrass_required_true(SEA_TURTLE_INTEGER_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (!sea_turtle_integer_init_integer(&copy[1], value)) {
+        seagrass_required_true(SEA_TURTLE_INTEGER_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        seagrass_required_true(sea_turtle_integer_invalidate(&copy[0]));
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    memmove(&object->keys[index + 1], &object->keys[index],
+            tail * sizeof(*object->keys));
+    memmove(&object->values[index + 1], &object->values[index],
+            tail * sizeof(*object->values));
+    object->keys[index] = copy[0];
+    object->values[index] = copy[1];
+    object->count += 1;
+    return true;
+}
+
+bool seahorse_flat_map_i_i_remove(struct seahorse_flat_map_i_i *const object,
+                                  const struct sea_turtle_integer *const key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    erase(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_contains(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    *out = find(object, key, &index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_get(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_i_i_ceiling(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_ceiling(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_i_i_floor(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_floor(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_i_i_higher(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_higher(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_i_i_lower(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_lower(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_i_i_first(
+        const struct seahorse_flat_map_i_i *const object,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = &object->values[0];
+    return true;
+}
+
+bool seahorse_flat_map_i_i_last(
+        const struct seahorse_flat_map_i_i *const object,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = &object->values[object->count - 1];
+    return true;
+}
+
+static const struct seahorse_flat_map_i_i_entry *entry_of(
+        const struct seahorse_flat_map_i_i *const object,
+        const uintmax_t index) {
+    assert(object);
+    assert(index < object->count);
+    return (const struct seahorse_flat_map_i_i_entry *) &object->keys[index];
+}
+
+static uintmax_t index_of(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry *const entry) {
+    assert(object);
+    assert(entry);
+    const uintmax_t index =
+            (const struct sea_turtle_integer *) entry - object->keys;
+    assert(index < object->count);
+    return index;
+}
+
+bool seahorse_flat_map_i_i_get_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_ceiling_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_ceiling(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_floor_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_floor(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_higher_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_higher(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_lower_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_lower(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_first_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = entry_of(object, 0);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_last_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = entry_of(object, object->count - 1);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_remove_entry(
+        struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    erase(object, index_of(object, entry));
+    return true;
+}
+
+bool seahorse_flat_map_i_i_next_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry *const entry,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t index = 1 + index_of(object, entry);
+    if (index == object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_prev_entry(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry *const entry,
+        const struct seahorse_flat_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t index = index_of(object, entry);
+    if (!index) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    *out = entry_of(object, index - 1);
+    return true;
+}
+
+bool seahorse_flat_map_i_i_entry_key(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry *const entry,
+        const struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &object->keys[index_of(object, entry)];
+    return true;
+}
+
+bool seahorse_flat_map_i_i_entry_value(
+        const struct seahorse_flat_map_i_i *const object,
+        const struct seahorse_flat_map_i_i_entry *const entry,
+        struct sea_turtle_integer **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &object->values[index_of(object, entry)];
+    return true;
+}
@@ -0,0 +1,766 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+static void init(struct seahorse_flat_map_ni_p *const object) {
+    assert(object);
+    *object = (struct seahorse_flat_map_ni_p) {0};
+}
+
+bool seahorse_flat_map_ni_p_init(struct seahorse_flat_map_ni_p *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+static void invalidate(struct seahorse_flat_map_ni_p *const object,
+                       void (*const on_destroy)(void *value)) {
+    assert(object);
+    if (on_destroy) {
+        for (uintmax_t i = 0; i < object->count; i++) {
+            on_destroy((void *) object->values[i]);
+        }
+    }
+    free(object->keys);
+    free(object->values);
+    *object = (struct seahorse_flat_map_ni_p) {0};
+}
+
+bool seahorse_flat_map_ni_p_invalidate(
+        struct seahorse_flat_map_ni_p *const object,
+        void (*const on_destroy)(void *value)) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    invalidate(object, on_destroy);
+    return true;
+}
+
+static bool reserve(struct seahorse_flat_map_ni_p *const object,
+                    const uintmax_t capacity) {
+    assert(object);
+    if (capacity <= object->capacity) {
+        return true;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, sizeof(*object->keys), &size)
+        || size > SIZE_MAX) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error || size > SIZE_MAX);
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    void *keys = realloc(object->keys, size);
+    if (!keys) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->keys = keys;
+    seagrass_required_true(seagrass_uintmax_t_multiply(
+            capacity, sizeof(*object->values), &size));
+    void *values = realloc(object->values, size);
+    if (!values) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->values = values;
+    object->capacity = capacity;
+    return true;
+}
+
+static bool grow(struct seahorse_flat_map_ni_p *const object) {
+    assert(object);
+    if (object->count < object->capacity) {
+        return true;
+    }
+    uintmax_t capacity = 8;
+    if (object->capacity
+        && !seagrass_uintmax_t_multiply(object->capacity, 2, &capacity)) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error);
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return reserve(object, capacity);
+}
+
+bool seahorse_flat_map_ni_p_init_flat_map_ni_p(
+        struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    if (!other->count) {
+        return true;
+    }
+    if (!reserve(object, other->count)) {
+        invalidate(object, NULL);
+        return false;
+    }
+    memcpy(object->keys, other->keys, other->count * sizeof(*other->keys));
+    memcpy(object->values, other->values,
+           other->count * sizeof(*other->values));
+    object->count = other->count;
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_init_red_black_tree_map_ni_p(
+        struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_red_black_tree_map_ni_p *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    uintmax_t count;
+    seagrass_required_true(seahorse_red_black_tree_map_ni_p_count(
+            other, &count));
+    if (!count) {
+        return true;
+    }
+    if (!reserve(object, count)) {
+        invalidate(object, NULL);
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_ni_p_entry *entry;
+    seagrass_required_true(seahorse_red_black_tree_map_ni_p_first_entry(
+            other, &entry));
+    do {
+        const uintmax_t *key;
+        seagrass_required_true(seahorse_red_black_tree_map_ni_p_entry_key(
+                other, entry, &key));
+        seagrass_required_true(seahorse_red_black_tree_map_ni_p_entry_get_value(
+                other, entry, &object->values[object->count]));
+        object->keys[object->count] = *key;
+        object->count += 1;
+    } while (seahorse_red_black_tree_map_ni_p_next_entry(entry, &entry));
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_count(
+        const struct seahorse_flat_map_ni_p *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Binary search without a data dependent branch in the loop, the comparison
+ * only selects the next base, so that the number of iterations depends on
+ * the count alone and no misprediction stalls the loop.
+ */
+static uintmax_t lower_bound(const struct seahorse_flat_map_ni_p *const object,
+                             const uintmax_t key) {
+    assert(object);
+    if (!object->count) {
+        return 0;
+    }
+    const uintmax_t *base = object->keys;
+    for (uintmax_t i = object->count; i > 1;) {
+        const uintmax_t half = i / 2;
+        base = base[half] < key ? base + half : base;
+        i -= half;
+    }
+    return (base - object->keys) + (base[0] < key);
+}
+
+static uintmax_t upper_bound(const struct seahorse_flat_map_ni_p *const object,
+                             const uintmax_t key) {
+    assert(object);
+    if (!object->count) {
+        return 0;
+    }
+    const uintmax_t *base = object->keys;
+    for (uintmax_t i = object->count; i > 1;) {
+        const uintmax_t half = i / 2;
+        base = base[half] <= key ? base + half : base;
+        i -= half;
+    }
+    return (base - object->keys) + (base[0] <= key);
+}
+
+static bool find(const struct seahorse_flat_map_ni_p *const object,
+                 const uintmax_t key,
+                 uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = lower_bound(object, key);
+    return *out < object->count
+           && object->keys[*out] == key;
+}
+
+static bool find_ceiling(const struct seahorse_flat_map_ni_p *const object,
+                         const uintmax_t key,
+                         uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = lower_bound(object, key);
+    return *out < object->count;
+}
+
+static bool find_floor(const struct seahorse_flat_map_ni_p *const object,
+                       const uintmax_t key,
+                       uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = upper_bound(object, key);
+    return (*out)-- > 0;
+}
+
+static bool find_higher(const struct seahorse_flat_map_ni_p *const object,
+                        const uintmax_t key,
+                        uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = upper_bound(object, key);
+    return *out < object->count;
+}
+
+static bool find_lower(const struct seahorse_flat_map_ni_p *const object,
+                       const uintmax_t key,
+                       uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    *out = lower_bound(object, key);
+    return (*out)-- > 0;
+}
+
+static void erase(struct seahorse_flat_map_ni_p *const object,
+                  const uintmax_t index) {
+    assert(object);
+    assert(index < object->count);
+    const uintmax_t tail = object->count - index - 1;
+    memmove(&object->keys[index], &object->keys[index + 1],
+            tail * sizeof(*object->keys));
+    memmove(&object->values[index], &object->values[index + 1],
+            tail * sizeof(*object->values));
+    object->count -= 1;
+}
+
+bool seahorse_flat_map_ni_p_add(struct seahorse_flat_map_ni_p *const object,
+                                const uintmax_t key,
+                                const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    if (!grow(object)) {
+        return false;
+    }
+    const uintmax_t tail = object->count - index;
+    memmove(&object->keys[index + 1], &object->keys[index],
+            tail * sizeof(*object->keys));
+    memmove(&object->values[index + 1], &object->values[index],
+            tail * sizeof(*object->values));
+    object->keys[index] = key;
+    object->values[index] = value;
+    object->count += 1;
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_remove(struct seahorse_flat_map_ni_p *const object,
+                                   const uintmax_t key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    erase(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_contains(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    *out = find(object, key, &index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_set(struct seahorse_flat_map_ni_p *const object,
+                                const uintmax_t key,
+                                const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    object->values[index] = value;
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_get(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_ceiling(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_ceiling(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_floor(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_floor(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_higher(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_higher(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_lower(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_lower(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = object->values[index];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_first(
+        const struct seahorse_flat_map_ni_p *const object,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->values[0];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_last(
+        const struct seahorse_flat_map_ni_p *const object,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->values[object->count - 1];
+    return true;
+}
+
+static const struct seahorse_flat_map_ni_p_entry *entry_of(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t index) {
+    assert(object);
+    assert(index < object->count);
+    return (const struct seahorse_flat_map_ni_p_entry *) &object->keys[index];
+}
+
+static uintmax_t index_of(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry *const entry) {
+    assert(object);
+    assert(entry);
+    const uintmax_t index =
+            (const uintmax_t *) entry - object->keys;
+    assert(index < object->count);
+    return index;
+}
+
+bool seahorse_flat_map_ni_p_get_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_ceiling_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_ceiling(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_floor_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_floor(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_higher_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_higher(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_lower_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const uintmax_t key,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find_lower(object, key, &index)) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_first_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = entry_of(object, 0);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_last_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = entry_of(object, object->count - 1);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_remove_entry(
+        struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    erase(object, index_of(object, entry));
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_next_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry *const entry,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t index = 1 + index_of(object, entry);
+    if (index == object->count) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    *out = entry_of(object, index);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_prev_entry(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry *const entry,
+        const struct seahorse_flat_map_ni_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t index = index_of(object, entry);
+    if (!index) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    *out = entry_of(object, index - 1);
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_entry_key(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry *const entry,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &object->keys[index_of(object, entry)];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_entry_get_value(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry *const entry,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->values[index_of(object, entry)];
+    return true;
+}
+
+bool seahorse_flat_map_ni_p_entry_set_value(
+        const struct seahorse_flat_map_ni_p *const object,
+        const struct seahorse_flat_map_ni_p_entry *const entry,
+        const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    object->values[index_of(object, entry)] = value;
+    return true;
+}
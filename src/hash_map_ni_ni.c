@@ -0,0 +1,402 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#include "private/hash_table.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+struct seahorse_hash_map_ni_ni_entry {
+    uintmax_t key;
+    uintmax_t value;
+};
+
+static uint64_t hash(const uintmax_t key) {
+    /* splitmix64 finalizer */
+    uint64_t result = (uint64_t) key;
+    result = (result ^ (result >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    result = (result ^ (result >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return result ^ (result >> 31);
+}
+
+static uint64_t hash_entry(const void *const entry) {
+    assert(entry);
+    return hash(((const struct seahorse_hash_map_ni_ni_entry *) entry)->key);
+}
+
+static bool matches(const void *const key, const void *const entry) {
+    assert(key);
+    assert(entry);
+    return *(const uintmax_t *) key
+           == ((const struct seahorse_hash_map_ni_ni_entry *) entry)->key;
+}
+
+static struct seahorse_hash_map_ni_ni_entry *entry_at(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const uintmax_t index) {
+    assert(object);
+    return seahorse_hash_table_entry(&object->table, index);
+}
+
+static void init(struct seahorse_hash_map_ni_ni *const object) {
+    assert(object);
+    seahorse_hash_table_init(&object->table,
+                             sizeof(struct seahorse_hash_map_ni_ni_entry),
+                             hash_entry);
+}
+
+bool seahorse_hash_map_ni_ni_init(
+        struct seahorse_hash_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_invalidate(
+        struct seahorse_hash_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    seahorse_hash_table_invalidate(&object->table);
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_init_hash_map_ni_ni(
+        struct seahorse_hash_map_ni_ni *const object,
+        const struct seahorse_hash_map_ni_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    if (!seahorse_hash_table_copy(&object->table, &other->table)) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_count(
+        const struct seahorse_hash_map_ni_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->table.count;
+    return true;
+}
+
+static bool find(const struct seahorse_hash_map_ni_ni *const object,
+                 const uintmax_t key,
+                 const uint64_t hashed,
+                 uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    return seahorse_hash_table_find(&object->table, hashed, &key, matches,
+                                    out);
+}
+
+static bool insert(struct seahorse_hash_map_ni_ni *const object,
+                   const uintmax_t key,
+                   const uintmax_t value,
+                   uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    const uint64_t hashed = hash(key);
+    if (find(object, key, hashed, out)) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    if (!seahorse_hash_table_reserve(&object->table, hashed, out)) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    *entry_at(object, *out) = (struct seahorse_hash_map_ni_ni_entry) {
+            .key = key,
+            .value = value
+    };
+    seahorse_hash_table_occupy(&object->table, *out, hashed);
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_add(struct seahorse_hash_map_ni_ni *const object,
+                                 const uintmax_t key,
+                                 const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    return insert(object, key, value, &index);
+}
+
+bool seahorse_hash_map_ni_ni_try_add(
+        struct seahorse_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value,
+        const struct seahorse_hash_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    const bool result = insert(object, key, value, &index);
+    if (result
+        || SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS
+           == seahorse_error) {
+        *out = entry_at(object, index);
+    }
+    return result;
+}
+
+bool seahorse_hash_map_ni_ni_remove(
+        struct seahorse_hash_map_ni_ni *const object,
+        const uintmax_t key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, hash(key), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    seahorse_hash_table_erase(&object->table, index);
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_contains(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    *out = find(object, key, hash(key), &index);
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_set(struct seahorse_hash_map_ni_ni *const object,
+                                 const uintmax_t key,
+                                 const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, hash(key), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    entry_at(object, index)->value = value;
+    return true;
+}
+
+static bool retrieve_entry(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_hash_map_ni_ni_entry **const out) {
+    assert(object);
+    assert(out);
+    uintmax_t index;
+    if (!find(object, key, hash(key), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_at(object, index);
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_get(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    if (!retrieve_entry(object, key, &entry)) {
+        return false;
+    }
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_get_entry(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_hash_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    return retrieve_entry(object, key, out);
+}
+
+static bool scan(const struct seahorse_hash_map_ni_ni *const object,
+                 const uintmax_t from,
+                 const struct seahorse_hash_map_ni_ni_entry **const out) {
+    assert(object);
+    assert(out);
+    uintmax_t index;
+    if (!seahorse_hash_table_scan(&object->table, from, &index)) {
+        return false;
+    }
+    *out = entry_at(object, index);
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_first_entry(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const struct seahorse_hash_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->table.count) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    seagrass_required_true(scan(object, 0, out));
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_next_entry(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const struct seahorse_hash_map_ni_ni_entry *const entry,
+        const struct seahorse_hash_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t index = seahorse_hash_table_index(&object->table,
+                                                     entry);
+    if (!scan(object, 1 + index, out)) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_remove_entry(
+        struct seahorse_hash_map_ni_ni *const object,
+        const struct seahorse_hash_map_ni_ni_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    seahorse_hash_table_erase(
+            &object->table,
+            seahorse_hash_table_index(&object->table, entry));
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_entry_key(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const struct seahorse_hash_map_ni_ni_entry *const entry,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &entry->key;
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_entry_get_value(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const struct seahorse_hash_map_ni_ni_entry *const entry,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_hash_map_ni_ni_entry_set_value(
+        const struct seahorse_hash_map_ni_ni *const object,
+        const struct seahorse_hash_map_ni_ni_entry *const entry,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    struct seahorse_hash_map_ni_ni_entry *const item
+            = (struct seahorse_hash_map_ni_ni_entry *) entry;
+    item->value = value;
+    return true;
+}
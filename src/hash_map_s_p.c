@@ -0,0 +1,656 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include "private/hash_table.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+struct seahorse_hash_map_s_p_entry {
+    uint64_t hash;
+    struct sea_turtle_string key;
+    const void *value;
+};
+
+static uint64_t hash(const char *const chars, const size_t size) {
+    /* FNV-1a followed by the splitmix64 finalizer to spread the bits */
+    uint64_t result = UINT64_C(0xCBF29CE484222325);
+    for (size_t i = 0; i < size; i++) {
+        result = (result ^ (uint8_t) chars[i]) * UINT64_C(0x100000001B3);
+    }
+    result = (result ^ (result >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    result = (result ^ (result >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return result ^ (result >> 31);
+}
+
+static void bytes_of(const struct sea_turtle_string *const object,
+                     const char **const chars,
+                     size_t *const size) {
+    assert(object);
+    assert(chars);
+    assert(size);
+    uintmax_t out;
+    seagrass_required_true(sea_turtle_string_size(object, &out));
+    seagrass_required_true(sea_turtle_string_char(object, chars));
+    *size = (size_t) out;
+}
+
+static uint64_t hash_entry(const void *const entry) {
+    assert(entry);
+    return ((const struct seahorse_hash_map_s_p_entry *) entry)->hash;
+}
+
+/*
+ * Key that is looked up, along with its hash to reject most entries before
+ * their bytes are compared.
+ */
+struct lookup {
+    const char *chars;
+    size_t size;
+    uint64_t hashed;
+};
+
+static bool matches(const void *const key, const void *const entry) {
+    assert(key);
+    assert(entry);
+    const struct lookup *const A = key;
+    const struct seahorse_hash_map_s_p_entry *const B = entry;
+    if (A->hashed != B->hash) {
+        return false;
+    }
+    const char *chars;
+    size_t size;
+    bytes_of(&B->key, &chars, &size);
+    return A->size == size && (!size || !memcmp(A->chars, chars, size));
+}
+
+static struct seahorse_hash_map_s_p_entry *entry_at(
+        const struct seahorse_hash_map_s_p *const object,
+        const uintmax_t index) {
+    assert(object);
+    return seahorse_hash_table_entry(&object->table, index);
+}
+
+static void init(struct seahorse_hash_map_s_p *const object) {
+    assert(object);
+    seahorse_hash_table_init(&object->table,
+                             sizeof(struct seahorse_hash_map_s_p_entry),
+                             hash_entry);
+}
+
+bool seahorse_hash_map_s_p_init(struct seahorse_hash_map_s_p *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+static void invalidate(struct seahorse_hash_map_s_p *const object,
+                       void (*const on_destroy)(void *value)) {
+    assert(object);
+    uintmax_t i = 0;
+    for (; seahorse_hash_table_scan(&object->table, i, &i); i++) {
+        struct seahorse_hash_map_s_p_entry *const entry = entry_at(object, i);
+        seagrass_required_true(sea_turtle_string_invalidate(&entry->key));
+        if (on_destroy) {
+            on_destroy((void *) entry->value);
+        }
+    }
+    seahorse_hash_table_invalidate(&object->table);
+}
+
+bool seahorse_hash_map_s_p_invalidate(
+        struct seahorse_hash_map_s_p *const object,
+        void (*const on_destroy)(void *value)) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    invalidate(object, on_destroy);
+    return true;
+}
+
+bool seahorse_hash_map_s_p_init_hash_map_s_p(
+        struct seahorse_hash_map_s_p *const object,
+        const struct seahorse_hash_map_s_p *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    if (!other->table.count) {
+        return true;
+    }
+    if (!seahorse_hash_table_allocate(&object->table,
+                                      other->table.capacity)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    uintmax_t i = 0;
+    for (; seahorse_hash_table_scan(&other->table, i, &i); i++) {
+        const struct seahorse_hash_map_s_p_entry *const entry
+                = entry_at(other, i);
+        struct seahorse_hash_map_s_p_entry *const copy = entry_at(object, i);
+        copy->hash = entry->hash;
+        if (!sea_turtle_string_init_string(&copy->key, &entry->key)) {
+            seagrass_required_true(
+                    SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                    == sea_turtle_error);
+            seahorse_error =
+                    SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+            invalidate(object, NULL);
+            return false;
+        }
+        copy->value = entry->value;
+        seahorse_hash_table_occupy(&object->table, i, entry->hash);
+    }
+    object->table.growth = other->table.growth;
+    return true;
+}
+
+bool seahorse_hash_map_s_p_count(
+        const struct seahorse_hash_map_s_p *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->table.count;
+    return true;
+}
+
+static bool find(const struct seahorse_hash_map_s_p *const object,
+                 const char *const chars,
+                 const size_t size,
+                 const uint64_t hashed,
+                 uintmax_t *const out) {
+    assert(object);
+    assert(chars || !size);
+    assert(out);
+    const struct lookup key = {
+            .chars = chars,
+            .size = size,
+            .hashed = hashed
+    };
+    return seahorse_hash_table_find(&object->table, hashed, &key, matches,
+                                    out);
+}
+
+/*
+ * Find the slot that the key will occupy, growing the table if needed, but
+ * leave the slot unoccupied so that the caller may still fail.
+ */
+static bool reserve(struct seahorse_hash_map_s_p *const object,
+                    const struct sea_turtle_string *const key,
+                    uint64_t *const hashed,
+                    uintmax_t *const out) {
+    assert(object);
+    assert(key);
+    assert(hashed);
+    assert(out);
+    const char *chars;
+    size_t size;
+    bytes_of(key, &chars, &size);
+    *hashed = hash(chars, size);
+    if (find(object, chars, size, *hashed, out)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    if (!seahorse_hash_table_reserve(&object->table, *hashed, out)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
+
+static void occupy(struct seahorse_hash_map_s_p *const object,
+                   const uintmax_t index,
+                   const uint64_t hashed) {
+    assert(object);
+    entry_at(object, index)->hash = hashed;
+    seahorse_hash_table_occupy(&object->table, index, hashed);
+}
+
+static void erase(struct seahorse_hash_map_s_p *const object,
+                  const uintmax_t index) {
+    assert(object);
+    struct seahorse_hash_map_s_p_entry *const entry = entry_at(object, index);
+    seagrass_required_true(sea_turtle_string_invalidate(&entry->key));
+    seahorse_hash_table_erase(&object->table, index);
+}
+
+static bool insert(struct seahorse_hash_map_s_p *const object,
+                   const struct sea_turtle_string *const key,
+                   const void *const value,
+                   uintmax_t *const out) {
+    assert(object);
+    assert(key);
+    assert(out);
+    uint64_t hashed;
+    if (!reserve(object, key, &hashed, out)) {
+        return false;
+    }
+    struct seahorse_hash_map_s_p_entry *const entry = entry_at(object, *out);
+    if (!sea_turtle_string_init_string(&entry->key, key)) {
+        seagrass_required_true(SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    entry->value = value;
+    occupy(object, *out, hashed);
+    return true;
+}
+
+bool seahorse_hash_map_s_p_add(struct seahorse_hash_map_s_p *const object,
+                               const struct sea_turtle_string *const key,
+                               const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    return insert(object, key, value, &index);
+}
+
+bool seahorse_hash_map_s_p_try_add(
+        struct seahorse_hash_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const void *const value,
+        const struct seahorse_hash_map_s_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    const bool result = insert(object, key, value, &index);
+    if (result
+        || SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS
+           == seahorse_error) {
+        *out = entry_at(object, index);
+    }
+    return result;
+}
+
+bool seahorse_hash_map_s_p_add_take(
+        struct seahorse_hash_map_s_p *const object,
+        struct sea_turtle_string *const key,
+        const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    uint64_t hashed;
+    uintmax_t index;
+    if (!reserve(object, key, &hashed, &index)) {
+        return false;
+    }
+    struct seahorse_hash_map_s_p_entry *const entry = entry_at(object, index);
+    entry->key = *key;
+    entry->value = value;
+    occupy(object, index, hashed);
+    *key = (struct sea_turtle_string) {0};
+    return true;
+}
+
+bool seahorse_hash_map_s_p_remove(
+        struct seahorse_hash_map_s_p *const object,
+        const struct sea_turtle_string *const key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const char *chars;
+    size_t size;
+    bytes_of(key, &chars, &size);
+    uintmax_t index;
+    if (!find(object, chars, size, hash(chars, size), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    erase(object, index);
+    return true;
+}
+
+bool seahorse_hash_map_s_p_remove_chars(
+        struct seahorse_hash_map_s_p *const object,
+        const char *const key,
+        const size_t size) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, size, hash(key, size), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    erase(object, index);
+    return true;
+}
+
+bool seahorse_hash_map_s_p_contains(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const char *chars;
+    size_t size;
+    bytes_of(key, &chars, &size);
+    uintmax_t index;
+    *out = find(object, chars, size, hash(chars, size), &index);
+    return true;
+}
+
+bool seahorse_hash_map_s_p_contains_chars(
+        const struct seahorse_hash_map_s_p *const object,
+        const char *const key,
+        const size_t size,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const char *const chars = key;
+    uintmax_t index;
+    *out = find(object, chars, size, hash(chars, size), &index);
+    return true;
+}
+
+bool seahorse_hash_map_s_p_set(
+        struct seahorse_hash_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const char *chars;
+    size_t size;
+    bytes_of(key, &chars, &size);
+    uintmax_t index;
+    if (!find(object, chars, size, hash(chars, size), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    entry_at(object, index)->value = value;
+    return true;
+}
+
+bool seahorse_hash_map_s_p_get(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const char *chars;
+    size_t size;
+    bytes_of(key, &chars, &size);
+    uintmax_t index;
+    if (!find(object, chars, size, hash(chars, size), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    const struct seahorse_hash_map_s_p_entry *const entry
+            = entry_at(object, index);
+    *out = entry->value;
+    return true;
+}
+
+bool seahorse_hash_map_s_p_get_chars(
+        const struct seahorse_hash_map_s_p *const object,
+        const char *const key,
+        const size_t size,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t index;
+    if (!find(object, key, size, hash(key, size), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    const struct seahorse_hash_map_s_p_entry *const entry
+            = entry_at(object, index);
+    *out = entry->value;
+    return true;
+}
+
+bool seahorse_hash_map_s_p_get_entry(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const struct seahorse_hash_map_s_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const char *chars;
+    size_t size;
+    bytes_of(key, &chars, &size);
+    uintmax_t index;
+    if (!find(object, chars, size, hash(chars, size), &index)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry_at(object, index);
+    return true;
+}
+
+static bool scan(const struct seahorse_hash_map_s_p *const object,
+                 const uintmax_t from,
+                 const struct seahorse_hash_map_s_p_entry **const out) {
+    assert(object);
+    assert(out);
+    uintmax_t index;
+    if (!seahorse_hash_table_scan(&object->table, from, &index)) {
+        return false;
+    }
+    *out = entry_at(object, index);
+    return true;
+}
+
+bool seahorse_hash_map_s_p_first_entry(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct seahorse_hash_map_s_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->table.count) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    seagrass_required_true(scan(object, 0, out));
+    return true;
+}
+
+bool seahorse_hash_map_s_p_next_entry(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct seahorse_hash_map_s_p_entry *const entry,
+        const struct seahorse_hash_map_s_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t index = seahorse_hash_table_index(&object->table,
+                                                     entry);
+    if (!scan(object, 1 + index, out)) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_hash_map_s_p_remove_entry(
+        struct seahorse_hash_map_s_p *const object,
+        const struct seahorse_hash_map_s_p_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    erase(object, seahorse_hash_table_index(&object->table, entry));
+    return true;
+}
+
+bool seahorse_hash_map_s_p_entry_key(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct seahorse_hash_map_s_p_entry *const entry,
+        const struct sea_turtle_string **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &entry->key;
+    return true;
+}
+
+bool seahorse_hash_map_s_p_entry_get_value(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct seahorse_hash_map_s_p_entry *const entry,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = entry->value;
+    return true;
+}
+
+bool seahorse_hash_map_s_p_entry_set_value(
+        const struct seahorse_hash_map_s_p *const object,
+        const struct seahorse_hash_map_s_p_entry *const entry,
+        const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    struct seahorse_hash_map_s_p_entry *const item
+            = (struct seahorse_hash_map_s_p_entry *) entry;
+    item->value = value;
+    return true;
+}
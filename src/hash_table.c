@@ -0,0 +1,421 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#include "private/hash_table.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/*
+ * Open addressing with one control byte per slot. A full slot holds the low
+ * 7 bits of the hash of its key while empty and deleted slots have their high
+ * bit set, which allows a whole group of slots to be matched against the
+ * hash of a key at once. The first GROUP_WIDTH control bytes are cloned past
+ * the end of the table so that a group may be loaded from any position.
+ */
+#define EMPTY                           ((uint8_t) 0x80)
+#define DELETED                         ((uint8_t) 0xFE)
+
+#if defined(__SSE2__)
+#define GROUP_WIDTH                     16
+#define GROUP_SHIFT                     0
+
+typedef uint32_t group_mask;
+
+static group_mask group_match(const uint8_t *const group,
+                              const uint8_t control) {
+    const __m128i controls = _mm_loadu_si128((const __m128i *) group);
+    return (group_mask) _mm_movemask_epi8(_mm_cmpeq_epi8(
+            controls, _mm_set1_epi8((char) control)));
+}
+
+static group_mask group_match_empty(const uint8_t *const group) {
+    return group_match(group, EMPTY);
+}
+
+static group_mask group_match_empty_or_deleted(const uint8_t *const group) {
+    const __m128i controls = _mm_loadu_si128((const __m128i *) group);
+    return (group_mask) _mm_movemask_epi8(controls);
+}
+#else
+#define GROUP_WIDTH                     8
+#define GROUP_SHIFT                     3
+#define LSBS                            UINT64_C(0x0101010101010101)
+#define MSBS                            UINT64_C(0x8080808080808080)
+
+typedef uint64_t group_mask;
+
+static uint64_t group_load(const uint8_t *const group) {
+    uint64_t result = 0;
+    for (uintmax_t i = 0; i < GROUP_WIDTH; i++) {
+        result |= (uint64_t) group[i] << (i * 8);
+    }
+    return result;
+}
+
+static group_mask group_match(const uint8_t *const group,
+                              const uint8_t control) {
+    /* may report a false positive which is rejected by comparing keys */
+    const uint64_t controls = group_load(group) ^ (LSBS * control);
+    return (controls - LSBS) & ~controls & MSBS;
+}
+
+static group_mask group_match_empty(const uint8_t *const group) {
+    const uint64_t controls = group_load(group);
+    return controls & ~(controls << 6) & MSBS;
+}
+
+static group_mask group_match_empty_or_deleted(const uint8_t *const group) {
+    const uint64_t controls = group_load(group);
+    return controls & ~(controls << 7) & MSBS;
+}
+#endif
+
+static uintmax_t group_lowest(const group_mask mask) {
+    assert(mask);
+#if defined(__GNUC__)
+    return (uintmax_t) __builtin_ctzll(mask) >> GROUP_SHIFT;
+#else
+    uintmax_t result = 0;
+    for (group_mask i = mask; !(i & 1); i >>= 1) {
+        result++;
+    }
+    return result >> GROUP_SHIFT;
+#endif
+}
+
+static uint8_t hash_control(const uint64_t hashed) {
+    return (uint8_t) (hashed & 0x7F);
+}
+
+static uintmax_t hash_position(const uint64_t hashed) {
+    return (uintmax_t) (hashed >> 7);
+}
+
+static uintmax_t maximum_load(const uintmax_t capacity) {
+    return capacity - capacity / 8;
+}
+
+static bool is_full(const uint8_t control) {
+    return !(control & 0x80);
+}
+
+static void set_control(struct seahorse_hash_table *const object,
+                        const uintmax_t index,
+                        const uint8_t control) {
+    assert(object);
+    assert(index < object->capacity);
+    object->controls[index] = control;
+    if (index < GROUP_WIDTH) {
+        object->controls[object->capacity + index] = control;
+    }
+}
+
+void seahorse_hash_table_init(struct seahorse_hash_table *const object,
+                              const size_t size,
+                              uint64_t (*const hash)(const void *)) {
+    assert(object);
+    assert(size);
+    assert(hash);
+    *object = (struct seahorse_hash_table) {
+            .size = size,
+            .hash = hash
+    };
+}
+
+void seahorse_hash_table_invalidate(struct seahorse_hash_table *const object) {
+    assert(object);
+    free(object->entries);
+    *object = (struct seahorse_hash_table) {0};
+}
+
+bool seahorse_hash_table_allocate(struct seahorse_hash_table *const object,
+                                  const uintmax_t capacity) {
+    assert(object);
+    assert(capacity >= GROUP_WIDTH);
+    assert(!(capacity & (capacity - 1)));
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, object->size, &size)
+        || !seagrass_uintmax_t_add(size, capacity + GROUP_WIDTH, &size)
+        || size > SIZE_MAX) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error || size > SIZE_MAX);
+        return false;
+    }
+    unsigned char *const entries = malloc(size);
+    if (!entries) {
+        return false;
+    }
+    *object = (struct seahorse_hash_table) {
+            .capacity = capacity,
+            .growth = maximum_load(capacity),
+            .controls = &entries[capacity * object->size],
+            .entries = entries,
+            .size = object->size,
+            .hash = object->hash
+    };
+    memset(object->controls, EMPTY, capacity + GROUP_WIDTH);
+    return true;
+}
+
+bool seahorse_hash_table_copy(struct seahorse_hash_table *const object,
+                              const struct seahorse_hash_table *const other) {
+    assert(object);
+    assert(other);
+    assert(object->size == other->size);
+    if (!other->capacity) {
+        return true;
+    }
+    if (!seahorse_hash_table_allocate(object, other->capacity)) {
+        return false;
+    }
+    memcpy(object->entries, other->entries,
+           other->capacity * other->size + other->capacity + GROUP_WIDTH);
+    object->count = other->count;
+    object->growth = other->growth;
+    return true;
+}
+
+void *seahorse_hash_table_entry(const struct seahorse_hash_table *const object,
+                                const uintmax_t index) {
+    assert(object);
+    assert(index < object->capacity);
+    return (unsigned char *) object->entries + index * object->size;
+}
+
+uintmax_t seahorse_hash_table_index(
+        const struct seahorse_hash_table *const object,
+        const void *const entry) {
+    assert(object);
+    assert(entry);
+    return ((const unsigned char *) entry
+            - (const unsigned char *) object->entries) / object->size;
+}
+
+bool seahorse_hash_table_find(
+        const struct seahorse_hash_table *const object,
+        const uint64_t hashed,
+        const void *const key,
+        bool (*const matches)(const void *, const void *),
+        uintmax_t *const out) {
+    assert(object);
+    assert(matches);
+    assert(out);
+    if (!object->capacity) {
+        return false;
+    }
+    const uintmax_t mask = object->capacity - 1;
+    const uint8_t control = hash_control(hashed);
+    uintmax_t position = hash_position(hashed) & mask;
+    for (uintmax_t stride = GROUP_WIDTH;; stride += GROUP_WIDTH) {
+        const uint8_t *const group = &object->controls[position];
+        for (group_mask i = group_match(group, control); i; i &= i - 1) {
+            const uintmax_t index = (position + group_lowest(i)) & mask;
+            if (control == object->controls[index]
+                && matches(key, seahorse_hash_table_entry(object, index))) {
+                *out = index;
+                return true;
+            }
+        }
+        if (group_match_empty(group)) {
+            return false;
+        }
+        position = (position + stride) & mask;
+    }
+}
+
+static uintmax_t find_free(const struct seahorse_hash_table *const object,
+                           const uint64_t hashed) {
+    assert(object);
+    assert(object->capacity);
+    const uintmax_t mask = object->capacity - 1;
+    uintmax_t position = hash_position(hashed) & mask;
+    for (uintmax_t stride = GROUP_WIDTH;; stride += GROUP_WIDTH) {
+        const group_mask i = group_match_empty_or_deleted(
+                &object->controls[position]);
+        if (i) {
+            return (position + group_lowest(i)) & mask;
+        }
+        position = (position + stride) & mask;
+    }
+}
+
+/*
+ * Number of groups between the first group probed for hashed and the one
+ * holding index.
+ */
+static uintmax_t probe_distance(const struct seahorse_hash_table *const object,
+                                const uint64_t hashed,
+                                const uintmax_t index) {
+    assert(object);
+    const uintmax_t mask = object->capacity - 1;
+    return ((index - (hash_position(hashed) & mask)) & mask) / GROUP_WIDTH;
+}
+
+/*
+ * Exchange two entries through a small buffer, as rehashing in place must
+ * not allocate.
+ */
+static void swap(unsigned char *first,
+                 unsigned char *second,
+                 size_t size) {
+    assert(first);
+    assert(second);
+    unsigned char buffer[64];
+    while (size) {
+        const size_t length = size < sizeof(buffer) ? size : sizeof(buffer);
+        memcpy(buffer, first, length);
+        memcpy(first, second, length);
+        memcpy(second, buffer, length);
+        first += length;
+        second += length;
+        size -= length;
+    }
+}
+
+/*
+ * Reclaim the deleted slots without allocating by turning them into empty
+ * ones and the full slots into deleted ones, which then mark the entries
+ * that are yet to be placed. Each of these either stays where it is, if that
+ * is within the group where a probe for it would first find room, or moves
+ * into that room, swapping places with another entry yet to be placed.
+ */
+static void rehash_in_place(struct seahorse_hash_table *const object) {
+    assert(object);
+    assert(object->capacity);
+    for (uintmax_t i = 0; i < object->capacity; i++) {
+        object->controls[i] = is_full(object->controls[i]) ? DELETED : EMPTY;
+    }
+    memcpy(&object->controls[object->capacity], object->controls,
+           GROUP_WIDTH);
+    for (uintmax_t i = 0; i < object->capacity; i++) {
+        if (DELETED != object->controls[i]) {
+            continue;
+        }
+        unsigned char *const entry = seahorse_hash_table_entry(object, i);
+        const uint64_t hashed = object->hash(entry);
+        const uintmax_t index = find_free(object, hashed);
+        if (probe_distance(object, hashed, i)
+            == probe_distance(object, hashed, index)) {
+            set_control(object, i, hash_control(hashed));
+            continue;
+        }
+        unsigned char *const other = seahorse_hash_table_entry(object, index);
+        if (EMPTY == object->controls[index]) {
+            memcpy(other, entry, object->size);
+            set_control(object, index, hash_control(hashed));
+            set_control(object, i, EMPTY);
+            continue;
+        }
+        swap(other, entry, object->size);
+        set_control(object, index, hash_control(hashed));
+        i--; /* place the entry swapped into i */
+    }
+    object->growth = maximum_load(object->capacity) - object->count;
+}
+
+static bool rehash(struct seahorse_hash_table *const object) {
+    assert(object);
+    uintmax_t capacity = GROUP_WIDTH;
+    if (object->capacity) {
+        if (object->count < maximum_load(object->capacity) / 2) {
+            /* mostly deleted slots are reclaimed without growing */
+            rehash_in_place(object);
+            return true;
+        }
+        capacity = object->capacity * 2;
+        if (capacity < object->capacity) {
+            return false;
+        }
+    }
+    struct seahorse_hash_table other = {
+            .size = object->size,
+            .hash = object->hash
+    };
+    if (!seahorse_hash_table_allocate(&other, capacity)) {
+        return false;
+    }
+    for (uintmax_t i = 0; i < object->capacity; i++) {
+        if (!is_full(object->controls[i])) {
+            continue;
+        }
+        const void *const entry = seahorse_hash_table_entry(object, i);
+        const uint64_t hashed = object->hash(entry);
+        const uintmax_t index = find_free(&other, hashed);
+        set_control(&other, index, hash_control(hashed));
+        memcpy(seahorse_hash_table_entry(&other, index), entry, object->size);
+    }
+    other.count = object->count;
+    other.growth -= object->count;
+    seahorse_hash_table_invalidate(object);
+    *object = other;
+    return true;
+}
+
+bool seahorse_hash_table_reserve(struct seahorse_hash_table *const object,
+                                 const uint64_t hashed,
+                                 uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    uintmax_t index = 0;
+    if (object->capacity) {
+        index = find_free(object, hashed);
+    }
+    if (!object->capacity
+        || (!object->growth && EMPTY == object->controls[index])) {
+        if (!rehash(object)) {
+            return false;
+        }
+        index = find_free(object, hashed);
+    }
+    *out = index;
+    return true;
+}
+
+void seahorse_hash_table_occupy(struct seahorse_hash_table *const object,
+                                const uintmax_t index,
+                                const uint64_t hashed) {
+    assert(object);
+    assert(index < object->capacity);
+    assert(!is_full(object->controls[index]));
+    if (EMPTY == object->controls[index]) {
+        object->growth -= 1;
+    }
+    set_control(object, index, hash_control(hashed));
+    object->count += 1;
+}
+
+void seahorse_hash_table_erase(struct seahorse_hash_table *const object,
+                               const uintmax_t index) {
+    assert(object);
+    assert(index < object->capacity);
+    assert(is_full(object->controls[index]));
+    set_control(object, index, DELETED);
+    object->count -= 1;
+    if (!object->count) {
+        memset(object->controls, EMPTY, object->capacity + GROUP_WIDTH);
+        object->growth = maximum_load(object->capacity);
+    }
+}
+
+bool seahorse_hash_table_scan(const struct seahorse_hash_table *const object,
+                              const uintmax_t from,
+                              uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    for (uintmax_t i = from; i < object->capacity; i++) {
+        if (is_full(object->controls[i])) {
+            *out = i;
+            return true;
+        }
+    }
+    return false;
+}
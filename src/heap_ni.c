@@ -0,0 +1,223 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define ARITY                           4
+#define MINIMUM_CAPACITY                8
+
+bool seahorse_heap_ni_init(struct seahorse_heap_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    *object = (struct seahorse_heap_ni) {0};
+    return true;
+}
+
+bool seahorse_heap_ni_invalidate(struct seahorse_heap_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    free(object->items);
+    *object = (struct seahorse_heap_ni) {0};
+    return true;
+}
+
+bool seahorse_heap_ni_count(const struct seahorse_heap_ni *const object,
+                            uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Make room for count more items by doubling the capacity.
+ */
+static bool reserve(struct seahorse_heap_ni *const object,
+                    const uintmax_t count) {
+    assert(object);
+    uintmax_t required;
+    if (!seagrass_uintmax_t_add(object->count, count, &required)) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error);
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (required <= object->capacity) {
+        return true;
+    }
+    uintmax_t capacity = object->capacity
+            ? object->capacity
+            : MINIMUM_CAPACITY;
+    while (capacity < required) {
+        if (capacity > UINTMAX_MAX / 2) {
+            seahorse_error = SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        capacity <<= 1;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, sizeof(uintmax_t), &size)
+        || size > SIZE_MAX) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    uintmax_t *const items = realloc(object->items, size);
+    if (!items) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->items = items;
+    object->capacity = capacity;
+    return true;
+}
+
+static void sift_up(uintmax_t *const items, uintmax_t i) {
+    assert(items);
+    const uintmax_t item = items[i];
+    while (i) {
+        const uintmax_t parent = (i - 1) / ARITY;
+        if (items[parent] <= item) {
+            break;
+        }
+        items[i] = items[parent];
+        i = parent;
+    }
+    items[i] = item;
+}
+
+static void sift_down(uintmax_t *const items,
+                      const uintmax_t count,
+                      uintmax_t i) {
+    assert(items);
+    assert(i < count);
+    const uintmax_t item = items[i];
+    for (;;) {
+        const uintmax_t first = i * ARITY + 1;
+        if (first >= count) {
+            break;
+        }
+        const uintmax_t last = count - first > ARITY
+                ? first + ARITY
+                : count;
+        uintmax_t least = first;
+        for (uintmax_t child = first + 1; child < last; child++) {
+            if (items[child] < items[least]) {
+                least = child;
+            }
+        }
+        if (item <= items[least]) {
+            break;
+        }
+        items[i] = items[least];
+        i = least;
+    }
+    items[i] = item;
+}
+
+bool seahorse_heap_ni_push(struct seahorse_heap_ni *const object,
+                           const uintmax_t item) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!reserve(object, 1)) {
+        return false;
+    }
+    object->items[object->count] = item;
+    sift_up(object->items, object->count);
+    object->count += 1;
+    return true;
+}
+
+bool seahorse_heap_ni_push_all(struct seahorse_heap_ni *const object,
+                               const uintmax_t count,
+                               const uintmax_t *const values) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!values) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_VALUES_IS_NULL;
+        return false;
+    }
+    if (!reserve(object, count)) {
+        return false;
+    }
+    memcpy(&object->items[object->count], values, count * sizeof(uintmax_t));
+    if (count < object->count) {
+        for (uintmax_t i = 0; i < count; i++) {
+            sift_up(object->items, object->count + i);
+        }
+        object->count += count;
+        return true;
+    }
+    /* sifting down every parent, last one first, is linear overall */
+    object->count += count;
+    if (object->count < 2) {
+        return true;
+    }
+    for (uintmax_t i = (object->count - 2) / ARITY + 1; i; i--) {
+        sift_down(object->items, object->count, i - 1);
+    }
+    return true;
+}
+
+bool seahorse_heap_ni_pop(struct seahorse_heap_ni *const object,
+                          uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_HEAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->items[0];
+    object->count -= 1;
+    if (object->count) {
+        object->items[0] = object->items[object->count];
+        sift_down(object->items, object->count, 0);
+    }
+    return true;
+}
+
+bool seahorse_heap_ni_peek(const struct seahorse_heap_ni *const object,
+                           uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_HEAP_NI_ERROR_HEAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->items[0];
+    return true;
+}
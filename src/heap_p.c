@@ -0,0 +1,240 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define ARITY                           4
+#define MINIMUM_CAPACITY                8
+
+bool seahorse_heap_p_init(struct seahorse_heap_p *const object,
+                          int (*const compare)(const void *first,
+                                               const void *second)) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!compare) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_COMPARE_IS_NULL;
+        return false;
+    }
+    *object = (struct seahorse_heap_p) {
+            .compare = compare
+    };
+    return true;
+}
+
+bool seahorse_heap_p_invalidate(struct seahorse_heap_p *const object,
+                                void (*const on_destroy)(void *item)) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (on_destroy) {
+        for (uintmax_t i = 0; i < object->count; i++) {
+            on_destroy(object->items[i]);
+        }
+    }
+    free(object->items);
+    *object = (struct seahorse_heap_p) {0};
+    return true;
+}
+
+bool seahorse_heap_p_count(const struct seahorse_heap_p *const object,
+                           uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Make room for count more items by doubling the capacity.
+ */
+static bool reserve(struct seahorse_heap_p *const object,
+                    const uintmax_t count) {
+    assert(object);
+    uintmax_t required;
+    if (!seagrass_uintmax_t_add(object->count, count, &required)) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error);
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (required <= object->capacity) {
+        return true;
+    }
+    uintmax_t capacity = object->capacity
+            ? object->capacity
+            : MINIMUM_CAPACITY;
+    while (capacity < required) {
+        if (capacity > UINTMAX_MAX / 2) {
+            seahorse_error = SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        capacity <<= 1;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, sizeof(void *), &size)
+        || size > SIZE_MAX) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    void **const items = realloc(object->items, size);
+    if (!items) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->items = items;
+    object->capacity = capacity;
+    return true;
+}
+
+static void sift_up(const struct seahorse_heap_p *const object,
+                    uintmax_t i) {
+    assert(object);
+    void **const items = object->items;
+    void *const item = items[i];
+    while (i) {
+        const uintmax_t parent = (i - 1) / ARITY;
+        if (object->compare(&items[parent], &item) <= 0) {
+            break;
+        }
+        items[i] = items[parent];
+        i = parent;
+    }
+    items[i] = item;
+}
+
+static void sift_down(const struct seahorse_heap_p *const object,
+                      uintmax_t i) {
+    assert(object);
+    assert(i < object->count);
+    void **const items = object->items;
+    const uintmax_t count = object->count;
+    void *const item = items[i];
+    for (;;) {
+        const uintmax_t first = i * ARITY + 1;
+        if (first >= count) {
+            break;
+        }
+        const uintmax_t last = count - first > ARITY
+                ? first + ARITY
+                : count;
+        uintmax_t least = first;
+        for (uintmax_t child = first + 1; child < last; child++) {
+            if (object->compare(&items[child], &items[least]) < 0) {
+                least = child;
+            }
+        }
+        if (object->compare(&item, &items[least]) <= 0) {
+            break;
+        }
+        items[i] = items[least];
+        i = least;
+    }
+    items[i] = item;
+}
+
+bool seahorse_heap_p_push(struct seahorse_heap_p *const object,
+                          void *const item) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!reserve(object, 1)) {
+        return false;
+    }
+    object->items[object->count] = item;
+    object->count += 1;
+    sift_up(object, object->count - 1);
+    return true;
+}
+
+bool seahorse_heap_p_push_all(struct seahorse_heap_p *const object,
+                              const uintmax_t count,
+                              void *const *const values) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!values) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_VALUES_IS_NULL;
+        return false;
+    }
+    if (!reserve(object, count)) {
+        return false;
+    }
+    memcpy(&object->items[object->count], values, count * sizeof(void *));
+    if (count < object->count) {
+        for (uintmax_t i = 0; i < count; i++) {
+            object->count += 1;
+            sift_up(object, object->count - 1);
+        }
+        return true;
+    }
+    /* sifting down every parent, last one first, is linear overall */
+    object->count += count;
+    if (object->count < 2) {
+        return true;
+    }
+    for (uintmax_t i = (object->count - 2) / ARITY + 1; i; i--) {
+        sift_down(object, i - 1);
+    }
+    return true;
+}
+
+bool seahorse_heap_p_pop(struct seahorse_heap_p *const object,
+                         void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_HEAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->items[0];
+    object->count -= 1;
+    if (object->count) {
+        object->items[0] = object->items[object->count];
+        sift_down(object, 0);
+    }
+    return true;
+}
+
+bool seahorse_heap_p_peek(const struct seahorse_heap_p *const object,
+                          void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_HEAP_P_ERROR_HEAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->items[0];
+    return true;
+}
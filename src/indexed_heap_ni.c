@@ -0,0 +1,360 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define ARITY                           4
+#define MINIMUM_CAPACITY                8
+
+bool seahorse_indexed_heap_ni_init(
+        struct seahorse_indexed_heap_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    *object = (struct seahorse_indexed_heap_ni) {0};
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_invalidate(
+        struct seahorse_indexed_heap_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    free(object->keys);
+    free(object->priorities);
+    free(object->positions);
+    *object = (struct seahorse_indexed_heap_ni) {0};
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_count(
+        const struct seahorse_indexed_heap_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Positions hold one more than the key's index in the heap so that zero
+ * means the key is not in the heap.
+ */
+static bool position_of(const struct seahorse_indexed_heap_ni *const object,
+                        const uintmax_t key,
+                        uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    if (key >= object->limit || !object->positions[key]) {
+        return false;
+    }
+    *out = object->positions[key] - 1;
+    return true;
+}
+
+static bool grow(struct seahorse_indexed_heap_ni *const object) {
+    assert(object);
+    if (object->count < object->capacity) {
+        return true;
+    }
+    uintmax_t capacity = MINIMUM_CAPACITY;
+    if (object->capacity
+        && !seagrass_uintmax_t_multiply(object->capacity, 2, &capacity)) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error);
+        seahorse_error =
+                SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, sizeof(uintmax_t), &size)
+        || size > SIZE_MAX) {
+        seahorse_error =
+                SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    uintmax_t *const keys = realloc(object->keys, size);
+    if (!keys) {
+        seahorse_error =
+                SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->keys = keys;
+    uintmax_t *const priorities = realloc(object->priorities, size);
+    if (!priorities) {
+        seahorse_error =
+                SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    object->priorities = priorities;
+    object->capacity = capacity;
+    return true;
+}
+
+/*
+ * Make room for the position of key, at least doubling the limit.
+ */
+static bool extend(struct seahorse_indexed_heap_ni *const object,
+                   const uintmax_t key) {
+    assert(object);
+    if (key < object->limit) {
+        return true;
+    }
+    uintmax_t limit = object->limit > MINIMUM_CAPACITY
+            ? object->limit
+            : MINIMUM_CAPACITY;
+    while (limit <= key) {
+        if (limit > UINTMAX_MAX / 2) {
+            seahorse_error =
+                    SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        limit <<= 1;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(limit, sizeof(uintmax_t), &size)
+        || size > SIZE_MAX) {
+        seahorse_error =
+                SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    uintmax_t *const positions = realloc(object->positions, size);
+    if (!positions) {
+        seahorse_error =
+                SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    memset(&positions[object->limit], 0,
+           (limit - object->limit) * sizeof(uintmax_t));
+    object->positions = positions;
+    object->limit = limit;
+    return true;
+}
+
+static void place(struct seahorse_indexed_heap_ni *const object,
+                  const uintmax_t i,
+                  const uintmax_t key,
+                  const uintmax_t priority) {
+    assert(object);
+    assert(i < object->count);
+    object->keys[i] = key;
+    object->priorities[i] = priority;
+    object->positions[key] = i + 1;
+}
+
+static void sift_up(struct seahorse_indexed_heap_ni *const object,
+                    uintmax_t i) {
+    assert(object);
+    const uintmax_t key = object->keys[i];
+    const uintmax_t priority = object->priorities[i];
+    while (i) {
+        const uintmax_t parent = (i - 1) / ARITY;
+        if (object->priorities[parent] <= priority) {
+            break;
+        }
+        place(object, i, object->keys[parent], object->priorities[parent]);
+        i = parent;
+    }
+    place(object, i, key, priority);
+}
+
+static void sift_down(struct seahorse_indexed_heap_ni *const object,
+                      uintmax_t i) {
+    assert(object);
+    const uintmax_t key = object->keys[i];
+    const uintmax_t priority = object->priorities[i];
+    for (;;) {
+        const uintmax_t first = i * ARITY + 1;
+        if (first >= object->count) {
+            break;
+        }
+        const uintmax_t last = object->count - first > ARITY
+                ? first + ARITY
+                : object->count;
+        uintmax_t least = first;
+        for (uintmax_t child = first + 1; child < last; child++) {
+            if (object->priorities[child] < object->priorities[least]) {
+                least = child;
+            }
+        }
+        if (priority <= object->priorities[least]) {
+            break;
+        }
+        place(object, i, object->keys[least], object->priorities[least]);
+        i = least;
+    }
+    place(object, i, key, priority);
+}
+
+/*
+ * Take the key at index i out of the heap, the last key filling its place.
+ */
+static void remove_at(struct seahorse_indexed_heap_ni *const object,
+                      const uintmax_t i) {
+    assert(object);
+    assert(i < object->count);
+    const uintmax_t priority = object->priorities[i];
+    object->positions[object->keys[i]] = 0;
+    object->count -= 1;
+    if (i == object->count) {
+        return;
+    }
+    const uintmax_t last = object->count;
+    place(object, i, object->keys[last], object->priorities[last]);
+    if (object->priorities[i] < priority) {
+        sift_up(object, i);
+    } else {
+        sift_down(object, i);
+    }
+}
+
+bool seahorse_indexed_heap_ni_push(
+        struct seahorse_indexed_heap_ni *const object,
+        const uintmax_t key,
+        const uintmax_t priority) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t i;
+    if (position_of(object, key, &i)) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    if (!extend(object, key) || !grow(object)) {
+        return false;
+    }
+    object->count += 1;
+    place(object, object->count - 1, key, priority);
+    sift_up(object, object->count - 1);
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_pop(
+        struct seahorse_indexed_heap_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_HEAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->keys[0];
+    remove_at(object, 0);
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_peek(
+        const struct seahorse_indexed_heap_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_HEAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->keys[0];
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_contains(
+        const struct seahorse_indexed_heap_ni *const object,
+        const uintmax_t key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t i;
+    *out = position_of(object, key, &i);
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_get(
+        const struct seahorse_indexed_heap_ni *const object,
+        const uintmax_t key,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t i;
+    if (!position_of(object, key, &i)) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = object->priorities[i];
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_decrease(
+        struct seahorse_indexed_heap_ni *const object,
+        const uintmax_t key,
+        const uintmax_t priority) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t i;
+    if (!position_of(object, key, &i)) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    if (priority > object->priorities[i]) {
+        seahorse_error =
+                SEAHORSE_INDEXED_HEAP_NI_ERROR_PRIORITY_IS_OUT_OF_BOUNDS;
+        return false;
+    }
+    object->priorities[i] = priority;
+    sift_up(object, i);
+    return true;
+}
+
+bool seahorse_indexed_heap_ni_remove(
+        struct seahorse_indexed_heap_ni *const object,
+        const uintmax_t key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    uintmax_t i;
+    if (!position_of(object, key, &i)) {
+        seahorse_error = SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    remove_at(object, i);
+    return true;
+}
@@ -0,0 +1,363 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <seagrass.h>
+#include <triggerfish.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define CACHE_LINE                      64
+
+/*
+ * A slot whose sequence equals the position of a producer is free for that
+ * producer, while one whose sequence is one past the position of a consumer
+ * holds the item for that consumer. Consuming a slot moves its sequence a
+ * whole lap ahead so that it becomes free for the producer of the next lap.
+ */
+struct slot {
+    atomic_uintmax_t sequence;
+    struct triggerfish_strong *item;
+};
+
+/*
+ * Producers and consumers each advance their own position, kept on separate
+ * cache lines so that adding does not slow down removing and vice versa.
+ * Waiting is only ever done through the lock and conditions, the ring itself
+ * never blocks.
+ */
+struct state {
+    _Alignas(CACHE_LINE) atomic_uintmax_t tail;
+    _Alignas(CACHE_LINE) atomic_uintmax_t head;
+    _Alignas(CACHE_LINE) uintmax_t mask;
+    struct slot *slots;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    atomic_uintmax_t consumers;
+    atomic_uintmax_t producers;
+};
+
+static bool init_synchronization(struct state *const state) {
+    assert(state);
+    if (pthread_mutex_init(&state->lock, NULL)) {
+        return false;
+    }
+    if (pthread_cond_init(&state->not_empty, NULL)) {
+        seagrass_required_true(!pthread_mutex_destroy(&state->lock));
+        return false;
+    }
+    if (pthread_cond_init(&state->not_full, NULL)) {
+        seagrass_required_true(!pthread_cond_destroy(&state->not_empty));
+        seagrass_required_true(!pthread_mutex_destroy(&state->lock));
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_mpmc_queue_sr_init(struct seahorse_mpmc_queue_sr *const object,
+                                 const uintmax_t capacity) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!capacity) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_CAPACITY_IS_ZERO;
+        return false;
+    }
+    uintmax_t count = 2;
+    while (count < capacity) {
+        if (count > UINTMAX_MAX / 2) {
+            seahorse_error =
+                    SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        count <<= 1;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(count, sizeof(struct slot), &size)
+        || size > SIZE_MAX) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    void *data;
+    if (posix_memalign(&data, CACHE_LINE, sizeof(struct state))) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct state *const state = data;
+    state->slots = malloc(size);
+    if (!state->slots) {
+        free(state);
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (!init_synchronization(state)) {
+        free(state->slots);
+        free(state);
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        atomic_init(&state->slots[i].sequence, i);
+        state->slots[i].item = NULL;
+    }
+    atomic_init(&state->tail, 0);
+    atomic_init(&state->head, 0);
+    atomic_init(&state->consumers, 0);
+    atomic_init(&state->producers, 0);
+    state->mask = count - 1;
+    *object = (struct seahorse_mpmc_queue_sr) {
+            .data = state
+    };
+    return true;
+}
+
+static bool dequeue(struct state *const state,
+                    struct triggerfish_strong **const out) {
+    assert(state);
+    assert(out);
+    uintmax_t position = atomic_load_explicit(&state->head,
+                                              memory_order_relaxed);
+    for (;;) {
+        struct slot *const slot = &state->slots[position & state->mask];
+        const uintmax_t sequence = atomic_load_explicit(
+                &slot->sequence, memory_order_acquire);
+        const intmax_t difference = (intmax_t) (sequence - (position + 1));
+        if (!difference) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &state->head, &position, position + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                *out = slot->item;
+                atomic_store_explicit(&slot->sequence,
+                                      position + state->mask + 1,
+                                      memory_order_release);
+                return true;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = atomic_load_explicit(&state->head,
+                                            memory_order_relaxed);
+        }
+    }
+}
+
+bool seahorse_mpmc_queue_sr_invalidate(
+        struct seahorse_mpmc_queue_sr *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    if (state) {
+        struct triggerfish_strong *item;
+        while (dequeue(state, &item)) {
+            seagrass_required_true(triggerfish_strong_release(item));
+        }
+        seagrass_required_true(!pthread_cond_destroy(&state->not_full));
+        seagrass_required_true(!pthread_cond_destroy(&state->not_empty));
+        seagrass_required_true(!pthread_mutex_destroy(&state->lock));
+        free(state->slots);
+        free(state);
+    }
+    *object = (struct seahorse_mpmc_queue_sr) {0};
+    return true;
+}
+
+bool seahorse_mpmc_queue_sr_capacity(
+        const struct seahorse_mpmc_queue_sr *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct state *const state = object->data;
+    *out = state->mask + 1;
+    return true;
+}
+
+bool seahorse_mpmc_queue_sr_count(
+        const struct seahorse_mpmc_queue_sr *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    /* head first as it never overtakes tail */
+    const uintmax_t head = atomic_load(&state->head);
+    const uintmax_t tail = atomic_load(&state->tail);
+    const uintmax_t count = tail - head;
+    *out = count > state->mask + 1 ? state->mask + 1 : count;
+    return true;
+}
+
+static bool enqueue(struct state *const state,
+                    struct triggerfish_strong *const item) {
+    assert(state);
+    assert(item);
+    uintmax_t position = atomic_load_explicit(&state->tail,
+                                              memory_order_relaxed);
+    for (;;) {
+        struct slot *const slot = &state->slots[position & state->mask];
+        const uintmax_t sequence = atomic_load_explicit(
+                &slot->sequence, memory_order_acquire);
+        const intmax_t difference = (intmax_t) (sequence - position);
+        if (!difference) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &state->tail, &position, position + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                slot->item = item;
+                atomic_store_explicit(&slot->sequence, position + 1,
+                                      memory_order_release);
+                return true;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = atomic_load_explicit(&state->tail,
+                                            memory_order_relaxed);
+        }
+    }
+}
+
+/*
+ * Waiters announce themselves before retrying under the lock, and the other
+ * side checks for waiters after completing its operation, so at least one
+ * of them is bound to notice the other and a wake up is never lost.
+ */
+static void wake(struct state *const state,
+                 atomic_uintmax_t *const waiters,
+                 pthread_cond_t *const condition) {
+    assert(state);
+    assert(waiters);
+    assert(condition);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!atomic_load(waiters)) {
+        return;
+    }
+    seagrass_required_true(!pthread_mutex_lock(&state->lock));
+    seagrass_required_true(!pthread_cond_broadcast(condition));
+    seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+}
+
+static bool retain(struct triggerfish_strong *const item) {
+    assert(item);
+    if (!triggerfish_strong_retain(item)) {
+        seagrass_required_true(TRIGGERFISH_STRONG_ERROR_OBJECT_IS_INVALID
+                               == triggerfish_error);
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_INVALID;
+        return false;
+    }
+    return true;
+}
+
+bool seahorse_mpmc_queue_sr_try_add(
+        struct seahorse_mpmc_queue_sr *const object,
+        struct triggerfish_strong *const item) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!item) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_NULL;
+        return false;
+    }
+    if (!retain(item)) {
+        return false;
+    }
+    struct state *const state = object->data;
+    if (!enqueue(state, item)) {
+        seagrass_required_true(triggerfish_strong_release(item));
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_FULL;
+        return false;
+    }
+    wake(state, &state->consumers, &state->not_empty);
+    return true;
+}
+
+bool seahorse_mpmc_queue_sr_add(struct seahorse_mpmc_queue_sr *const object,
+                                struct triggerfish_strong *const item) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!item) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_NULL;
+        return false;
+    }
+    if (!retain(item)) {
+        return false;
+    }
+    struct state *const state = object->data;
+    if (!enqueue(state, item)) {
+        seagrass_required_true(!pthread_mutex_lock(&state->lock));
+        atomic_fetch_add(&state->producers, 1);
+        while (!enqueue(state, item)) {
+            seagrass_required_true(!pthread_cond_wait(&state->not_full,
+                                                      &state->lock));
+        }
+        atomic_fetch_sub(&state->producers, 1);
+        seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+    }
+    wake(state, &state->consumers, &state->not_empty);
+    return true;
+}
+
+bool seahorse_mpmc_queue_sr_try_remove(
+        struct seahorse_mpmc_queue_sr *const object,
+        struct triggerfish_strong **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    if (!dequeue(state, out)) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_EMPTY;
+        return false;
+    }
+    wake(state, &state->producers, &state->not_full);
+    return true;
+}
+
+bool seahorse_mpmc_queue_sr_remove(
+        struct seahorse_mpmc_queue_sr *const object,
+        struct triggerfish_strong **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    if (!dequeue(state, out)) {
+        seagrass_required_true(!pthread_mutex_lock(&state->lock));
+        atomic_fetch_add(&state->consumers, 1);
+        while (!dequeue(state, out)) {
+            seagrass_required_true(!pthread_cond_wait(&state->not_empty,
+                                                      &state->lock));
+        }
+        atomic_fetch_sub(&state->consumers, 1);
+        seagrass_required_true(!pthread_mutex_unlock(&state->lock));
+    }
+    wake(state, &state->producers, &state->not_full);
+    return true;
+}
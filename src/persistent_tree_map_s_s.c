@@ -0,0 +1,665 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include "private/weight_balanced_tree.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/*
+ * Key-value association shared by every copy of the node that holds it, so
+ * that copying a path never copies the strings.
+ */
+struct item {
+    atomic_uintmax_t references;
+    struct sea_turtle_string key;
+    struct sea_turtle_string value;
+};
+
+struct node {
+    atomic_uintmax_t references;
+    struct node *left;
+    struct node *right;
+    uintmax_t size;
+    struct item *item;
+};
+
+/*
+ * Nodes are reserved before a write begins so that copying the path can not
+ * fail halfway through, which would leave a partially built tree behind.
+ */
+struct pool {
+    struct node *head;
+};
+
+static struct item *retain_item(struct item *const item) {
+    assert(item);
+    atomic_fetch_add_explicit(&item->references, 1, memory_order_relaxed);
+    return item;
+}
+
+static void release_item(struct item *const item) {
+    assert(item);
+    if (1 != atomic_fetch_sub_explicit(&item->references, 1,
+                                       memory_order_acq_rel)) {
+        return;
+    }
+    seagrass_required_true(sea_turtle_string_invalidate(&item->key));
+    seagrass_required_true(sea_turtle_string_invalidate(&item->value));
+    free(item);
+}
+
+static struct node *retain(struct node *const node) {
+    if (node) {
+        atomic_fetch_add_explicit(&node->references, 1, memory_order_relaxed);
+    }
+    return node;
+}
+
+static void release(struct node *const node) {
+    if (!node || 1 != atomic_fetch_sub_explicit(&node->references, 1,
+                                                memory_order_acq_rel)) {
+        return;
+    }
+    release_item(node->item);
+    release(node->left);
+    release(node->right);
+    free(node);
+}
+
+static void drain(struct pool *const pool) {
+    assert(pool);
+    while (pool->head) {
+        struct node *const node = pool->head;
+        pool->head = node->left;
+        free(node);
+    }
+}
+
+static bool fill(struct pool *const pool, uintmax_t count) {
+    assert(pool);
+    *pool = (struct pool) {0};
+    for (; count; count--) {
+        struct node *const node = malloc(sizeof(*node));
+        if (!node) {
+            drain(pool);
+            return false;
+        }
+        node->left = pool->head;
+        pool->head = node;
+    }
+    return true;
+}
+
+static uintmax_t size_of(const struct node *const node) {
+    return node ? node->size : 0;
+}
+
+static uintmax_t weight_of(const struct node *const node) {
+    return 1 + size_of(node);
+}
+
+/*
+ * Takes ownership of left and right.
+ */
+static struct node *make(struct pool *const pool,
+                         struct item *const item,
+                         struct node *const left,
+                         struct node *const right) {
+    assert(pool);
+    assert(pool->head);
+    assert(item);
+    struct node *const node = pool->head;
+    pool->head = node->left;
+    atomic_init(&node->references, 1);
+    node->left = left;
+    node->right = right;
+    node->size = 1 + size_of(left) + size_of(right);
+    node->item = retain_item(item);
+    return node;
+}
+
+/*
+ * Builds a balanced node out of item, left and right, copying at most three
+ * nodes to rotate. Takes ownership of left and right.
+ */
+static struct node *balance(struct pool *const pool,
+                            struct item *const item,
+                            struct node *const left,
+                            struct node *const right) {
+    assert(pool);
+    assert(item);
+    struct node *result;
+    if (weight_of(right) > DELTA * weight_of(left)) {
+        if (weight_of(right->left) >= RATIO * weight_of(right->right)) {
+            struct node *const middle = right->left;
+            result = make(
+                    pool, middle->item,
+                    make(pool, item, left, retain(middle->left)),
+                    make(pool, right->item, retain(middle->right),
+                         retain(right->right)));
+        } else {
+            result = make(
+                    pool, right->item,
+                    make(pool, item, left, retain(right->left)),
+                    retain(right->right));
+        }
+        release(right);
+    } else if (weight_of(left) > DELTA * weight_of(right)) {
+        if (weight_of(left->right) >= RATIO * weight_of(left->left)) {
+            struct node *const middle = left->right;
+            result = make(
+                    pool, middle->item,
+                    make(pool, left->item, retain(left->left),
+                         retain(middle->left)),
+                    make(pool, item, retain(middle->right), right));
+        } else {
+            result = make(
+                    pool, left->item,
+                    retain(left->left),
+                    make(pool, item, retain(left->right), right));
+        }
+        release(left);
+    } else {
+        result = make(pool, item, left, right);
+    }
+    return result;
+}
+
+/*
+ * Retrieve the node holding key, if any, along with the count of nodes on
+ * the path from the root to it.
+ */
+static struct node *find(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        uintmax_t *const depth) {
+    assert(object);
+    assert(key);
+    uintmax_t count = 0;
+    struct node *node = object->root;
+    while (node) {
+        count++;
+        const int result = sea_turtle_string_compare(key, &node->item->key);
+        if (!result) {
+            break;
+        }
+        node = result < 0 ? node->left : node->right;
+    }
+    if (depth) {
+        *depth = count;
+    }
+    return node;
+}
+
+static void replace_root(struct seahorse_persistent_tree_map_s_s *const object,
+                         struct node *const root) {
+    assert(object);
+    struct node *const previous = object->root;
+    object->root = root;
+    release(previous);
+}
+
+static struct item *item_of(const struct sea_turtle_string *const key,
+                            const struct sea_turtle_string *const value) {
+    assert(key);
+    assert(value);
+    struct item *const item = calloc(1, sizeof(*item));
+    if (!item) {
+        return NULL;
+    }
+    if (!sea_turtle_string_init_string(&item->key, key)
+        || !sea_turtle_string_init_string(&item->value, value)) {
+        seagrass_required_true(
+                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                == sea_turtle_error);
+        seagrass_required_true(sea_turtle_string_invalidate(&item->key));
+        seagrass_required_true(sea_turtle_string_invalidate(&item->value));
+        free(item);
+        return NULL;
+    }
+    atomic_init(&item->references, 1);
+    return item;
+}
+
+bool seahorse_persistent_tree_map_s_s_init(
+        struct seahorse_persistent_tree_map_s_s *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    *object = (struct seahorse_persistent_tree_map_s_s) {0};
+    return true;
+}
+
+bool seahorse_persistent_tree_map_s_s_invalidate(
+        struct seahorse_persistent_tree_map_s_s *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    release(object->root);
+    *object = (struct seahorse_persistent_tree_map_s_s) {0};
+    return true;
+}
+
+bool seahorse_persistent_tree_map_s_s_snapshot(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        struct seahorse_persistent_tree_map_s_s *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = (struct seahorse_persistent_tree_map_s_s) {
+            .root = retain(object->root)
+    };
+    return true;
+}
+
+bool seahorse_persistent_tree_map_s_s_count(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = size_of(object->root);
+    return true;
+}
+
+/*
+ * Key of item must not be present in the subtree rooted at node.
+ */
+static struct node *insert(struct pool *const pool,
+                           struct node *const node,
+                           struct item *const item) {
+    assert(pool);
+    assert(item);
+    if (!node) {
+        return make(pool, item, NULL, NULL);
+    }
+    const int result = sea_turtle_string_compare(&item->key,
+                                                 &node->item->key);
+    assert(result);
+    if (result < 0) {
+        return balance(pool, node->item,
+                       insert(pool, node->left, item),
+                       retain(node->right));
+    }
+    return balance(pool, node->item,
+                   retain(node->left),
+                   insert(pool, node->right, item));
+}
+
+bool seahorse_persistent_tree_map_s_s_add(
+        struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        const struct sea_turtle_string *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    uintmax_t depth;
+    if (find(object, key, &depth)) {
+        seahorse_error =
+                SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    struct item *const item = item_of(key, value);
+    struct pool pool;
+    if (!item || !fill(&pool, 1 + 3 * depth)) {
+        if (item) {
+            release_item(item);
+        }
+        seahorse_error =
+                SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    replace_root(object, insert(&pool, object->root, item));
+    release_item(item);
+    drain(&pool);
+    return true;
+}
+
+/*
+ * Key of item must be present in the subtree rooted at node.
+ */
+static struct node *update(struct pool *const pool,
+                           struct node *const node,
+                           struct item *const item) {
+    assert(pool);
+    assert(node);
+    assert(item);
+    const int result = sea_turtle_string_compare(&item->key,
+                                                 &node->item->key);
+    if (result < 0) {
+        return make(pool, node->item,
+                    update(pool, node->left, item),
+                    retain(node->right));
+    }
+    if (result > 0) {
+        return make(pool, node->item,
+                    retain(node->left),
+                    update(pool, node->right, item));
+    }
+    return make(pool, item, retain(node->left), retain(node->right));
+}
+
+bool seahorse_persistent_tree_map_s_s_set(
+        struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        const struct sea_turtle_string *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    uintmax_t depth;
+    if (!find(object, key, &depth)) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    struct item *const item = item_of(key, value);
+    struct pool pool;
+    if (!item || !fill(&pool, depth)) {
+        if (item) {
+            release_item(item);
+        }
+        seahorse_error =
+                SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    replace_root(object, update(&pool, object->root, item));
+    release_item(item);
+    drain(&pool);
+    return true;
+}
+
+static struct node *detach_first(struct pool *const pool,
+                                 struct node *const node,
+                                 struct item **const out) {
+    assert(pool);
+    assert(node);
+    assert(out);
+    if (!node->left) {
+        *out = node->item;
+        return retain(node->right);
+    }
+    return balance(pool, node->item,
+                   detach_first(pool, node->left, out),
+                   retain(node->right));
+}
+
+static struct node *detach_last(struct pool *const pool,
+                                struct node *const node,
+                                struct item **const out) {
+    assert(pool);
+    assert(node);
+    assert(out);
+    if (!node->right) {
+        *out = node->item;
+        return retain(node->left);
+    }
+    return balance(pool, node->item,
+                   retain(node->left),
+                   detach_last(pool, node->right, out));
+}
+
+/*
+ * Count of nodes that glue will walk through in the heavier child.
+ */
+static uintmax_t glue_depth(const struct node *const left,
+                            const struct node *const right) {
+    if (!left || !right) {
+        return 0;
+    }
+    uintmax_t depth = 0;
+    if (left->size > right->size) {
+        for (const struct node *node = left; node; node = node->right) {
+            depth++;
+        }
+    } else {
+        for (const struct node *node = right; node; node = node->left) {
+            depth++;
+        }
+    }
+    return depth;
+}
+
+/*
+ * Joins the children of a removed node by lifting the neighbouring
+ * association out of the heavier child.
+ */
+static struct node *glue(struct pool *const pool,
+                         struct node *const left,
+                         struct node *const right) {
+    assert(pool);
+    if (!left) {
+        return retain(right);
+    }
+    if (!right) {
+        return retain(left);
+    }
+    struct item *item;
+    if (left->size > right->size) {
+        struct node *const rest = detach_last(pool, left, &item);
+        return balance(pool, item, rest, retain(right));
+    }
+    struct node *const rest = detach_first(pool, right, &item);
+    return balance(pool, item, retain(left), rest);
+}
+
+/*
+ * Key must be present in the subtree rooted at node.
+ */
+static struct node *erase(struct pool *const pool,
+                          struct node *const node,
+                          const struct sea_turtle_string *const key) {
+    assert(pool);
+    assert(node);
+    assert(key);
+    const int result = sea_turtle_string_compare(key, &node->item->key);
+    if (result < 0) {
+        return balance(pool, node->item,
+                       erase(pool, node->left, key),
+                       retain(node->right));
+    }
+    if (result > 0) {
+        return balance(pool, node->item,
+                       retain(node->left),
+                       erase(pool, node->right, key));
+    }
+    return glue(pool, node->left, node->right);
+}
+
+bool seahorse_persistent_tree_map_s_s_remove(
+        struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    uintmax_t depth;
+    const struct node *const node = find(object, key, &depth);
+    if (!node) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    depth += glue_depth(node->left, node->right);
+    struct pool pool;
+    if (!fill(&pool, 3 * depth)) {
+        seahorse_error =
+                SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    replace_root(object, erase(&pool, object->root, key));
+    drain(&pool);
+    return true;
+}
+
+bool seahorse_persistent_tree_map_s_s_contains(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = NULL != find(object, key, NULL);
+    return true;
+}
+
+bool seahorse_persistent_tree_map_s_s_get(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        const struct sea_turtle_string **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct node *const node = find(object, key, NULL);
+    if (!node) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &node->item->value;
+    return true;
+}
+
+static bool retrieve_fl(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string **const out,
+        const bool first) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct node *node = object->root;
+    if (!node) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    for (;;) {
+        const struct node *const next = first ? node->left : node->right;
+        if (!next) {
+            break;
+        }
+        node = next;
+    }
+    *out = &node->item->key;
+    return true;
+}
+
+bool seahorse_persistent_tree_map_s_s_first(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string **const out) {
+    return retrieve_fl(object, out, true);
+}
+
+bool seahorse_persistent_tree_map_s_s_last(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string **const out) {
+    return retrieve_fl(object, out, false);
+}
+
+static bool retrieve_hl(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        const struct sea_turtle_string **const out,
+        const bool higher) {
+    if (!object) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct node *found = NULL;
+    const struct node *node = object->root;
+    while (node) {
+        const int result = sea_turtle_string_compare(key, &node->item->key);
+        if (higher ? result < 0 : result > 0) {
+            found = node;
+            node = higher ? node->left : node->right;
+        } else {
+            node = higher ? node->right : node->left;
+        }
+    }
+    if (!found) {
+        seahorse_error = SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &found->item->key;
+    return true;
+}
+
+bool seahorse_persistent_tree_map_s_s_higher(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        const struct sea_turtle_string **const out) {
+    return retrieve_hl(object, key, out, true);
+}
+
+bool seahorse_persistent_tree_map_s_s_lower(
+        const struct seahorse_persistent_tree_map_s_s *const object,
+        const struct sea_turtle_string *const key,
+        const struct sea_turtle_string **const out) {
+    return retrieve_hl(object, key, out, false);
+}
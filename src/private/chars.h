@@ -0,0 +1,31 @@
+#ifndef _SEAHORSE_PRIVATE_CHARS_H_
+#define _SEAHORSE_PRIVATE_CHARS_H_
+
+#include <stddef.h>
+
+/*
+ * Borrowed characters of a key that is looked up without first being copied
+ * into a sea_turtle_string.
+ */
+struct seahorse_chars {
+    const char *data;
+    size_t size;
+};
+
+/*
+ * Order two sea_turtle_string with sea_turtle_string_compare, which is the
+ * order that every string keyed container keeps.
+ */
+int seahorse_chars_compare_string(const void *first, const void *second);
+
+/*
+ * Compare a seahorse_chars, given as key, against a sea_turtle_string, given
+ * as data, in the order of sea_turtle_string_compare. That order follows the
+ * code points of both strings one after the other, where a string comes
+ * before every longer string that it is a prefix of. Since UTF-8 encodes
+ * larger code points as larger leading bytes, comparing the bytes unsigned
+ * arrives at the same result without decoding them.
+ */
+int seahorse_chars_compare(const void *key, const void *data);
+
+#endif /* _SEAHORSE_PRIVATE_CHARS_H_ */
@@ -0,0 +1,84 @@
+#ifndef _SEAHORSE_PRIVATE_HASH_TABLE_H_
+#define _SEAHORSE_PRIVATE_HASH_TABLE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct seahorse_hash_table;
+
+/*
+ * Every entry holds size bytes and hash retrieves the hash it was added
+ * with. No memory is allocated until the first entry is reserved.
+ */
+void seahorse_hash_table_init(struct seahorse_hash_table *object,
+                              size_t size,
+                              uint64_t (*hash)(const void *entry));
+
+/*
+ * Release the storage of the table, the entries are expected to have been
+ * released by the caller.
+ */
+void seahorse_hash_table_invalidate(struct seahorse_hash_table *object);
+
+/*
+ * Allocate an empty table of capacity slots, which must be a power of two.
+ */
+bool seahorse_hash_table_allocate(struct seahorse_hash_table *object,
+                                  uintmax_t capacity);
+
+/*
+ * Copy the storage of other into object, which only suits entries that can
+ * be copied byte for byte.
+ */
+bool seahorse_hash_table_copy(struct seahorse_hash_table *object,
+                              const struct seahorse_hash_table *other);
+
+void *seahorse_hash_table_entry(const struct seahorse_hash_table *object,
+                                uintmax_t index);
+
+uintmax_t seahorse_hash_table_index(const struct seahorse_hash_table *object,
+                                    const void *entry);
+
+/*
+ * Retrieve the index of the entry added with hashed for which matches,
+ * given key as its first argument, returns true.
+ */
+bool seahorse_hash_table_find(
+        const struct seahorse_hash_table *object,
+        uint64_t hashed,
+        const void *key,
+        bool (*matches)(const void *key, const void *entry),
+        uintmax_t *out);
+
+/*
+ * Retrieve the index of the slot that an entry added with hashed would
+ * occupy. The table is grown, or its deleted slots reclaimed in place, if it
+ * has no room left, which only fails if memory could not be allocated.
+ */
+bool seahorse_hash_table_reserve(struct seahorse_hash_table *object,
+                                 uint64_t hashed,
+                                 uintmax_t *out);
+
+/*
+ * Mark the reserved slot at index as full once its entry has been filled in.
+ */
+void seahorse_hash_table_occupy(struct seahorse_hash_table *object,
+                                uintmax_t index,
+                                uint64_t hashed);
+
+/*
+ * Mark the full slot at index as deleted, the entry is expected to have been
+ * released by the caller.
+ */
+void seahorse_hash_table_erase(struct seahorse_hash_table *object,
+                               uintmax_t index);
+
+/*
+ * Retrieve the index of the first full slot at or after from.
+ */
+bool seahorse_hash_table_scan(const struct seahorse_hash_table *object,
+                              uintmax_t from,
+                              uintmax_t *out);
+
+#endif /* _SEAHORSE_PRIVATE_HASH_TABLE_H_ */
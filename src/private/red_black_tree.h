@@ -0,0 +1,187 @@
+#ifndef _SEAHORSE_PRIVATE_RED_BLACK_TREE_H_
+#define _SEAHORSE_PRIVATE_RED_BLACK_TREE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct seahorse_red_black_tree;
+struct seahorse_red_black_tree_pool;
+
+/*
+ * Where a key that is not in the tree would have to be linked in, only valid
+ * until the tree is next modified.
+ */
+struct seahorse_red_black_tree_position {
+    void *parent;
+    bool left;
+};
+
+/*
+ * Every node holds size bytes of data that the tree orders with compare,
+ * where the first argument is the key being looked up and the second is the
+ * data of a node. Without a pool each node is allocated individually.
+ */
+void seahorse_red_black_tree_init(
+        struct seahorse_red_black_tree *object,
+        size_t size,
+        int (*compare)(const void *key, const void *data),
+        struct seahorse_red_black_tree_pool *pool);
+
+/*
+ * Release every node, on_destroy, if not NULL, is given the data of each
+ * node first.
+ */
+void seahorse_red_black_tree_invalidate(
+        struct seahorse_red_black_tree *object,
+        void (*on_destroy)(void *data));
+
+/*
+ * Allocate an unlinked node and retrieve its data, which is returned with
+ * seahorse_red_black_tree_free unless it is linked into the tree.
+ */
+bool seahorse_red_black_tree_alloc(struct seahorse_red_black_tree *object,
+                                   void **out);
+
+void seahorse_red_black_tree_free(struct seahorse_red_black_tree *object,
+                                  void *data);
+
+/*
+ * Retrieve the data whose key compares equal to key, or if there is none,
+ * NULL and the position where key would be linked in.
+ */
+void *seahorse_red_black_tree_locate(
+        const struct seahorse_red_black_tree *object,
+        const void *key,
+        struct seahorse_red_black_tree_position *out);
+
+/*
+ * Link the node of data, whose key has been filled in, at position.
+ */
+void seahorse_red_black_tree_link(
+        struct seahorse_red_black_tree *object,
+        const struct seahorse_red_black_tree_position *position,
+        void *data);
+
+/*
+ * Unlink the node of data from the tree without releasing it.
+ */
+void seahorse_red_black_tree_unlink(struct seahorse_red_black_tree *object,
+                                    void *data);
+
+void seahorse_red_black_tree_remove(struct seahorse_red_black_tree *object,
+                                    void *data);
+
+/*
+ * Lookups return the matching data or NULL, compare is given key as its
+ * first argument which lets a lookup use a key of a different type than the
+ * one stored.
+ */
+void *seahorse_red_black_tree_get(
+        const struct seahorse_red_black_tree *object,
+        const void *key,
+        int (*compare)(const void *key, const void *data));
+
+void *seahorse_red_black_tree_ceiling(
+        const struct seahorse_red_black_tree *object,
+        const void *key,
+        int (*compare)(const void *key, const void *data));
+
+void *seahorse_red_black_tree_floor(
+        const struct seahorse_red_black_tree *object,
+        const void *key,
+        int (*compare)(const void *key, const void *data));
+
+void *seahorse_red_black_tree_higher(
+        const struct seahorse_red_black_tree *object,
+        const void *key,
+        int (*compare)(const void *key, const void *data));
+
+void *seahorse_red_black_tree_lower(
+        const struct seahorse_red_black_tree *object,
+        const void *key,
+        int (*compare)(const void *key, const void *data));
+
+void *seahorse_red_black_tree_first(
+        const struct seahorse_red_black_tree *object);
+
+void *seahorse_red_black_tree_last(
+        const struct seahorse_red_black_tree *object);
+
+void *seahorse_red_black_tree_next(const void *data);
+
+void *seahorse_red_black_tree_prev(const void *data);
+
+/*
+ * Retrieve how many nodes come before the node of data in logarithmic time.
+ */
+uintmax_t seahorse_red_black_tree_index(const void *data);
+
+/*
+ * Retrieve the data of the node that index nodes come before, which must be
+ * less than the count of nodes, in logarithmic time.
+ */
+void *seahorse_red_black_tree_at(const struct seahorse_red_black_tree *object,
+                                 uintmax_t index);
+
+/*
+ * Remove the node of first, the node of last and every node in between them,
+ * giving the data of each to on_destroy, if not NULL. The tree is split
+ * around them and the rest joined back together by relinking, so that the
+ * remaining nodes are rebalanced once in logarithmic time.
+ */
+void seahorse_red_black_tree_remove_range(
+        struct seahorse_red_black_tree *object,
+        const void *first,
+        const void *last,
+        void (*on_destroy)(void *data));
+
+/*
+ * Populate an empty tree with count nodes in linear time, fill is given the
+ * data of each node in ascending order and must leave them strictly
+ * ascending. If fill fails the nodes filled so far are given to on_destroy,
+ * if not NULL, and the tree is left empty.
+ */
+bool seahorse_red_black_tree_build(
+        struct seahorse_red_black_tree *object,
+        uintmax_t count,
+        bool (*fill)(void *data, void *context),
+        void (*on_destroy)(void *data),
+        void *context);
+
+/*
+ * Move the node of data and every node after it into out, which must be
+ * empty and initialized like object, by relinking them in logarithmic time.
+ */
+void seahorse_red_black_tree_split(struct seahorse_red_black_tree *object,
+                                   const void *data,
+                                   struct seahorse_red_black_tree *out);
+
+/*
+ * Whether the last node of object comes before the first node of other,
+ * which holds as well if either of them is empty.
+ */
+bool seahorse_red_black_tree_precedes(
+        const struct seahorse_red_black_tree *object,
+        const struct seahorse_red_black_tree *other);
+
+/*
+ * Move every node of other, all of which must come after the last node of
+ * object, into object. Trees sharing a pool are relinked in logarithmic
+ * time and nothing is allocated, otherwise the nodes of other are first
+ * moved into new nodes owned by object.
+ */
+bool seahorse_red_black_tree_join(struct seahorse_red_black_tree *object,
+                                  struct seahorse_red_black_tree *other);
+
+#ifdef TEST
+/*
+ * Whether the root of object is black, no red node has a red child, every
+ * path down from the root holds as many black nodes and every parent link
+ * and subtree count agrees with the shape of the tree.
+ */
+bool seahorse_red_black_tree_is_valid(
+        const struct seahorse_red_black_tree *object);
+#endif
+
+#endif /* _SEAHORSE_PRIVATE_RED_BLACK_TREE_H_ */
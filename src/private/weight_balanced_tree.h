@@ -0,0 +1,13 @@
+#ifndef _SEAHORSE_PRIVATE_WEIGHT_BALANCED_TREE_H_
+#define _SEAHORSE_PRIVATE_WEIGHT_BALANCED_TREE_H_
+
+/*
+ * Balance parameters of the persistent and concurrent tree maps, a node is
+ * balanced while neither child weighs more than DELTA times the other and a
+ * double rotation is used when the inner grandchild weighs at least RATIO
+ * times the outer one.
+ */
+#define DELTA                           3
+#define RATIO                           2
+
+#endif /* _SEAHORSE_PRIVATE_WEIGHT_BALANCED_TREE_H_ */
@@ -0,0 +1,1119 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/*
+ * Adaptive radix tree where each inner node discriminates on a single byte of
+ * the key and grows or shrinks between 4, 16, 48 and 256 children as needed.
+ * An inner node records the byte it discriminates on as its depth together
+ * with the bytes above it as its prefix, so runs of bytes shared by all keys
+ * below a node are skipped without intermediate nodes and a node can replace
+ * its parent without being rewritten. Children are either inner nodes or
+ * entries, entries being tagged in the lowest bit of the pointer.
+ */
+#define KEY_BYTES                       sizeof(uintmax_t)
+#define NODE_4                          0
+#define NODE_16                         1
+#define NODE_48                         2
+#define NODE_256                        3
+
+struct entry {
+    struct entry *prev;
+    struct entry *next;
+    uintmax_t key;
+    uintmax_t value;
+};
+
+struct node {
+    uintmax_t prefix;
+    uint16_t count;
+    uint8_t type;
+    uint8_t depth;
+};
+
+struct node_4 {
+    struct node node;
+    uint8_t keys[4];
+    void *children[4];
+};
+
+struct node_16 {
+    struct node node;
+    uint8_t keys[16];
+    void *children[16];
+};
+
+struct node_48 {
+    struct node node;
+    /* slot of the child for each byte plus one, zero if there is none */
+    uint8_t indexes[256];
+    void *children[48];
+};
+
+struct node_256 {
+    struct node node;
+    void *children[256];
+};
+
+static const uint16_t CAPACITY[] = {4, 16, 48, 256};
+/* a node shrinks once its children fit the next smaller type with room */
+static const uint16_t MINIMUM[] = {0, 3, 12, 37};
+static const size_t SIZE[] = {
+        sizeof(struct node_4),
+        sizeof(struct node_16),
+        sizeof(struct node_48),
+        sizeof(struct node_256)
+};
+
+static bool is_entry(const void *const child) {
+    return (uintptr_t) child & 1;
+}
+
+static struct entry *entry_of(const void *const child) {
+    assert(is_entry(child));
+    return (struct entry *) ((uintptr_t) child & ~(uintptr_t) 1);
+}
+
+static void *child_of(const struct entry *const entry) {
+    assert(entry);
+    return (void *) ((uintptr_t) entry | 1);
+}
+
+static uint8_t byte_of(const uintmax_t key, const uintmax_t depth) {
+    assert(depth < KEY_BYTES);
+    return (uint8_t) (key >> (8 * (KEY_BYTES - 1 - depth)));
+}
+
+static uintmax_t prefix_of(const uintmax_t key, const uintmax_t depth) {
+    assert(depth < KEY_BYTES);
+    return depth ? key & ~(UINTMAX_MAX >> (8 * depth)) : 0;
+}
+
+/*
+ * Returns the first byte in which a and b differ.
+ */
+static uint8_t mismatch_of(const uintmax_t a, const uintmax_t b) {
+    assert(a != b);
+    uint8_t depth = 0;
+    while (byte_of(a, depth) == byte_of(b, depth)) {
+        depth += 1;
+    }
+    return depth;
+}
+
+static void **find_child(struct node *const node, const uint8_t byte) {
+    assert(node);
+    switch (node->type) {
+        case NODE_4: {
+            struct node_4 *const n = (struct node_4 *) node;
+            for (uintmax_t i = 0; i < node->count; i++) {
+                if (byte == n->keys[i]) {
+                    return &n->children[i];
+                }
+            }
+            return NULL;
+        }
+        case NODE_16: {
+            struct node_16 *const n = (struct node_16 *) node;
+#if defined(__SSE2__)
+            const __m128i keys = _mm_loadu_si128((const __m128i *) n->keys);
+            const uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(
+                    keys, _mm_set1_epi8((char) byte)))
+                                  & ((UINT32_C(1) << node->count) - 1);
+            return mask ? &n->children[__builtin_ctz(mask)] : NULL;
+#else
+            for (uintmax_t i = 0; i < node->count; i++) {
+                if (byte == n->keys[i]) {
+                    return &n->children[i];
+                }
+            }
+            return NULL;
+#endif
+        }
+        case NODE_48: {
+            struct node_48 *const n = (struct node_48 *) node;
+            const uint8_t index = n->indexes[byte];
+            return index ? &n->children[index - 1] : NULL;
+        }
+        default: {
+            struct node_256 *const n = (struct node_256 *) node;
+            return n->children[byte] ? &n->children[byte] : NULL;
+        }
+    }
+}
+
+/*
+ * Returns the child with the greatest byte less than limit, a limit of 256
+ * returns the last child.
+ */
+static void *child_below(const struct node *const node,
+                         const uint16_t limit) {
+    assert(node);
+    switch (node->type) {
+        case NODE_4:
+        case NODE_16: {
+            const uint8_t *const keys = NODE_4 == node->type
+                                        ? ((const struct node_4 *) node)->keys
+                                        : ((const struct node_16 *) node)->keys;
+            void *const *const children = NODE_4 == node->type
+                    ? ((const struct node_4 *) node)->children
+                    : ((const struct node_16 *) node)->children;
+            uintmax_t i = node->count;
+            while (i && keys[i - 1] >= limit) {
+                i -= 1;
+            }
+            return i ? children[i - 1] : NULL;
+        }
+        case NODE_48: {
+            const struct node_48 *const n = (const struct node_48 *) node;
+            for (uint16_t i = limit; i > 0; i--) {
+                if (n->indexes[i - 1]) {
+                    return n->children[n->indexes[i - 1] - 1];
+                }
+            }
+            return NULL;
+        }
+        default: {
+            const struct node_256 *const n = (const struct node_256 *) node;
+            for (uint16_t i = limit; i > 0; i--) {
+                if (n->children[i - 1]) {
+                    return n->children[i - 1];
+                }
+            }
+            return NULL;
+        }
+    }
+}
+
+static struct node *node_of(const uint8_t type,
+                            const uint8_t depth,
+                            const uintmax_t key) {
+    assert(type <= NODE_256);
+    struct node *const node = calloc(1, SIZE[type]);
+    if (node) {
+        node->type = type;
+        node->depth = depth;
+        node->prefix = prefix_of(key, depth);
+    }
+    return node;
+}
+
+/*
+ * Adds the child for byte to a node that has room for it.
+ */
+static void add_child(struct node *const node,
+                      const uint8_t byte,
+                      void *const child) {
+    assert(node);
+    assert(node->count < CAPACITY[node->type]);
+    assert(!find_child(node, byte));
+    switch (node->type) {
+        case NODE_4:
+        case NODE_16: {
+            uint8_t *const keys = NODE_4 == node->type
+                                  ? ((struct node_4 *) node)->keys
+                                  : ((struct node_16 *) node)->keys;
+            void **const children = NODE_4 == node->type
+                                    ? ((struct node_4 *) node)->children
+                                    : ((struct node_16 *) node)->children;
+            uintmax_t i = node->count;
+            for (; i && keys[i - 1] > byte; i--) {
+                keys[i] = keys[i - 1];
+                children[i] = children[i - 1];
+            }
+            keys[i] = byte;
+            children[i] = child;
+            break;
+        }
+        case NODE_48: {
+            struct node_48 *const n = (struct node_48 *) node;
+            uint8_t i = 0;
+            while (n->children[i]) {
+                i += 1;
+            }
+            n->children[i] = child;
+            n->indexes[byte] = 1 + i;
+            break;
+        }
+        default: {
+            ((struct node_256 *) node)->children[byte] = child;
+            break;
+        }
+    }
+    node->count += 1;
+}
+
+static void remove_child(struct node *const node, const uint8_t byte) {
+    assert(node);
+    switch (node->type) {
+        case NODE_4:
+        case NODE_16: {
+            uint8_t *const keys = NODE_4 == node->type
+                                  ? ((struct node_4 *) node)->keys
+                                  : ((struct node_16 *) node)->keys;
+            void **const children = NODE_4 == node->type
+                                    ? ((struct node_4 *) node)->children
+                                    : ((struct node_16 *) node)->children;
+            uintmax_t i = 0;
+            while (keys[i] != byte) {
+                i += 1;
+            }
+            assert(i < node->count);
+            for (i += 1; i < node->count; i++) {
+                keys[i - 1] = keys[i];
+                children[i - 1] = children[i];
+            }
+            break;
+        }
+        case NODE_48: {
+            struct node_48 *const n = (struct node_48 *) node;
+            assert(n->indexes[byte]);
+            n->children[n->indexes[byte] - 1] = NULL;
+            n->indexes[byte] = 0;
+            break;
+        }
+        default: {
+            struct node_256 *const n = (struct node_256 *) node;
+            assert(n->children[byte]);
+            n->children[byte] = NULL;
+            break;
+        }
+    }
+    node->count -= 1;
+}
+
+/*
+ * Returns the byte by which node reaches child.
+ */
+static uint8_t byte_in(const struct node *const node, const void *const child) {
+    assert(node);
+    assert(child);
+    const uintmax_t key = is_entry(child)
+                          ? entry_of(child)->key
+                          : ((const struct node *) child)->prefix;
+    return byte_of(key, node->depth);
+}
+
+/*
+ * Moves the children of node into a new node of the given type that replaces
+ * node at ref.
+ */
+static bool resize(void **const ref, const uint8_t type) {
+    assert(ref);
+    struct node *const node = *ref;
+    struct node *const other = node_of(type, node->depth, node->prefix);
+    if (!other) {
+        return false;
+    }
+    for (void *child = child_below(node, 256); child;
+         child = child_below(node, byte_in(node, child))) {
+        add_child(other, byte_in(node, child), child);
+    }
+    assert(node->count == other->count);
+    free(node);
+    *ref = other;
+    return true;
+}
+
+static void *maximum_of(void *child) {
+    assert(child);
+    while (!is_entry(child)) {
+        child = child_below(child, 256);
+    }
+    return child;
+}
+
+/*
+ * Returns the entry with the greatest key less than key. Along the path of
+ * key the last child with a smaller byte holds the closest smaller keys,
+ * which are only needed if the path itself has none.
+ */
+static struct entry *find_lower(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key) {
+    assert(object);
+    void *child = object->root;
+    void *candidate = NULL;
+    while (child) {
+        if (is_entry(child)) {
+            struct entry *const entry = entry_of(child);
+            if (entry->key < key) {
+                return entry;
+            }
+            break;
+        }
+        struct node *const node = child;
+        const uintmax_t prefix = prefix_of(key, node->depth);
+        if (node->prefix != prefix) {
+            if (node->prefix < prefix) {
+                return entry_of(maximum_of(node));
+            }
+            break;
+        }
+        const uint8_t byte = byte_of(key, node->depth);
+        void *const below = child_below(node, byte);
+        if (below) {
+            candidate = below;
+        }
+        void **const slot = find_child(node, byte);
+        child = slot ? *slot : NULL;
+    }
+    return candidate ? entry_of(maximum_of(candidate)) : NULL;
+}
+
+static struct entry *find(const struct seahorse_radix_map_ni_ni *const object,
+                          const uintmax_t key) {
+    assert(object);
+    void *child = object->root;
+    while (child && !is_entry(child)) {
+        struct node *const node = child;
+        if (node->prefix != prefix_of(key, node->depth)) {
+            return NULL;
+        }
+        void **const slot = find_child(node, byte_of(key, node->depth));
+        child = slot ? *slot : NULL;
+    }
+    if (!child || entry_of(child)->key != key) {
+        return NULL;
+    }
+    return entry_of(child);
+}
+
+static void destroy(void *const child) {
+    assert(child);
+    if (is_entry(child)) {
+        return;
+    }
+    struct node *const node = child;
+    void *other = child_below(node, 256);
+    while (other) {
+        const uint8_t byte = byte_in(node, other);
+        destroy(other);
+        other = child_below(node, byte);
+    }
+    free(node);
+}
+
+static void init(struct seahorse_radix_map_ni_ni *const object) {
+    assert(object);
+    *object = (struct seahorse_radix_map_ni_ni) {0};
+}
+
+bool seahorse_radix_map_ni_ni_init(
+        struct seahorse_radix_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    init(object);
+    return true;
+}
+
+static void invalidate(struct seahorse_radix_map_ni_ni *const object) {
+    assert(object);
+    if (object->root) {
+        destroy(object->root);
+    }
+    struct entry *entry = object->first;
+    while (entry) {
+        struct entry *const next = entry->next;
+        free(entry);
+        entry = next;
+    }
+    *object = (struct seahorse_radix_map_ni_ni) {0};
+}
+
+bool seahorse_radix_map_ni_ni_invalidate(
+        struct seahorse_radix_map_ni_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    invalidate(object);
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_count(
+        const struct seahorse_radix_map_ni_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * The entry and any node that has to be created or grown are allocated
+ * before the tree is changed, so that running out of memory leaves the tree
+ * as it was.
+ */
+static bool insert(struct seahorse_radix_map_ni_ni *const object,
+                   const uintmax_t key,
+                   const uintmax_t value,
+                   const struct entry **const out) {
+    assert(object);
+    struct entry *entry = find(object, key);
+    if (entry) {
+        if (out) {
+            *out = entry;
+        }
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    entry = malloc(sizeof(*entry));
+    if (!entry) {
+        seahorse_error =
+                SEAHORSE_RADIX_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    *entry = (struct entry) {
+            .key = key,
+            .value = value
+    };
+    void **ref = &object->root;
+    while (*ref) {
+        uintmax_t other;
+        if (is_entry(*ref)) {
+            other = entry_of(*ref)->key;
+        } else {
+            struct node *const node = *ref;
+            if (node->prefix == prefix_of(key, node->depth)) {
+                const uint8_t byte = byte_of(key, node->depth);
+                void **const slot = find_child(node, byte);
+                if (slot) {
+                    ref = slot;
+                    continue;
+                }
+                if (CAPACITY[node->type] == node->count
+                    && !resize(ref, 1 + node->type)) {
+                    free(entry);
+                    seahorse_error =
+                            SEAHORSE_RADIX_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+                    return false;
+                }
+                add_child(*ref, byte, child_of(entry));
+                break;
+            }
+            other = node->prefix;
+        }
+        /* key leaves the path of the child at ref before its depth */
+        const uint8_t depth = mismatch_of(other, key);
+        struct node *const node = node_of(NODE_4, depth, key);
+        if (!node) {
+            free(entry);
+            seahorse_error =
+                    SEAHORSE_RADIX_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        add_child(node, byte_of(other, depth), *ref);
+        add_child(node, byte_of(key, depth), child_of(entry));
+        *ref = node;
+        break;
+    }
+    if (!*ref) {
+        *ref = child_of(entry);
+    }
+    struct entry *const prev = find_lower(object, key);
+    struct entry *const next = prev ? prev->next : object->first;
+    entry->prev = prev;
+    entry->next = next;
+    if (prev) {
+        prev->next = entry;
+    } else {
+        object->first = entry;
+    }
+    if (next) {
+        next->prev = entry;
+    } else {
+        object->last = entry;
+    }
+    object->count += 1;
+    if (out) {
+        *out = entry;
+    }
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_init_radix_map_ni_ni(
+        struct seahorse_radix_map_ni_ni *const object,
+        const struct seahorse_radix_map_ni_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    init(object);
+    for (const struct entry *entry = other->first; entry;
+         entry = entry->next) {
+        if (!insert(object, entry->key, entry->value, NULL)) {
+            invalidate(object);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_add(
+        struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    return insert(object, key, value, NULL);
+}
+
+bool seahorse_radix_map_ni_ni_try_add(
+        struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    return insert(object, key, value,
+                  (const struct entry **) out);
+}
+
+/*
+ * Removes the entry for key from the tree, a node left with a single child
+ * is replaced by that child and a node that became sparse is shrunk if
+ * memory permits.
+ */
+static void erase(struct seahorse_radix_map_ni_ni *const object,
+                  struct entry *const entry) {
+    assert(object);
+    assert(entry);
+    const uintmax_t key = entry->key;
+    void **ref = &object->root;
+    void **parent = NULL;
+    while (!is_entry(*ref)) {
+        parent = ref;
+        ref = find_child(*ref, byte_of(key, ((struct node *) *ref)->depth));
+        assert(ref);
+    }
+    assert(entry_of(*ref) == entry);
+    if (!parent) {
+        object->root = NULL;
+    } else {
+        struct node *const node = *parent;
+        remove_child(node, byte_of(key, node->depth));
+        if (1 == node->count) {
+            *parent = child_below(node, 256);
+            free(node);
+        } else if (node->count < MINIMUM[node->type]) {
+            /* a node that cannot be shrunk only costs space */
+            (void) resize(parent, node->type - 1);
+        }
+    }
+    if (entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        object->first = entry->next;
+    }
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    } else {
+        object->last = entry->prev;
+    }
+    free(entry);
+    object->count -= 1;
+}
+
+bool seahorse_radix_map_ni_ni_remove(
+        struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct entry *const entry = find(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    erase(object, entry);
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_contains(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = find(object, key);
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_set(
+        struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct entry *const entry = find(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    entry->value = value;
+    return true;
+}
+
+static const struct entry *find_ceiling(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key) {
+    assert(object);
+    const struct entry *const entry = find_lower(object, key);
+    return entry ? entry->next : object->first;
+}
+
+static const struct entry *find_floor(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key) {
+    assert(object);
+    return UINTMAX_MAX == key
+           ? object->last
+           : find_lower(object, 1 + key);
+}
+
+static const struct entry *find_higher(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key) {
+    assert(object);
+    const struct entry *const entry = find_floor(object, key);
+    return entry ? entry->next : object->first;
+}
+
+bool seahorse_radix_map_ni_ni_get(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_ceiling(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_ceiling(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_floor(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_floor(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_higher(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_higher(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_lower(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_lower(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_first(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    const struct entry *const entry = object->first;
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_last(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    const struct entry *const entry = object->last;
+    *out = &entry->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_get_entry(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = (const struct seahorse_radix_map_ni_ni_entry *) entry;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_ceiling_entry(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_ceiling(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = (const struct seahorse_radix_map_ni_ni_entry *) entry;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_floor_entry(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_floor(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = (const struct seahorse_radix_map_ni_ni_entry *) entry;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_higher_entry(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_higher(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = (const struct seahorse_radix_map_ni_ni_entry *) entry;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_lower_entry(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const uintmax_t key,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const entry = find_lower(object, key);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = (const struct seahorse_radix_map_ni_ni_entry *) entry;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_first_entry(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->first;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_last_entry(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
+    }
+    *out = object->last;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_remove_entry(
+        struct seahorse_radix_map_ni_ni *const object,
+        const struct seahorse_radix_map_ni_ni_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    erase(object, (struct entry *) entry);
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_next_entry(
+        const struct seahorse_radix_map_ni_ni_entry *const entry,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const next = ((const struct entry *) entry)->next;
+    if (!next) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    *out = (const struct seahorse_radix_map_ni_ni_entry *) next;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_prev_entry(
+        const struct seahorse_radix_map_ni_ni_entry *const entry,
+        const struct seahorse_radix_map_ni_ni_entry **const out) {
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct entry *const prev = ((const struct entry *) entry)->prev;
+    if (!prev) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_END_OF_SEQUENCE;
+        return false;
+    }
+    *out = (const struct seahorse_radix_map_ni_ni_entry *) prev;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_entry_key(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const struct seahorse_radix_map_ni_ni_entry *const entry,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &((const struct entry *) entry)->key;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_entry_get_value(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const struct seahorse_radix_map_ni_ni_entry *const entry,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = &((const struct entry *) entry)->value;
+    return true;
+}
+
+bool seahorse_radix_map_ni_ni_entry_set_value(
+        const struct seahorse_radix_map_ni_ni *const object,
+        const struct seahorse_radix_map_ni_ni_entry *const entry,
+        const uintmax_t value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_RADIX_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    ((struct entry *) entry)->value = value;
+    return true;
+}
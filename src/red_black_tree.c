@@ -0,0 +1,1124 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#include "private/red_black_tree.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/*
+ * Chunks of a pool start out with room for CHUNK_MINIMUM nodes and each new
+ * chunk doubles in size up until it can hold CHUNK_MAXIMUM nodes.
+ */
+#define CHUNK_MINIMUM                   32
+#define CHUNK_MAXIMUM                   4096
+
+struct node {
+    struct node *parent;
+    struct node *left;
+    struct node *right;
+    uintmax_t count;
+    bool red;
+    _Alignas(max_align_t) unsigned char data[];
+};
+
+struct chunk {
+    struct chunk *next;
+    uintmax_t capacity;
+    _Alignas(max_align_t) unsigned char data[];
+};
+
+/*
+ * The nodes of a given size that a pool hands out. Chunks are kept in the
+ * order in which they were allocated and carved out one after the other,
+ * while released nodes are kept in a free list linked through their parent.
+ */
+struct slab {
+    struct slab *next;
+    struct chunk *chunks;
+    struct chunk *chunk;
+    unsigned char *cursor;
+    uintmax_t remaining;
+    struct node *free;
+    uintmax_t count;
+    size_t size;
+};
+
+#pragma mark pool -
+
+bool seahorse_red_black_tree_pool_init(
+        struct seahorse_red_black_tree_pool *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_POOL_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    *object = (struct seahorse_red_black_tree_pool) {0};
+    return true;
+}
+
+bool seahorse_red_black_tree_pool_invalidate(
+        struct seahorse_red_black_tree_pool *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_POOL_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (object->count) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE;
+        return false;
+    }
+    struct slab *slab = object->slabs;
+    while (slab) {
+        struct chunk *chunk = slab->chunks;
+        while (chunk) {
+            struct chunk *const next = chunk->next;
+            free(chunk);
+            chunk = next;
+        }
+        struct slab *const next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    *object = (struct seahorse_red_black_tree_pool) {0};
+    return true;
+}
+
+static struct slab *slab_of(
+        const struct seahorse_red_black_tree_pool *const pool,
+        const size_t size) {
+    assert(pool);
+    struct slab *slab = pool->slabs;
+    while (slab && slab->size != size) {
+        slab = slab->next;
+    }
+    return slab;
+}
+
+static struct node *carve(struct slab *const slab) {
+    assert(slab);
+    if (slab->free) {
+        struct node *const node = slab->free;
+        slab->free = node->parent;
+        return node;
+    }
+    if (!slab->remaining) {
+        struct chunk *chunk = slab->chunk
+                              ? slab->chunk->next
+                              : slab->chunks;
+        if (!chunk) {
+            uintmax_t capacity = CHUNK_MINIMUM;
+            if (slab->chunk) {
+                capacity = 2 * slab->chunk->capacity;
+                if (capacity > CHUNK_MAXIMUM) {
+                    capacity = CHUNK_MAXIMUM;
+                }
+            }
+            chunk = malloc(offsetof(struct chunk, data)
+                           + capacity * slab->size);
+            if (!chunk) {
+                return NULL;
+            }
+            chunk->next = NULL;
+            chunk->capacity = capacity;
+            if (slab->chunk) {
+                slab->chunk->next = chunk;
+            } else {
+                slab->chunks = chunk;
+            }
+        }
+        slab->chunk = chunk;
+        slab->cursor = chunk->data;
+        slab->remaining = chunk->capacity;
+    }
+    struct node *const node = (struct node *) slab->cursor;
+    slab->cursor += slab->size;
+    slab->remaining--;
+    return node;
+}
+
+/*
+ * Make every chunk of slab available again without releasing any of them.
+ */
+static void reset(struct slab *const slab) {
+    assert(slab);
+    slab->chunk = NULL;
+    slab->cursor = NULL;
+    slab->remaining = 0;
+    slab->free = NULL;
+    slab->count = 0;
+}
+
+#pragma mark node -
+
+static struct node *node_of(const void *const data) {
+    assert(data);
+    return (struct node *) ((unsigned char *) data
+                            - offsetof(struct node, data));
+}
+
+static uintmax_t count_of(const struct node *const node) {
+    return node ? node->count : 0;
+}
+
+static size_t size_of(const struct seahorse_red_black_tree *const object) {
+    assert(object);
+    const size_t alignment = _Alignof(max_align_t);
+    const size_t size = offsetof(struct node, data) + object->size;
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+static bool allocate(const struct seahorse_red_black_tree *const object,
+                     struct node **const out) {
+    assert(object);
+    assert(out);
+    const size_t size = size_of(object);
+    if (!object->pool) {
+        *out = malloc(size);
+        return *out;
+    }
+    struct slab *slab = slab_of(object->pool, size);
+    if (!slab) {
+        slab = calloc(1, sizeof(*slab));
+        if (!slab) {
+            return false;
+        }
+        slab->size = size;
+        slab->next = object->pool->slabs;
+        object->pool->slabs = slab;
+    }
+    *out = carve(slab);
+    if (!*out) {
+        return false;
+    }
+    slab->count++;
+    return true;
+}
+
+static void release(const struct seahorse_red_black_tree *const object,
+                    struct node *const node) {
+    assert(object);
+    assert(node);
+    if (!object->pool) {
+        free(node);
+        return;
+    }
+    struct slab *const slab = slab_of(object->pool, size_of(object));
+    assert(slab);
+    assert(slab->count);
+    node->parent = slab->free;
+    slab->free = node;
+    slab->count--;
+}
+
+static void destroy(const struct seahorse_red_black_tree *const object,
+                    struct node *node,
+                    void (*const on_destroy)(void *)) {
+    assert(object);
+    while (node) {
+        destroy(object, node->left, on_destroy);
+        struct node *const right = node->right;
+        if (on_destroy) {
+            on_destroy(node->data);
+        }
+        release(object, node);
+        node = right;
+    }
+}
+
+static struct node *minimum(struct node *node) {
+    assert(node);
+    while (node->left) {
+        node = node->left;
+    }
+    return node;
+}
+
+static struct node *maximum(struct node *node) {
+    assert(node);
+    while (node->right) {
+        node = node->right;
+    }
+    return node;
+}
+
+/*
+ * Black height of the subtree rooted at node, including node itself.
+ */
+static uintmax_t height_of(const struct node *node) {
+    uintmax_t height = 0;
+    for (; node; node = node->left) {
+        height += !node->red;
+    }
+    return height;
+}
+
+#pragma mark balance -
+
+static void replace(struct node **const root,
+                    struct node *const node,
+                    struct node *const other) {
+    assert(root);
+    assert(node);
+    struct node *const parent = node->parent;
+    if (!parent) {
+        *root = other;
+    } else if (parent->left == node) {
+        parent->left = other;
+    } else {
+        parent->right = other;
+    }
+    if (other) {
+        other->parent = parent;
+    }
+}
+
+static void rotate_left(struct node **const root, struct node *const node) {
+    assert(root);
+    assert(node);
+    assert(node->right);
+    struct node *const right = node->right;
+    node->right = right->left;
+    if (right->left) {
+        right->left->parent = node;
+    }
+    replace(root, node, right);
+    right->left = node;
+    node->parent = right;
+    right->count = node->count;
+    node->count = 1 + count_of(node->left) + count_of(node->right);
+}
+
+static void rotate_right(struct node **const root, struct node *const node) {
+    assert(root);
+    assert(node);
+    assert(node->left);
+    struct node *const left = node->left;
+    node->left = left->right;
+    if (left->right) {
+        left->right->parent = node;
+    }
+    replace(root, node, left);
+    left->right = node;
+    node->parent = left;
+    left->count = node->count;
+    node->count = 1 + count_of(node->left) + count_of(node->right);
+}
+
+/*
+ * Restore the red black properties after the red node has been linked in,
+ * except that the root may be left red.
+ */
+static void insert_fixup(struct node **const root, struct node *node) {
+    assert(root);
+    assert(node);
+    while (node->parent && node->parent->red) {
+        struct node *parent = node->parent;
+        struct node *const grandparent = parent->parent;
+        assert(grandparent);
+        if (parent == grandparent->left) {
+            struct node *const uncle = grandparent->right;
+            if (uncle && uncle->red) {
+                parent->red = uncle->red = false;
+                grandparent->red = true;
+                node = grandparent;
+                continue;
+            }
+            if (node == parent->right) {
+                rotate_left(root, parent);
+                node = parent;
+                parent = node->parent;
+            }
+            parent->red = false;
+            grandparent->red = true;
+            rotate_right(root, grandparent);
+        } else {
+            struct node *const uncle = grandparent->left;
+            if (uncle && uncle->red) {
+                parent->red = uncle->red = false;
+                grandparent->red = true;
+                node = grandparent;
+                continue;
+            }
+            if (node == parent->left) {
+                rotate_right(root, parent);
+                node = parent;
+                parent = node->parent;
+            }
+            parent->red = false;
+            grandparent->red = true;
+            rotate_left(root, grandparent);
+        }
+    }
+}
+
+static bool is_black(const struct node *const node) {
+    return !node || !node->red;
+}
+
+/*
+ * Restore the red black properties after a black node was removed from
+ * above node, which may be NULL and so its parent is given as well.
+ */
+static void erase_fixup(struct node **const root,
+                        struct node *node,
+                        struct node *parent) {
+    assert(root);
+    while (node != *root && is_black(node)) {
+        assert(parent);
+        if (node == parent->left) {
+            struct node *sibling = parent->right;
+            if (sibling->red) {
+                sibling->red = false;
+                parent->red = true;
+                rotate_left(root, parent);
+                sibling = parent->right;
+            }
+            if (is_black(sibling->left) && is_black(sibling->right)) {
+                sibling->red = true;
+                node = parent;
+                parent = node->parent;
+                continue;
+            }
+            if (is_black(sibling->right)) {
+                sibling->left->red = false;
+                sibling->red = true;
+                rotate_right(root, sibling);
+                sibling = parent->right;
+            }
+            sibling->red = parent->red;
+            parent->red = false;
+            sibling->right->red = false;
+            rotate_left(root, parent);
+        } else {
+            struct node *sibling = parent->left;
+            if (sibling->red) {
+                sibling->red = false;
+                parent->red = true;
+                rotate_right(root, parent);
+                sibling = parent->left;
+            }
+            if (is_black(sibling->left) && is_black(sibling->right)) {
+                sibling->red = true;
+                node = parent;
+                parent = node->parent;
+                continue;
+            }
+            if (is_black(sibling->left)) {
+                sibling->right->red = false;
+                sibling->red = true;
+                rotate_left(root, sibling);
+                sibling = parent->left;
+            }
+            sibling->red = parent->red;
+            parent->red = false;
+            sibling->left->red = false;
+            rotate_right(root, parent);
+        }
+        node = *root;
+        parent = NULL;
+    }
+    if (node) {
+        node->red = false;
+    }
+}
+
+static void erase(struct node **const root, struct node *const node) {
+    assert(root);
+    assert(node);
+    struct node *const successor = node->left && node->right
+                                   ? minimum(node->right)
+                                   : node;
+    for (struct node *i = successor->parent; i; i = i->parent) {
+        i->count--;
+    }
+    struct node *child;
+    struct node *parent;
+    bool red;
+    if (!node->left || !node->right) {
+        child = node->left ? node->left : node->right;
+        parent = node->parent;
+        red = node->red;
+        replace(root, node, child);
+    } else {
+        child = successor->right;
+        red = successor->red;
+        if (successor->parent == node) {
+            parent = successor;
+        } else {
+            parent = successor->parent;
+            replace(root, successor, child);
+            successor->right = node->right;
+            successor->right->parent = successor;
+        }
+        replace(root, node, successor);
+        successor->left = node->left;
+        successor->left->parent = successor;
+        successor->red = node->red;
+        successor->count = node->count;
+    }
+    if (!red) {
+        erase_fixup(root, child, parent);
+    }
+}
+
+/*
+ * Join the black rooted trees left and right, of black heights left_height
+ * and right_height, with node in between them. Only the spine of the taller
+ * tree is walked down to where node is linked in, which takes time in
+ * proportion to the difference in black heights.
+ */
+static struct node *join(struct node *const left,
+                         const uintmax_t left_height,
+                         struct node *const node,
+                         struct node *const right,
+                         const uintmax_t right_height,
+                         uintmax_t *const out) {
+    assert(is_black(left));
+    assert(is_black(right));
+    assert(node);
+    assert(out);
+    node->red = true;
+    node->count = 1 + count_of(left) + count_of(right);
+    struct node *root;
+    struct node *parent = NULL;
+    uintmax_t height;
+    if (left_height >= right_height) {
+        struct node *child = left;
+        height = left_height;
+        while (child && (height > right_height || child->red)) {
+            height -= !child->red;
+            parent = child;
+            child = child->right;
+        }
+        node->left = child;
+        node->right = right;
+        if (parent) {
+            parent->right = node;
+        }
+        root = parent ? left : node;
+        height = left_height;
+    } else {
+        struct node *child = right;
+        height = right_height;
+        while (child && (height > left_height || child->red)) {
+            height -= !child->red;
+            parent = child;
+            child = child->left;
+        }
+        node->left = left;
+        node->right = child;
+        if (parent) {
+            parent->left = node;
+        }
+        root = parent ? right : node;
+        height = right_height;
+    }
+    node->parent = parent;
+    if (node->left) {
+        node->left->parent = node;
+    }
+    if (node->right) {
+        node->right->parent = node;
+    }
+    node->count = 1 + count_of(node->left) + count_of(node->right);
+    for (struct node *i = parent; i; i = i->parent) {
+        i->count = 1 + count_of(i->left) + count_of(i->right);
+    }
+    insert_fixup(&root, node);
+    if (root->red) {
+        root->red = false;
+        height++;
+    }
+    *out = height;
+    return root;
+}
+
+/*
+ * Detach the subtree node so that it can stand on its own as a black rooted
+ * tree whose black height is then given by height.
+ */
+static struct node *detach(struct node *const node, uintmax_t *const height) {
+    assert(height);
+    if (node) {
+        node->parent = NULL;
+        if (node->red) {
+            node->red = false;
+            (*height)++;
+        }
+    }
+    return node;
+}
+
+/*
+ * Split the black rooted tree node, of black height height, into the nodes
+ * that come before the given index and those that do not.
+ */
+static void split(struct node *const node,
+                  const uintmax_t height,
+                  const uintmax_t index,
+                  struct node **const left,
+                  uintmax_t *const left_height,
+                  struct node **const right,
+                  uintmax_t *const right_height) {
+    assert(is_black(node));
+    assert(left);
+    assert(left_height);
+    assert(right);
+    assert(right_height);
+    if (!node) {
+        *left = *right = NULL;
+        *left_height = *right_height = 0;
+        return;
+    }
+    uintmax_t lower_height = height - 1;
+    struct node *const lower = detach(node->left, &lower_height);
+    uintmax_t upper_height = height - 1;
+    struct node *const upper = detach(node->right, &upper_height);
+    node->left = node->right = node->parent = NULL;
+    struct node *middle;
+    uintmax_t middle_height;
+    if (index <= count_of(lower)) {
+        split(lower, lower_height, index, left, left_height,
+              &middle, &middle_height);
+        *right = join(middle, middle_height, node, upper, upper_height,
+                      right_height);
+    } else {
+        split(upper, upper_height, index - count_of(lower) - 1,
+              &middle, &middle_height, right, right_height);
+        *left = join(lower, lower_height, node, middle, middle_height,
+                     left_height);
+    }
+}
+
+/*
+ * Concatenate the black rooted trees left and right, where every node of
+ * left comes before those of right.
+ */
+static struct node *concatenate(struct node *const left,
+                                struct node *right) {
+    assert(is_black(left));
+    assert(is_black(right));
+    if (!left) {
+        return right;
+    }
+    if (!right) {
+        return left;
+    }
+    struct node *const node = minimum(right);
+    erase(&right, node);
+    uintmax_t right_height = 0;
+    if (right) {
+        right->red = false;
+        right_height = height_of(right);
+    }
+    uintmax_t height;
+    return join(left, height_of(left), node, right, right_height, &height);
+}
+
+/*
+ * Link the count nodes of chain, which are linked through right, into a
+ * tree where every level except the last is complete. The nodes of the last
+ * level are red when it is at depth red.
+ */
+static struct node *assemble(struct node **const chain,
+                             const uintmax_t count,
+                             const uintmax_t depth,
+                             const uintmax_t red) {
+    assert(chain);
+    if (!count) {
+        return NULL;
+    }
+    const uintmax_t half = (count - 1) / 2;
+    struct node *const left = assemble(chain, half, 1 + depth, red);
+    struct node *const node = *chain;
+    assert(node);
+    *chain = node->right;
+    node->left = left;
+    if (left) {
+        left->parent = node;
+    }
+    node->right = assemble(chain, count - 1 - half, 1 + depth, red);
+    if (node->right) {
+        node->right->parent = node;
+    }
+    node->parent = NULL;
+    node->count = count;
+    node->red = depth == red;
+    return node;
+}
+
+static struct node *assemble_all(struct node *chain, const uintmax_t count) {
+    uintmax_t depth = 0;
+    for (uintmax_t i = count; i > 1; i >>= 1) {
+        depth++;
+    }
+    struct node *const root = assemble(&chain, count, 0, depth);
+    assert(!chain);
+    if (root) {
+        root->red = false;
+    }
+    return root;
+}
+
+/*
+ * Allocate count unlinked nodes, linked through right, or none at all.
+ */
+static bool allocate_chain(const struct seahorse_red_black_tree *const object,
+                           const uintmax_t count,
+                           struct node **const out) {
+    assert(object);
+    assert(out);
+    struct node *chain = NULL;
+    for (uintmax_t i = 0; i < count; i++) {
+        struct node *node;
+        if (!allocate(object, &node)) {
+            while (chain) {
+                struct node *const next = chain->right;
+                release(object, chain);
+                chain = next;
+            }
+            return false;
+        }
+        node->right = chain;
+        chain = node;
+    }
+    *out = chain;
+    return true;
+}
+
+#pragma mark tree -
+
+void seahorse_red_black_tree_init(
+        struct seahorse_red_black_tree *const object,
+        const size_t size,
+        int (*const compare)(const void *, const void *),
+        struct seahorse_red_black_tree_pool *const pool) {
+    assert(object);
+    assert(size);
+    assert(compare);
+    *object = (struct seahorse_red_black_tree) {
+            .pool = pool,
+            .compare = compare,
+            .size = size
+    };
+    if (pool) {
+        pool->count++;
+    }
+}
+
+void seahorse_red_black_tree_invalidate(
+        struct seahorse_red_black_tree *const object,
+        void (*const on_destroy)(void *)) {
+    assert(object);
+    struct slab *const slab = object->pool
+                              ? slab_of(object->pool, size_of(object))
+                              : NULL;
+    if (slab && !on_destroy && slab->count == object->count) {
+        reset(slab);
+    } else {
+        destroy(object, object->root, on_destroy);
+    }
+    if (object->pool) {
+        assert(object->pool->count);
+        object->pool->count--;
+    }
+    *object = (struct seahorse_red_black_tree) {0};
+}
+
+bool seahorse_red_black_tree_alloc(
+        struct seahorse_red_black_tree *const object,
+        void **const out) {
+    assert(object);
+    assert(out);
+    struct node *node;
+    if (!allocate(object, &node)) {
+        return false;
+    }
+    *out = node->data;
+    return true;
+}
+
+void seahorse_red_black_tree_free(struct seahorse_red_black_tree *const object,
+                                  void *const data) {
+    assert(object);
+    release(object, node_of(data));
+}
+
+void *seahorse_red_black_tree_locate(
+        const struct seahorse_red_black_tree *const object,
+        const void *const key,
+        struct seahorse_red_black_tree_position *const out) {
+    assert(object);
+    assert(out);
+    struct node *parent = NULL;
+    bool left = false;
+    struct node *node = object->root;
+    while (node) {
+        const int result = object->compare(key, node->data);
+        if (!result) {
+            return node->data;
+        }
+        parent = node;
+        left = result < 0;
+        node = left ? node->left : node->right;
+    }
+    *out = (struct seahorse_red_black_tree_position) {
+            .parent = parent,
+            .left = left
+    };
+    return NULL;
+}
+
+void seahorse_red_black_tree_link(
+        struct seahorse_red_black_tree *const object,
+        const struct seahorse_red_black_tree_position *const position,
+        void *const data) {
+    assert(object);
+    assert(position);
+    struct node *const node = node_of(data);
+    struct node *const parent = position->parent;
+    *node = (struct node) {
+            .parent = parent,
+            .count = 1,
+            .red = true
+    };
+    struct node *root = object->root;
+    if (!parent) {
+        assert(!root);
+        root = node;
+    } else if (position->left) {
+        assert(!parent->left);
+        parent->left = node;
+    } else {
+        assert(!parent->right);
+        parent->right = node;
+    }
+    for (struct node *i = parent; i; i = i->parent) {
+        i->count++;
+    }
+    insert_fixup(&root, node);
+    root->red = false;
+    object->root = root;
+    object->count++;
+}
+
+void seahorse_red_black_tree_unlink(
+        struct seahorse_red_black_tree *const object,
+        void *const data) {
+    assert(object);
+    assert(object->count);
+    struct node *root = object->root;
+    erase(&root, node_of(data));
+    object->root = root;
+    object->count--;
+}
+
+void seahorse_red_black_tree_remove(
+        struct seahorse_red_black_tree *const object,
+        void *const data) {
+    seahorse_red_black_tree_unlink(object, data);
+    release(object, node_of(data));
+}
+
+void *seahorse_red_black_tree_get(
+        const struct seahorse_red_black_tree *const object,
+        const void *const key,
+        int (*const compare)(const void *, const void *)) {
+    assert(object);
+    assert(compare);
+    const struct node *node = object->root;
+    while (node) {
+        const int result = compare(key, node->data);
+        if (!result) {
+            return (void *) node->data;
+        }
+        node = result < 0 ? node->left : node->right;
+    }
+    return NULL;
+}
+
+/*
+ * Retrieve the first data after key, or the last data before key, and the
+ * data matching key itself when inclusive.
+ */
+static void *search(const struct seahorse_red_black_tree *const object,
+                    const void *const key,
+                    int (*const compare)(const void *, const void *),
+                    const bool inclusive,
+                    const bool after) {
+    assert(object);
+    assert(compare);
+    const struct node *result = NULL;
+    const struct node *node = object->root;
+    while (node) {
+        const int order = compare(key, node->data);
+        if (!order && inclusive) {
+            return (void *) node->data;
+        }
+        if (after ? order < 0 : order > 0) {
+            result = node;
+            node = after ? node->left : node->right;
+        } else {
+            node = after ? node->right : node->left;
+        }
+    }
+    return result ? (void *) result->data : NULL;
+}
+
+void *seahorse_red_black_tree_ceiling(
+        const struct seahorse_red_black_tree *const object,
+        const void *const key,
+        int (*const compare)(const void *, const void *)) {
+    return search(object, key, compare, true, true);
+}
+
+void *seahorse_red_black_tree_floor(
+        const struct seahorse_red_black_tree *const object,
+        const void *const key,
+        int (*const compare)(const void *, const void *)) {
+    return search(object, key, compare, true, false);
+}
+
+void *seahorse_red_black_tree_higher(
+        const struct seahorse_red_black_tree *const object,
+        const void *const key,
+        int (*const compare)(const void *, const void *)) {
+    return search(object, key, compare, false, true);
+}
+
+void *seahorse_red_black_tree_lower(
+        const struct seahorse_red_black_tree *const object,
+        const void *const key,
+        int (*const compare)(const void *, const void *)) {
+    return search(object, key, compare, false, false);
+}
+
+void *seahorse_red_black_tree_first(
+        const struct seahorse_red_black_tree *const object) {
+    assert(object);
+    return object->root
+           ? minimum(object->root)->data
+           : NULL;
+}
+
+void *seahorse_red_black_tree_last(
+        const struct seahorse_red_black_tree *const object) {
+    assert(object);
+    return object->root
+           ? maximum(object->root)->data
+           : NULL;
+}
+
+void *seahorse_red_black_tree_next(const void *const data) {
+    struct node *node = node_of(data);
+    if (node->right) {
+        return minimum(node->right)->data;
+    }
+    while (node->parent && node == node->parent->right) {
+        node = node->parent;
+    }
+    return node->parent ? node->parent->data : NULL;
+}
+
+void *seahorse_red_black_tree_prev(const void *const data) {
+    struct node *node = node_of(data);
+    if (node->left) {
+        return maximum(node->left)->data;
+    }
+    while (node->parent && node == node->parent->left) {
+        node = node->parent;
+    }
+    return node->parent ? node->parent->data : NULL;
+}
+
+uintmax_t seahorse_red_black_tree_index(const void *const data) {
+    const struct node *node = node_of(data);
+    uintmax_t index = count_of(node->left);
+    for (; node->parent; node = node->parent) {
+        if (node == node->parent->right) {
+            index += 1 + count_of(node->parent->left);
+        }
+    }
+    return index;
+}
+
+void *seahorse_red_black_tree_at(
+        const struct seahorse_red_black_tree *const object,
+        uintmax_t index) {
+    assert(object);
+    assert(index < object->count);
+    const struct node *node = object->root;
+    for (;;) {
+        const uintmax_t count = count_of(node->left);
+        if (index == count) {
+            return (void *) node->data;
+        }
+        if (index < count) {
+            node = node->left;
+        } else {
+            index -= 1 + count;
+            node = node->right;
+        }
+    }
+}
+
+void seahorse_red_black_tree_remove_range(
+        struct seahorse_red_black_tree *const object,
+        const void *const first,
+        const void *const last,
+        void (*const on_destroy)(void *)) {
+    assert(object);
+    const uintmax_t low = seahorse_red_black_tree_index(first);
+    const uintmax_t high = seahorse_red_black_tree_index(last);
+    assert(low <= high);
+    struct node *const root = object->root;
+    struct node *head;
+    uintmax_t head_height;
+    struct node *tail;
+    uintmax_t tail_height;
+    split(root, height_of(root), 1 + high, &head, &head_height,
+          &tail, &tail_height);
+    struct node *left;
+    uintmax_t left_height;
+    struct node *range;
+    uintmax_t range_height;
+    split(head, head_height, low, &left, &left_height,
+          &range, &range_height);
+    destroy(object, range, on_destroy);
+    object->root = concatenate(left, tail);
+    object->count = count_of(object->root);
+}
+
+bool seahorse_red_black_tree_build(
+        struct seahorse_red_black_tree *const object,
+        const uintmax_t count,
+        bool (*const fill)(void *, void *),
+        void (*const on_destroy)(void *),
+        void *const context) {
+    assert(object);
+    assert(!object->root);
+    assert(fill);
+    struct node *chain;
+    if (!allocate_chain(object, count, &chain)) {
+        return false;
+    }
+    for (struct node *node = chain; node; node = node->right) {
+        if (fill(node->data, context)) {
+            continue;
+        }
+        bool filled = true;
+        while (chain) {
+            struct node *const next = chain->right;
+            filled = filled && chain != node;
+            if (filled && on_destroy) {
+                on_destroy(chain->data);
+            }
+            release(object, chain);
+            chain = next;
+        }
+        return false;
+    }
+    object->root = assemble_all(chain, count);
+    object->count = count;
+    return true;
+}
+
+void seahorse_red_black_tree_split(
+        struct seahorse_red_black_tree *const object,
+        const void *const data,
+        struct seahorse_red_black_tree *const out) {
+    assert(object);
+    assert(out);
+    assert(!out->root);
+    assert(object->size == out->size);
+    assert(object->pool == out->pool);
+    struct node *const root = object->root;
+    struct node *left;
+    uintmax_t left_height;
+    struct node *right;
+    uintmax_t right_height;
+    split(root, height_of(root), seahorse_red_black_tree_index(data),
+          &left, &left_height, &right, &right_height);
+    object->root = left;
+    object->count = count_of(left);
+    out->root = right;
+    out->count = count_of(right);
+}
+
+bool seahorse_red_black_tree_precedes(
+        const struct seahorse_red_black_tree *const object,
+        const struct seahorse_red_black_tree *const other) {
+    assert(object);
+    assert(other);
+    const void *const last = seahorse_red_black_tree_last(object);
+    const void *const first = seahorse_red_black_tree_first(other);
+    return !last || !first || object->compare(last, first) < 0;
+}
+
+bool seahorse_red_black_tree_join(
+        struct seahorse_red_black_tree *const object,
+        struct seahorse_red_black_tree *const other) {
+    assert(object);
+    assert(other);
+    assert(object->size == other->size);
+    struct node *right = other->root;
+    if (!right) {
+        return true;
+    }
+    if (object->pool != other->pool) {
+        const uintmax_t count = count_of(right);
+        struct node *chain;
+        if (!allocate_chain(object, count, &chain)) {
+            return false;
+        }
+        struct node *node = chain;
+        const void *data = seahorse_red_black_tree_first(other);
+        for (; data; data = seahorse_red_black_tree_next(data)) {
+            memcpy(node->data, data, object->size);
+            node = node->right;
+        }
+        destroy(other, right, NULL);
+        right = assemble_all(chain, count);
+    }
+    object->root = concatenate(object->root, right);
+    object->count = count_of(object->root);
+    other->root = NULL;
+    other->count = 0;
+    return true;
+}
+
+#ifdef TEST
+/*
+ * Black height of the subtree rooted at node, or UINTMAX_MAX if a red node
+ * has a red parent, a parent link or subtree count is wrong or the black
+ * heights of the two children differ.
+ */
+static uintmax_t verify(const struct node *const node,
+                        const struct node *const parent) {
+    if (!node) {
+        return 0;
+    }
+    if (parent != node->parent
+        || (node->red && parent && parent->red)
+        || 1 + count_of(node->left) + count_of(node->right) != node->count) {
+        return UINTMAX_MAX;
+    }
+    const uintmax_t height = verify(node->left, node);
+    if (UINTMAX_MAX == height || height != verify(node->right, node)) {
+        return UINTMAX_MAX;
+    }
+    return height + !node->red;
+}
+
+bool seahorse_red_black_tree_is_valid(
+        const struct seahorse_red_black_tree *const object) {
+    assert(object);
+    const struct node *const root = object->root;
+    return is_black(root)
+           && count_of(root) == object->count
+           && UINTMAX_MAX != verify(root, NULL);
+}
+#endif
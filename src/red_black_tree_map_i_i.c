@@ -3,13 +3,15 @@
 #include <seagrass.h>
 #include <sea-turtle.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
 struct seahorse_red_black_tree_map_i_i_entry {
-    void *data;
+    struct sea_turtle_integer key;
+    struct sea_turtle_integer value;
 };
 
 static int compare(const void *const a, const void *const b) {
@@ -18,14 +20,15 @@ static int compare(const void *const a, const void *const b) {
     return sea_turtle_integer_compare(A, B);
 }
 
-static void init(struct seahorse_red_black_tree_map_i_i *const object) {
+static void init(struct seahorse_red_black_tree_map_i_i *const object,
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     *object = (struct seahorse_red_black_tree_map_i_i) {0};
-    seagrass_required_true(coral_red_black_tree_map_init(
-            &object->map,
-            sizeof(struct sea_turtle_integer),
-            sizeof(struct sea_turtle_integer),
-            compare));
+    seahorse_red_black_tree_init(
+            &object->tree,
+            sizeof(struct seahorse_red_black_tree_map_i_i_entry),
+            compare,
+            pool);
 }
 
 bool seahorse_red_black_tree_map_i_i_init(
@@ -34,19 +37,34 @@ bool seahorse_red_black_tree_map_i_i_init(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
     return true;
 }
 
-static void on_destroy(void *key, void *value) {
-    seagrass_required_true(sea_turtle_integer_invalidate(key));
-    seagrass_required_true(sea_turtle_integer_invalidate(value));
+bool seahorse_red_black_tree_map_i_i_init_pool(
+        struct seahorse_red_black_tree_map_i_i *const object,
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, pool);
+    return true;
+}
+
+static void on_destroy(void *const data) {
+    struct seahorse_red_black_tree_map_i_i_entry *const entry = data;
+    seagrass_required_true(sea_turtle_integer_invalidate(&entry->key));
+    seagrass_required_true(sea_turtle_integer_invalidate(&entry->value));
 }
 
 static void invalidate(struct seahorse_red_black_tree_map_i_i *const object) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_map_invalidate(
-            &object->map, on_destroy));
+    seahorse_red_black_tree_invalidate(&object->tree, on_destroy);
     *object = (struct seahorse_red_black_tree_map_i_i) {0};
 }
 
@@ -60,6 +78,24 @@ bool seahorse_red_black_tree_map_i_i_invalidate(
     return true;
 }
 
+/*
+ * Fill the entry of the next node with a copy of the entry at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const struct seahorse_red_black_tree_map_i_i_entry **const cursor = context;
+    struct seahorse_red_black_tree_map_i_i_entry *const entry = data;
+    *entry = (struct seahorse_red_black_tree_map_i_i_entry) {0};
+    if (!sea_turtle_integer_init_integer(&entry->key, &(*cursor)->key)
+        || !sea_turtle_integer_init_integer(&entry->value,
+                                            &(*cursor)->value)) {
+        on_destroy(entry);
+        return false;
+    }
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_map_i_i_init_red_black_tree_map_i_i(
         struct seahorse_red_black_tree_map_i_i *const object,
         const struct seahorse_red_black_tree_map_i_i *const other) {
@@ -71,32 +107,16 @@ bool seahorse_red_black_tree_map_i_i_init_red_black_tree_map_i_i(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object);
-    const struct seahorse_red_black_tree_map_i_i_entry *entry;
-    if (!seahorse_red_black_tree_map_i_i_first_entry(other, &entry)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MAP_IS_EMPTY
-                == seahorse_error);
-        return true;
-    }
-    do {
-        const struct sea_turtle_integer *key;
-        seagrass_required_true(seahorse_red_black_tree_map_i_i_entry_key(
-                other, entry, &key));
-        struct sea_turtle_integer *value;
-        seagrass_required_true(seahorse_red_black_tree_map_i_i_entry_value(
-                other, entry, &value));
-        if (!seahorse_red_black_tree_map_i_i_add(object, key, value)) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object);
-            return false;
-        }
-    } while (seahorse_red_black_tree_map_i_i_next_entry(entry, &entry));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
+    init(object, other->tree.pool);
+    const struct seahorse_red_black_tree_map_i_i_entry *cursor
+            = seahorse_red_black_tree_first(&other->tree);
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, on_destroy, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
     return true;
 }
 
@@ -111,8 +131,47 @@ bool seahorse_red_black_tree_map_i_i_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_count(
-            &object->map, out));
+    *out = object->tree.count;
+    return true;
+}
+
+/*
+ * Add key and value or, if key is already present, retrieve its entry, with
+ * a single descent of the tree.
+ */
+static bool insert(
+        struct seahorse_red_black_tree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct sea_turtle_integer *const value,
+        const struct seahorse_red_black_tree_map_i_i_entry **const out) {
+    assert(object);
+    assert(out);
+    struct seahorse_red_black_tree_position position;
+    const struct seahorse_red_black_tree_map_i_i_entry *const match
+            = seahorse_red_black_tree_locate(&object->tree, key, &position);
+    if (match) {
+        *out = match;
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    struct seahorse_red_black_tree_map_i_i_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    *entry = (struct seahorse_red_black_tree_map_i_i_entry) {0};
+    if (!sea_turtle_integer_init_integer(&entry->key, key)
+        || !sea_turtle_integer_init_integer(&entry->value, value)) {
+        on_destroy(entry);
+        seahorse_red_black_tree_free(&object->tree, entry);
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *out = entry;
     return true;
 }
 
@@ -132,39 +191,68 @@ bool seahorse_red_black_tree_map_i_i_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_VALUE_IS_NULL;
         return false;
     }
-    bool result;
-    if (!coral_red_black_tree_map_contains(&object->map, key, &result)) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+    const struct seahorse_red_black_tree_map_i_i_entry *entry;
+    return insert(object, key, value, &entry);
+}
+
+bool seahorse_red_black_tree_map_i_i_try_add(
+        struct seahorse_red_black_tree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        const struct sea_turtle_integer *const value,
+        const struct seahorse_red_black_tree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL;
         return false;
     }
-    if (result) {
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    return insert(object, key, value, out);
+}
+
+bool seahorse_red_black_tree_map_i_i_add_take(
+        struct seahorse_red_black_tree_map_i_i *const object,
+        struct sea_turtle_integer *const key,
+        struct sea_turtle_integer *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, key, &position)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS;
         return false;
     }
-    struct {
-        struct sea_turtle_integer key;
-        struct sea_turtle_integer value;
-    } copy = {};
-    seagrass_required_true(sea_turtle_integer_init_integer(
-            &copy.key, key));
-    seagrass_required_true(sea_turtle_integer_init_integer(
-            &copy.value, value));
-    result = coral_red_black_tree_map_add(&object->map, &copy.key, &copy.value);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seagrass_required_true(sea_turtle_integer_invalidate(&copy.key));
-        seagrass_required_true(sea_turtle_integer_invalidate(&copy.value));
+    struct seahorse_red_black_tree_map_i_i_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
     }
-    return result;
+    entry->key = *key;
+    entry->value = *value;
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *key = (struct sea_turtle_integer) {0};
+    *value = (struct sea_turtle_integer) {0};
+    return true;
 }
 
 bool seahorse_red_black_tree_map_i_i_remove(
@@ -178,37 +266,15 @@ bool seahorse_red_black_tree_map_i_i_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL;
         return false;
     }
-    const struct coral_red_black_tree_map_entry *entry;
-    if (!coral_red_black_tree_map_get_entry(&object->map, key,
-                                            &entry)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_i_i_entry *const entry
+            = seahorse_red_black_tree_get(
+            &object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
         return false;
     }
-    struct {
-        struct sea_turtle_integer *key;
-        struct sea_turtle_integer *value;
-    } e;
-    seagrass_required_true(coral_red_black_tree_map_entry_key(
-            &object->map, entry, (const void **) &e.key));
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map, entry, (const void **) &e.value));
-    on_destroy(e.key, e.value);
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map, entry));
+    on_destroy(entry);
+    seahorse_red_black_tree_remove(&object->tree, entry);
     return true;
 }
 
@@ -228,25 +294,17 @@ bool seahorse_red_black_tree_map_i_i_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_contains(&object->map, key,
-                                                          out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
-    }
-    return result;
+    *out = seahorse_red_black_tree_get(&object->tree, key, compare);
+    return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         struct sea_turtle_integer **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const void **const out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
@@ -260,67 +318,55 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, key, (const void **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_i_i_entry *const entry
+            = func(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = &entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_i_i_get(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         struct sea_turtle_integer **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_get);
+    return retrieve(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_i_i_ceiling(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         struct sea_turtle_integer **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_ceiling);
+    return retrieve(object, key, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_i_i_floor(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         struct sea_turtle_integer **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_floor);
+    return retrieve(object, key, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_i_i_higher(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         struct sea_turtle_integer **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_higher);
+    return retrieve(object, key, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_i_i_lower(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         struct sea_turtle_integer **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_lower);
+    return retrieve(object, key, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_map_i_i *const object,
         struct sea_turtle_integer **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
@@ -330,34 +376,35 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, (const void **) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    struct seahorse_red_black_tree_map_i_i_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = &entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_i_i_first(
         const struct seahorse_red_black_tree_map_i_i *const object,
         struct sea_turtle_integer **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_i_i_last(
         const struct seahorse_red_black_tree_map_i_i *const object,
         struct sea_turtle_integer **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 static bool retrieve_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         const struct seahorse_red_black_tree_map_i_i_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
@@ -371,72 +418,55 @@ static bool retrieve_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, key,
-                             (const struct coral_red_black_tree_map_entry **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_i_i_entry *const entry
+            = func(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_i_i_get_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry(object, key, out, coral_red_black_tree_map_get_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_i_i_ceiling_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_ceiling_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_i_i_floor_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_floor_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_i_i_higher_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_higher_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_i_i_lower_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct sea_turtle_integer *const key,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_lower_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_entry_fl(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct seahorse_red_black_tree_map_i_i_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
@@ -446,27 +476,26 @@ static bool retrieve_entry_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry **const) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_i_i_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_i_i_first_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_first_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_i_i_last_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_last_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_map_i_i_remove_entry(
@@ -480,26 +509,15 @@ bool seahorse_red_black_tree_map_i_i_remove_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    struct {
-        struct sea_turtle_integer *key;
-        struct sea_turtle_integer *value;
-    } e;
-    seagrass_required_true(seahorse_red_black_tree_map_i_i_entry_key(
-            object, entry, (const struct sea_turtle_integer **) &e.key));
-    seagrass_required_true(seahorse_red_black_tree_map_i_i_entry_value(
-            object, entry, (struct sea_turtle_integer **) &e.value));
-    on_destroy(e.key, e.value);
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry));
+    on_destroy((void *) entry);
+    seahorse_red_black_tree_remove(&object->tree, (void *) entry);
     return true;
 }
 
 static bool retrieve_entry_np(
         const struct seahorse_red_black_tree_map_i_i_entry *const entry,
         const struct seahorse_red_black_tree_map_i_i_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map_entry *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const void *)) {
     assert(func);
     if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_ENTRY_IS_NULL;
@@ -509,38 +527,32 @@ static bool retrieve_entry_np(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const struct coral_red_black_tree_map_entry **) out);
+    const struct seahorse_red_black_tree_map_i_i_entry *const result
+            = func(entry);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_END_OF_SEQUENCE
-                               == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_END_OF_SEQUENCE;
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_i_i_next_entry(
         const struct seahorse_red_black_tree_map_i_i_entry *const entry,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_next_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_map_i_i_prev_entry(
         const struct seahorse_red_black_tree_map_i_i_entry *const entry,
         const struct seahorse_red_black_tree_map_i_i_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_prev_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_prev);
 }
 
-static bool entry_retrieve(
+static bool check_entry(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct seahorse_red_black_tree_map_i_i_entry *const entry,
-        const struct sea_turtle_integer **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry *const,
-                           const void **const)) {
-    assert(func);
+        const void *const out) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
         return false;
@@ -553,10 +565,6 @@ static bool entry_retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **) out));
     return true;
 }
 
@@ -564,15 +572,209 @@ bool seahorse_red_black_tree_map_i_i_entry_key(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct seahorse_red_black_tree_map_i_i_entry *const entry,
         const struct sea_turtle_integer **const out) {
-    return entry_retrieve(object, entry, out,
-                          coral_red_black_tree_map_entry_key);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    *out = &entry->key;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_i_i_entry_value(
         const struct seahorse_red_black_tree_map_i_i *const object,
         const struct seahorse_red_black_tree_map_i_i_entry *const entry,
         struct sea_turtle_integer **const out) {
-    return entry_retrieve(object, entry,
-                          (const struct sea_turtle_integer **) out,
-                          coral_red_black_tree_map_entry_get_value);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    *out = (struct sea_turtle_integer *) &entry->value;
+    return true;
+}
+
+/*
+ * Retrieve the first and last entries of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_map_i_i *const object,
+        const struct sea_turtle_integer *const low,
+        const struct sea_turtle_integer *const high,
+        const struct seahorse_red_black_tree_map_i_i_entry **const first,
+        const struct seahorse_red_black_tree_map_i_i_entry **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_map_i_i_ceiling_entry(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_map_i_i_floor_entry(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_i_i_remove_range(
+        struct seahorse_red_black_tree_map_i_i *const object,
+        const struct sea_turtle_integer *const low,
+        const struct sea_turtle_integer *const high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_i_i_entry *first;
+    const struct seahorse_red_black_tree_map_i_i_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             on_destroy);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_i_i_count_range(
+        const struct seahorse_red_black_tree_map_i_i *const object,
+        const struct sea_turtle_integer *const low,
+        const struct sea_turtle_integer *const high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_i_i_entry *first;
+    const struct seahorse_red_black_tree_map_i_i_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_i_i_at_rank(
+        const struct seahorse_red_black_tree_map_i_i *const object,
+        const uintmax_t rank,
+        const struct seahorse_red_black_tree_map_i_i_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (rank >= object->tree.count) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_RANK_IS_OUT_OF_BOUNDS;
+        return false;
+    }
+    *out = seahorse_red_black_tree_at(&object->tree, rank);
+    return true;
+}
+
+bool seahorse_red_black_tree_map_i_i_rank_of(
+        const struct seahorse_red_black_tree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_i_i_entry *const entry
+            = seahorse_red_black_tree_ceiling(&object->tree, key, compare);
+    *out = entry
+           ? seahorse_red_black_tree_index(entry)
+           : object->tree.count;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_i_i_split_at(
+        struct seahorse_red_black_tree_map_i_i *const object,
+        const struct sea_turtle_integer *const key,
+        struct seahorse_red_black_tree_map_i_i *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.pool);
+    const struct seahorse_red_black_tree_map_i_i_entry *entry;
+    if (!seahorse_red_black_tree_map_i_i_ceiling_entry(object, key, &entry)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        entry = NULL;
+    }
+    if (entry) {
+        seahorse_red_black_tree_split(&object->tree, entry, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_i_i_join(
+        struct seahorse_red_black_tree_map_i_i *const object,
+        struct seahorse_red_black_tree_map_i_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEYS_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
 }
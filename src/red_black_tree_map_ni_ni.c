@@ -2,13 +2,15 @@
 #include <assert.h>
 #include <seagrass.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
 
 #ifdef TESTß
 #include <test/cmocka.h>
 #endif
 
 struct seahorse_red_black_tree_map_ni_ni_entry {
-    void *data;
+    uintmax_t key;
+    uintmax_t value;
 };
 
 static int compare(const void *const a, const void *const b) {
@@ -16,14 +18,15 @@ static int compare(const void *const a, const void *const b) {
                                       *(uintmax_t *) b);
 }
 
-static void init(struct seahorse_red_black_tree_map_ni_ni *const object) {
+static void init(struct seahorse_red_black_tree_map_ni_ni *const object,
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     *object = (struct seahorse_red_black_tree_map_ni_ni) {0};
-    seagrass_required_true(coral_red_black_tree_map_init(
-            &object->map,
-            sizeof(uintmax_t),
-            sizeof(uintmax_t),
-            compare));
+    seahorse_red_black_tree_init(
+            &object->tree,
+            sizeof(struct seahorse_red_black_tree_map_ni_ni_entry),
+            compare,
+            pool);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_init(
@@ -32,14 +35,28 @@ bool seahorse_red_black_tree_map_ni_ni_init(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
+    return true;
+}
+
+bool seahorse_red_black_tree_map_ni_ni_init_pool(
+        struct seahorse_red_black_tree_map_ni_ni *const object,
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, pool);
     return true;
 }
 
 static void invalidate(struct seahorse_red_black_tree_map_ni_ni *const object) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_map_invalidate(
-            &object->map, NULL));
+    seahorse_red_black_tree_invalidate(&object->tree, NULL);
     *object = (struct seahorse_red_black_tree_map_ni_ni) {0};
 }
 
@@ -53,6 +70,18 @@ bool seahorse_red_black_tree_map_ni_ni_invalidate(
     return true;
 }
 
+/*
+ * Fill the entry of the next node with a copy of the entry at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const struct seahorse_red_black_tree_map_ni_ni_entry **const cursor
+            = context;
+    *(struct seahorse_red_black_tree_map_ni_ni_entry *) data = **cursor;
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_map_ni_ni_init_red_black_tree_map_ni_ni(
         struct seahorse_red_black_tree_map_ni_ni *const object,
         const struct seahorse_red_black_tree_map_ni_ni *const other) {
@@ -64,33 +93,79 @@ bool seahorse_red_black_tree_map_ni_ni_init_red_black_tree_map_ni_ni(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object);
-    const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
-    if (!seahorse_red_black_tree_map_ni_ni_first_entry(other, &entry)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY
-                == seahorse_error);
-        return true;
-    }
-    do {
-        const uintmax_t *key;
-        seagrass_required_true(seahorse_red_black_tree_map_ni_ni_entry_key(
-                other, entry, &key));
-        const uintmax_t *value;
-        seagrass_required_true(
-                seahorse_red_black_tree_map_ni_ni_entry_get_value(
-                        other, entry, &value));
-        if (!seahorse_red_black_tree_map_ni_ni_add(object, *key, *value)) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object);
+    init(object, other->tree.pool);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *cursor
+            = seahorse_red_black_tree_first(&other->tree);
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, NULL, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Sorted keys, and their values, that are yet to be filled into nodes.
+ */
+struct run {
+    const uintmax_t *keys;
+    const uintmax_t *values;
+};
+
+/*
+ * Fill the entry of the next node with the first key and value of the run
+ * and advance the run past them.
+ */
+static bool fill(void *const data, void *const context) {
+    struct run *const run = context;
+    struct seahorse_red_black_tree_map_ni_ni_entry *const entry = data;
+    entry->key = *run->keys++;
+    entry->value = *run->values++;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_ni_ni_init_sorted(
+        struct seahorse_red_black_tree_map_ni_ni *const object,
+        const uintmax_t count,
+        const uintmax_t *const keys,
+        const uintmax_t *const values) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!keys) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEYS_IS_NULL;
+        return false;
+    }
+    if (!values) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_VALUES_IS_NULL;
+        return false;
+    }
+    for (uintmax_t i = 1; i < count; i++) {
+        if (keys[i - 1] >= keys[i]) {
+            seahorse_error =
+                    SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEYS_ARE_NOT_SORTED;
             return false;
         }
-    } while (seahorse_red_black_tree_map_ni_ni_next_entry(entry, &entry));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
+    }
+    init(object, NULL);
+    struct run run = {
+            .keys = keys,
+            .values = values
+    };
+    if (!seahorse_red_black_tree_build(&object->tree, count, fill, NULL,
+                                       &run)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
     return true;
 }
 
@@ -105,8 +180,40 @@ bool seahorse_red_black_tree_map_ni_ni_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_count(
-            &object->map, out));
+    *out = object->tree.count;
+    return true;
+}
+
+/*
+ * Add key and value or, if key is already present, retrieve its entry, with
+ * a single descent of the tree.
+ */
+static bool insert(
+        struct seahorse_red_black_tree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value,
+        const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
+    assert(object);
+    assert(out);
+    struct seahorse_red_black_tree_position position;
+    const struct seahorse_red_black_tree_map_ni_ni_entry *const match
+            = seahorse_red_black_tree_locate(&object->tree, &key, &position);
+    if (match) {
+        *out = match;
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    struct seahorse_red_black_tree_map_ni_ni_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    entry->key = key;
+    entry->value = value;
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *out = entry;
     return true;
 }
 
@@ -118,26 +225,24 @@ bool seahorse_red_black_tree_map_ni_ni_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_add(&object->map, &key,
-                                                     &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_ALREADY_EXISTS: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
+    return insert(object, key, value, &entry);
+}
+
+bool seahorse_red_black_tree_map_ni_ni_try_add(
+        struct seahorse_red_black_tree_map_ni_ni *const object,
+        const uintmax_t key,
+        const uintmax_t value,
+        const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
     }
-    return result;
+    return insert(object, key, value, out);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_remove(
@@ -147,25 +252,14 @@ bool seahorse_red_black_tree_map_ni_ni_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_remove(&object->map, &key);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    void *const entry = seahorse_red_black_tree_get(&object->tree, &key,
+                                                    compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    seahorse_red_black_tree_remove(&object->tree, entry);
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_contains(
@@ -180,16 +274,8 @@ bool seahorse_red_black_tree_map_ni_ni_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_contains(&object->map, &key,
-                                                          out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-    }
-    return result;
+    *out = seahorse_red_black_tree_get(&object->tree, &key, compare);
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_set(
@@ -200,35 +286,23 @@ bool seahorse_red_black_tree_map_ni_ni_set(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_set(&object->map, &key,
-                                                     &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_ni_ni_entry *const entry
+            = seahorse_red_black_tree_get(&object->tree, &key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    entry->value = value;
+    return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const uintmax_t **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const void **const out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
@@ -238,67 +312,55 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, &key, (const void **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_ni_ni_entry *const entry
+            = func(&object->tree, &key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = &entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_get(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const uintmax_t **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_get);
+    return retrieve(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_ceiling(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const uintmax_t **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_ceiling);
+    return retrieve(object, key, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_floor(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const uintmax_t **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_floor);
+    return retrieve(object, key, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_higher(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const uintmax_t **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_higher);
+    return retrieve(object, key, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_lower(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const uintmax_t **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_lower);
+    return retrieve(object, key, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
@@ -308,34 +370,35 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, (const void **) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = &entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_first(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_last(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 static bool retrieve_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
@@ -345,72 +408,55 @@ static bool retrieve_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, &key,
-                             (const struct coral_red_black_tree_map_entry **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_ni_ni_entry *const entry
+            = func(&object->tree, &key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_get_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry(object, key, out, coral_red_black_tree_map_get_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_ceiling_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_ceiling_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_floor_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_floor_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_higher_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_higher_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_lower_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const uintmax_t key,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_lower_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_entry_fl(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
@@ -420,27 +466,26 @@ static bool retrieve_entry_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry **const) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_first_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_first_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_last_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_last_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_remove_entry(
@@ -454,17 +499,14 @@ bool seahorse_red_black_tree_map_ni_ni_remove_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry));
+    seahorse_red_black_tree_remove(&object->tree, (void *) entry);
     return true;
 }
 
 static bool retrieve_entry_np(
         const struct seahorse_red_black_tree_map_ni_ni_entry *const entry,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map_entry *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const void *)) {
     assert(func);
     if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
@@ -474,38 +516,33 @@ static bool retrieve_entry_np(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const struct coral_red_black_tree_map_entry **) out);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *const result
+            = func(entry);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_END_OF_SEQUENCE
-                               == coral_error);
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_next_entry(
         const struct seahorse_red_black_tree_map_ni_ni_entry *const entry,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_next_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_map_ni_ni_prev_entry(
         const struct seahorse_red_black_tree_map_ni_ni_entry *const entry,
         const struct seahorse_red_black_tree_map_ni_ni_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_prev_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_prev);
 }
 
-static bool entry_retrieve(
+static bool check_entry(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const struct seahorse_red_black_tree_map_ni_ni_entry *const entry,
-        const uintmax_t **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry *const,
-                           const void **const)) {
-    assert(func);
+        const uintmax_t **const out) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
         return false;
@@ -518,10 +555,6 @@ static bool entry_retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **) out));
     return true;
 }
 
@@ -529,16 +562,22 @@ bool seahorse_red_black_tree_map_ni_ni_entry_key(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const struct seahorse_red_black_tree_map_ni_ni_entry *const entry,
         const uintmax_t **const out) {
-    return entry_retrieve(object, entry, out,
-                          coral_red_black_tree_map_entry_key);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    *out = &entry->key;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_entry_get_value(
         const struct seahorse_red_black_tree_map_ni_ni *const object,
         const struct seahorse_red_black_tree_map_ni_ni_entry *const entry,
         const uintmax_t **const out) {
-    return entry_retrieve(object, entry, out,
-                          coral_red_black_tree_map_entry_get_value);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    *out = &entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_ni_ni_entry_set_value(
@@ -553,9 +592,138 @@ bool seahorse_red_black_tree_map_ni_ni_entry_set_value(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_entry_set_value(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            &value));
+    ((struct seahorse_red_black_tree_map_ni_ni_entry *) entry)->value = value;
+    return true;
+}
+
+/*
+ * Retrieve the first and last entries of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_map_ni_ni *const object,
+        const uintmax_t low,
+        const uintmax_t high,
+        const struct seahorse_red_black_tree_map_ni_ni_entry **const first,
+        const struct seahorse_red_black_tree_map_ni_ni_entry **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_map_ni_ni_ceiling_entry(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_map_ni_ni_floor_entry(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_ni_ni_remove_range(
+        struct seahorse_red_black_tree_map_ni_ni *const object,
+        const uintmax_t low,
+        const uintmax_t high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_ni_ni_entry *first;
+    const struct seahorse_red_black_tree_map_ni_ni_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             NULL);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_ni_ni_count_range(
+        const struct seahorse_red_black_tree_map_ni_ni *const object,
+        const uintmax_t low,
+        const uintmax_t high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_ni_ni_entry *first;
+    const struct seahorse_red_black_tree_map_ni_ni_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_ni_ni_split_at(
+        struct seahorse_red_black_tree_map_ni_ni *const object,
+        const uintmax_t key,
+        struct seahorse_red_black_tree_map_ni_ni *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.pool);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
+    if (!seahorse_red_black_tree_map_ni_ni_ceiling_entry(object, key, &entry)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        entry = NULL;
+    }
+    if (entry) {
+        seahorse_red_black_tree_split(&object->tree, entry, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_ni_ni_join(
+        struct seahorse_red_black_tree_map_ni_ni *const object,
+        struct seahorse_red_black_tree_map_ni_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEYS_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
     return true;
 }
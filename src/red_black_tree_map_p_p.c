@@ -2,26 +2,29 @@
 #include <assert.h>
 #include <seagrass.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
 struct seahorse_red_black_tree_map_p_p_entry {
-    void *data;
+    void *key;
+    void *value;
 };
 
 static void init(struct seahorse_red_black_tree_map_p_p *const object,
                  int (*const compare)(const void *first,
-                                      const void *second)) {
+                                      const void *second),
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     assert(compare);
     *object = (struct seahorse_red_black_tree_map_p_p) {0};
-    seagrass_required_true(coral_red_black_tree_map_init(
-            &object->map,
-            sizeof(void *),
-            sizeof(void *),
-            compare));
+    seahorse_red_black_tree_init(
+            &object->tree,
+            sizeof(struct seahorse_red_black_tree_map_p_p_entry),
+            compare,
+            pool);
 }
 
 bool seahorse_red_black_tree_map_p_p_init(
@@ -36,16 +39,47 @@ bool seahorse_red_black_tree_map_p_p_init(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_COMPARE_IS_NULL;
         return false;
     }
-    init(object, compare);
+    init(object, compare, NULL);
     return true;
 }
 
+bool seahorse_red_black_tree_map_p_p_init_pool(
+        struct seahorse_red_black_tree_map_p_p *const object,
+        int (*const compare)(const void *first,
+                             const void *second),
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!compare) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_COMPARE_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, compare, pool);
+    return true;
+}
+
+static _Thread_local void (*on_destroy_callback)(void *key, void *value);
+
+static void on_destroy_entity(void *const data) {
+    if (!on_destroy_callback) {
+        return;
+    }
+    struct seahorse_red_black_tree_map_p_p_entry *const entry = data;
+    on_destroy_callback(&entry->key, &entry->value);
+}
+
 static void invalidate(struct seahorse_red_black_tree_map_p_p *const object,
                        void (*const on_destroy)(void *key,
                                                 void *value)) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_map_invalidate(
-            &object->map, on_destroy));
+    on_destroy_callback = on_destroy;
+    seahorse_red_black_tree_invalidate(&object->tree, on_destroy_entity);
     *object = (struct seahorse_red_black_tree_map_p_p) {0};
 }
 
@@ -62,6 +96,17 @@ bool seahorse_red_black_tree_map_p_p_invalidate(
     return true;
 }
 
+/*
+ * Fill the entry of the next node with a copy of the entry at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const struct seahorse_red_black_tree_map_p_p_entry **const cursor = context;
+    *(struct seahorse_red_black_tree_map_p_p_entry *) data = **cursor;
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_map_p_p_init_red_black_tree_map_p_p(
         struct seahorse_red_black_tree_map_p_p *const object,
         const struct seahorse_red_black_tree_map_p_p *const other) {
@@ -73,32 +118,16 @@ bool seahorse_red_black_tree_map_p_p_init_red_black_tree_map_p_p(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object, other->map.compare);
-    const struct seahorse_red_black_tree_map_p_p_entry *entry;
-    if (!seahorse_red_black_tree_map_p_p_first_entry(other, &entry)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MAP_IS_EMPTY
-                == seahorse_error);
-        return true;
-    }
-    do {
-        const void *key;
-        seagrass_required_true(seahorse_red_black_tree_map_p_p_entry_key(
-                other, entry, &key));
-        const void *value;
-        seagrass_required_true(seahorse_red_black_tree_map_p_p_entry_get_value(
-                other, entry, &value));
-        if (!seahorse_red_black_tree_map_p_p_add(object, key, value)) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object, NULL);
-            return false;
-        }
-    } while (seahorse_red_black_tree_map_p_p_next_entry(entry, &entry));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
+    init(object, other->tree.compare, other->tree.pool);
+    const struct seahorse_red_black_tree_map_p_p_entry *cursor
+            = seahorse_red_black_tree_first(&other->tree);
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, NULL, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object, NULL);
+        return false;
+    }
     return true;
 }
 
@@ -113,8 +142,40 @@ bool seahorse_red_black_tree_map_p_p_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_count(
-            &object->map, out));
+    *out = object->tree.count;
+    return true;
+}
+
+/*
+ * Add key and value or, if key is already present, retrieve its entry, with
+ * a single descent of the tree.
+ */
+static bool insert(
+        struct seahorse_red_black_tree_map_p_p *const object,
+        const void *const key,
+        const void *const value,
+        const struct seahorse_red_black_tree_map_p_p_entry **const out) {
+    assert(object);
+    assert(out);
+    struct seahorse_red_black_tree_position position;
+    const struct seahorse_red_black_tree_map_p_p_entry *const match
+            = seahorse_red_black_tree_locate(&object->tree, &key, &position);
+    if (match) {
+        *out = match;
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    struct seahorse_red_black_tree_map_p_p_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    entry->key = (void *) key;
+    entry->value = (void *) value;
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *out = entry;
     return true;
 }
 
@@ -126,26 +187,24 @@ bool seahorse_red_black_tree_map_p_p_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_add(&object->map, &key,
-                                                     &value);
-    if (!result) {
-        switch (coral_error) {
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_ALREADY_EXISTS: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_ALREADY_EXISTS;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-            default: {
-                seagrass_required_true(false);
-            }
-        }
+    const struct seahorse_red_black_tree_map_p_p_entry *entry;
+    return insert(object, key, value, &entry);
+}
+
+bool seahorse_red_black_tree_map_p_p_try_add(
+        struct seahorse_red_black_tree_map_p_p *const object,
+        const void *const key,
+        const void *const value,
+        const struct seahorse_red_black_tree_map_p_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
+        return false;
     }
-    return result;
+    return insert(object, key, value, out);
 }
 
 bool seahorse_red_black_tree_map_p_p_remove(
@@ -155,25 +214,14 @@ bool seahorse_red_black_tree_map_p_p_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_remove(&object->map, &key);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    void *const entry = seahorse_red_black_tree_get(
+            &object->tree, &key, object->tree.compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    seahorse_red_black_tree_remove(&object->tree, entry);
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_contains(
@@ -188,16 +236,9 @@ bool seahorse_red_black_tree_map_p_p_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_contains(&object->map, &key,
-                                                          out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
-    }
-    return result;
+    *out = seahorse_red_black_tree_get(
+            &object->tree, &key, object->tree.compare);
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_set(
@@ -208,35 +249,24 @@ bool seahorse_red_black_tree_map_p_p_set(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_set(&object->map, &key,
-                                                     &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_p_p_entry *const entry
+            = seahorse_red_black_tree_get(
+            &object->tree, &key, object->tree.compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    entry->value = (void *) value;
+    return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const void **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const void **const out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
@@ -246,70 +276,55 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const void **value;
-    const bool result = func(&object->map, &key, (const void **const) &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
-    } else {
-        *out = *value;
+    struct seahorse_red_black_tree_map_p_p_entry *const entry
+            = func(&object->tree, &key, object->tree.compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_get(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_get);
+    return retrieve(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_p_p_ceiling(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_ceiling);
+    return retrieve(object, key, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_p_p_floor(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_floor);
+    return retrieve(object, key, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_p_p_higher(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_higher);
+    return retrieve(object, key, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_p_p_lower(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_lower);
+    return retrieve(object, key, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
@@ -319,37 +334,35 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    void *value;
-    const bool result = func(&object->map, (const void **const) &value);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    struct seahorse_red_black_tree_map_p_p_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MAP_IS_EMPTY;
-    } else {
-        *out = *(void **) value;
+        return false;
     }
-    return result;
+    *out = entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_first(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_p_p_last(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 static bool retrieve_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const struct seahorse_red_black_tree_map_p_p_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
@@ -359,72 +372,55 @@ static bool retrieve_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, &key,
-                             (const struct coral_red_black_tree_map_entry **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_p_p_entry *const entry
+            = func(&object->tree, &key, object->tree.compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_get_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry(object, key, out, coral_red_black_tree_map_get_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_p_p_ceiling_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_ceiling_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_p_p_floor_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_floor_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_p_p_higher_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_higher_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_p_p_lower_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const void *const key,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_lower_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_entry_fl(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const struct seahorse_red_black_tree_map_p_p_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
@@ -434,27 +430,26 @@ static bool retrieve_entry_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry **const) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_p_p_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_first_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_first_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_p_p_last_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_last_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_map_p_p_remove_entry(
@@ -468,17 +463,14 @@ bool seahorse_red_black_tree_map_p_p_remove_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry));
+    seahorse_red_black_tree_remove(&object->tree, (void *) entry);
     return true;
 }
 
 static bool retrieve_entry_np(
         const struct seahorse_red_black_tree_map_p_p_entry *const entry,
         const struct seahorse_red_black_tree_map_p_p_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map_entry *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const void *)) {
     assert(func);
     if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_ENTRY_IS_NULL;
@@ -488,38 +480,32 @@ static bool retrieve_entry_np(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const struct coral_red_black_tree_map_entry **) out);
+    const struct seahorse_red_black_tree_map_p_p_entry *const result
+            = func(entry);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_END_OF_SEQUENCE
-                               == coral_error);
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_next_entry(
         const struct seahorse_red_black_tree_map_p_p_entry *const entry,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_next_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_map_p_p_prev_entry(
         const struct seahorse_red_black_tree_map_p_p_entry *const entry,
         const struct seahorse_red_black_tree_map_p_p_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_prev_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_prev);
 }
 
-
-static bool entry_retrieve(
+static bool check_entry(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const struct seahorse_red_black_tree_map_p_p_entry *const entry,
-        const void **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry *const,
-                           const void **const)) {
-    assert(func);
+        const void *const out) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
         return false;
@@ -532,12 +518,6 @@ static bool entry_retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const void *value;
-    seagrass_required_true(func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **const) &value));
-    *out = *(void **) value;
     return true;
 }
 
@@ -545,16 +525,22 @@ bool seahorse_red_black_tree_map_p_p_entry_key(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const struct seahorse_red_black_tree_map_p_p_entry *const entry,
         const void **const out) {
-    return entry_retrieve(object, entry, out,
-                          coral_red_black_tree_map_entry_key);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    *out = entry->key;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_entry_get_value(
         const struct seahorse_red_black_tree_map_p_p *const object,
         const struct seahorse_red_black_tree_map_p_p_entry *const entry,
         const void **const out) {
-    return entry_retrieve(object, entry, out,
-                          coral_red_black_tree_map_entry_get_value);;
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    *out = entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_p_p_entry_set_value(
@@ -569,10 +555,140 @@ bool seahorse_red_black_tree_map_p_p_entry_set_value(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_entry_set_value(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            &value));
+    struct seahorse_red_black_tree_map_p_p_entry *const node
+            = (struct seahorse_red_black_tree_map_p_p_entry *) entry;
+    node->value = (void *) value;
+    return true;
+}
+
+/*
+ * Retrieve the first and last entries of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_map_p_p *const object,
+        const void *const low,
+        const void *const high,
+        const struct seahorse_red_black_tree_map_p_p_entry **const first,
+        const struct seahorse_red_black_tree_map_p_p_entry **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_map_p_p_ceiling_entry(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_map_p_p_floor_entry(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_p_p_remove_range(
+        struct seahorse_red_black_tree_map_p_p *const object,
+        const void *const low,
+        const void *const high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_p_p_entry *first;
+    const struct seahorse_red_black_tree_map_p_p_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             NULL);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_p_p_count_range(
+        const struct seahorse_red_black_tree_map_p_p *const object,
+        const void *const low,
+        const void *const high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_p_p_entry *first;
+    const struct seahorse_red_black_tree_map_p_p_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_p_p_split_at(
+        struct seahorse_red_black_tree_map_p_p *const object,
+        const void *const key,
+        struct seahorse_red_black_tree_map_p_p *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.compare, object->tree.pool);
+    const struct seahorse_red_black_tree_map_p_p_entry *entry;
+    if (!seahorse_red_black_tree_map_p_p_ceiling_entry(object, key, &entry)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        entry = NULL;
+    }
+    if (entry) {
+        seahorse_red_black_tree_split(&object->tree, entry, &out->tree);
+    }
     return true;
 }
 
+bool seahorse_red_black_tree_map_p_p_join(
+        struct seahorse_red_black_tree_map_p_p *const object,
+        struct seahorse_red_black_tree_map_p_p *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEYS_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
@@ -3,60 +3,70 @@
 #include <seagrass.h>
 #include <sea-turtle.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
+#include "private/chars.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
 struct seahorse_red_black_tree_map_s_p_entry {
-    void *data;
+    struct sea_turtle_string key;
+    void *value;
 };
 
-static int compare(const void *const a, const void *const b) {
-    const struct sea_turtle_string *const A
-            = (const struct sea_turtle_string *) a;
-    const struct sea_turtle_string *const B
-            = (const struct sea_turtle_string *) b;
-    return sea_turtle_string_compare(A, B);
-}
-
-static void init(struct seahorse_red_black_tree_map_s_p *const object) {
+static void init(struct seahorse_red_black_tree_map_s_p *const object,
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     *object = (struct seahorse_red_black_tree_map_s_p) {0};
-    seagrass_required_true(coral_red_black_tree_map_init(
-            &object->map,
-            sizeof(struct sea_turtle_string),
-            sizeof(void *),
-            compare));
+    seahorse_red_black_tree_init(
+            &object->tree,
+            sizeof(struct seahorse_red_black_tree_map_s_p_entry),
+            seahorse_chars_compare_string,
+            pool);
 }
 
-
 bool seahorse_red_black_tree_map_s_p_init(
         struct seahorse_red_black_tree_map_s_p *const object) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_p_init_pool(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, pool);
     return true;
 }
 
 static _Thread_local void (*on_destroy_callback)(void *value);
 
-static void on_destroy_entity(void *key, void *value) {
-    seagrass_required_true(sea_turtle_string_invalidate(key));
+static void on_destroy_entity(void *const data) {
+    struct seahorse_red_black_tree_map_s_p_entry *const entry = data;
+    seagrass_required_true(sea_turtle_string_invalidate(&entry->key));
     if (!on_destroy_callback) {
         return;
     }
-    on_destroy_callback(*(void **) value);
+    on_destroy_callback(entry->value);
 }
 
 static void invalidate(struct seahorse_red_black_tree_map_s_p *const object,
                        void (*on_destroy)(void *value)) {
     assert(object);
     on_destroy_callback = on_destroy;
-    seagrass_required_true(coral_red_black_tree_map_invalidate(
-            &object->map, on_destroy_entity));
+    seahorse_red_black_tree_invalidate(&object->tree, on_destroy_entity);
     *object = (struct seahorse_red_black_tree_map_s_p) {0};
 }
 
@@ -71,6 +81,24 @@ bool seahorse_red_black_tree_map_s_p_invalidate(
     return true;
 }
 
+/*
+ * Fill the entry of the next node with a copy of the entry at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const struct seahorse_red_black_tree_map_s_p_entry **const cursor = context;
+    struct seahorse_red_black_tree_map_s_p_entry *const entry = data;
+    if (!sea_turtle_string_init_string(&entry->key, &(*cursor)->key)) {
+        seagrass_required_true(
+                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                == sea_turtle_error);
+        return false;
+    }
+    entry->value = (*cursor)->value;
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_map_s_p_init_red_black_tree_map_s_p(
         struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p *const other) {
@@ -82,32 +110,17 @@ bool seahorse_red_black_tree_map_s_p_init_red_black_tree_map_s_p(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object);
-    const struct seahorse_red_black_tree_map_s_p_entry *entry;
-    if (!seahorse_red_black_tree_map_s_p_first_entry(other, &entry)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MAP_IS_EMPTY
-                == seahorse_error);
-        return true;
-    }
-    do {
-        const struct sea_turtle_string *key;
-        seagrass_required_true(seahorse_red_black_tree_map_s_p_entry_key(
-                other, entry, &key));
-        const void *value;
-        seagrass_required_true(seahorse_red_black_tree_map_s_p_entry_get_value(
-                other, entry, &value));
-        if (!seahorse_red_black_tree_map_s_p_add(object, key, value)) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object, NULL);
-            return false;
-        }
-    } while (seahorse_red_black_tree_map_s_p_next_entry(entry, &entry));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
+    init(object, other->tree.pool);
+    const struct seahorse_red_black_tree_map_s_p_entry *cursor
+            = seahorse_red_black_tree_first(&other->tree);
+    on_destroy_callback = NULL;
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, on_destroy_entity, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object, NULL);
+        return false;
+    }
     return true;
 }
 
@@ -122,8 +135,49 @@ bool seahorse_red_black_tree_map_s_p_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_count(
-            &object->map, out));
+    *out = object->tree.count;
+    return true;
+}
+
+/*
+ * Add key and value or, if key is already present, retrieve its entry, with
+ * a single descent of the tree.
+ */
+static bool insert(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const void *const value,
+        const struct seahorse_red_black_tree_map_s_p_entry **const out) {
+    assert(object);
+    assert(out);
+    struct seahorse_red_black_tree_position position;
+    const struct seahorse_red_black_tree_map_s_p_entry *const match
+            = seahorse_red_black_tree_locate(&object->tree, key, &position);
+    if (match) {
+        *out = match;
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    struct seahorse_red_black_tree_map_s_p_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    *entry = (struct seahorse_red_black_tree_map_s_p_entry) {0};
+    if (!sea_turtle_string_init_string(&entry->key, key)) {
+        seagrass_required_true(
+                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                == sea_turtle_error);
+        seahorse_red_black_tree_free(&object->tree, entry);
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    entry->value = (void *) value;
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *out = entry;
     return true;
 }
 
@@ -139,34 +193,78 @@ bool seahorse_red_black_tree_map_s_p_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
         return false;
     }
-    bool result;
-    if (!coral_red_black_tree_map_contains(&object->map, key, &result)) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+    const struct seahorse_red_black_tree_map_s_p_entry *entry;
+    return insert(object, key, value, &entry);
+}
+
+bool seahorse_red_black_tree_map_s_p_try_add(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        const void *const value,
+        const struct seahorse_red_black_tree_map_s_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
         return false;
-    } else if (result) {
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    return insert(object, key, value, out);
+}
+
+bool seahorse_red_black_tree_map_s_p_add_take(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        struct sea_turtle_string *const key,
+        const void *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, key, &position)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS;
         return false;
     }
-    struct {
-        struct sea_turtle_string key;
-    } copy = {};
-    if (!sea_turtle_string_init_string(&copy.key, key)
-        || !coral_red_black_tree_map_add(&object->map, &copy.key, &value)) {
-        seagrass_required_true(
-                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
-                == sea_turtle_error
-                || CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                   == coral_error);
-        seagrass_required_true(sea_turtle_string_invalidate(&copy.key));
+    struct seahorse_red_black_tree_map_s_p_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
         return false;
     }
+    entry->key = *key;
+    entry->value = (void *) value;
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *key = (struct sea_turtle_string) {0};
+    return true;
+}
+
+/*
+ * Remove the entry that compares equal to key.
+ */
+static bool erase(struct seahorse_red_black_tree_map_s_p *const object,
+                  const void *const key,
+                  int (*const compare)(const void *, const void *)) {
+    assert(object);
+    assert(key);
+    assert(compare);
+    struct seahorse_red_black_tree_map_s_p_entry *const entry
+            = seahorse_red_black_tree_get(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    seagrass_required_true(sea_turtle_string_invalidate(&entry->key));
+    seahorse_red_black_tree_remove(&object->tree, entry);
     return true;
 }
 
@@ -181,33 +279,26 @@ bool seahorse_red_black_tree_map_s_p_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
         return false;
     }
-    const struct coral_red_black_tree_map_entry *entry;
-    if (!coral_red_black_tree_map_get_entry(&object->map, key,
-                                            &entry)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    return erase(object, key, seahorse_chars_compare_string);
+}
+
+bool seahorse_red_black_tree_map_s_p_remove_chars(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        const char *const key,
+        const size_t size) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    struct sea_turtle_string *k;
-    seagrass_required_true(coral_red_black_tree_map_entry_key(
-            &object->map, entry, (const void **) &k));
-    seagrass_required_true(sea_turtle_string_invalidate(k));
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map, entry));
-    return true;
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return erase(object, &chars, seahorse_chars_compare);
 }
 
 bool seahorse_red_black_tree_map_s_p_contains(
@@ -226,16 +317,35 @@ bool seahorse_red_black_tree_map_s_p_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_contains(&object->map, key,
-                                                          out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+    *out = seahorse_red_black_tree_get(
+            &object->tree, key, seahorse_chars_compare_string);
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_p_contains_chars(
+        const struct seahorse_red_black_tree_map_s_p *const object,
+        const char *const key,
+        const size_t size,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
     }
-    return result;
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    *out = seahorse_red_black_tree_get(
+            &object->tree, &chars, seahorse_chars_compare);
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_set(
@@ -250,35 +360,25 @@ bool seahorse_red_black_tree_map_s_p_set(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_set(&object->map, key,
-                                                     &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_s_p_entry *const entry
+            = seahorse_red_black_tree_get(
+            &object->tree, key, seahorse_chars_compare_string);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    entry->value = (void *) value;
+    return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_map_s_p *const object,
-        const struct sea_turtle_string *const key,
+        const void *const key,
+        int (*const compare)(const void *, const void *),
         const void **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const void **const out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
@@ -292,70 +392,123 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const void **value;
-    const bool result = func(&object->map, key, (const void **const) &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
-    } else {
-        *out = *value;
+    struct seahorse_red_black_tree_map_s_p_entry *const entry
+            = func(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_get(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_get);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_get);
+}
+
+bool seahorse_red_black_tree_map_s_p_get_chars(
+        const struct seahorse_red_black_tree_map_s_p *const object,
+        const char *const key,
+        const size_t size,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_s_p_ceiling(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_ceiling);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_ceiling);
+}
+
+bool seahorse_red_black_tree_map_s_p_ceiling_chars(
+        const struct seahorse_red_black_tree_map_s_p *const object,
+        const char *const key,
+        const size_t size,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_s_p_floor(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_floor);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_floor);
+}
+
+bool seahorse_red_black_tree_map_s_p_floor_chars(
+        const struct seahorse_red_black_tree_map_s_p *const object,
+        const char *const key,
+        const size_t size,
+        const void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_s_p_higher(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_higher);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_s_p_lower(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const void **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_lower);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const void **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
@@ -365,37 +518,36 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    void *value;
-    const bool result = func(&object->map, (const void **const) &value);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    struct seahorse_red_black_tree_map_s_p_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MAP_IS_EMPTY;
-    } else {
-        *out = *(void **) value;
+        return false;
     }
-    return result;
+    *out = entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_first(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const void **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_s_p_last(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const void **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 static bool retrieve_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
-        const struct sea_turtle_string *const key,
+        const void *const key,
+        int (*const compare)(const void *, const void *),
         const struct seahorse_red_black_tree_map_s_p_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
@@ -409,72 +561,60 @@ static bool retrieve_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, key,
-                             (const struct coral_red_black_tree_map_entry **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_s_p_entry *const entry
+            = func(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_get_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry(object, key, out, coral_red_black_tree_map_get_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_s_p_ceiling_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_ceiling_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_s_p_floor_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_floor_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_s_p_higher_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_higher_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_s_p_lower_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_lower_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_entry_fl(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
@@ -484,27 +624,26 @@ static bool retrieve_entry_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry **const) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_s_p_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_first_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_first_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_s_p_last_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_last_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_map_s_p_remove_entry(
@@ -518,21 +657,17 @@ bool seahorse_red_black_tree_map_s_p_remove_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    struct sea_turtle_string *key;
-    seagrass_required_true(seahorse_red_black_tree_map_s_p_entry_key(
-            object, entry, (const struct sea_turtle_string **) &key));
-    seagrass_required_true(sea_turtle_string_invalidate(key));
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry));
+    struct seahorse_red_black_tree_map_s_p_entry *const node
+            = (struct seahorse_red_black_tree_map_s_p_entry *) entry;
+    seagrass_required_true(sea_turtle_string_invalidate(&node->key));
+    seahorse_red_black_tree_remove(&object->tree, node);
     return true;
 }
 
 static bool retrieve_entry_np(
         const struct seahorse_red_black_tree_map_s_p_entry *const entry,
         const struct seahorse_red_black_tree_map_s_p_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map_entry *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const void *)) {
     assert(func);
     if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_ENTRY_IS_NULL;
@@ -542,38 +677,32 @@ static bool retrieve_entry_np(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const struct coral_red_black_tree_map_entry **) out);
+    const struct seahorse_red_black_tree_map_s_p_entry *const result
+            = func(entry);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_END_OF_SEQUENCE
-                               == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_END_OF_SEQUENCE;
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_next_entry(
         const struct seahorse_red_black_tree_map_s_p_entry *const entry,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_next_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_map_s_p_prev_entry(
         const struct seahorse_red_black_tree_map_s_p_entry *const entry,
         const struct seahorse_red_black_tree_map_s_p_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_prev_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_prev);
 }
 
-static bool entry_retrieve(
+static bool check_entry(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p_entry *const entry,
-        const void **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry *const,
-                           const void **const)) {
-    assert(func);
+        const void *const out) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
         return false;
@@ -586,10 +715,6 @@ static bool entry_retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **) out));
     return true;
 }
 
@@ -597,31 +722,28 @@ bool seahorse_red_black_tree_map_s_p_entry_key(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p_entry *const entry,
         const struct sea_turtle_string **const out) {
-    return entry_retrieve(object, entry, (const void **) out,
-                          coral_red_black_tree_map_entry_key);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    *out = &entry->key;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_entry_get_value(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p_entry *const entry,
         const void **const out) {
-    if (!out) {
-        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+    if (!check_entry(object, entry, out)) {
         return false;
     }
-    const void *address;
-    const bool result = entry_retrieve(object, entry, &address,
-                                       coral_red_black_tree_map_entry_get_value);
-    if (result) {
-        *out = *(void **) address;
-    }
-    return result;
+    *out = entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_p_entry_set_value(
         const struct seahorse_red_black_tree_map_s_p *const object,
         const struct seahorse_red_black_tree_map_s_p_entry *const entry,
-        const void *value) {
+        const void *const value) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
         return false;
@@ -630,9 +752,153 @@ bool seahorse_red_black_tree_map_s_p_entry_set_value(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_entry_set_value(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            &value));
+    struct seahorse_red_black_tree_map_s_p_entry *const node
+            = (struct seahorse_red_black_tree_map_s_p_entry *) entry;
+    node->value = (void *) value;
+    return true;
+}
+
+/*
+ * Retrieve the first and last entries of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_map_s_p *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high,
+        const struct seahorse_red_black_tree_map_s_p_entry **const first,
+        const struct seahorse_red_black_tree_map_s_p_entry **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_map_s_p_ceiling_entry(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_map_s_p_floor_entry(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_p_remove_range(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_s_p_entry *first;
+    const struct seahorse_red_black_tree_map_s_p_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        on_destroy_callback = NULL;
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             on_destroy_entity);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_p_count_range(
+        const struct seahorse_red_black_tree_map_s_p *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_s_p_entry *first;
+    const struct seahorse_red_black_tree_map_s_p_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_p_split_at(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        const struct sea_turtle_string *const key,
+        struct seahorse_red_black_tree_map_s_p *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.pool);
+    const struct seahorse_red_black_tree_map_s_p_entry *entry;
+    if (!seahorse_red_black_tree_map_s_p_ceiling_entry(object, key, &entry)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        entry = NULL;
+    }
+    if (entry) {
+        seahorse_red_black_tree_split(&object->tree, entry, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_p_join(
+        struct seahorse_red_black_tree_map_s_p *const object,
+        struct seahorse_red_black_tree_map_s_p *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEYS_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
     return true;
 }
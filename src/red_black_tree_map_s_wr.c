@@ -4,31 +4,27 @@
 #include <sea-turtle.h>
 #include <triggerfish.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
+#include "private/chars.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
 struct seahorse_red_black_tree_map_s_wr_entry {
-    void *data;
+    struct sea_turtle_string key;
+    struct triggerfish_weak *value;
 };
 
-static int compare(const void *const a, const void *const b) {
-    const struct sea_turtle_string *const A
-            = (const struct sea_turtle_string *) a;
-    const struct sea_turtle_string *const B
-            = (const struct sea_turtle_string *) b;
-    return sea_turtle_string_compare(A, B);
-}
-
-static void init(struct seahorse_red_black_tree_map_s_wr *const object) {
+static void init(struct seahorse_red_black_tree_map_s_wr *const object,
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     *object = (struct seahorse_red_black_tree_map_s_wr) {0};
-    seagrass_required_true(coral_red_black_tree_map_init(
-            &object->map,
-            sizeof(struct sea_turtle_string),
-            sizeof(struct triggerfish_weak *),
-            compare));
+    seahorse_red_black_tree_init(
+            &object->tree,
+            sizeof(struct seahorse_red_black_tree_map_s_wr_entry),
+            seahorse_chars_compare_string,
+            pool);
 }
 
 bool seahorse_red_black_tree_map_s_wr_init(
@@ -37,20 +33,34 @@ bool seahorse_red_black_tree_map_s_wr_init(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_wr_init_pool(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, pool);
     return true;
 }
 
-static void on_destroy(void *const key, void *const value) {
-    seagrass_required_true(sea_turtle_string_invalidate(key));
-    struct triggerfish_weak **const V = value;
-    seagrass_required_true(triggerfish_weak_destroy(*V));
+static void on_destroy(void *const data) {
+    struct seahorse_red_black_tree_map_s_wr_entry *const entry = data;
+    seagrass_required_true(sea_turtle_string_invalidate(&entry->key));
+    seagrass_required_true(triggerfish_weak_destroy(entry->value));
 }
 
 static void invalidate(struct seahorse_red_black_tree_map_s_wr *const object) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_map_invalidate(
-            &object->map, on_destroy));
+    seahorse_red_black_tree_invalidate(&object->tree, on_destroy);
     *object = (struct seahorse_red_black_tree_map_s_wr) {0};
 }
 
@@ -64,6 +74,31 @@ bool seahorse_red_black_tree_map_s_wr_invalidate(
     return true;
 }
 
+/*
+ * Fill the entry of the next node with a copy of the entry at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const struct seahorse_red_black_tree_map_s_wr_entry **const cursor
+            = context;
+    struct seahorse_red_black_tree_map_s_wr_entry *const entry = data;
+    if (!sea_turtle_string_init_string(&entry->key, &(*cursor)->key)) {
+        seagrass_required_true(
+                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                == sea_turtle_error);
+        return false;
+    }
+    if (!triggerfish_weak_copy_of((*cursor)->value, &entry->value)) {
+        seagrass_required_true(
+                TRIGGERFISH_WEAK_ERROR_MEMORY_ALLOCATION_FAILED
+                == triggerfish_error);
+        seagrass_required_true(sea_turtle_string_invalidate(&entry->key));
+        return false;
+    }
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_map_s_wr_init_red_black_tree_map_s_wr(
         struct seahorse_red_black_tree_map_s_wr *const object,
         const struct seahorse_red_black_tree_map_s_wr *const other) {
@@ -75,32 +110,16 @@ bool seahorse_red_black_tree_map_s_wr_init_red_black_tree_map_s_wr(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object);
-    const struct seahorse_red_black_tree_map_s_wr_entry *entry;
-    if (!seahorse_red_black_tree_map_s_wr_first_entry(other, &entry)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MAP_IS_EMPTY
-                == seahorse_error);
-        return true;
-    }
-    do {
-        const struct sea_turtle_string *key;
-        seagrass_required_true(seahorse_red_black_tree_map_s_wr_entry_key(
-                other, entry, &key));
-        const struct triggerfish_weak *value;
-        seagrass_required_true(seahorse_red_black_tree_map_s_wr_entry_get_value(
-                other, entry, &value));
-        if (!seahorse_red_black_tree_map_s_wr_add(object, key, value)) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object);
-            return false;
-        }
-    } while (seahorse_red_black_tree_map_s_wr_next_entry(entry, &entry));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
+    init(object, other->tree.pool);
+    const struct seahorse_red_black_tree_map_s_wr_entry *cursor
+            = seahorse_red_black_tree_first(&other->tree);
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, on_destroy, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
     return true;
 }
 
@@ -115,8 +134,57 @@ bool seahorse_red_black_tree_map_s_wr_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_count(
-            &object->map, out));
+    *out = object->tree.count;
+    return true;
+}
+
+/*
+ * Add key and value or, if key is already present, retrieve its entry, with
+ * a single descent of the tree.
+ */
+static bool insert(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        const struct sea_turtle_string *const key,
+        const struct triggerfish_weak *const value,
+        const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
+    assert(object);
+    assert(out);
+    struct seahorse_red_black_tree_position position;
+    const struct seahorse_red_black_tree_map_s_wr_entry *const match
+            = seahorse_red_black_tree_locate(&object->tree, key, &position);
+    if (match) {
+        *out = match;
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_ALREADY_EXISTS;
+        return false;
+    }
+    struct seahorse_red_black_tree_map_s_wr_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (!sea_turtle_string_init_string(&entry->key, key)) {
+        seagrass_required_true(
+                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                == sea_turtle_error);
+        seahorse_red_black_tree_free(&object->tree, entry);
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (!triggerfish_weak_copy_of(value, &entry->value)) {
+        seagrass_required_true(
+                TRIGGERFISH_WEAK_ERROR_MEMORY_ALLOCATION_FAILED
+                == triggerfish_error);
+        seagrass_required_true(sea_turtle_string_invalidate(&entry->key));
+        seahorse_red_black_tree_free(&object->tree, entry);
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *out = entry;
     return true;
 }
 
@@ -136,48 +204,94 @@ bool seahorse_red_black_tree_map_s_wr_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_VALUE_IS_NULL;
         return false;
     }
-    bool result;
-    if (!coral_red_black_tree_map_contains(&object->map, key, &result)) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+    const struct seahorse_red_black_tree_map_s_wr_entry *entry;
+    return insert(object, key, value, &entry);
+}
+
+bool seahorse_red_black_tree_map_s_wr_try_add(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        const struct sea_turtle_string *const key,
+        const struct triggerfish_weak *const value,
+        const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
         return false;
-    } else if (result) {
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    return insert(object, key, value, out);
+}
+
+bool seahorse_red_black_tree_map_s_wr_add_take(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        struct sea_turtle_string *const key,
+        const struct triggerfish_weak *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, key, &position)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_ALREADY_EXISTS;
         return false;
     }
-    struct sea_turtle_string k;
-    if (!sea_turtle_string_init_string(&k, key)) {
-        seagrass_required_true(
-                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
-                == sea_turtle_error);
+    struct seahorse_red_black_tree_map_s_wr_entry *entry;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &entry)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
         return false;
     }
-    struct triggerfish_weak *out;
-    if (!triggerfish_weak_copy_of(value, &out)) {
-        seagrass_required_true(sea_turtle_string_invalidate(&k));
+    if (!triggerfish_weak_copy_of(value, &entry->value)) {
         seagrass_required_true(
                 TRIGGERFISH_WEAK_ERROR_MEMORY_ALLOCATION_FAILED
                 == triggerfish_error);
+        seahorse_red_black_tree_free(&object->tree, entry);
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
         return false;
     }
-    if (!coral_red_black_tree_map_add(&object->map, &k, &out)) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seagrass_required_true(sea_turtle_string_invalidate(&k));
-        seagrass_required_true(triggerfish_weak_destroy(out));
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+    entry->key = *key;
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *key = (struct sea_turtle_string) {0};
+    return true;
+}
+
+/*
+ * Remove the entry that compares equal to key.
+ */
+static bool erase(struct seahorse_red_black_tree_map_s_wr *const object,
+                  const void *const key,
+                  int (*const compare)(const void *, const void *)) {
+    assert(object);
+    assert(key);
+    assert(compare);
+    struct seahorse_red_black_tree_map_s_wr_entry *const entry
+            = seahorse_red_black_tree_get(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
         return false;
     }
+    on_destroy(entry);
+    seahorse_red_black_tree_remove(&object->tree, entry);
     return true;
 }
 
@@ -192,35 +306,26 @@ bool seahorse_red_black_tree_map_s_wr_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
         return false;
     }
-    const struct coral_red_black_tree_map_entry *entry;
-    if (!coral_red_black_tree_map_get_entry(&object->map, key, &entry)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    return erase(object, key, seahorse_chars_compare_string);
+}
+
+bool seahorse_red_black_tree_map_s_wr_remove_chars(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        const char *const key,
+        const size_t size) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    struct sea_turtle_string *k;
-    seagrass_required_true(coral_red_black_tree_map_entry_key(
-            &object->map, entry, (const void **) &k));
-    struct triggerfish_weak **v;
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map, entry, (const void **) &v));
-    on_destroy(k, v);
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map, entry));
-    return true;
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return erase(object, &chars, seahorse_chars_compare);
 }
 
 bool seahorse_red_black_tree_map_s_wr_contains(
@@ -239,16 +344,35 @@ bool seahorse_red_black_tree_map_s_wr_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_map_contains(&object->map, key,
-                                                          out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+    *out = seahorse_red_black_tree_get(
+            &object->tree, key, seahorse_chars_compare_string);
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_wr_contains_chars(
+        const struct seahorse_red_black_tree_map_s_wr *const object,
+        const char *const key,
+        const size_t size,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
     }
-    return result;
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    *out = seahorse_red_black_tree_get(
+            &object->tree, &chars, seahorse_chars_compare);
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_wr_set(
@@ -267,23 +391,11 @@ bool seahorse_red_black_tree_map_s_wr_set(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_VALUE_IS_NULL;
         return false;
     }
-    const struct coral_red_black_tree_map_entry *entry;
-    if (!coral_red_black_tree_map_get_entry(&object->map, key, &entry)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_s_wr_entry *const entry
+            = seahorse_red_black_tree_get(
+            &object->tree, key, seahorse_chars_compare_string);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
         return false;
     }
     struct triggerfish_weak *copy;
@@ -295,30 +407,19 @@ bool seahorse_red_black_tree_map_s_wr_set(
                 SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
         return false;
     }
-    struct triggerfish_weak **out;
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map, entry, (const void **) &out));
-    struct triggerfish_weak *const weak = *out;
-    if (!coral_red_black_tree_map_set(&object->map, key, &copy)) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seagrass_required_true(triggerfish_weak_destroy(copy));
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
-        return false;
-    }
-    seagrass_required_true(triggerfish_weak_destroy(weak));
+    seagrass_required_true(triggerfish_weak_destroy(entry->value));
+    entry->value = copy;
     return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_map_s_wr *const object,
-        const struct sea_turtle_string *const key,
+        const void *const key,
+        int (*const compare)(const void *, const void *),
         const struct triggerfish_weak **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const void **const out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
@@ -332,26 +433,13 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    struct triggerfish_weak **value;
-    if (!func(&object->map, key, (const void **) &value)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_s_wr_entry *const entry
+            = func(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
         return false;
     }
-    *out = *value;
+    *out = entry->value;
     return true;
 }
 
@@ -359,42 +447,109 @@ bool seahorse_red_black_tree_map_s_wr_get(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct triggerfish_weak **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_get);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_get);
+}
+
+bool seahorse_red_black_tree_map_s_wr_get_chars(
+        const struct seahorse_red_black_tree_map_s_wr *const object,
+        const char *const key,
+        const size_t size,
+        const struct triggerfish_weak **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_s_wr_ceiling(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct triggerfish_weak **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_ceiling);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_ceiling);
+}
+
+bool seahorse_red_black_tree_map_s_wr_ceiling_chars(
+        const struct seahorse_red_black_tree_map_s_wr *const object,
+        const char *const key,
+        const size_t size,
+        const struct triggerfish_weak **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_s_wr_floor(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct triggerfish_weak **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_floor);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_floor);
+}
+
+bool seahorse_red_black_tree_map_s_wr_floor_chars(
+        const struct seahorse_red_black_tree_map_s_wr *const object,
+        const char *const key,
+        const size_t size,
+        const struct triggerfish_weak **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = key,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_s_wr_higher(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct triggerfish_weak **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_higher);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_s_wr_lower(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct triggerfish_weak **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_lower);
+    return retrieve(object, key, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct triggerfish_weak **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
@@ -404,36 +559,36 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    struct triggerfish_weak **value;
-    if (!func(&object->map, (const void **) &value)) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    struct seahorse_red_black_tree_map_s_wr_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MAP_IS_EMPTY;
         return false;
     }
-    *out = *value;
+    *out = entry->value;
     return true;
 }
 
 bool seahorse_red_black_tree_map_s_wr_first(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct triggerfish_weak **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_s_wr_last(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct triggerfish_weak **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 static bool retrieve_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
-        const struct sea_turtle_string *const key,
+        const void *const key,
+        int (*const compare)(const void *, const void *),
         const struct seahorse_red_black_tree_map_s_wr_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
@@ -447,72 +602,60 @@ static bool retrieve_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->map, key,
-                             (const struct coral_red_black_tree_map_entry **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_s_wr_entry *const entry
+            = func(&object->tree, key, compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_wr_get_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry(object, key, out, coral_red_black_tree_map_get_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_s_wr_ceiling_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_ceiling_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_s_wr_floor_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_floor_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_s_wr_higher_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_higher_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_s_wr_lower_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct sea_turtle_string *const key,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_lower_entry);
+    return retrieve_entry(object, key, seahorse_chars_compare_string, out,
+                          seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_entry_fl(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
@@ -522,27 +665,26 @@ static bool retrieve_entry_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry **const) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_s_wr_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_wr_first_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_first_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_s_wr_last_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_last_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_map_s_wr_remove_entry(
@@ -556,26 +698,15 @@ bool seahorse_red_black_tree_map_s_wr_remove_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    struct sea_turtle_string *key;
-    seagrass_required_true(seahorse_red_black_tree_map_s_wr_entry_key(
-            object, entry, (const struct sea_turtle_string **) &key));
-    const struct triggerfish_weak **value;
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **) &value));
-    on_destroy(key, value);
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry));
+    on_destroy((void *) entry);
+    seahorse_red_black_tree_remove(&object->tree, (void *) entry);
     return true;
 }
 
 static bool retrieve_entry_np(
         const struct seahorse_red_black_tree_map_s_wr_entry *const entry,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map_entry *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const void *)) {
     assert(func);
     if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_ENTRY_IS_NULL;
@@ -585,34 +716,32 @@ static bool retrieve_entry_np(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const struct coral_red_black_tree_map_entry **) out);
+    const struct seahorse_red_black_tree_map_s_wr_entry *const result
+            = func(entry);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_END_OF_SEQUENCE
-                               == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_END_OF_SEQUENCE;
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_s_wr_next_entry(
         const struct seahorse_red_black_tree_map_s_wr_entry *const entry,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_next_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_map_s_wr_prev_entry(
         const struct seahorse_red_black_tree_map_s_wr_entry *const entry,
         const struct seahorse_red_black_tree_map_s_wr_entry **const out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_prev_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_prev);
 }
 
-bool seahorse_red_black_tree_map_s_wr_entry_key(
+static bool check_entry(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct seahorse_red_black_tree_map_s_wr_entry *const entry,
-        const struct sea_turtle_string **const out) {
+        const void *const out) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
         return false;
@@ -625,35 +754,28 @@ bool seahorse_red_black_tree_map_s_wr_entry_key(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_entry_key(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **) out));
     return true;
 }
 
-bool seahorse_red_black_tree_map_s_wr_entry_get_value(
+bool seahorse_red_black_tree_map_s_wr_entry_key(
         const struct seahorse_red_black_tree_map_s_wr *const object,
         const struct seahorse_red_black_tree_map_s_wr_entry *const entry,
-        const struct triggerfish_weak **const out) {
-    if (!object) {
-        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
-        return false;
-    }
-    if (!entry) {
-        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_ENTRY_IS_NULL;
+        const struct sea_turtle_string **const out) {
+    if (!check_entry(object, entry, out)) {
         return false;
     }
-    if (!out) {
-        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
+    *out = &entry->key;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_wr_entry_get_value(
+        const struct seahorse_red_black_tree_map_s_wr *const object,
+        const struct seahorse_red_black_tree_map_s_wr_entry *const entry,
+        const struct triggerfish_weak **const out) {
+    if (!check_entry(object, entry, out)) {
         return false;
     }
-    const struct triggerfish_weak **value;
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **) &value));
-    *out = *value;
+    *out = entry->value;
     return true;
 }
 
@@ -682,13 +804,153 @@ bool seahorse_red_black_tree_map_s_wr_entry_set_value(
                 SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
         return false;
     }
-    struct triggerfish_weak *out;
-    seagrass_required_true(seahorse_red_black_tree_map_s_wr_entry_get_value(
-            object, entry, (const struct triggerfish_weak **) &out));
-    seagrass_required_true(triggerfish_weak_destroy(out));
-    seagrass_required_true(coral_red_black_tree_map_entry_set_value(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            &copy));
+    struct seahorse_red_black_tree_map_s_wr_entry *const node
+            = (struct seahorse_red_black_tree_map_s_wr_entry *) entry;
+    seagrass_required_true(triggerfish_weak_destroy(node->value));
+    node->value = copy;
+    return true;
+}
+
+/*
+ * Retrieve the first and last entries of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_map_s_wr *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high,
+        const struct seahorse_red_black_tree_map_s_wr_entry **const first,
+        const struct seahorse_red_black_tree_map_s_wr_entry **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_map_s_wr_ceiling_entry(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_map_s_wr_floor_entry(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_wr_remove_range(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_s_wr_entry *first;
+    const struct seahorse_red_black_tree_map_s_wr_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             on_destroy);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_wr_count_range(
+        const struct seahorse_red_black_tree_map_s_wr *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_s_wr_entry *first;
+    const struct seahorse_red_black_tree_map_s_wr_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_wr_split_at(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        const struct sea_turtle_string *const key,
+        struct seahorse_red_black_tree_map_s_wr *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.pool);
+    const struct seahorse_red_black_tree_map_s_wr_entry *entry;
+    if (!seahorse_red_black_tree_map_s_wr_ceiling_entry(object, key, &entry)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        entry = NULL;
+    }
+    if (entry) {
+        seahorse_red_black_tree_split(&object->tree, entry, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_s_wr_join(
+        struct seahorse_red_black_tree_map_s_wr *const object,
+        struct seahorse_red_black_tree_map_s_wr *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEYS_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
     return true;
 }
@@ -3,27 +3,30 @@
 #include <seagrass.h>
 #include <triggerfish.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
 struct seahorse_red_black_tree_map_sr_sr_entry {
-    void *data;
+    struct triggerfish_strong *key;
+    struct triggerfish_strong *value;
 };
 
 static void init(
         struct seahorse_red_black_tree_map_sr_sr *const object,
         int (*const compare)(const struct triggerfish_strong **first,
-                             const struct triggerfish_strong **second)) {
+                             const struct triggerfish_strong **second),
+        struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     assert(compare);
     *object = (struct seahorse_red_black_tree_map_sr_sr) {0};
-    seagrass_required_true(coral_red_black_tree_map_init(
-            &object->map,
-            sizeof(struct triggerfish_strong *),
-            sizeof(struct triggerfish_strong *),
-            (int (*)(const void *, const void *)) compare));
+    seahorse_red_black_tree_init(
+            &object->tree,
+            sizeof(struct seahorse_red_black_tree_map_sr_sr_entry),
+            (int (*)(const void *, const void *)) compare,
+            pool);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_init(
@@ -40,24 +43,45 @@ bool seahorse_red_black_tree_map_sr_sr_init(
                 SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_COMPARE_IS_NULL;
         return false;
     }
-    init(object, compare);
+    init(object, compare, NULL);
+    return true;
+}
+
+bool seahorse_red_black_tree_map_sr_sr_init_pool(
+        struct seahorse_red_black_tree_map_sr_sr *const object,
+        int (*const compare)(const struct triggerfish_strong **first,
+                             const struct triggerfish_strong **second),
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!compare) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_COMPARE_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, compare, pool);
     return true;
 }
 
-static void on_destroy(void *k, void *v) {
-    struct triggerfish_strong *const K = *(struct triggerfish_strong **) k;
-    seagrass_required_true(triggerfish_strong_release(K));
-    struct triggerfish_strong *const V = *(struct triggerfish_strong **) v;
-    if (!V) {
+static void on_destroy(void *const data) {
+    struct seahorse_red_black_tree_map_sr_sr_entry *const entry = data;
+    seagrass_required_true(triggerfish_strong_release(entry->key));
+    if (!entry->value) {
         return;
     }
-    seagrass_required_true(triggerfish_strong_release(V));
+    seagrass_required_true(triggerfish_strong_release(entry->value));
 }
 
 static void invalidate(struct seahorse_red_black_tree_map_sr_sr *const object) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_map_invalidate(
-            &object->map, on_destroy));
+    seahorse_red_black_tree_invalidate(&object->tree, on_destroy);
     *object = (struct seahorse_red_black_tree_map_sr_sr) {0};
 }
 
@@ -72,6 +96,23 @@ bool seahorse_red_black_tree_map_sr_sr_invalidate(
     return true;
 }
 
+/*
+ * Fill the entry of the next node with a copy of the entry at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const struct seahorse_red_black_tree_map_sr_sr_entry **const cursor
+            = context;
+    struct seahorse_red_black_tree_map_sr_sr_entry *const entry = data;
+    *entry = **cursor;
+    seagrass_required_true(triggerfish_strong_retain(entry->key));
+    if (entry->value) {
+        seagrass_required_true(triggerfish_strong_retain(entry->value));
+    }
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_map_sr_sr_init_red_black_tree_map_sr_sr(
         struct seahorse_red_black_tree_map_sr_sr *const object,
         const struct seahorse_red_black_tree_map_sr_sr *const other) {
@@ -84,37 +125,17 @@ bool seahorse_red_black_tree_map_sr_sr_init_red_black_tree_map_sr_sr(
         return false;
     }
     init(object, (int (*)(const struct triggerfish_strong **,
-                          const struct triggerfish_strong **)) other->map.compare);
-    const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
-    if (!seahorse_red_black_tree_map_sr_sr_first_entry(other, &entry)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MAP_IS_EMPTY
-                == seahorse_error);
-        return true;
-    }
-    do {
-        struct triggerfish_strong *key;
-        seagrass_required_true(seahorse_red_black_tree_map_sr_sr_entry_key(
-                other, entry, &key));
-        struct triggerfish_strong *value;
-        seagrass_required_true(
-                seahorse_red_black_tree_map_sr_sr_entry_get_value(
-                        other, entry, &value));
-        const bool result = seahorse_red_black_tree_map_sr_sr_add(
-                object, key, value);
-        seagrass_required_true(triggerfish_strong_release(key));
-        seagrass_required_true(triggerfish_strong_release(value));
-        if (!result) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object);
-            return false;
-        }
-    } while (seahorse_red_black_tree_map_sr_sr_next_entry(entry, &entry));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
+                          const struct triggerfish_strong **))
+            other->tree.compare, other->tree.pool);
+    const struct seahorse_red_black_tree_map_sr_sr_entry *cursor
+            = seahorse_red_black_tree_first(&other->tree);
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, on_destroy, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
     return true;
 }
 
@@ -131,24 +152,21 @@ bool seahorse_red_black_tree_map_sr_sr_count(
                 SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_map_count(
-            &object->map, out));
+    *out = object->tree.count;
     return true;
 }
 
-bool seahorse_red_black_tree_map_sr_sr_add(
+/*
+ * Add key and value or, if key is already present, retrieve its entry, with
+ * a single descent of the tree.
+ */
+static bool insert(
         struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong *const key,
-        struct triggerfish_strong *const value) {
-    if (!object) {
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
-        return false;
-    }
-    if (!key) {
-        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL;
-        return false;
-    }
+        struct triggerfish_strong *const value,
+        const struct seahorse_red_black_tree_map_sr_sr_entry **const out) {
+    assert(object);
+    assert(out);
     if (!triggerfish_strong_retain(key)) {
         seagrass_required_true(TRIGGERFISH_STRONG_ERROR_OBJECT_IS_INVALID
                                == triggerfish_error);
@@ -163,30 +181,68 @@ bool seahorse_red_black_tree_map_sr_sr_add(
                 SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_VALUE_IS_INVALID;
         return false;
     }
-    const bool result = coral_red_black_tree_map_add(&object->map, &key,
-                                                     &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_ALREADY_EXISTS: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_ALREADY_EXISTS;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_position position;
+    struct seahorse_red_black_tree_map_sr_sr_entry *entry = NULL;
+    const struct seahorse_red_black_tree_map_sr_sr_entry *const match
+            = seahorse_red_black_tree_locate(&object->tree, &key, &position);
+    if (match) {
+        *out = match;
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_ALREADY_EXISTS;
+    } else if (!seahorse_red_black_tree_alloc(&object->tree,
+                                              (void **) &entry)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    if (!entry) {
         seagrass_required_true(triggerfish_strong_release(key));
         if (value) {
             seagrass_required_true(triggerfish_strong_release(value));
         }
+        return false;
     }
-    return result;
+    entry->key = key;
+    entry->value = value;
+    seahorse_red_black_tree_link(&object->tree, &position, entry);
+    *out = entry;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_sr_sr_add(
+        struct seahorse_red_black_tree_map_sr_sr *const object,
+        struct triggerfish_strong *const key,
+        struct triggerfish_strong *const value) {
+    if (!object) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
+    return insert(object, key, value, &entry);
+}
+
+bool seahorse_red_black_tree_map_sr_sr_try_add(
+        struct seahorse_red_black_tree_map_sr_sr *const object,
+        struct triggerfish_strong *const key,
+        struct triggerfish_strong *const value,
+        const struct seahorse_red_black_tree_map_sr_sr_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    return insert(object, key, value, out);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_remove(
@@ -207,37 +263,16 @@ bool seahorse_red_black_tree_map_sr_sr_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID;
         return false;
     }
-    const struct coral_red_black_tree_map_entry *entry;
-    if (!coral_red_black_tree_map_get_entry(&object->map, &key, &entry)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_sr_sr_entry *const entry
+            = seahorse_red_black_tree_get(
+            &object->tree, &key, object->tree.compare);
+    if (!entry) {
         seagrass_required_true(triggerfish_strong_release(key));
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
         return false;
     }
-    struct {
-        struct triggerfish_strong **key;
-        struct triggerfish_strong **value;
-    } pair;
-    seagrass_required_true(coral_red_black_tree_map_entry_key(
-            &object->map, entry, (const void **) &pair.key));
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map, entry, (const void **) &pair.value));
-    on_destroy(pair.key, pair.value);
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map, entry));
+    on_destroy(entry);
+    seahorse_red_black_tree_remove(&object->tree, entry);
     seagrass_required_true(triggerfish_strong_release(key));
     return true;
 }
@@ -265,17 +300,10 @@ bool seahorse_red_black_tree_map_sr_sr_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID;
         return false;
     }
-    const bool result = coral_red_black_tree_map_contains(&object->map, &key,
-                                                          out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
-    }
+    *out = seahorse_red_black_tree_get(&object->tree, &key,
+                                       object->tree.compare);
     seagrass_required_true(triggerfish_strong_release(key));
-    return result;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_sr_sr_set(
@@ -305,37 +333,21 @@ bool seahorse_red_black_tree_map_sr_sr_set(
                 SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_VALUE_IS_INVALID;
         return false;
     }
-    const struct coral_red_black_tree_map_entry *entry;
-    if (!coral_red_black_tree_map_get_entry(&object->map, &key, &entry)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_map_sr_sr_entry *const entry
+            = seahorse_red_black_tree_get(
+            &object->tree, &key, object->tree.compare);
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
         seagrass_required_true(triggerfish_strong_release(key));
         if (value) {
             seagrass_required_true(triggerfish_strong_release(value));
         }
         return false;
     }
-    struct triggerfish_strong **strong;
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map, entry, (const void **) &strong));
-    if (*strong) {
-        seagrass_required_true(triggerfish_strong_release(*strong));
+    if (entry->value) {
+        seagrass_required_true(triggerfish_strong_release(entry->value));
     }
-    seagrass_required_true(coral_red_black_tree_map_entry_set_value(
-            &object->map, entry, &value));
+    entry->value = value;
     seagrass_required_true(triggerfish_strong_release(key));
     return true;
 }
@@ -344,9 +356,9 @@ static bool retrieve(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong *const key,
         struct triggerfish_strong **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const void **const out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
@@ -366,30 +378,17 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID;
         return false;
     }
-    struct triggerfish_strong **value;
-    if (!func(&object->map, &key, (const void **) &value)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    const struct seahorse_red_black_tree_map_sr_sr_entry *const entry
+            = func(&object->tree, &key, object->tree.compare);
+    if (!entry) {
         seagrass_required_true(triggerfish_strong_release(key));
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
         return false;
     }
-    if (*value) {
-        seagrass_required_true(triggerfish_strong_retain(*value));
+    if (entry->value) {
+        seagrass_required_true(triggerfish_strong_retain(entry->value));
     }
-    *out = *value;
+    *out = entry->value;
     seagrass_required_true(triggerfish_strong_release(key));
     return true;
 }
@@ -398,42 +397,41 @@ bool seahorse_red_black_tree_map_sr_sr_get(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong *const key,
         struct triggerfish_strong **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_get);
+    return retrieve(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_ceiling(
         const struct seahorse_red_black_tree_map_sr_sr *object,
         struct triggerfish_strong *const key,
         struct triggerfish_strong **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_ceiling);
+    return retrieve(object, key, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_floor(
         const struct seahorse_red_black_tree_map_sr_sr *object,
         struct triggerfish_strong *const key,
         struct triggerfish_strong **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_floor);
+    return retrieve(object, key, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_higher(
         const struct seahorse_red_black_tree_map_sr_sr *object,
         struct triggerfish_strong *const key,
         struct triggerfish_strong **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_higher);
+    return retrieve(object, key, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_lower(
         const struct seahorse_red_black_tree_map_sr_sr *object,
         struct triggerfish_strong *const key,
         struct triggerfish_strong **const out) {
-    return retrieve(object, key, out, coral_red_black_tree_map_lower);
+    return retrieve(object, key, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
@@ -443,39 +441,38 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
         return false;
     }
-    struct triggerfish_strong **value;
-    if (!func(&object->map, (const void **) &value)) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_sr_sr_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MAP_IS_EMPTY;
         return false;
     }
-    if (*value) {
-        seagrass_required_true(triggerfish_strong_retain(*value));
+    if (entry->value) {
+        seagrass_required_true(triggerfish_strong_retain(entry->value));
     }
-    *out = *value;
+    *out = entry->value;
     return true;
 }
 
 bool seahorse_red_black_tree_map_sr_sr_first(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_last(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_map_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 static bool retrieve_entry(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong *const key,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const void *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
@@ -495,34 +492,22 @@ static bool retrieve_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID;
         return false;
     }
-    const bool result = func(&object->map, &key,
-                             (const struct coral_red_black_tree_map_entry **) out);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_KEY_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_MAP_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
-    }
+    const struct seahorse_red_black_tree_map_sr_sr_entry *const entry
+            = func(&object->tree, &key, object->tree.compare);
     seagrass_required_true(triggerfish_strong_release(key));
-    return result;
+    if (!entry) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND;
+        return false;
+    }
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_sr_sr_get_entry(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         struct triggerfish_strong *const key,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out) {
-    return retrieve_entry(object, key, out, coral_red_black_tree_map_get_entry);
+    return retrieve_entry(object, key, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_ceiling_entry(
@@ -530,7 +515,7 @@ bool seahorse_red_black_tree_map_sr_sr_ceiling_entry(
         struct triggerfish_strong *const key,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out) {
     return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_ceiling_entry);
+                          seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_floor_entry(
@@ -538,7 +523,7 @@ bool seahorse_red_black_tree_map_sr_sr_floor_entry(
         struct triggerfish_strong *const key,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out) {
     return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_floor_entry);
+                          seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_higher_entry(
@@ -546,7 +531,7 @@ bool seahorse_red_black_tree_map_sr_sr_higher_entry(
         struct triggerfish_strong *const key,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out) {
     return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_higher_entry);
+                          seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_lower_entry(
@@ -554,14 +539,13 @@ bool seahorse_red_black_tree_map_sr_sr_lower_entry(
         struct triggerfish_strong *const key,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out) {
     return retrieve_entry(object, key, out,
-                          coral_red_black_tree_map_lower_entry);
+                          seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_entry_fl(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
@@ -571,27 +555,26 @@ static bool retrieve_entry_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry **const) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_MAP_IS_EMPTY
-                               == coral_error);
+    const struct seahorse_red_black_tree_map_sr_sr_entry *const entry
+            = func(&object->tree);
+    if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MAP_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = entry;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_sr_sr_first_entry(
         const struct seahorse_red_black_tree_map_sr_sr *object,
         const struct seahorse_red_black_tree_map_sr_sr_entry **out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_first_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_last_entry(
         const struct seahorse_red_black_tree_map_sr_sr *object,
         const struct seahorse_red_black_tree_map_sr_sr_entry **out) {
-    return retrieve_entry_fl(object, out, coral_red_black_tree_map_last_entry);
+    return retrieve_entry_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_remove_entry(
@@ -605,27 +588,17 @@ bool seahorse_red_black_tree_map_sr_sr_remove_entry(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_ENTRY_IS_NULL;
         return false;
     }
-    struct {
-        struct triggerfish_strong **key;
-        struct triggerfish_strong **value;
-    } pair;
-    const struct coral_red_black_tree_map_entry *e
-            = (const struct coral_red_black_tree_map_entry *) entry;
-    seagrass_required_true(coral_red_black_tree_map_entry_key(
-            &object->map, e, (const void **) &pair.key));
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map, e, (const void **) &pair.value));
-    on_destroy(pair.key, pair.value);
-    seagrass_required_true(coral_red_black_tree_map_remove_entry(
-            &object->map, e));
+    struct seahorse_red_black_tree_map_sr_sr_entry *const node
+            = (struct seahorse_red_black_tree_map_sr_sr_entry *) entry;
+    on_destroy(node);
+    seahorse_red_black_tree_remove(&object->tree, node);
     return true;
 }
 
 static bool retrieve_entry_np(
         const struct seahorse_red_black_tree_map_sr_sr_entry *const entry,
         const struct seahorse_red_black_tree_map_sr_sr_entry **const out,
-        bool (*const func)(const struct coral_red_black_tree_map_entry *const,
-                           const struct coral_red_black_tree_map_entry **const)) {
+        void *(*const func)(const void *)) {
     assert(func);
     if (!entry) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_ENTRY_IS_NULL;
@@ -635,38 +608,33 @@ static bool retrieve_entry_np(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const struct coral_red_black_tree_map_entry **) out);
+    const struct seahorse_red_black_tree_map_sr_sr_entry *const result
+            = func(entry);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_MAP_ERROR_END_OF_SEQUENCE
-                               == coral_error);
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_sr_sr_next_entry(
         const struct seahorse_red_black_tree_map_sr_sr_entry *entry,
         const struct seahorse_red_black_tree_map_sr_sr_entry **out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_next_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_map_sr_sr_prev_entry(
         const struct seahorse_red_black_tree_map_sr_sr_entry *entry,
         const struct seahorse_red_black_tree_map_sr_sr_entry **out) {
-    return retrieve_entry_np(entry, out, coral_red_black_tree_map_prev_entry);
+    return retrieve_entry_np(entry, out, seahorse_red_black_tree_prev);
 }
 
-static bool entry_retrieve(
+static bool check_entry(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         const struct seahorse_red_black_tree_map_sr_sr_entry *const entry,
-        struct triggerfish_strong **const out,
-        bool (*const func)(const struct coral_red_black_tree_map *const,
-                           const struct coral_red_black_tree_map_entry *const,
-                           const void **const)) {
-    assert(func);
+        const void *const out) {
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
         return false;
@@ -679,15 +647,6 @@ static bool entry_retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
         return false;
     }
-    struct triggerfish_strong **value;
-    seagrass_required_true(func(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            (const void **) &value));
-    if (*value) {
-        seagrass_required_true(triggerfish_strong_retain(*value));
-    }
-    *out = *value;
     return true;
 }
 
@@ -695,16 +654,26 @@ bool seahorse_red_black_tree_map_sr_sr_entry_key(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         const struct seahorse_red_black_tree_map_sr_sr_entry *const entry,
         struct triggerfish_strong **const out) {
-    return entry_retrieve(object, entry, out,
-                          coral_red_black_tree_map_entry_key);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    seagrass_required_true(triggerfish_strong_retain(entry->key));
+    *out = entry->key;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_sr_sr_entry_get_value(
         const struct seahorse_red_black_tree_map_sr_sr *const object,
         const struct seahorse_red_black_tree_map_sr_sr_entry *const entry,
         struct triggerfish_strong **const out) {
-    return entry_retrieve(object, entry, out,
-                          coral_red_black_tree_map_entry_get_value);
+    if (!check_entry(object, entry, out)) {
+        return false;
+    }
+    if (entry->value) {
+        seagrass_required_true(triggerfish_strong_retain(entry->value));
+    }
+    *out = entry->value;
+    return true;
 }
 
 bool seahorse_red_black_tree_map_sr_sr_entry_set_value(
@@ -726,18 +695,157 @@ bool seahorse_red_black_tree_map_sr_sr_entry_set_value(
                 SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_VALUE_IS_INVALID;
         return false;
     }
-    struct triggerfish_strong **out;
-    seagrass_required_true(coral_red_black_tree_map_entry_get_value(
-            &object->map,
-            (struct coral_red_black_tree_map_entry *) entry,
-            (const void **) &out));
-    if (*out) {
-        seagrass_required_true(triggerfish_strong_release(*out));
+    struct seahorse_red_black_tree_map_sr_sr_entry *const node
+            = (struct seahorse_red_black_tree_map_sr_sr_entry *) entry;
+    if (node->value) {
+        seagrass_required_true(triggerfish_strong_release(node->value));
     }
-    seagrass_required_true(coral_red_black_tree_map_entry_set_value(
-            &object->map,
-            (const struct coral_red_black_tree_map_entry *) entry,
-            &value));
+    node->value = value;
     return true;
 }
 
+/*
+ * Retrieve the first and last entries of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_map_sr_sr *const object,
+        struct triggerfish_strong *const low,
+        struct triggerfish_strong *const high,
+        const struct seahorse_red_black_tree_map_sr_sr_entry **const first,
+        const struct seahorse_red_black_tree_map_sr_sr_entry **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_map_sr_sr_ceiling_entry(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_map_sr_sr_floor_entry(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_sr_sr_remove_range(
+        struct seahorse_red_black_tree_map_sr_sr *const object,
+        struct triggerfish_strong *const low,
+        struct triggerfish_strong *const high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_sr_sr_entry *first;
+    const struct seahorse_red_black_tree_map_sr_sr_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             on_destroy);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_sr_sr_count_range(
+        const struct seahorse_red_black_tree_map_sr_sr *const object,
+        struct triggerfish_strong *const low,
+        struct triggerfish_strong *const high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct seahorse_red_black_tree_map_sr_sr_entry *first;
+    const struct seahorse_red_black_tree_map_sr_sr_entry *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_map_sr_sr_split_at(
+        struct seahorse_red_black_tree_map_sr_sr *const object,
+        struct triggerfish_strong *const key,
+        struct seahorse_red_black_tree_map_sr_sr *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!key) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, (int (*)(const struct triggerfish_strong **,
+                       const struct triggerfish_strong **))
+            object->tree.compare, object->tree.pool);
+    const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
+    if (!seahorse_red_black_tree_map_sr_sr_ceiling_entry(object, key, &entry)) {
+        if (SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        entry = NULL;
+    }
+    if (entry) {
+        seahorse_red_black_tree_split(&object->tree, entry, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_map_sr_sr_join(
+        struct seahorse_red_black_tree_map_sr_sr *const object,
+        struct seahorse_red_black_tree_map_sr_sr *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEYS_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
@@ -5,6 +5,7 @@
 #include <seahorse.h>
 
 #include "private/sorted_set_i.h"
+#include "private/red_black_tree.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
@@ -132,15 +133,17 @@ static int compare(const void *const a, const void *const b) {
     return sea_turtle_integer_compare(A, B);
 }
 
-static void init(struct seahorse_red_black_tree_set_i *const object) {
+static void init(struct seahorse_red_black_tree_set_i *const object,
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     *object = (struct seahorse_red_black_tree_set_i) {
             .sorted_set_i = &sorted_set_i
     };
-    seagrass_required_true(coral_red_black_tree_set_init(
-            &object->set,
+    seahorse_red_black_tree_init(
+            &object->tree,
             sizeof(struct sea_turtle_integer),
-            compare));
+            compare,
+            pool);
 }
 
 bool seahorse_red_black_tree_set_i_init(
@@ -149,7 +152,22 @@ bool seahorse_red_black_tree_set_i_init(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
+    return true;
+}
+
+bool seahorse_red_black_tree_set_i_init_pool(
+        struct seahorse_red_black_tree_set_i *const object,
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, pool);
     return true;
 }
 
@@ -159,8 +177,7 @@ static void on_destroy(void *a) {
 
 static void invalidate(struct seahorse_red_black_tree_set_i *const object) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_set_invalidate(
-            &object->set, on_destroy));
+    seahorse_red_black_tree_invalidate(&object->tree, on_destroy);
     *object = (struct seahorse_red_black_tree_set_i) {0};
 }
 
@@ -175,7 +192,7 @@ bool seahorse_red_black_tree_set_i_init_set_i(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
     const struct sea_turtle_integer *integer;
     if (!seahorse_stream_i_first(other, &integer)) {
         seagrass_required_true(SEAHORSE_STREAM_I_ERROR_STREAM_IS_EMPTY
@@ -194,6 +211,7 @@ bool seahorse_red_black_tree_set_i_init_set_i(
                 continue;
             }
             case SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED: {
+                invalidate(object);
                 return false;
             }
         }
@@ -203,6 +221,54 @@ bool seahorse_red_black_tree_set_i_init_set_i(
     return true;
 }
 
+/*
+ * Fill the item of the next node with a copy of the first value of run and
+ * advance run past it.
+ */
+static bool fill(void *const data, void *const context) {
+    const struct sea_turtle_integer **const run = context;
+    if (!sea_turtle_integer_init_integer(data, *run)) {
+        return false;
+    }
+    (*run)++;
+    return true;
+}
+
+bool seahorse_red_black_tree_set_i_init_sorted(
+        struct seahorse_red_black_tree_set_i *const object,
+        const uintmax_t count,
+        const struct sea_turtle_integer *const values) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!values) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_IS_NULL;
+        return false;
+    }
+    for (uintmax_t i = 1; i < count; i++) {
+        if (sea_turtle_integer_compare(&values[i - 1], &values[i]) >= 0) {
+            seahorse_error =
+                    SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_ARE_NOT_SORTED;
+            return false;
+        }
+    }
+    init(object, NULL);
+    const struct sea_turtle_integer *run = values;
+    if (!seahorse_red_black_tree_build(&object->tree, count, fill, on_destroy,
+                                       &run)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
+    return true;
+}
+
 bool seahorse_red_black_tree_set_i_invalidate(
         struct seahorse_red_black_tree_set_i *const object) {
     if (!object) {
@@ -224,8 +290,7 @@ bool seahorse_red_black_tree_set_i_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_set_count(
-            &object->set, out));
+    *out = object->tree.count;
     return true;
 }
 
@@ -240,31 +305,55 @@ bool seahorse_red_black_tree_set_i_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL;
         return false;
     }
-    bool result;
-    if (!coral_red_black_tree_set_contains(&object->set, value, &result)) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, value, &position)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_ALREADY_EXISTS;
+        return false;
+    }
+    struct sea_turtle_integer *item;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &item)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
         return false;
-    } else if (result) {
+    }
+    if (!sea_turtle_integer_init_integer(item, value)) {
+        seahorse_red_black_tree_free(&object->tree, item);
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    seahorse_red_black_tree_link(&object->tree, &position, item);
+    return true;
+}
+
+bool seahorse_red_black_tree_set_i_add_take(
+        struct seahorse_red_black_tree_set_i *const object,
+        struct sea_turtle_integer *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, value, &position)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_ALREADY_EXISTS;
         return false;
     }
-    struct sea_turtle_integer copy;
-    result = sea_turtle_integer_init_integer(&copy, value)
-             && coral_red_black_tree_set_add(&object->set, &copy);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seagrass_required_true(sea_turtle_integer_invalidate(&copy));
+    struct sea_turtle_integer *item;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &item)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
     }
-    return result;
+    *item = *value;
+    seahorse_red_black_tree_link(&object->tree, &position, item);
+    *value = (struct sea_turtle_integer) {0};
+    return true;
 }
 
 bool seahorse_red_black_tree_set_i_remove(
@@ -278,29 +367,14 @@ bool seahorse_red_black_tree_set_i_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL;
         return false;
     }
-    struct sea_turtle_integer *out;
-    if (!coral_red_black_tree_set_get(&object->set, value,
-                                      (const void **) &out)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_ITEM_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    struct sea_turtle_integer *const item = seahorse_red_black_tree_get(
+            &object->tree, value, compare);
+    if (!item) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_NOT_FOUND;
         return false;
     }
-    on_destroy(out);
-    seagrass_required_true(coral_red_black_tree_set_remove_item(
-            &object->set, out));
+    on_destroy(item);
+    seahorse_red_black_tree_remove(&object->tree, item);
     return true;
 }
 
@@ -320,25 +394,17 @@ bool seahorse_red_black_tree_set_i_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_set_contains(
-            &object->set, value, out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
-    }
-    return result;
+    *out = seahorse_red_black_tree_get(&object->tree, value, compare);
+    return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer *const value,
         const struct sea_turtle_integer **const out,
-        bool (*const func)(const struct coral_red_black_tree_set *,
-                           const void *,
-                           const void **out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
@@ -352,67 +418,55 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    if (func(&object->set, value, (const void **) out)) {
-        return true;
-    }
-    switch (coral_error) {
-        default: {
-            seagrass_required_true(false);
-        }
-        case CORAL_RED_BLACK_TREE_SET_ERROR_ITEM_NOT_FOUND: {
-            seahorse_error =
-                    SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND;
-            break;
-        }
-        case CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED: {
-            seahorse_error =
-                    SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
-            break;
-        }
+    const struct sea_turtle_integer *const item
+            = func(&object->tree, value, compare);
+    if (!item) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND;
+        return false;
     }
-    return false;
+    *out = item;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_i_get(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer *const value,
         const struct sea_turtle_integer **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_get);
+    return retrieve(object, value, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_set_i_ceiling(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer *const value,
         const struct sea_turtle_integer **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_ceiling);
+    return retrieve(object, value, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_set_i_floor(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer *const value,
         const struct sea_turtle_integer **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_floor);
+    return retrieve(object, value, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_set_i_higher(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer *const value,
         const struct sea_turtle_integer **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_higher);
+    return retrieve(object, value, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_set_i_lower(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer *const value,
         const struct sea_turtle_integer **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_lower);
+    return retrieve(object, value, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer **const out,
-        bool (*const func)(const struct coral_red_black_tree_set *,
-                           const void **out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
@@ -422,25 +476,25 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->set, (const void **) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_SET_ERROR_SET_IS_EMPTY
-                               == coral_error);
+    const struct sea_turtle_integer *const item = func(&object->tree);
+    if (!item) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_SET_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = item;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_i_first(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_set_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_set_i_last(
         const struct seahorse_red_black_tree_set_i *const object,
         const struct sea_turtle_integer **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_set_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_set_i_remove_item(
@@ -455,14 +509,13 @@ bool seahorse_red_black_tree_set_i_remove_item(
         return false;
     }
     on_destroy((void *) item);
-    seagrass_required_true(coral_red_black_tree_set_remove_item(
-            &object->set, item));
+    seahorse_red_black_tree_remove(&object->tree, (void *) item);
     return true;
 }
 
 static bool retrieve_np(const struct sea_turtle_integer *const item,
                         const struct sea_turtle_integer **const out,
-                        bool (*const func)(const void *, const void **)) {
+                        void *(*const func)(const void *)) {
     assert(func);
     if (!item) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_IS_NULL;
@@ -472,24 +525,339 @@ static bool retrieve_np(const struct sea_turtle_integer *const item,
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(item, (const void **) out);
+    const struct sea_turtle_integer *const result = func(item);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_SET_ERROR_END_OF_SEQUENCE
-                               == coral_error);
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_i_next(
         const struct sea_turtle_integer *const item,
         const struct sea_turtle_integer **const out) {
-    return retrieve_np(item, out, coral_red_black_tree_set_next);
+    return retrieve_np(item, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_set_i_prev(
         const struct sea_turtle_integer *const item,
         const struct sea_turtle_integer **const out) {
-    return retrieve_np(item, out, coral_red_black_tree_set_prev);
+    return retrieve_np(item, out, seahorse_red_black_tree_prev);
+}
+
+static const struct sea_turtle_integer *first_of(
+        const struct seahorse_red_black_tree_set_i *const object) {
+    assert(object);
+    return seahorse_red_black_tree_first(&object->tree);
+}
+
+static const struct sea_turtle_integer *next_of(
+        const struct sea_turtle_integer *const item) {
+    assert(item);
+    return seahorse_red_black_tree_next(item);
+}
+
+#define LEFT                            1
+#define BOTH                            2
+#define RIGHT                           4
+
+/*
+ * Position in a side by side walk of two tree sets in order, along with the
+ * origins, out of LEFT, BOTH and RIGHT, of the values that it yields.
+ */
+struct walk {
+    const struct sea_turtle_integer *a;
+    const struct sea_turtle_integer *b;
+    int keep;
+};
+
+/*
+ * Advance walk to the next value whose origin is in keep and return it, or
+ * NULL once there are no more such values.
+ */
+static const struct sea_turtle_integer *step(struct walk *const walk) {
+    assert(walk);
+    while ((walk->a && (walk->b || LEFT & walk->keep))
+           || (walk->b && RIGHT & walk->keep)) {
+        const int order = !walk->a ? 1
+                          : !walk->b ? -1
+                          : compare(walk->a, walk->b);
+        const struct sea_turtle_integer *const a = walk->a;
+        const struct sea_turtle_integer *const b = walk->b;
+        if (order <= 0) {
+            walk->a = next_of(a);
+        }
+        if (order >= 0) {
+            walk->b = next_of(b);
+        }
+        const int origin = order < 0 ? LEFT : order > 0 ? RIGHT : BOTH;
+        if (origin & walk->keep) {
+            return order > 0 ? b : a;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Fill the item of the next node with a copy of the next value of walk.
+ */
+static bool pick(void *const data, void *const context) {
+    const struct sea_turtle_integer *const value = step(context);
+    assert(value);
+    return sea_turtle_integer_init_integer(data, value);
+}
+
+/*
+ * Walks left and right in order side by side, once to count the values whose
+ * origin is in keep and once more to build the tree set from them, so that
+ * each value is placed without a descent or rebalance of the tree set.
+ */
+static bool merge(struct seahorse_red_black_tree_set_i *const object,
+                  const struct seahorse_red_black_tree_set_i *const left,
+                  const struct seahorse_red_black_tree_set_i *const right,
+                  const int keep) {
+    assert(object);
+    assert(left);
+    assert(right);
+    const struct walk start = {
+            .a = first_of(left),
+            .b = first_of(right),
+            .keep = keep
+    };
+    struct walk walk = start;
+    uintmax_t count = 0;
+    for (; step(&walk); count++);
+    walk = start;
+    init(object, NULL);
+    if (!seahorse_red_black_tree_build(&object->tree, count, pick, on_destroy,
+                                       &walk)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
+    return true;
+}
+
+static bool combine(struct seahorse_red_black_tree_set_i *const object,
+                    const struct seahorse_red_black_tree_set_i *const left,
+                    const struct seahorse_red_black_tree_set_i *const right,
+                    const int keep) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!left) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL;
+        return false;
+    }
+    if (!right) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL;
+        return false;
+    }
+    return merge(object, left, right, keep);
+}
+
+bool seahorse_red_black_tree_set_i_init_union(
+        struct seahorse_red_black_tree_set_i *const object,
+        const struct seahorse_red_black_tree_set_i *const left,
+        const struct seahorse_red_black_tree_set_i *const right) {
+    return combine(object, left, right, LEFT | BOTH | RIGHT);
+}
+
+bool seahorse_red_black_tree_set_i_init_intersection(
+        struct seahorse_red_black_tree_set_i *const object,
+        const struct seahorse_red_black_tree_set_i *const left,
+        const struct seahorse_red_black_tree_set_i *const right) {
+    return combine(object, left, right, BOTH);
+}
+
+bool seahorse_red_black_tree_set_i_init_difference(
+        struct seahorse_red_black_tree_set_i *const object,
+        const struct seahorse_red_black_tree_set_i *const left,
+        const struct seahorse_red_black_tree_set_i *const right) {
+    return combine(object, left, right, LEFT);
+}
+
+bool seahorse_red_black_tree_set_i_is_subset(
+        const struct seahorse_red_black_tree_set_i *const object,
+        const struct seahorse_red_black_tree_set_i *const other,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t count = object->tree.count;
+    const uintmax_t limit = other->tree.count;
+    if (count > limit) {
+        *out = false;
+        return true;
+    }
+    const struct sea_turtle_integer *a = first_of(object);
+    const struct sea_turtle_integer *b = first_of(other);
+    while (a && b) {
+        const int order = compare(a, b);
+        if (order < 0) {
+            break;
+        }
+        if (!order) {
+            a = next_of(a);
+        }
+        b = next_of(b);
+    }
+    *out = !a;
+    return true;
 }
 
+/*
+ * Retrieve the first and last items of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_set_i *const object,
+        const struct sea_turtle_integer *const low,
+        const struct sea_turtle_integer *const high,
+        const struct sea_turtle_integer **const first,
+        const struct sea_turtle_integer **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_set_i_ceiling(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_set_i_floor(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_i_remove_range(
+        struct seahorse_red_black_tree_set_i *const object,
+        const struct sea_turtle_integer *const low,
+        const struct sea_turtle_integer *const high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    const struct sea_turtle_integer *first;
+    const struct sea_turtle_integer *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             on_destroy);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_i_count_range(
+        const struct seahorse_red_black_tree_set_i *const object,
+        const struct sea_turtle_integer *const low,
+        const struct sea_turtle_integer *const high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct sea_turtle_integer *first;
+    const struct sea_turtle_integer *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_set_i_split_at(
+        struct seahorse_red_black_tree_set_i *const object,
+        const struct sea_turtle_integer *const value,
+        struct seahorse_red_black_tree_set_i *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.pool);
+    const struct sea_turtle_integer *item;
+    if (!seahorse_red_black_tree_set_i_ceiling(object, value, &item)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        item = NULL;
+    }
+    if (item) {
+        seahorse_red_black_tree_split(&object->tree, item, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_i_join(
+        struct seahorse_red_black_tree_set_i *const object,
+        struct seahorse_red_black_tree_set_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <seagrass.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
@@ -12,13 +13,15 @@ static int compare(const void *const a, const void *const b) {
                                       *(uintmax_t *) b);
 }
 
-static void init(struct seahorse_red_black_tree_set_ni *const object) {
+static void init(struct seahorse_red_black_tree_set_ni *const object,
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     *object = (struct seahorse_red_black_tree_set_ni) {0};
-    seagrass_required_true(coral_red_black_tree_set_init(
-            &object->set,
+    seahorse_red_black_tree_init(
+            &object->tree,
             sizeof(uintmax_t),
-            compare));
+            compare,
+            pool);
 }
 
 bool seahorse_red_black_tree_set_ni_init(
@@ -27,15 +30,28 @@ bool seahorse_red_black_tree_set_ni_init(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_init_pool(
+        struct seahorse_red_black_tree_set_ni *const object,
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, pool);
     return true;
 }
 
 static void invalidate(struct seahorse_red_black_tree_set_ni *const object) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_set_invalidate(
-            &object->set,
-            NULL));
+    seahorse_red_black_tree_invalidate(&object->tree, NULL);
     *object = (struct seahorse_red_black_tree_set_ni) {0};
 }
 
@@ -49,6 +65,17 @@ bool seahorse_red_black_tree_set_ni_invalidate(
     return true;
 }
 
+/*
+ * Fill the item of the next node with a copy of the item at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const uintmax_t **const cursor = context;
+    *(uintmax_t *) data = **cursor;
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_set_ni_init_red_black_tree_set_ni(
         struct seahorse_red_black_tree_set_ni *const object,
         const struct seahorse_red_black_tree_set_ni *const other) {
@@ -60,26 +87,60 @@ bool seahorse_red_black_tree_set_ni_init_red_black_tree_set_ni(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object);
-    const uintmax_t *item;
-    if (!seahorse_red_black_tree_set_ni_first(other, &item)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_SET_IS_EMPTY
-                == seahorse_error);
-        return true;
+    init(object, other->tree.pool);
+    const uintmax_t *cursor = seahorse_red_black_tree_first(&other->tree);
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, NULL, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Fill the item of the next node with the first value of run and advance run
+ * past it.
+ */
+static bool fill(void *const data, void *const context) {
+    const uintmax_t **const run = context;
+    *(uintmax_t *) data = *(*run)++;
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_init_sorted(
+        struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t count,
+        const uintmax_t *const values) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_COUNT_IS_ZERO;
+        return false;
     }
-    do {
-        if (!seahorse_red_black_tree_set_ni_add(object, *item)) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object);
+    if (!values) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUES_IS_NULL;
+        return false;
+    }
+    for (uintmax_t i = 1; i < count; i++) {
+        if (values[i - 1] >= values[i]) {
+            seahorse_error =
+                    SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUES_ARE_NOT_SORTED;
             return false;
         }
-    } while (seahorse_red_black_tree_set_ni_next(item, &item));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
+    }
+    init(object, NULL);
+    const uintmax_t *run = values;
+    if (!seahorse_red_black_tree_build(&object->tree, count, fill, NULL,
+                                       &run)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
     return true;
 }
 
@@ -94,8 +155,7 @@ bool seahorse_red_black_tree_set_ni_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_set_count(
-            &object->set, out));
+    *out = object->tree.count;
     return true;
 }
 
@@ -106,25 +166,21 @@ bool seahorse_red_black_tree_set_ni_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_set_add(&object->set, &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_VALUE_ALREADY_EXISTS: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUE_ALREADY_EXISTS;
-                break;
-            }
-        }
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, &value, &position)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUE_ALREADY_EXISTS;
+        return false;
+    }
+    uintmax_t *item;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &item)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
     }
-    return result;
+    *item = value;
+    seahorse_red_black_tree_link(&object->tree, &position, item);
+    return true;
 }
 
 bool seahorse_red_black_tree_set_ni_remove(
@@ -134,25 +190,14 @@ bool seahorse_red_black_tree_set_ni_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_set_remove(&object->set, &value);
-    if (!result) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_VALUE_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUE_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    void *const item = seahorse_red_black_tree_get(&object->tree, &value,
+                                                   compare);
+    if (!item) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUE_NOT_FOUND;
+        return false;
     }
-    return result;
+    seahorse_red_black_tree_remove(&object->tree, item);
+    return true;
 }
 
 bool seahorse_red_black_tree_set_ni_contains(
@@ -167,25 +212,17 @@ bool seahorse_red_black_tree_set_ni_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_set_contains(&object->set, &value,
-                                                          out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-    }
-    return result;
+    *out = seahorse_red_black_tree_get(&object->tree, &value, compare);
+    return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t value,
         const uintmax_t **const out,
-        bool (*const func)(const struct coral_red_black_tree_set *,
-                           const void *,
-                           const void **out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
@@ -195,67 +232,54 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    if (func(&object->set, &value, (const void **) out)) {
-        return true;
-    }
-    switch (coral_error) {
-        default: {
-            seagrass_required_true(false);
-        }
-        case CORAL_RED_BLACK_TREE_SET_ERROR_ITEM_NOT_FOUND: {
-            seahorse_error =
-                    SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_ITEM_NOT_FOUND;
-            break;
-        }
-        case CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED: {
-            seahorse_error =
-                    SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
-            break;
-        }
+    const uintmax_t *const item = func(&object->tree, &value, compare);
+    if (!item) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_ITEM_NOT_FOUND;
+        return false;
     }
-    return false;
+    *out = item;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_ni_get(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t value,
         const uintmax_t **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_get);
+    return retrieve(object, value, out, seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_set_ni_ceiling(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t value,
         const uintmax_t **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_ceiling);
+    return retrieve(object, value, out, seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_set_ni_floor(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t value,
         const uintmax_t **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_floor);
+    return retrieve(object, value, out, seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_set_ni_higher(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t value,
         const uintmax_t **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_higher);
+    return retrieve(object, value, out, seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_set_ni_lower(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t value,
         const uintmax_t **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_lower);
+    return retrieve(object, value, out, seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t **const out,
-        bool (*const func)(const struct coral_red_black_tree_set *,
-                           const void **out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
@@ -265,25 +289,25 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->set, (const void **) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_SET_ERROR_SET_IS_EMPTY
-                               == coral_error);
+    const uintmax_t *const item = func(&object->tree);
+    if (!item) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_SET_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = item;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_ni_first(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_set_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_set_ni_last(
         const struct seahorse_red_black_tree_set_ni *const object,
         const uintmax_t **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_set_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_set_ni_remove_item(
@@ -297,14 +321,13 @@ bool seahorse_red_black_tree_set_ni_remove_item(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_ITEM_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_set_remove_item(
-            &object->set, item));
+    seahorse_red_black_tree_remove(&object->tree, (void *) item);
     return true;
 }
 
 static bool retrieve_np(const uintmax_t *const item,
                         const uintmax_t **const out,
-                        bool (*const func)(const void *, const void **)) {
+                        void *(*const func)(const void *)) {
     assert(func);
     if (!item) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_ITEM_IS_NULL;
@@ -314,22 +337,366 @@ static bool retrieve_np(const uintmax_t *const item,
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(item, (const void **) out);
+    const uintmax_t *const result = func(item);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_SET_ERROR_END_OF_SEQUENCE
-                               == coral_error);
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_ni_next(const uintmax_t *const item,
                                          const uintmax_t **const out) {
-    return retrieve_np(item, out, coral_red_black_tree_set_next);
+    return retrieve_np(item, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_set_ni_prev(const uintmax_t *const item,
                                          const uintmax_t **const out) {
-    return retrieve_np(item, out, coral_red_black_tree_set_prev);
+    return retrieve_np(item, out, seahorse_red_black_tree_prev);
 }
 
+static const uintmax_t *first_of(
+        const struct seahorse_red_black_tree_set_ni *const object) {
+    assert(object);
+    return seahorse_red_black_tree_first(&object->tree);
+}
+
+static const uintmax_t *next_of(const uintmax_t *const item) {
+    assert(item);
+    return seahorse_red_black_tree_next(item);
+}
+
+#define LEFT                            1
+#define BOTH                            2
+#define RIGHT                           4
+
+/*
+ * Position in a side by side walk of two tree sets in order, along with the
+ * origins, out of LEFT, BOTH and RIGHT, of the values that it yields.
+ */
+struct walk {
+    const uintmax_t *a;
+    const uintmax_t *b;
+    int keep;
+};
+
+/*
+ * Advance walk to the next value whose origin is in keep and return it, or
+ * NULL once there are no more such values.
+ */
+static const uintmax_t *step(struct walk *const walk) {
+    assert(walk);
+    while ((walk->a && (walk->b || LEFT & walk->keep))
+           || (walk->b && RIGHT & walk->keep)) {
+        const int order = !walk->a ? 1
+                          : !walk->b ? -1
+                          : compare(walk->a, walk->b);
+        const uintmax_t *const a = walk->a;
+        const uintmax_t *const b = walk->b;
+        if (order <= 0) {
+            walk->a = next_of(a);
+        }
+        if (order >= 0) {
+            walk->b = next_of(b);
+        }
+        const int origin = order < 0 ? LEFT : order > 0 ? RIGHT : BOTH;
+        if (origin & walk->keep) {
+            return order > 0 ? b : a;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Fill the item of the next node with a copy of the next value of walk.
+ */
+static bool pick(void *const data, void *const context) {
+    const uintmax_t *const value = step(context);
+    assert(value);
+    *(uintmax_t *) data = *value;
+    return true;
+}
+
+/*
+ * Walks left and right in order side by side, once to count the values whose
+ * origin is in keep and once more to build the tree set from them, so that
+ * each value is placed without a descent or rebalance of the tree set.
+ */
+static bool merge(struct seahorse_red_black_tree_set_ni *const object,
+                  const struct seahorse_red_black_tree_set_ni *const left,
+                  const struct seahorse_red_black_tree_set_ni *const right,
+                  const int keep) {
+    assert(object);
+    assert(left);
+    assert(right);
+    const struct walk start = {
+            .a = first_of(left),
+            .b = first_of(right),
+            .keep = keep
+    };
+    struct walk walk = start;
+    uintmax_t count = 0;
+    for (; step(&walk); count++);
+    walk = start;
+    init(object, NULL);
+    if (!seahorse_red_black_tree_build(&object->tree, count, pick, NULL,
+                                       &walk)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
+    return true;
+}
+
+static bool combine(struct seahorse_red_black_tree_set_ni *const object,
+                    const struct seahorse_red_black_tree_set_ni *const left,
+                    const struct seahorse_red_black_tree_set_ni *const right,
+                    const int keep) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!left) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_LEFT_IS_NULL;
+        return false;
+    }
+    if (!right) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_RIGHT_IS_NULL;
+        return false;
+    }
+    return merge(object, left, right, keep);
+}
+
+bool seahorse_red_black_tree_set_ni_init_union(
+        struct seahorse_red_black_tree_set_ni *const object,
+        const struct seahorse_red_black_tree_set_ni *const left,
+        const struct seahorse_red_black_tree_set_ni *const right) {
+    return combine(object, left, right, LEFT | BOTH | RIGHT);
+}
+
+bool seahorse_red_black_tree_set_ni_init_intersection(
+        struct seahorse_red_black_tree_set_ni *const object,
+        const struct seahorse_red_black_tree_set_ni *const left,
+        const struct seahorse_red_black_tree_set_ni *const right) {
+    return combine(object, left, right, BOTH);
+}
+
+bool seahorse_red_black_tree_set_ni_init_difference(
+        struct seahorse_red_black_tree_set_ni *const object,
+        const struct seahorse_red_black_tree_set_ni *const left,
+        const struct seahorse_red_black_tree_set_ni *const right) {
+    return combine(object, left, right, LEFT);
+}
+
+bool seahorse_red_black_tree_set_ni_is_subset(
+        const struct seahorse_red_black_tree_set_ni *const object,
+        const struct seahorse_red_black_tree_set_ni *const other,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t count = object->tree.count;
+    const uintmax_t limit = other->tree.count;
+    if (count > limit) {
+        *out = false;
+        return true;
+    }
+    const uintmax_t *a = first_of(object);
+    const uintmax_t *b = first_of(other);
+    while (a && b) {
+        const int order = compare(a, b);
+        if (order < 0) {
+            break;
+        }
+        if (!order) {
+            a = next_of(a);
+        }
+        b = next_of(b);
+    }
+    *out = !a;
+    return true;
+}
+
+/*
+ * Retrieve the first and last items of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t low,
+        const uintmax_t high,
+        const uintmax_t **const first,
+        const uintmax_t **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_set_ni_ceiling(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_set_ni_floor(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_remove_range(
+        struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t low,
+        const uintmax_t high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    const uintmax_t *first;
+    const uintmax_t *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             NULL);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_count_range(
+        const struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t low,
+        const uintmax_t high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t *first;
+    const uintmax_t *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_at_rank(
+        const struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t rank,
+        const uintmax_t **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (rank >= object->tree.count) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_RANK_IS_OUT_OF_BOUNDS;
+        return false;
+    }
+    *out = seahorse_red_black_tree_at(&object->tree, rank);
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_rank_of(
+        const struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t value,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t *const item = seahorse_red_black_tree_ceiling(
+            &object->tree, &value, compare);
+    *out = item
+           ? seahorse_red_black_tree_index(item)
+           : object->tree.count;
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_split_at(
+        struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t value,
+        struct seahorse_red_black_tree_set_ni *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.pool);
+    const uintmax_t *item;
+    if (!seahorse_red_black_tree_set_ni_ceiling(object, value, &item)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        item = NULL;
+    }
+    if (item) {
+        seahorse_red_black_tree_split(&object->tree, item, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_ni_join(
+        struct seahorse_red_black_tree_set_ni *const object,
+        struct seahorse_red_black_tree_set_ni *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUES_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
@@ -3,26 +3,22 @@
 #include <seagrass.h>
 #include <sea-turtle.h>
 #include <seahorse.h>
+#include "private/red_black_tree.h"
+#include "private/chars.h"
 
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
-static int compare(const void *const a, const void *const b) {
-    const struct sea_turtle_string *const A
-            = (const struct sea_turtle_string *) a;
-    const struct sea_turtle_string *const B
-            = (const struct sea_turtle_string *) b;
-    return sea_turtle_string_compare(A, B);
-}
-
-static void init(struct seahorse_red_black_tree_set_s *const object) {
+static void init(struct seahorse_red_black_tree_set_s *const object,
+                 struct seahorse_red_black_tree_pool *const pool) {
     assert(object);
     *object = (struct seahorse_red_black_tree_set_s) {0};
-    seagrass_required_true(coral_red_black_tree_set_init(
-            &object->set,
+    seahorse_red_black_tree_init(
+            &object->tree,
             sizeof(struct sea_turtle_string),
-            compare));
+            seahorse_chars_compare_string,
+            pool);
 }
 
 bool seahorse_red_black_tree_set_s_init(
@@ -31,7 +27,22 @@ bool seahorse_red_black_tree_set_s_init(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    init(object);
+    init(object, NULL);
+    return true;
+}
+
+bool seahorse_red_black_tree_set_s_init_pool(
+        struct seahorse_red_black_tree_set_s *const object,
+        struct seahorse_red_black_tree_pool *const pool) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!pool) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_POOL_IS_NULL;
+        return false;
+    }
+    init(object, pool);
     return true;
 }
 
@@ -41,8 +52,7 @@ static void on_destroy(void *a) {
 
 static void invalidate(struct seahorse_red_black_tree_set_s *const object) {
     assert(object);
-    seagrass_required_true(coral_red_black_tree_set_invalidate(
-            &object->set, on_destroy));
+    seahorse_red_black_tree_invalidate(&object->tree, on_destroy);
     *object = (struct seahorse_red_black_tree_set_s) {0};
 }
 
@@ -56,6 +66,21 @@ bool seahorse_red_black_tree_set_s_invalidate(
     return true;
 }
 
+/*
+ * Fill the item of the next node with a copy of the item at cursor and
+ * advance cursor to the one after it.
+ */
+static bool copy(void *const data, void *const context) {
+    const struct sea_turtle_string **const cursor = context;
+    if (!sea_turtle_string_init_string(data, *cursor)) {
+        seagrass_required_true(SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        return false;
+    }
+    *cursor = seahorse_red_black_tree_next(*cursor);
+    return true;
+}
+
 bool seahorse_red_black_tree_set_s_init_red_black_tree_set_s(
         struct seahorse_red_black_tree_set_s *const object,
         const struct seahorse_red_black_tree_set_s *const other) {
@@ -67,26 +92,16 @@ bool seahorse_red_black_tree_set_s_init_red_black_tree_set_s(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL;
         return false;
     }
-    init(object);
-    const struct sea_turtle_string *item;
-    if (!seahorse_red_black_tree_set_s_first(other, &item)) {
-        seagrass_required_true(
-                SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_SET_IS_EMPTY
-                == seahorse_error);
-        return true;
+    init(object, other->tree.pool);
+    const struct sea_turtle_string *cursor
+            = seahorse_red_black_tree_first(&other->tree);
+    if (!seahorse_red_black_tree_build(&object->tree, other->tree.count,
+                                       copy, on_destroy, &cursor)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
     }
-    do {
-        if (!seahorse_red_black_tree_set_s_add(object, item)) {
-            seagrass_required_true(
-                    SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED
-                    == seahorse_error);
-            invalidate(object);
-            return false;
-        }
-    } while (seahorse_red_black_tree_set_s_next(item, &item));
-    seagrass_required_true(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_END_OF_SEQUENCE
-            == seahorse_error);
     return true;
 }
 
@@ -101,8 +116,7 @@ bool seahorse_red_black_tree_set_s_count(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
         return false;
     }
-    seagrass_required_true(coral_red_black_tree_set_count(
-            &object->set, out));
+    *out = object->tree.count;
     return true;
 }
 
@@ -117,33 +131,77 @@ bool seahorse_red_black_tree_set_s_add(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
         return false;
     }
-    bool result;
-    if (!coral_red_black_tree_set_contains(&object->set, value, &result)) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, value, &position)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_ALREADY_EXISTS;
+        return false;
+    }
+    struct sea_turtle_string *item;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &item)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
         return false;
-    } else if (result) {
+    }
+    if (!sea_turtle_string_init_string(item, value)) {
+        seagrass_required_true(SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        seahorse_red_black_tree_free(&object->tree, item);
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    seahorse_red_black_tree_link(&object->tree, &position, item);
+    return true;
+}
+
+bool seahorse_red_black_tree_set_s_add_take(
+        struct seahorse_red_black_tree_set_s *const object,
+        struct sea_turtle_string *const value) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    struct seahorse_red_black_tree_position position;
+    if (seahorse_red_black_tree_locate(&object->tree, value, &position)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_ALREADY_EXISTS;
         return false;
     }
-    struct sea_turtle_string copy;
-    result = sea_turtle_string_init_string(&copy, value)
-             && coral_red_black_tree_set_add(&object->set, &copy);
-    if (!result) {
-        seagrass_required_true(
-                SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
-                == sea_turtle_error
-                || CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED
-                   == coral_error);
-        seagrass_required_true(sea_turtle_string_invalidate(&copy));
+    struct sea_turtle_string *item;
+    if (!seahorse_red_black_tree_alloc(&object->tree, (void **) &item)) {
         seahorse_error =
                 SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
     }
-    return result;
+    *item = *value;
+    seahorse_red_black_tree_link(&object->tree, &position, item);
+    *value = (struct sea_turtle_string) {0};
+    return true;
+}
+
+/*
+ * Remove the item that compares equal to value.
+ */
+static bool erase(struct seahorse_red_black_tree_set_s *const object,
+                  const void *const value,
+                  int (*const compare)(const void *, const void *)) {
+    assert(object);
+    assert(value);
+    assert(compare);
+    struct sea_turtle_string *const item = seahorse_red_black_tree_get(
+            &object->tree, value, compare);
+    if (!item) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_NOT_FOUND;
+        return false;
+    }
+    on_destroy(item);
+    seahorse_red_black_tree_remove(&object->tree, item);
+    return true;
 }
 
 bool seahorse_red_black_tree_set_s_remove(
@@ -157,30 +215,26 @@ bool seahorse_red_black_tree_set_s_remove(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
         return false;
     }
-    struct sea_turtle_string *out;
-    if (!coral_red_black_tree_set_get(&object->set, value,
-                                      (const void **) &out)) {
-        switch (coral_error) {
-            default: {
-                seagrass_required_true(false);
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_ITEM_NOT_FOUND: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_NOT_FOUND;
-                break;
-            }
-            case CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED: {
-                seahorse_error =
-                        SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
-                break;
-            }
-        }
+    return erase(object, value, seahorse_chars_compare_string);
+}
+
+bool seahorse_red_black_tree_set_s_remove_chars(
+        struct seahorse_red_black_tree_set_s *const object,
+        const char *const value,
+        const size_t size) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
         return false;
     }
-    on_destroy(out);
-    seagrass_required_true(coral_red_black_tree_set_remove_item(
-            &object->set, out));
-    return true;
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = value,
+            .size = size
+    };
+    return erase(object, &chars, seahorse_chars_compare);
 }
 
 bool seahorse_red_black_tree_set_s_contains(
@@ -199,25 +253,45 @@ bool seahorse_red_black_tree_set_s_contains(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = coral_red_black_tree_set_contains(
-            &object->set, value, out);
-    if (!result) {
-        seagrass_required_true(
-                CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED
-                == coral_error);
-        seahorse_error =
-                SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
+    *out = seahorse_red_black_tree_get(
+            &object->tree, value, seahorse_chars_compare_string);
+    return true;
+}
+
+bool seahorse_red_black_tree_set_s_contains_chars(
+        const struct seahorse_red_black_tree_set_s *const object,
+        const char *const value,
+        const size_t size,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
+        return false;
     }
-    return result;
+    const struct seahorse_chars chars = {
+            .data = value,
+            .size = size
+    };
+    *out = seahorse_red_black_tree_get(
+            &object->tree, &chars, seahorse_chars_compare);
+    return true;
 }
 
 static bool retrieve(
         const struct seahorse_red_black_tree_set_s *const object,
-        const struct sea_turtle_string *const value,
+        const void *const value,
+        int (*const compare)(const void *, const void *),
         const struct sea_turtle_string **const out,
-        bool (*const func)(const struct coral_red_black_tree_set *,
-                           const void *,
-                           const void **out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *,
+                            const void *,
+                            int (*)(const void *, const void *))) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
@@ -231,67 +305,123 @@ static bool retrieve(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
         return false;
     }
-    if (func(&object->set, value, (const void **) out)) {
-        return true;
-    }
-    switch (coral_error) {
-        default: {
-            seagrass_required_true(false);
-        }
-        case CORAL_RED_BLACK_TREE_SET_ERROR_ITEM_NOT_FOUND: {
-            seahorse_error =
-                    SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND;
-            break;
-        }
-        case CORAL_RED_BLACK_TREE_SET_ERROR_MEMORY_ALLOCATION_FAILED: {
-            seahorse_error =
-                    SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
-            break;
-        }
+    const struct sea_turtle_string *const item
+            = func(&object->tree, value, compare);
+    if (!item) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND;
+        return false;
     }
-    return false;
+    *out = item;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_s_get(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string *const value,
         const struct sea_turtle_string **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_get);
+    return retrieve(object, value, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_get);
+}
+
+bool seahorse_red_black_tree_set_s_get_chars(
+        const struct seahorse_red_black_tree_set_s *const object,
+        const char *const value,
+        const size_t size,
+        const struct sea_turtle_string **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = value,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_get);
 }
 
 bool seahorse_red_black_tree_set_s_ceiling(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string *const value,
         const struct sea_turtle_string **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_ceiling);
+    return retrieve(object, value, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_ceiling);
+}
+
+bool seahorse_red_black_tree_set_s_ceiling_chars(
+        const struct seahorse_red_black_tree_set_s *const object,
+        const char *const value,
+        const size_t size,
+        const struct sea_turtle_string **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = value,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_ceiling);
 }
 
 bool seahorse_red_black_tree_set_s_floor(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string *const value,
         const struct sea_turtle_string **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_floor);
+    return retrieve(object, value, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_floor);
+}
+
+bool seahorse_red_black_tree_set_s_floor_chars(
+        const struct seahorse_red_black_tree_set_s *const object,
+        const char *const value,
+        const size_t size,
+        const struct sea_turtle_string **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    const struct seahorse_chars chars = {
+            .data = value,
+            .size = size
+    };
+    return retrieve(object, &chars, seahorse_chars_compare, out,
+                    seahorse_red_black_tree_floor);
 }
 
 bool seahorse_red_black_tree_set_s_higher(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string *const value,
         const struct sea_turtle_string **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_higher);
+    return retrieve(object, value, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_higher);
 }
 
 bool seahorse_red_black_tree_set_s_lower(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string *const value,
         const struct sea_turtle_string **const out) {
-    return retrieve(object, value, out, coral_red_black_tree_set_lower);
+    return retrieve(object, value, seahorse_chars_compare_string, out,
+                    seahorse_red_black_tree_lower);
 }
 
 static bool retrieve_fl(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string **const out,
-        bool (*const func)(const struct coral_red_black_tree_set *,
-                           const void **out)) {
+        void *(*const func)(const struct seahorse_red_black_tree *)) {
     assert(func);
     if (!object) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
@@ -301,25 +431,25 @@ static bool retrieve_fl(
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(&object->set, (const void **) out);
-    if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_SET_ERROR_SET_IS_EMPTY
-                               == coral_error);
+    const struct sea_turtle_string *const item = func(&object->tree);
+    if (!item) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_SET_IS_EMPTY;
+        return false;
     }
-    return result;
+    *out = item;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_s_first(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_set_first);
+    return retrieve_fl(object, out, seahorse_red_black_tree_first);
 }
 
 bool seahorse_red_black_tree_set_s_last(
         const struct seahorse_red_black_tree_set_s *const object,
         const struct sea_turtle_string **const out) {
-    return retrieve_fl(object, out, coral_red_black_tree_set_last);
+    return retrieve_fl(object, out, seahorse_red_black_tree_last);
 }
 
 bool seahorse_red_black_tree_set_s_remove_item(
@@ -334,14 +464,13 @@ bool seahorse_red_black_tree_set_s_remove_item(
         return false;
     }
     on_destroy((void *) item);
-    seagrass_required_true(coral_red_black_tree_set_remove_item(
-            &object->set, item));
+    seahorse_red_black_tree_remove(&object->tree, (void *) item);
     return true;
 }
 
 static bool retrieve_np(const struct sea_turtle_string *const item,
                         const struct sea_turtle_string **const out,
-                        bool (*const func)(const void *, const void **)) {
+                        void *(*const func)(const void *)) {
     assert(func);
     if (!item) {
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_IS_NULL;
@@ -351,24 +480,344 @@ static bool retrieve_np(const struct sea_turtle_string *const item,
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
         return false;
     }
-    const bool result = func(item, (const void **) out);
+    const struct sea_turtle_string *const result = func(item);
     if (!result) {
-        seagrass_required_true(CORAL_RED_BLACK_TREE_SET_ERROR_END_OF_SEQUENCE
-                               == coral_error);
         seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_END_OF_SEQUENCE;
+        return false;
     }
-    return result;
+    *out = result;
+    return true;
 }
 
 bool seahorse_red_black_tree_set_s_next(
         const struct sea_turtle_string *const item,
         const struct sea_turtle_string **const out) {
-    return retrieve_np(item, out, coral_red_black_tree_set_next);
+    return retrieve_np(item, out, seahorse_red_black_tree_next);
 }
 
 bool seahorse_red_black_tree_set_s_prev(
         const struct sea_turtle_string *const item,
         const struct sea_turtle_string **const out) {
-    return retrieve_np(item, out, coral_red_black_tree_set_prev);
+    return retrieve_np(item, out, seahorse_red_black_tree_prev);
+}
+
+static const struct sea_turtle_string *first_of(
+        const struct seahorse_red_black_tree_set_s *const object) {
+    assert(object);
+    return seahorse_red_black_tree_first(&object->tree);
+}
+
+static const struct sea_turtle_string *next_of(
+        const struct sea_turtle_string *const item) {
+    assert(item);
+    return seahorse_red_black_tree_next(item);
+}
+
+#define LEFT                            1
+#define BOTH                            2
+#define RIGHT                           4
+
+/*
+ * Position in a side by side walk of two tree sets in order, along with the
+ * origins, out of LEFT, BOTH and RIGHT, of the values that it yields.
+ */
+struct walk {
+    const struct sea_turtle_string *a;
+    const struct sea_turtle_string *b;
+    int keep;
+};
+
+/*
+ * Advance walk to the next value whose origin is in keep and return it, or
+ * NULL once there are no more such values.
+ */
+static const struct sea_turtle_string *step(struct walk *const walk) {
+    assert(walk);
+    while ((walk->a && (walk->b || LEFT & walk->keep))
+           || (walk->b && RIGHT & walk->keep)) {
+        const int order = !walk->a ? 1
+                          : !walk->b ? -1
+                          : seahorse_chars_compare_string(walk->a, walk->b);
+        const struct sea_turtle_string *const a = walk->a;
+        const struct sea_turtle_string *const b = walk->b;
+        if (order <= 0) {
+            walk->a = next_of(a);
+        }
+        if (order >= 0) {
+            walk->b = next_of(b);
+        }
+        const int origin = order < 0 ? LEFT : order > 0 ? RIGHT : BOTH;
+        if (origin & walk->keep) {
+            return order > 0 ? b : a;
+        }
+    }
+    return NULL;
 }
 
+/*
+ * Fill the item of the next node with a copy of the next value of walk.
+ */
+static bool pick(void *const data, void *const context) {
+    const struct sea_turtle_string *const value = step(context);
+    assert(value);
+    if (!sea_turtle_string_init_string(data, value)) {
+        seagrass_required_true(SEA_TURTLE_STRING_ERROR_MEMORY_ALLOCATION_FAILED
+                               == sea_turtle_error);
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Walks left and right in order side by side, once to count the values whose
+ * origin is in keep and once more to build the tree set from them, so that
+ * each value is placed without a descent or rebalance of the tree set.
+ */
+static bool merge(struct seahorse_red_black_tree_set_s *const object,
+                  const struct seahorse_red_black_tree_set_s *const left,
+                  const struct seahorse_red_black_tree_set_s *const right,
+                  const int keep) {
+    assert(object);
+    assert(left);
+    assert(right);
+    const struct walk start = {
+            .a = first_of(left),
+            .b = first_of(right),
+            .keep = keep
+    };
+    struct walk walk = start;
+    uintmax_t count = 0;
+    for (; step(&walk); count++);
+    walk = start;
+    init(object, NULL);
+    if (!seahorse_red_black_tree_build(&object->tree, count, pick, on_destroy,
+                                       &walk)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        invalidate(object);
+        return false;
+    }
+    return true;
+}
+
+static bool combine(struct seahorse_red_black_tree_set_s *const object,
+                    const struct seahorse_red_black_tree_set_s *const left,
+                    const struct seahorse_red_black_tree_set_s *const right,
+                    const int keep) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!left) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL;
+        return false;
+    }
+    if (!right) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL;
+        return false;
+    }
+    return merge(object, left, right, keep);
+}
+
+bool seahorse_red_black_tree_set_s_init_union(
+        struct seahorse_red_black_tree_set_s *const object,
+        const struct seahorse_red_black_tree_set_s *const left,
+        const struct seahorse_red_black_tree_set_s *const right) {
+    return combine(object, left, right, LEFT | BOTH | RIGHT);
+}
+
+bool seahorse_red_black_tree_set_s_init_intersection(
+        struct seahorse_red_black_tree_set_s *const object,
+        const struct seahorse_red_black_tree_set_s *const left,
+        const struct seahorse_red_black_tree_set_s *const right) {
+    return combine(object, left, right, BOTH);
+}
+
+bool seahorse_red_black_tree_set_s_init_difference(
+        struct seahorse_red_black_tree_set_s *const object,
+        const struct seahorse_red_black_tree_set_s *const left,
+        const struct seahorse_red_black_tree_set_s *const right) {
+    return combine(object, left, right, LEFT);
+}
+
+bool seahorse_red_black_tree_set_s_is_subset(
+        const struct seahorse_red_black_tree_set_s *const object,
+        const struct seahorse_red_black_tree_set_s *const other,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const uintmax_t count = object->tree.count;
+    const uintmax_t limit = other->tree.count;
+    if (count > limit) {
+        *out = false;
+        return true;
+    }
+    const struct sea_turtle_string *a = first_of(object);
+    const struct sea_turtle_string *b = first_of(other);
+    while (a && b) {
+        const int order = seahorse_chars_compare_string(a, b);
+        if (order < 0) {
+            break;
+        }
+        if (!order) {
+            a = next_of(a);
+        }
+        b = next_of(b);
+    }
+    *out = !a;
+    return true;
+}
+
+/*
+ * Retrieve the first and last items of the range, which are both NULL if the
+ * range is empty.
+ */
+static bool within(
+        const struct seahorse_red_black_tree_set_s *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high,
+        const struct sea_turtle_string **const first,
+        const struct sea_turtle_string **const last) {
+    assert(object);
+    assert(first);
+    assert(last);
+    if (!seahorse_red_black_tree_set_s_ceiling(
+            object, low, first)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *first = NULL;
+    }
+    if (!seahorse_red_black_tree_set_s_floor(
+            object, high, last)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        *last = NULL;
+    }
+    if (!*first || !*last
+        || seahorse_red_black_tree_index(*first)
+           > seahorse_red_black_tree_index(*last)) {
+        *first = *last = NULL;
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_s_remove_range(
+        struct seahorse_red_black_tree_set_s *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    const struct sea_turtle_string *first;
+    const struct sea_turtle_string *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    if (first) {
+        seahorse_red_black_tree_remove_range(&object->tree, first, last,
+                                             on_destroy);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_s_count_range(
+        const struct seahorse_red_black_tree_set_s *const object,
+        const struct sea_turtle_string *const low,
+        const struct sea_turtle_string *const high,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!low || !high) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    const struct sea_turtle_string *first;
+    const struct sea_turtle_string *last;
+    if (!within(object, low, high, &first, &last)) {
+        return false;
+    }
+    *out = first
+           ? 1 + seahorse_red_black_tree_index(last)
+             - seahorse_red_black_tree_index(first)
+           : 0;
+    return true;
+}
+
+bool seahorse_red_black_tree_set_s_split_at(
+        struct seahorse_red_black_tree_set_s *const object,
+        const struct sea_turtle_string *const value,
+        struct seahorse_red_black_tree_set_s *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!value) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    init(out, object->tree.pool);
+    const struct sea_turtle_string *item;
+    if (!seahorse_red_black_tree_set_s_ceiling(object, value, &item)) {
+        if (SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND
+            != seahorse_error) {
+            return false;
+        }
+        item = NULL;
+    }
+    if (item) {
+        seahorse_red_black_tree_split(&object->tree, item, &out->tree);
+    }
+    return true;
+}
+
+bool seahorse_red_black_tree_set_s_join(
+        struct seahorse_red_black_tree_set_s *const object,
+        struct seahorse_red_black_tree_set_s *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!seahorse_red_black_tree_precedes(&object->tree, &other->tree)) {
+        seahorse_error = SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUES_OVERLAP;
+        return false;
+    }
+    if (!seahorse_red_black_tree_join(&object->tree, &other->tree)) {
+        seahorse_error =
+                SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,235 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define MINIMUM_CAPACITY                8
+
+bool seahorse_ring_queue_ni_init(struct seahorse_ring_queue_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    *object = (struct seahorse_ring_queue_ni) {0};
+    return true;
+}
+
+bool seahorse_ring_queue_ni_invalidate(
+        struct seahorse_ring_queue_ni *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    free(object->items);
+    *object = (struct seahorse_ring_queue_ni) {0};
+    return true;
+}
+
+bool seahorse_ring_queue_ni_count(
+        const struct seahorse_ring_queue_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+/*
+ * Copy count items starting at position from the ring into out, in at most
+ * two runs since the items may wrap around the end of the buffer.
+ */
+static void copy_out(const struct seahorse_ring_queue_ni *const object,
+                     const uintmax_t position,
+                     const uintmax_t count,
+                     uintmax_t *const out) {
+    assert(object);
+    assert(out);
+    assert(count <= object->count);
+    if (!count) {
+        return;
+    }
+    const uintmax_t start = position & (object->capacity - 1);
+    const uintmax_t first = object->capacity - start < count
+            ? object->capacity - start
+            : count;
+    memcpy(out, &object->items[start], first * sizeof(uintmax_t));
+    memcpy(&out[first], object->items, (count - first) * sizeof(uintmax_t));
+}
+
+static void copy_in(struct seahorse_ring_queue_ni *const object,
+                    const uintmax_t position,
+                    const uintmax_t count,
+                    const uintmax_t *const values) {
+    assert(object);
+    assert(values);
+    assert(object->count + count <= object->capacity);
+    const uintmax_t start = position & (object->capacity - 1);
+    const uintmax_t first = object->capacity - start < count
+            ? object->capacity - start
+            : count;
+    memcpy(&object->items[start], values, first * sizeof(uintmax_t));
+    memcpy(object->items, &values[first], (count - first) * sizeof(uintmax_t));
+}
+
+/*
+ * Make room for count more items, the items are laid out again from the
+ * start of the new buffer so that the head is back at zero.
+ */
+static bool reserve(struct seahorse_ring_queue_ni *const object,
+                    const uintmax_t count) {
+    assert(object);
+    uintmax_t required;
+    if (!seagrass_uintmax_t_add(object->count, count, &required)) {
+        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
+                               == seagrass_error);
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    if (required <= object->capacity) {
+        return true;
+    }
+    uintmax_t capacity = object->capacity
+            ? object->capacity
+            : MINIMUM_CAPACITY;
+    while (capacity < required) {
+        if (capacity > UINTMAX_MAX / 2) {
+            seahorse_error =
+                    SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+            return false;
+        }
+        capacity <<= 1;
+    }
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, sizeof(uintmax_t), &size)
+        || size > SIZE_MAX) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    uintmax_t *const items = malloc(size);
+    if (!items) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    copy_out(object, object->head, object->count, items);
+    free(object->items);
+    object->items = items;
+    object->capacity = capacity;
+    object->head = 0;
+    return true;
+}
+
+bool seahorse_ring_queue_ni_add(struct seahorse_ring_queue_ni *const object,
+                                const uintmax_t item) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!reserve(object, 1)) {
+        return false;
+    }
+    const uintmax_t position = (object->head + object->count)
+            & (object->capacity - 1);
+    object->items[position] = item;
+    object->count += 1;
+    return true;
+}
+
+bool seahorse_ring_queue_ni_add_all(
+        struct seahorse_ring_queue_ni *const object,
+        const uintmax_t count,
+        const uintmax_t *const values) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!values) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_VALUES_IS_NULL;
+        return false;
+    }
+    if (!reserve(object, count)) {
+        return false;
+    }
+    copy_in(object, object->head + object->count, count, values);
+    object->count += count;
+    return true;
+}
+
+bool seahorse_ring_queue_ni_remove(struct seahorse_ring_queue_ni *const object,
+                                   uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_QUEUE_IS_EMPTY;
+        return false;
+    }
+    *out = object->items[object->head];
+    object->head = (object->head + 1) & (object->capacity - 1);
+    object->count -= 1;
+    return true;
+}
+
+bool seahorse_ring_queue_ni_remove_all(
+        struct seahorse_ring_queue_ni *const object,
+        const uintmax_t count,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (count > object->count) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_OUT_OF_BOUNDS;
+        return false;
+    }
+    copy_out(object, object->head, count, out);
+    object->head = (object->head + count) & (object->capacity - 1);
+    object->count -= count;
+    return true;
+}
+
+bool seahorse_ring_queue_ni_peek(
+        const struct seahorse_ring_queue_ni *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (!object->count) {
+        seahorse_error = SEAHORSE_RING_QUEUE_NI_ERROR_QUEUE_IS_EMPTY;
+        return false;
+    }
+    *out = object->items[object->head];
+    return true;
+}
@@ -1,4 +1,7 @@
 #include <stdlib.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <sea-turtle.h>
 #include <seahorse.h>
 
 #include "private/sorted_set_i.h"
@@ -281,3 +284,179 @@ bool seahorse_sorted_set_i_lower(
     }
     return INVOKABLE->lower(object, value, out);
 }
+
+#pragma mark set algebra -
+
+static const struct sea_turtle_integer *first_of(
+        const struct seahorse_sorted_set_i *const object) {
+    assert(object);
+    const struct sea_turtle_integer *out;
+    if (seahorse_sorted_set_i_first(object, &out)) {
+        return out;
+    }
+    seagrass_required_true(SEAHORSE_SORTED_SET_I_ERROR_SET_IS_EMPTY
+                           == seahorse_error);
+    return NULL;
+}
+
+static const struct sea_turtle_integer *next_of(
+        const struct seahorse_sorted_set_i *const object,
+        const struct sea_turtle_integer *const item) {
+    assert(object);
+    assert(item);
+    const struct sea_turtle_integer *out;
+    if (seahorse_sorted_set_i_next(object, item, &out)) {
+        return out;
+    }
+    seagrass_required_true(SEAHORSE_SORTED_SET_I_ERROR_END_OF_SEQUENCE
+                           == seahorse_error);
+    return NULL;
+}
+
+bool seahorse_sorted_set_i_add_all(
+        struct seahorse_sorted_set_i *const object,
+        const struct seahorse_sorted_set_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (object == other) {
+        return true;
+    }
+    const struct sea_turtle_integer *a = first_of(object);
+    const struct sea_turtle_integer *b = first_of(other);
+    while (b) {
+        const int order = !a ? 1 : sea_turtle_integer_compare(a, b);
+        if (order < 0) {
+            a = next_of(object, a);
+            continue;
+        }
+        if (!order) {
+            a = next_of(object, a);
+        } else if (!seahorse_sorted_set_i_add(object, b)) {
+            seagrass_required_true(
+                    SEAHORSE_SORTED_SET_I_ERROR_MEMORY_ALLOCATION_FAILED
+                    == seahorse_error);
+            return false;
+        }
+        b = next_of(other, b);
+    }
+    return true;
+}
+
+bool seahorse_sorted_set_i_retain_all(
+        struct seahorse_sorted_set_i *const object,
+        const struct seahorse_sorted_set_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (object == other) {
+        return true;
+    }
+    const struct sea_turtle_integer *a = first_of(object);
+    const struct sea_turtle_integer *b = first_of(other);
+    while (a) {
+        const int order = !b ? -1 : sea_turtle_integer_compare(a, b);
+        if (order > 0) {
+            b = next_of(other, b);
+            continue;
+        }
+        const struct sea_turtle_integer *const next = next_of(object, a);
+        if (order < 0) {
+            seagrass_required_true(seahorse_sorted_set_i_remove_item(
+                    object, a));
+        } else {
+            b = next_of(other, b);
+        }
+        a = next;
+    }
+    return true;
+}
+
+bool seahorse_sorted_set_i_remove_all(
+        struct seahorse_sorted_set_i *const object,
+        const struct seahorse_sorted_set_i *const other) {
+    if (!object) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    const struct sea_turtle_integer *a = first_of(object);
+    if (object == other) {
+        while (a) {
+            const struct sea_turtle_integer *const next = next_of(object, a);
+            seagrass_required_true(seahorse_sorted_set_i_remove_item(
+                    object, a));
+            a = next;
+        }
+        return true;
+    }
+    const struct sea_turtle_integer *b = first_of(other);
+    while (a && b) {
+        const int order = sea_turtle_integer_compare(a, b);
+        if (order < 0) {
+            a = next_of(object, a);
+        } else if (order > 0) {
+            b = next_of(other, b);
+        } else {
+            const struct sea_turtle_integer *const next = next_of(object, a);
+            seagrass_required_true(seahorse_sorted_set_i_remove_item(
+                    object, a));
+            a = next;
+            b = next_of(other, b);
+        }
+    }
+    return true;
+}
+
+bool seahorse_sorted_set_i_is_subset(
+        const struct seahorse_sorted_set_i *const object,
+        const struct seahorse_sorted_set_i *const other,
+        bool *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!other) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_SORTED_SET_I_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    uintmax_t count;
+    seagrass_required_true(seahorse_sorted_set_i_count(object, &count));
+    uintmax_t limit;
+    seagrass_required_true(seahorse_sorted_set_i_count(other, &limit));
+    if (count > limit) {
+        *out = false;
+        return true;
+    }
+    const struct sea_turtle_integer *a = first_of(object);
+    const struct sea_turtle_integer *b = first_of(other);
+    while (a && b) {
+        const int order = sea_turtle_integer_compare(a, b);
+        if (order < 0) {
+            break;
+        }
+        if (!order) {
+            a = next_of(object, a);
+        }
+        b = next_of(other, b);
+    }
+    *out = !a;
+    return true;
+}
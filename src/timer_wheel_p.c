@@ -0,0 +1,430 @@
+#include <stdlib.h>
+#include <limits.h>
+#include <assert.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define LEVEL_BITS                      6
+#define SLOTS                           (1 << LEVEL_BITS)
+#define LEVELS                          \
+    ((sizeof(uintmax_t) * CHAR_BIT + LEVEL_BITS - 1) / LEVEL_BITS)
+#define DUE                             LEVELS
+
+/*
+ * Circular doubly linked list node, the heads of the lists being sentinels
+ * so that an entry can unlink itself without knowing its slot.
+ */
+struct link {
+    struct link *next;
+    struct link *prev;
+};
+
+struct seahorse_timer_wheel_p_entry {
+    struct link link;
+    uintmax_t deadline;
+    void *item;
+    unsigned level;
+    unsigned slot;
+};
+
+/*
+ * Each level has a bit set in occupied for every slot that is not empty so
+ * that advancing skips over empty slots. Entries whose item is due wait in
+ * due until advance hands them out.
+ */
+struct state {
+    uint64_t occupied[LEVELS];
+    struct link slots[LEVELS][SLOTS];
+    struct link due;
+};
+
+static void list_init(struct link *const head) {
+    assert(head);
+    head->next = head->prev = head;
+}
+
+static bool list_is_empty(const struct link *const head) {
+    assert(head);
+    return head->next == head;
+}
+
+static void list_append(struct link *const head, struct link *const link) {
+    assert(head);
+    assert(link);
+    link->prev = head->prev;
+    link->next = head;
+    head->prev->next = link;
+    head->prev = link;
+}
+
+static void list_remove(struct link *const link) {
+    assert(link);
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+}
+
+/*
+ * Move all the links of from onto the end of to, leaving from empty.
+ */
+static void list_splice(struct link *const to, struct link *const from) {
+    assert(to);
+    assert(from);
+    if (list_is_empty(from)) {
+        return;
+    }
+    from->next->prev = to->prev;
+    to->prev->next = from->next;
+    from->prev->next = to;
+    to->prev = from->prev;
+    list_init(from);
+}
+
+static unsigned msb(const uintmax_t value) {
+    assert(value);
+#if defined(__GNUC__)
+    return (unsigned) (sizeof(unsigned long long) * CHAR_BIT - 1
+                       - __builtin_clzll(value));
+#else
+    unsigned result = 0;
+    for (uintmax_t i = value >> 1; i; i >>= 1) {
+        result++;
+    }
+    return result;
+#endif
+}
+
+static unsigned lsb(const uint64_t value) {
+    assert(value);
+#if defined(__GNUC__)
+    return (unsigned) __builtin_ctzll(value);
+#else
+    unsigned result = 0;
+    for (uint64_t i = value; !(i & 1); i >>= 1) {
+        result++;
+    }
+    return result;
+#endif
+}
+
+static uint64_t rotate_left(const uint64_t value, const unsigned count) {
+    assert(count < 64);
+    return count
+           ? value << count | value >> (64 - count)
+           : value;
+}
+
+/*
+ * Link entry into the slot for its deadline, which is at the level of the
+ * most significant bit in which the deadline differs from now.
+ */
+static void place(struct state *const state,
+                  const uintmax_t now,
+                  struct seahorse_timer_wheel_p_entry *const entry) {
+    assert(state);
+    assert(entry);
+    if (entry->deadline <= now) {
+        entry->level = DUE;
+        list_append(&state->due, &entry->link);
+        return;
+    }
+    entry->level = msb(entry->deadline ^ now) / LEVEL_BITS;
+    entry->slot = (unsigned) (entry->deadline >> (entry->level * LEVEL_BITS))
+            & (SLOTS - 1);
+    list_append(&state->slots[entry->level][entry->slot], &entry->link);
+    state->occupied[entry->level] |= (uint64_t) 1 << entry->slot;
+}
+
+static void unplace(struct state *const state,
+                    struct seahorse_timer_wheel_p_entry *const entry) {
+    assert(state);
+    assert(entry);
+    list_remove(&entry->link);
+    if (DUE != entry->level
+        && list_is_empty(&state->slots[entry->level][entry->slot])) {
+        state->occupied[entry->level] &= ~((uint64_t) 1 << entry->slot);
+    }
+}
+
+bool seahorse_timer_wheel_p_init(struct seahorse_timer_wheel_p *const object,
+                                 const uintmax_t now) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = malloc(sizeof(struct state));
+    if (!state) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    for (unsigned i = 0; i < LEVELS; i++) {
+        state->occupied[i] = 0;
+        for (unsigned j = 0; j < SLOTS; j++) {
+            list_init(&state->slots[i][j]);
+        }
+    }
+    list_init(&state->due);
+    *object = (struct seahorse_timer_wheel_p) {
+            .now = now,
+            .data = state
+    };
+    return true;
+}
+
+static void destroy(struct link *const head,
+                    void (*const on_destroy)(void *item)) {
+    assert(head);
+    struct link *link = head->next;
+    while (link != head) {
+        struct seahorse_timer_wheel_p_entry *const entry =
+                (struct seahorse_timer_wheel_p_entry *) link;
+        link = link->next;
+        if (on_destroy) {
+            on_destroy(entry->item);
+        }
+        free(entry);
+    }
+}
+
+bool seahorse_timer_wheel_p_invalidate(
+        struct seahorse_timer_wheel_p *const object,
+        void (*const on_destroy)(void *item)) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    if (state) {
+        for (unsigned i = 0; i < LEVELS; i++) {
+            for (uint64_t j = state->occupied[i]; j; j &= j - 1) {
+                destroy(&state->slots[i][lsb(j)], on_destroy);
+            }
+        }
+        destroy(&state->due, on_destroy);
+        free(state);
+    }
+    *object = (struct seahorse_timer_wheel_p) {0};
+    return true;
+}
+
+bool seahorse_timer_wheel_p_count(
+        const struct seahorse_timer_wheel_p *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->count;
+    return true;
+}
+
+bool seahorse_timer_wheel_p_now(
+        const struct seahorse_timer_wheel_p *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = object->now;
+    return true;
+}
+
+bool seahorse_timer_wheel_p_schedule(
+        struct seahorse_timer_wheel_p *const object,
+        const uintmax_t deadline,
+        void *const item,
+        const struct seahorse_timer_wheel_p_entry **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct seahorse_timer_wheel_p_entry *const entry = malloc(
+            sizeof(struct seahorse_timer_wheel_p_entry));
+    if (!entry) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    entry->deadline = deadline;
+    entry->item = item;
+    place(object->data, object->now, entry);
+    object->count += 1;
+    *out = entry;
+    return true;
+}
+
+bool seahorse_timer_wheel_p_cancel(
+        struct seahorse_timer_wheel_p *const object,
+        const struct seahorse_timer_wheel_p_entry *const entry) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    struct seahorse_timer_wheel_p_entry *const e =
+            (struct seahorse_timer_wheel_p_entry *) entry;
+    unplace(object->data, e);
+    free(e);
+    object->count -= 1;
+    return true;
+}
+
+bool seahorse_timer_wheel_p_reschedule(
+        struct seahorse_timer_wheel_p *const object,
+        const struct seahorse_timer_wheel_p_entry *const entry,
+        const uintmax_t deadline) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    struct seahorse_timer_wheel_p_entry *const e =
+            (struct seahorse_timer_wheel_p_entry *) entry;
+    unplace(object->data, e);
+    e->deadline = deadline;
+    place(object->data, object->now, e);
+    return true;
+}
+
+/*
+ * Gather the entries of every slot whose span time has moved into, level by
+ * level, and place them again relative to now. Those that are due end up in
+ * due while the rest cascade to a lower level.
+ */
+static void turn(struct seahorse_timer_wheel_p *const object,
+                 const uintmax_t now) {
+    assert(object);
+    assert(now > object->now);
+    struct state *const state = object->data;
+    struct link pending;
+    list_init(&pending);
+    for (unsigned i = 0; i < LEVELS; i++) {
+        const unsigned shift = i * LEVEL_BITS;
+        const uintmax_t from = object->now >> shift;
+        const uintmax_t to = now >> shift;
+        if (from == to) {
+            break;
+        }
+        uint64_t slots = UINT64_MAX;
+        if (to - from < SLOTS) {
+            /* the slots after the current one up to and including to */
+            slots = rotate_left(((uint64_t) 1 << (to - from)) - 1,
+                                (unsigned) (from + 1) & (SLOTS - 1));
+        }
+        slots &= state->occupied[i];
+        state->occupied[i] &= ~slots;
+        for (; slots; slots &= slots - 1) {
+            list_splice(&pending, &state->slots[i][lsb(slots)]);
+        }
+    }
+    object->now = now;
+    while (!list_is_empty(&pending)) {
+        struct seahorse_timer_wheel_p_entry *const entry =
+                (struct seahorse_timer_wheel_p_entry *) pending.next;
+        list_remove(&entry->link);
+        place(state, now, entry);
+    }
+}
+
+bool seahorse_timer_wheel_p_advance(
+        struct seahorse_timer_wheel_p *const object,
+        const uintmax_t now,
+        const uintmax_t count,
+        void **const items,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!count) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_COUNT_IS_ZERO;
+        return false;
+    }
+    if (!items) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_ITEMS_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    if (now < object->now) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_NOW_IS_OUT_OF_BOUNDS;
+        return false;
+    }
+    if (now > object->now) {
+        turn(object, now);
+    }
+    struct state *const state = object->data;
+    uintmax_t result = 0;
+    for (; result < count && !list_is_empty(&state->due); result++) {
+        struct seahorse_timer_wheel_p_entry *const entry =
+                (struct seahorse_timer_wheel_p_entry *) state->due.next;
+        list_remove(&entry->link);
+        items[result] = entry->item;
+        free(entry);
+    }
+    object->count -= result;
+    *out = result;
+    return true;
+}
+
+bool seahorse_timer_wheel_p_entry_deadline(
+        const struct seahorse_timer_wheel_p *const object,
+        const struct seahorse_timer_wheel_p_entry *const entry,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = entry->deadline;
+    return true;
+}
+
+bool seahorse_timer_wheel_p_entry_item(
+        const struct seahorse_timer_wheel_p *const object,
+        const struct seahorse_timer_wheel_p_entry *const entry,
+        void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!entry) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    *out = entry->item;
+    return true;
+}
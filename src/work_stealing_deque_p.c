@@ -0,0 +1,256 @@
+#include <stdlib.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <seagrass.h>
+#include <seahorse.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define CACHE_LINE                      64
+#define INITIAL_CAPACITY                32
+
+/*
+ * Circular array of items, replaced by one twice as large when the owner
+ * runs out of room. Replaced arrays are chained through retired and kept
+ * until the deque is invalidated since a thief may still be reading them.
+ */
+struct array {
+    uintmax_t mask;
+    struct array *retired;
+    _Atomic(void *) items[];
+};
+
+/*
+ * Items live at positions [top, bottom), top being advanced by thieves and
+ * by the owner taking the last item, bottom only ever being written by the
+ * owner. Positions are unsigned and compared through their difference so
+ * that they may wrap around.
+ */
+struct state {
+    _Alignas(CACHE_LINE) atomic_uintmax_t top;
+    _Alignas(CACHE_LINE) atomic_uintmax_t bottom;
+    _Atomic(struct array *) array;
+};
+
+static struct array *array_of(const uintmax_t capacity) {
+    assert(capacity && !(capacity & (capacity - 1)));
+    uintmax_t size;
+    if (!seagrass_uintmax_t_multiply(capacity, sizeof(void *), &size)
+        || !seagrass_uintmax_t_add(size, sizeof(struct array), &size)
+        || size > SIZE_MAX) {
+        seahorse_error =
+                SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return NULL;
+    }
+    struct array *const array = malloc(size);
+    if (!array) {
+        seahorse_error =
+                SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return NULL;
+    }
+    array->mask = capacity - 1;
+    array->retired = NULL;
+    return array;
+}
+
+bool seahorse_work_stealing_deque_p_init(
+        struct seahorse_work_stealing_deque_p *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    void *data;
+    if (posix_memalign(&data, CACHE_LINE, sizeof(struct state))) {
+        seahorse_error =
+                SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return false;
+    }
+    struct state *const state = data;
+    struct array *const array = array_of(INITIAL_CAPACITY);
+    if (!array) {
+        free(state);
+        return false;
+    }
+    atomic_init(&state->top, 0);
+    atomic_init(&state->bottom, 0);
+    atomic_init(&state->array, array);
+    *object = (struct seahorse_work_stealing_deque_p) {
+            .data = state
+    };
+    return true;
+}
+
+bool seahorse_work_stealing_deque_p_invalidate(
+        struct seahorse_work_stealing_deque_p *const object) {
+    if (!object) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    if (state) {
+        struct array *array = atomic_load(&state->array);
+        while (array) {
+            struct array *const retired = array->retired;
+            free(array);
+            array = retired;
+        }
+        free(state);
+    }
+    *object = (struct seahorse_work_stealing_deque_p) {0};
+    return true;
+}
+
+bool seahorse_work_stealing_deque_p_count(
+        const struct seahorse_work_stealing_deque_p *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    const uintmax_t top = atomic_load(&state->top);
+    const uintmax_t bottom = atomic_load(&state->bottom);
+    const intmax_t count = (intmax_t) (bottom - top);
+    *out = count > 0 ? (uintmax_t) count : 0;
+    return true;
+}
+
+static struct array *grow(struct state *const state,
+                          struct array *const array,
+                          const uintmax_t top,
+                          const uintmax_t bottom) {
+    assert(state);
+    assert(array);
+    if (array->mask > UINTMAX_MAX / 2) {
+        seahorse_error =
+                SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED;
+        return NULL;
+    }
+    struct array *const result = array_of(2 * (array->mask + 1));
+    if (!result) {
+        return NULL;
+    }
+    for (uintmax_t i = top; i != bottom; i++) {
+        atomic_init(&result->items[i & result->mask],
+                    atomic_load_explicit(&array->items[i & array->mask],
+                                         memory_order_relaxed));
+    }
+    result->retired = array;
+    atomic_store_explicit(&state->array, result, memory_order_release);
+    return result;
+}
+
+bool seahorse_work_stealing_deque_p_push(
+        struct seahorse_work_stealing_deque_p *const object,
+        void *const item) {
+    if (!object) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    const uintmax_t bottom = atomic_load_explicit(&state->bottom,
+                                                  memory_order_relaxed);
+    const uintmax_t top = atomic_load_explicit(&state->top,
+                                               memory_order_acquire);
+    struct array *array = atomic_load_explicit(&state->array,
+                                               memory_order_relaxed);
+    if (bottom - top > array->mask) {
+        array = grow(state, array, top, bottom);
+        if (!array) {
+            return false;
+        }
+    }
+    atomic_store_explicit(&array->items[bottom & array->mask], item,
+                          memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&state->bottom, bottom + 1, memory_order_relaxed);
+    return true;
+}
+
+bool seahorse_work_stealing_deque_p_pop(
+        struct seahorse_work_stealing_deque_p *const object,
+        void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    /* claim the bottom item before looking at what thieves have taken */
+    const uintmax_t bottom = atomic_load_explicit(&state->bottom,
+                                                  memory_order_relaxed) - 1;
+    struct array *const array = atomic_load_explicit(&state->array,
+                                                     memory_order_relaxed);
+    atomic_store_explicit(&state->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    uintmax_t top = atomic_load_explicit(&state->top, memory_order_relaxed);
+    const intmax_t difference = (intmax_t) (bottom - top);
+    if (difference < 0) {
+        atomic_store_explicit(&state->bottom, bottom + 1,
+                              memory_order_relaxed);
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY;
+        return false;
+    }
+    void *const item = atomic_load_explicit(&array->items[bottom & array->mask],
+                                            memory_order_relaxed);
+    if (difference > 0) {
+        *out = item;
+        return true;
+    }
+    /* last item, race the thieves for it */
+    const bool result = atomic_compare_exchange_strong_explicit(
+            &state->top, &top, top + 1,
+            memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&state->bottom, bottom + 1, memory_order_relaxed);
+    if (!result) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY;
+        return false;
+    }
+    *out = item;
+    return true;
+}
+
+bool seahorse_work_stealing_deque_p_steal(
+        struct seahorse_work_stealing_deque_p *const object,
+        void **const out) {
+    if (!object) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL;
+        return false;
+    }
+    if (!out) {
+        seahorse_error = SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL;
+        return false;
+    }
+    struct state *const state = object->data;
+    for (;;) {
+        uintmax_t top = atomic_load_explicit(&state->top,
+                                             memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        const uintmax_t bottom = atomic_load_explicit(&state->bottom,
+                                                      memory_order_acquire);
+        if ((intmax_t) (bottom - top) <= 0) {
+            seahorse_error =
+                    SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY;
+            return false;
+        }
+        struct array *const array = atomic_load_explicit(
+                &state->array, memory_order_acquire);
+        void *const item = atomic_load_explicit(
+                &array->items[top & array->mask], memory_order_relaxed);
+        if (atomic_compare_exchange_strong_explicit(
+                &state->top, &top, top + 1,
+                memory_order_seq_cst, memory_order_relaxed)) {
+            *out = item;
+            return true;
+        }
+    }
+}
@@ -201,6 +201,55 @@ static void check_add(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_array_list_i_add_take(NULL, (void *)1));
+    assert_int_equal(SEAHORSE_ARRAY_LIST_I_ERROR_OBJECT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_array_list_i_add_take((void *)1, NULL));
+    assert_int_equal(SEAHORSE_ARRAY_LIST_I_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_array_list_i object;
+    assert_true(seahorse_array_list_i_init(&object, 0));
+    struct sea_turtle_integer i;
+    assert_true(sea_turtle_integer_init(&i));
+    calloc_is_overridden = true;
+    assert_false(seahorse_array_list_i_add_take(&object, &i));
+    calloc_is_overridden = false;
+    assert_int_equal(SEAHORSE_ARRAY_LIST_I_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&i));
+    assert_true(seahorse_array_list_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_array_list_i object;
+    assert_true(seahorse_array_list_i_init(&object, 0));
+    struct sea_turtle_integer i;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &i, rand() % UINTMAX_MAX));
+    uintmax_t out;
+    assert_true(seahorse_array_list_i_get_length(&object, &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_array_list_i_add_take(&object, &i));
+    assert_true(seahorse_array_list_i_get_length(&object, &out));
+    assert_int_equal(out, 1);
+    assert_true(sea_turtle_integer_invalidate(&i));
+    assert_true(seahorse_array_list_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_add_all_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_array_list_i_add_all(NULL, 1, (void *)1));
@@ -372,6 +421,76 @@ static void check_insert(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_insert_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_array_list_i_insert_take(NULL, 0, (void *)1));
+    assert_int_equal(SEAHORSE_ARRAY_LIST_I_ERROR_OBJECT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_insert_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_array_list_i_insert_take((void *)1, 0, NULL));
+    assert_int_equal(SEAHORSE_ARRAY_LIST_I_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_insert_take_error_on_index_out_of_bounds(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_array_list_i object;
+    assert_true(seahorse_array_list_i_init(&object, 0));
+    struct sea_turtle_integer i;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &i, rand() % UINTMAX_MAX));
+    assert_false(seahorse_array_list_i_insert_take(&object, 0, &i));
+    assert_int_equal(SEAHORSE_ARRAY_LIST_I_ERROR_INDEX_IS_OUT_OF_BOUNDS,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&i));
+    assert_true(seahorse_array_list_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_insert_take_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_array_list_i object;
+    assert_true(seahorse_array_list_i_init(&object, 0));
+    struct sea_turtle_integer i;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &i, rand() % UINTMAX_MAX));
+    assert_true(seahorse_array_list_i_add(&object, &i));
+    assert_true(seahorse_array_list_i_shrink(&object));
+    realloc_is_overridden = true;
+    assert_false(seahorse_array_list_i_insert_take(&object, 0, &i));
+    realloc_is_overridden = false;
+    assert_int_equal(SEAHORSE_ARRAY_LIST_I_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&i));
+    assert_true(seahorse_array_list_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_insert_take(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_array_list_i object;
+    assert_true(seahorse_array_list_i_init(&object, 0));
+    struct sea_turtle_integer i;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &i, rand() % UINTMAX_MAX));
+    assert_true(seahorse_array_list_i_add(&object,&i));
+    uintmax_t out;
+    assert_true(seahorse_array_list_i_get_length(&object, &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_array_list_i_insert_take(&object, 0, &i));
+    assert_true(seahorse_array_list_i_get_length(&object, &out));
+    assert_int_equal(out, 2);
+    assert_true(sea_turtle_integer_invalidate(&i));
+    assert_true(seahorse_array_list_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_insert_all_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_array_list_i_insert_all(NULL, 0, 1, (void *)1));
@@ -868,6 +987,10 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add_error_on_value_is_null),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_value_is_null),
+            cmocka_unit_test(check_add_take_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_take),
             cmocka_unit_test(check_add_all_error_on_object_is_null),
             cmocka_unit_test(check_add_all_error_on_count_is_zero),
             cmocka_unit_test(check_add_all_error_on_values_is_null),
@@ -881,6 +1004,11 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_insert_error_on_index_out_of_bounds),
             cmocka_unit_test(check_insert_error_on_memory_allocation_failed),
             cmocka_unit_test(check_insert),
+            cmocka_unit_test(check_insert_take_error_on_object_is_null),
+            cmocka_unit_test(check_insert_take_error_on_value_is_null),
+            cmocka_unit_test(check_insert_take_error_on_index_out_of_bounds),
+            cmocka_unit_test(check_insert_take_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_insert_take),
             cmocka_unit_test(check_insert_all_error_on_object_is_null),
             cmocka_unit_test(check_insert_all_error_on_count_is_zero),
             cmocka_unit_test(check_insert_all_error_on_values_is_null),
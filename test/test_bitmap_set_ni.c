@@ -0,0 +1,914 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object = {};
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_init(NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.length, 0);
+    assert_null(object.data);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_bitmap_set_ni_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_init_bitmap_set_ni(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_bitmap_set_ni_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_init_bitmap_set_ni((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_bitmap_set_ni(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 3 * i));
+    }
+    assert_true(seahorse_bitmap_set_ni_add(&object, UINTMAX_MAX));
+    struct seahorse_bitmap_set_ni copy;
+    assert_true(seahorse_bitmap_set_ni_init_bitmap_set_ni(&copy, &object));
+    assert_int_equal(copy.count, 10001);
+    bool out;
+    for (uintmax_t i = 0; i < 30000; i++) {
+        assert_true(seahorse_bitmap_set_ni_contains(&copy, i, &out));
+        assert_int_equal(out, 0 == i % 3);
+    }
+    assert_true(seahorse_bitmap_set_ni_contains(&copy, UINTMAX_MAX, &out));
+    assert_true(out);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&copy));
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_bitmap_set_ni_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 10 * i));
+    }
+    struct seahorse_bitmap_set_ni copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_bitmap_set_ni_init_bitmap_set_ni(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_bitmap_set_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_bitmap_set_ni_add(&object, 7));
+    assert_true(seahorse_bitmap_set_ni_add(&object, 1 + UINT16_MAX));
+    assert_true(seahorse_bitmap_set_ni_count(&object, &count));
+    assert_int_equal(count, 2);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_add(NULL, 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_value_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    assert_true(seahorse_bitmap_set_ni_add(&object, 100));
+    assert_false(seahorse_bitmap_set_ni_add(&object, 100));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_bitmap_set_ni_add(&object, 1));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    bool out;
+    assert_true(seahorse_bitmap_set_ni_contains(&object, 42, &out));
+    assert_false(out);
+    assert_true(seahorse_bitmap_set_ni_add(&object, 42));
+    assert_true(seahorse_bitmap_set_ni_contains(&object, 42, &out));
+    assert_true(out);
+    assert_int_equal(object.count, 1);
+    assert_int_equal(object.length, 1);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_dense_values(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 3 * 65536; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(
+                &object, (i * 7919) % (3 * 65536)));
+    }
+    assert_int_equal(object.count, 3 * 65536);
+    assert_int_equal(object.length, 3);
+    bool out;
+    for (uintmax_t i = 0; i < 3 * 65536; i++) {
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i, &out));
+        assert_true(out);
+    }
+    assert_true(seahorse_bitmap_set_ni_contains(&object, 3 * 65536, &out));
+    assert_false(out);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_sparse_values(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, i << 40));
+    }
+    assert_int_equal(object.count, 1000);
+    assert_int_equal(object.length, 1000);
+    bool out;
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i << 40, &out));
+        assert_true(out);
+        assert_true(seahorse_bitmap_set_ni_contains(
+                &object, 1 + (i << 40), &out));
+        assert_false(out);
+    }
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_remove(NULL, 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_value_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    assert_false(seahorse_bitmap_set_ni_remove(&object, 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_add(&object, 2));
+    assert_false(seahorse_bitmap_set_ni_remove(&object, 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, i));
+    }
+    bool out;
+    for (uintmax_t i = 0; i < 10000; i += 2) {
+        assert_true(seahorse_bitmap_set_ni_remove(&object, i));
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i, &out));
+        assert_false(out);
+    }
+    assert_int_equal(object.count, 5000);
+    for (uintmax_t i = 1; i < 10000; i += 2) {
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i, &out));
+        assert_true(out);
+        assert_true(seahorse_bitmap_set_ni_remove(&object, i));
+    }
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.length, 0);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_contains(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_contains((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    bool out;
+    assert_true(seahorse_bitmap_set_ni_contains(&object, 0, &out));
+    assert_false(out);
+    assert_true(seahorse_bitmap_set_ni_add(&object, 0));
+    assert_true(seahorse_bitmap_set_ni_contains(&object, 0, &out));
+    assert_true(out);
+    assert_true(seahorse_bitmap_set_ni_contains(&object, UINTMAX_MAX, &out));
+    assert_false(out);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_ceiling(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_ceiling((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_value_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_bitmap_set_ni_ceiling(&object, 100, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_add(&object, 100));
+    assert_false(seahorse_bitmap_set_ni_ceiling(&object, 101, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_floor(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_floor((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_value_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_bitmap_set_ni_floor(&object, 100, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_add(&object, 100));
+    assert_false(seahorse_bitmap_set_ni_floor(&object, 99, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 10 * i));
+    }
+    assert_true(seahorse_bitmap_set_ni_add(&object, 1 << 30));
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_ceiling(&object, 100, &out));
+    assert_int_equal(out, 100);
+    assert_true(seahorse_bitmap_set_ni_ceiling(&object, 105, &out));
+    assert_int_equal(out, 110);
+    assert_true(seahorse_bitmap_set_ni_ceiling(&object, 0, &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_bitmap_set_ni_ceiling(&object, 99991, &out));
+    assert_int_equal(out, 1 << 30);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    assert_true(seahorse_bitmap_set_ni_add(&object, 5));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, (1 << 30) + 10 * i));
+    }
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_floor(&object, (1 << 30) + 100, &out));
+    assert_int_equal(out, (1 << 30) + 100);
+    assert_true(seahorse_bitmap_set_ni_floor(&object, (1 << 30) + 105, &out));
+    assert_int_equal(out, (1 << 30) + 100);
+    assert_true(seahorse_bitmap_set_ni_floor(&object, UINTMAX_MAX, &out));
+    assert_int_equal(out, (1 << 30) + 99990);
+    assert_true(seahorse_bitmap_set_ni_floor(&object, (1 << 30) - 1, &out));
+    assert_int_equal(out, 5);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_first(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_first((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_set_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_bitmap_set_ni_first(&object, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_SET_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_last(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_last((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_set_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_bitmap_set_ni_last(&object, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_SET_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 100000 - 10 * i));
+    }
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_first(&object, &out));
+    assert_int_equal(out, 10);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 10 * i));
+    }
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_last(&object, &out));
+    assert_int_equal(out, 99990);
+    assert_true(seahorse_bitmap_set_ni_add(&object, UINTMAX_MAX));
+    assert_true(seahorse_bitmap_set_ni_last(&object, &out));
+    assert_true(UINTMAX_MAX == out);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_next(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_next((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_error_on_end_of_sequence(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_add(&object, UINTMAX_MAX));
+    assert_false(seahorse_bitmap_set_ni_next(&object, UINTMAX_MAX, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_prev(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_prev((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_error_on_end_of_sequence(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_add(&object, 0));
+    assert_false(seahorse_bitmap_set_ni_prev(&object, 0, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 1000 * i));
+    }
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_first(&object, &out));
+    for (uintmax_t i = 1; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_next(&object, out, &out));
+        assert_int_equal(out, 1000 * i);
+    }
+    assert_false(seahorse_bitmap_set_ni_next(&object, out, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 100000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 3 * i));
+    }
+    uintmax_t out;
+    assert_true(seahorse_bitmap_set_ni_last(&object, &out));
+    for (uintmax_t i = 99999; i > 0; i--) {
+        assert_true(seahorse_bitmap_set_ni_prev(&object, out, &out));
+        assert_int_equal(out, 3 * (i - 1));
+    }
+    assert_false(seahorse_bitmap_set_ni_prev(&object, out, &out));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_union_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_union(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_union_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_union((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_union(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    struct seahorse_bitmap_set_ni other;
+    assert_true(seahorse_bitmap_set_ni_init(&other));
+    for (uintmax_t i = 0; i < 200000; i++) {
+        if (0 == i % 2) {
+            assert_true(seahorse_bitmap_set_ni_add(&object, i));
+        }
+        if (0 == i % 3) {
+            assert_true(seahorse_bitmap_set_ni_add(&other, i));
+        }
+    }
+    for (uintmax_t i = 1; i < 100; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, (i << 32) | 1));
+        assert_true(seahorse_bitmap_set_ni_add(&other, (i << 33) | 1));
+    }
+    assert_true(seahorse_bitmap_set_ni_union(&object, &other));
+    uintmax_t count = 0;
+    bool out;
+    for (uintmax_t i = 0; i < 200000; i++) {
+        const bool expected = 0 == i % 2 || 0 == i % 3;
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    for (uintmax_t i = 1; i < 200; i++) {
+        const bool expected = i < 100 || 0 == i % 2;
+        assert_true(seahorse_bitmap_set_ni_contains(
+                &object, (i << 32) | 1, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    assert_int_equal(object.count, count);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&other));
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_intersection_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_intersection(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_intersection_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_intersection((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_intersection(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    struct seahorse_bitmap_set_ni other;
+    assert_true(seahorse_bitmap_set_ni_init(&other));
+    for (uintmax_t i = 0; i < 200000; i++) {
+        if (0 == i % 2) {
+            assert_true(seahorse_bitmap_set_ni_add(&object, i));
+        }
+        if (0 == i % 3) {
+            assert_true(seahorse_bitmap_set_ni_add(&other, i));
+        }
+    }
+    for (uintmax_t i = 1; i < 100; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, (i << 32) | 1));
+        assert_true(seahorse_bitmap_set_ni_add(&other, (i << 33) | 1));
+    }
+    assert_true(seahorse_bitmap_set_ni_intersection(&object, &other));
+    uintmax_t count = 0;
+    bool out;
+    for (uintmax_t i = 0; i < 200000; i++) {
+        const bool expected = 0 == i % 2 && 0 == i % 3;
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    for (uintmax_t i = 1; i < 200; i++) {
+        const bool expected = i < 100 && 0 == i % 2;
+        assert_true(seahorse_bitmap_set_ni_contains(
+                &object, (i << 32) | 1, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    assert_int_equal(object.count, count);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&other));
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_difference_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_difference(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_difference_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_bitmap_set_ni_difference((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_difference(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    struct seahorse_bitmap_set_ni other;
+    assert_true(seahorse_bitmap_set_ni_init(&other));
+    for (uintmax_t i = 0; i < 200000; i++) {
+        if (0 == i % 2) {
+            assert_true(seahorse_bitmap_set_ni_add(&object, i));
+        }
+        if (0 == i % 3) {
+            assert_true(seahorse_bitmap_set_ni_add(&other, i));
+        }
+    }
+    for (uintmax_t i = 1; i < 100; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, (i << 32) | 1));
+        assert_true(seahorse_bitmap_set_ni_add(&other, (i << 33) | 1));
+    }
+    assert_true(seahorse_bitmap_set_ni_difference(&object, &other));
+    uintmax_t count = 0;
+    bool out;
+    for (uintmax_t i = 0; i < 200000; i++) {
+        const bool expected = 0 == i % 2 && !(0 == i % 3);
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    for (uintmax_t i = 1; i < 200; i++) {
+        const bool expected = i < 100 && !(0 == i % 2);
+        assert_true(seahorse_bitmap_set_ni_contains(
+                &object, (i << 32) | 1, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    assert_int_equal(object.count, count);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&other));
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_union_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    struct seahorse_bitmap_set_ni other;
+    assert_true(seahorse_bitmap_set_ni_init(&other));
+    for (uintmax_t i = 0; i < 200000; i++) {
+        if (0 == i % 2) {
+            assert_true(seahorse_bitmap_set_ni_add(&object, i));
+        }
+        if (0 == i % 3) {
+            assert_true(seahorse_bitmap_set_ni_add(&other, i));
+        }
+    }
+    for (uintmax_t i = 1; i < 100; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, (i << 32) | 1));
+        assert_true(seahorse_bitmap_set_ni_add(&other, (i << 33) | 1));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_bitmap_set_ni_union(&object, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_BITMAP_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    uintmax_t count = 0;
+    bool out;
+    for (uintmax_t i = 0; i < 200000; i++) {
+        const bool expected = 0 == i % 2;
+        assert_true(seahorse_bitmap_set_ni_contains(&object, i, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    for (uintmax_t i = 1; i < 200; i++) {
+        const bool expected = i < 100;
+        assert_true(seahorse_bitmap_set_ni_contains(
+                &object, (i << 32) | 1, &out));
+        assert_int_equal(out, expected);
+        count += expected;
+    }
+    assert_int_equal(object.count, count);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&other));
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_union_self(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10000; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, 5 * i));
+    }
+    assert_true(seahorse_bitmap_set_ni_union(&object, &object));
+    assert_int_equal(object.count, 10000);
+    assert_true(seahorse_bitmap_set_ni_intersection(&object, &object));
+    assert_int_equal(object.count, 10000);
+    assert_true(seahorse_bitmap_set_ni_difference(&object, &object));
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_after_intersection(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_bitmap_set_ni object;
+    assert_true(seahorse_bitmap_set_ni_init(&object));
+    struct seahorse_bitmap_set_ni other;
+    assert_true(seahorse_bitmap_set_ni_init(&other));
+    for (uintmax_t i = 0; i < 200000; i++) {
+        if (0 == i % 2) {
+            assert_true(seahorse_bitmap_set_ni_add(&object, i));
+        }
+        if (0 == i % 3) {
+            assert_true(seahorse_bitmap_set_ni_add(&other, i));
+        }
+    }
+    for (uintmax_t i = 1; i < 100; i++) {
+        assert_true(seahorse_bitmap_set_ni_add(&object, (i << 32) | 1));
+        assert_true(seahorse_bitmap_set_ni_add(&other, (i << 33) | 1));
+    }
+    assert_true(seahorse_bitmap_set_ni_intersection(&object, &other));
+    for (uintmax_t i = 0; i < 200000; i += 6) {
+        assert_true(seahorse_bitmap_set_ni_remove(&object, i));
+    }
+    for (uintmax_t i = 2; i < 100; i += 2) {
+        assert_true(seahorse_bitmap_set_ni_remove(&object, (i << 32) | 1));
+    }
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.length, 0);
+    assert_true(seahorse_bitmap_set_ni_invalidate(&other));
+    assert_true(seahorse_bitmap_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_bitmap_set_ni_error_on_object_is_null),
+            cmocka_unit_test(check_init_bitmap_set_ni_error_on_other_is_null),
+            cmocka_unit_test(check_init_bitmap_set_ni),
+            cmocka_unit_test(check_init_bitmap_set_ni_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_value_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_dense_values),
+            cmocka_unit_test(check_add_sparse_values),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_value_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_ceiling_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_error_on_value_not_found),
+            cmocka_unit_test(check_floor_error_on_object_is_null),
+            cmocka_unit_test(check_floor_error_on_out_is_null),
+            cmocka_unit_test(check_floor_error_on_value_not_found),
+            cmocka_unit_test(check_ceiling),
+            cmocka_unit_test(check_floor),
+            cmocka_unit_test(check_first_error_on_object_is_null),
+            cmocka_unit_test(check_first_error_on_out_is_null),
+            cmocka_unit_test(check_first_error_on_set_is_empty),
+            cmocka_unit_test(check_last_error_on_object_is_null),
+            cmocka_unit_test(check_last_error_on_out_is_null),
+            cmocka_unit_test(check_last_error_on_set_is_empty),
+            cmocka_unit_test(check_first),
+            cmocka_unit_test(check_last),
+            cmocka_unit_test(check_next_error_on_object_is_null),
+            cmocka_unit_test(check_next_error_on_out_is_null),
+            cmocka_unit_test(check_next_error_on_end_of_sequence),
+            cmocka_unit_test(check_prev_error_on_object_is_null),
+            cmocka_unit_test(check_prev_error_on_out_is_null),
+            cmocka_unit_test(check_prev_error_on_end_of_sequence),
+            cmocka_unit_test(check_next),
+            cmocka_unit_test(check_prev),
+            cmocka_unit_test(check_union_error_on_object_is_null),
+            cmocka_unit_test(check_union_error_on_other_is_null),
+            cmocka_unit_test(check_union),
+            cmocka_unit_test(check_intersection_error_on_object_is_null),
+            cmocka_unit_test(check_intersection_error_on_other_is_null),
+            cmocka_unit_test(check_intersection),
+            cmocka_unit_test(check_difference_error_on_object_is_null),
+            cmocka_unit_test(check_difference_error_on_other_is_null),
+            cmocka_unit_test(check_difference),
+            cmocka_unit_test(check_union_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_union_self),
+            cmocka_unit_test(check_remove_after_intersection),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,1834 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_invalidate(NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object = {};
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_init(NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.height, 0);
+    assert_null(object.root);
+    assert_null(object.first);
+    assert_null(object.last);
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_btree_map_i_i_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_init_btree_map_i_i(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_btree_map_i_i_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_init_btree_map_i_i((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_btree_map_i_i(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, (i * 7919) % 1000));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(
+                &value, 1 + (i * 7919) % 1000));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_btree_map_i_i copy;
+    assert_true(seahorse_btree_map_i_i_init_btree_map_i_i(&copy, &object));
+    assert_int_equal(copy.count, 1000);
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_first_entry(&copy, &entry));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const struct sea_turtle_integer *key;
+        assert_true(seahorse_btree_map_i_i_entry_key(&copy, entry, &key));
+        assert_true(sea_turtle_integer_set_uintmax_t(&expected, i));
+        assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+        struct sea_turtle_integer *value;
+        assert_true(seahorse_btree_map_i_i_entry_value(&copy, entry, &value));
+        assert_true(sea_turtle_integer_set_uintmax_t(&expected, 1 + i));
+        assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+        if (i < 999) {
+            assert_true(seahorse_btree_map_i_i_next_entry(entry, &entry));
+        }
+    }
+    assert_true(seahorse_btree_map_i_i_invalidate(&copy));
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_btree_map_i_i_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_btree_map_i_i copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_btree_map_i_i_init_btree_map_i_i(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    uintmax_t count;
+    assert_true(seahorse_btree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 100; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(seahorse_btree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 100);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_add(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_add((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_add((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, (i * 7919) % 1000));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_int_equal(object.count, 1000);
+    assert_true(object.height > 0);
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_first_entry(&object, &entry));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const struct sea_turtle_integer *key;
+        assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+        assert_true(sea_turtle_integer_set_uintmax_t(&expected, i));
+        assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+        if (i < 999) {
+            assert_true(seahorse_btree_map_i_i_next_entry(entry, &entry));
+        }
+    }
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 0));
+    assert_false(seahorse_btree_map_i_i_add(&object, &query, &query));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_btree_map_i_i_add(&object, &query, &query));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_false(seahorse_btree_map_i_i_remove(&object, &query));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(sea_turtle_integer_set_uintmax_t(&query, 10 * i));
+        assert_true(seahorse_btree_map_i_i_remove(&object, &query));
+    }
+    assert_int_equal(object.count, 500);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_integer_set_uintmax_t(&query, 10 * i));
+        bool result;
+        assert_true(seahorse_btree_map_i_i_contains(&object, &query, &result));
+        assert_int_equal(result, i % 2);
+    }
+    for (uintmax_t i = 1; i < 1000; i += 2) {
+        assert_true(sea_turtle_integer_set_uintmax_t(&query, 10 * i));
+        assert_true(seahorse_btree_map_i_i_remove(&object, &query));
+    }
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.height, 0);
+    assert_null(object.root);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_contains(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_contains((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_contains((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 0));
+    bool result;
+    assert_true(seahorse_btree_map_i_i_contains(&object, &query, &result));
+    assert_false(result);
+    for (uintmax_t i = 0; i < 1; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(seahorse_btree_map_i_i_contains(&object, &query, &result));
+    assert_true(result);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_get(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_get((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_get((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *value;
+    assert_false(seahorse_btree_map_i_i_get(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer *value;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_get(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 101));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_false(seahorse_btree_map_i_i_get(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_ceiling(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_ceiling((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_ceiling((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *value;
+    assert_false(seahorse_btree_map_i_i_ceiling(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer *value;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_ceiling(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 101));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_ceiling(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 111));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 0));
+    assert_true(seahorse_btree_map_i_i_ceiling(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 1));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9991));
+    assert_false(seahorse_btree_map_i_i_ceiling(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_floor(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_floor((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_floor((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *value;
+    assert_false(seahorse_btree_map_i_i_floor(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer *value;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_floor(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 101));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_floor(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 101));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9990));
+    assert_true(seahorse_btree_map_i_i_floor(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 9991));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9999));
+    assert_true(seahorse_btree_map_i_i_floor(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 9991));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_higher(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_higher((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_higher((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *value;
+    assert_false(seahorse_btree_map_i_i_higher(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer *value;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_higher(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 111));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_higher(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 111));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9990));
+    assert_false(seahorse_btree_map_i_i_higher(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_lower(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_lower((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_lower((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *value;
+    assert_false(seahorse_btree_map_i_i_lower(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer *value;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_lower(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 91));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_lower(&object, &query, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 101));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 0));
+    assert_false(seahorse_btree_map_i_i_lower(&object, &query, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_first(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_first((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *value;
+    assert_false(seahorse_btree_map_i_i_first(&object, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer *value;
+    assert_true(seahorse_btree_map_i_i_first(&object, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 1));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_last(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_last((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *value;
+    assert_false(seahorse_btree_map_i_i_last(&object, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer *value;
+    assert_true(seahorse_btree_map_i_i_last(&object, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 9991));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_get_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_get_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_get_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_false(seahorse_btree_map_i_i_get_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_get_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 100));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_false(seahorse_btree_map_i_i_get_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_ceiling_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_ceiling_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_ceiling_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_false(seahorse_btree_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 100));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 110));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 0));
+    assert_true(seahorse_btree_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 0));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9991));
+    assert_false(seahorse_btree_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_floor_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_floor_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_floor_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_false(seahorse_btree_map_i_i_floor_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_floor_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 100));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_floor_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 100));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9990));
+    assert_true(seahorse_btree_map_i_i_floor_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 9990));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9999));
+    assert_true(seahorse_btree_map_i_i_floor_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 9990));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_higher_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_higher_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_higher_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_false(seahorse_btree_map_i_i_higher_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_higher_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 110));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_higher_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 110));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 9990));
+    assert_false(seahorse_btree_map_i_i_higher_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_lower_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_lower_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_lower_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_false(seahorse_btree_map_i_i_lower_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 100));
+    assert_true(seahorse_btree_map_i_i_lower_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 90));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 105));
+    assert_true(seahorse_btree_map_i_i_lower_entry(&object, &query, &entry));
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 100));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 0));
+    assert_false(seahorse_btree_map_i_i_lower_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_first_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_first_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_false(seahorse_btree_map_i_i_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_first_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 0));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_last_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_last_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_false(seahorse_btree_map_i_i_last_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_last_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 9990));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_remove_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_remove_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    while (seahorse_btree_map_i_i_first_entry(&object, &entry)) {
+        assert_true(seahorse_btree_map_i_i_remove_entry(&object, entry));
+    }
+    assert_int_equal(object.count, 0);
+    assert_null(object.root);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_next_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_next_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_first_entry(&object, &entry));
+    uintmax_t count = 1;
+    while (seahorse_btree_map_i_i_next_entry(entry, &entry)) {
+        count += 1;
+    }
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 1000);
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 9990));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_prev_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_prev_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10 * i));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_last_entry(&object, &entry));
+    uintmax_t count = 1;
+    while (seahorse_btree_map_i_i_prev_entry(entry, &entry)) {
+        count += 1;
+    }
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 1000);
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 0));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_entry_key(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_entry_key(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_entry_key(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + 10 * i));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_first_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_btree_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_entry_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_entry_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_i_i_entry_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_i_i object;
+    assert_true(seahorse_btree_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1; i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, 10));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 11));
+        assert_true(seahorse_btree_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    const struct seahorse_btree_map_i_i_entry *entry;
+    assert_true(seahorse_btree_map_i_i_first_entry(&object, &entry));
+    struct sea_turtle_integer *value;
+    assert_true(seahorse_btree_map_i_i_entry_value(&object, entry, &value));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 11));
+    assert_int_equal(sea_turtle_integer_compare(value, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_btree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_btree_map_i_i_error_on_object_is_null),
+            cmocka_unit_test(check_init_btree_map_i_i_error_on_other_is_null),
+            cmocka_unit_test(check_init_btree_map_i_i),
+            cmocka_unit_test(check_init_btree_map_i_i_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_key_is_null),
+            cmocka_unit_test(check_add_error_on_value_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_key_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_key_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_ceiling_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_error_on_key_is_null),
+            cmocka_unit_test(check_ceiling_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling),
+            cmocka_unit_test(check_floor_error_on_object_is_null),
+            cmocka_unit_test(check_floor_error_on_key_is_null),
+            cmocka_unit_test(check_floor_error_on_out_is_null),
+            cmocka_unit_test(check_floor_error_on_key_not_found),
+            cmocka_unit_test(check_floor),
+            cmocka_unit_test(check_higher_error_on_object_is_null),
+            cmocka_unit_test(check_higher_error_on_key_is_null),
+            cmocka_unit_test(check_higher_error_on_out_is_null),
+            cmocka_unit_test(check_higher_error_on_key_not_found),
+            cmocka_unit_test(check_higher),
+            cmocka_unit_test(check_lower_error_on_object_is_null),
+            cmocka_unit_test(check_lower_error_on_key_is_null),
+            cmocka_unit_test(check_lower_error_on_out_is_null),
+            cmocka_unit_test(check_lower_error_on_key_not_found),
+            cmocka_unit_test(check_lower),
+            cmocka_unit_test(check_first_error_on_object_is_null),
+            cmocka_unit_test(check_first_error_on_out_is_null),
+            cmocka_unit_test(check_first_error_on_map_is_empty),
+            cmocka_unit_test(check_first),
+            cmocka_unit_test(check_last_error_on_object_is_null),
+            cmocka_unit_test(check_last_error_on_out_is_null),
+            cmocka_unit_test(check_last_error_on_map_is_empty),
+            cmocka_unit_test(check_last),
+            cmocka_unit_test(check_get_entry_error_on_object_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_is_null),
+            cmocka_unit_test(check_get_entry_error_on_out_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_not_found),
+            cmocka_unit_test(check_get_entry),
+            cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_key_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling_entry),
+            cmocka_unit_test(check_floor_entry_error_on_object_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_key_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_out_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_key_not_found),
+            cmocka_unit_test(check_floor_entry),
+            cmocka_unit_test(check_higher_entry_error_on_object_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_key_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_out_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_key_not_found),
+            cmocka_unit_test(check_higher_entry),
+            cmocka_unit_test(check_lower_entry_error_on_object_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_key_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_out_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_key_not_found),
+            cmocka_unit_test(check_lower_entry),
+            cmocka_unit_test(check_first_entry_error_on_object_is_null),
+            cmocka_unit_test(check_first_entry_error_on_out_is_null),
+            cmocka_unit_test(check_first_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_first_entry),
+            cmocka_unit_test(check_last_entry_error_on_object_is_null),
+            cmocka_unit_test(check_last_entry_error_on_out_is_null),
+            cmocka_unit_test(check_last_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_last_entry),
+            cmocka_unit_test(check_remove_entry_error_on_object_is_null),
+            cmocka_unit_test(check_remove_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_remove_entry),
+            cmocka_unit_test(check_next_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_next_entry_error_on_out_is_null),
+            cmocka_unit_test(check_next_entry),
+            cmocka_unit_test(check_prev_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_prev_entry_error_on_out_is_null),
+            cmocka_unit_test(check_prev_entry),
+            cmocka_unit_test(check_entry_key_error_on_object_is_null),
+            cmocka_unit_test(check_entry_key_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_key_error_on_out_is_null),
+            cmocka_unit_test(check_entry_key),
+            cmocka_unit_test(check_entry_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_value_error_on_out_is_null),
+            cmocka_unit_test(check_entry_value),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
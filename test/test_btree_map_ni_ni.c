@@ -0,0 +1,1389 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+extern bool avx2_is_overridden;
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object = {};
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_init(NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.height, 0);
+    assert_null(object.root);
+    assert_null(object.first);
+    assert_null(object.last);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_btree_map_ni_ni_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_init_btree_map_ni_ni(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_btree_map_ni_ni_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_init_btree_map_ni_ni(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_btree_map_ni_ni(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(
+                &object, (i * 7919) % 1000, 1 + (i * 7919) % 1000));
+    }
+    struct seahorse_btree_map_ni_ni copy;
+    assert_true(seahorse_btree_map_ni_ni_init_btree_map_ni_ni(&copy, &object));
+    assert_int_equal(copy.count, 1000);
+    assert_int_equal(copy.height, object.height);
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_first_entry(&copy, &entry));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const uintmax_t *key;
+        assert_true(seahorse_btree_map_ni_ni_entry_key(&copy, entry, &key));
+        assert_int_equal(*key, i);
+        const uintmax_t *value;
+        assert_true(seahorse_btree_map_ni_ni_entry_get_value(
+                &copy, entry, &value));
+        assert_int_equal(*value, 1 + i);
+        if (i < 999) {
+            assert_true(seahorse_btree_map_ni_ni_next_entry(entry, &entry));
+        }
+    }
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&copy));
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_btree_map_ni_ni_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    struct seahorse_btree_map_ni_ni copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_btree_map_ni_ni_init_btree_map_ni_ni(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_btree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 100; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    assert_true(seahorse_btree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 100);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_add(NULL, 1, 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(
+                &object, (i * 7919) % 1000, i));
+    }
+    assert_int_equal(object.count, 1000);
+    assert_true(object.height > 0);
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_first_entry(&object, &entry));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const uintmax_t *key;
+        assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+        assert_int_equal(*key, i);
+        if (i < 999) {
+            assert_true(seahorse_btree_map_ni_ni_next_entry(entry, &entry));
+        }
+    }
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_true(seahorse_btree_map_ni_ni_add(&object, 10, 11));
+    assert_false(seahorse_btree_map_ni_ni_add(&object, 10, 12));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_btree_map_ni_ni_add(&object, 10, 11));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_try_add(NULL, 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_try_add((void *) 1, 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_try_add(&object, 10, 11, &entry));
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_entry_get_value(
+            &object, entry, &value));
+    assert_int_equal(*value, 11);
+    assert_false(seahorse_btree_map_ni_ni_try_add(&object, 10, 12, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_entry_get_value(
+            &object, entry, &value));
+    assert_int_equal(*value, 11);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_remove(NULL, 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_false(seahorse_btree_map_ni_ni_remove(&object, 10));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_btree_map_ni_ni_remove(&object, 10 * i));
+    }
+    assert_int_equal(object.count, 500);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        bool result;
+        assert_true(seahorse_btree_map_ni_ni_contains(
+                &object, 10 * i, &result));
+        assert_int_equal(result, i % 2);
+    }
+    for (uintmax_t i = 1; i < 1000; i += 2) {
+        assert_true(seahorse_btree_map_ni_ni_remove(&object, 10 * i));
+    }
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.height, 0);
+    assert_null(object.root);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_contains(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_contains((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    bool result;
+    assert_true(seahorse_btree_map_ni_ni_contains(&object, 10, &result));
+    assert_false(result);
+    assert_true(seahorse_btree_map_ni_ni_add(&object, 10, 11));
+    assert_true(seahorse_btree_map_ni_ni_contains(&object, 10, &result));
+    assert_true(result);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_set(NULL, 1, 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_false(seahorse_btree_map_ni_ni_set(&object, 10, 11));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_true(seahorse_btree_map_ni_ni_add(&object, 10, 11));
+    assert_true(seahorse_btree_map_ni_ni_set(&object, 10, 12));
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(*value, 12);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_get(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_get((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const uintmax_t *value;
+    assert_false(seahorse_btree_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_get(&object, 100, &value));
+    assert_int_equal(*value, 101);
+    assert_false(seahorse_btree_map_ni_ni_get(&object, 105, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_ceiling(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_ceiling((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const uintmax_t *value;
+    assert_false(seahorse_btree_map_ni_ni_ceiling(&object, 10, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_ceiling(&object, 100, &value));
+    assert_int_equal(*value, 101);
+    assert_true(seahorse_btree_map_ni_ni_ceiling(&object, 105, &value));
+    assert_int_equal(*value, 111);
+    assert_true(seahorse_btree_map_ni_ni_ceiling(&object, 0, &value));
+    assert_int_equal(*value, 1);
+    assert_false(seahorse_btree_map_ni_ni_ceiling(&object, 9991, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_floor(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_floor((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const uintmax_t *value;
+    assert_false(seahorse_btree_map_ni_ni_floor(&object, 10, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_floor(&object, 100, &value));
+    assert_int_equal(*value, 101);
+    assert_true(seahorse_btree_map_ni_ni_floor(&object, 105, &value));
+    assert_int_equal(*value, 101);
+    assert_true(seahorse_btree_map_ni_ni_floor(&object, 9990, &value));
+    assert_int_equal(*value, 9991);
+    assert_true(seahorse_btree_map_ni_ni_floor(&object, 9999, &value));
+    assert_int_equal(*value, 9991);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_higher(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_higher((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const uintmax_t *value;
+    assert_false(seahorse_btree_map_ni_ni_higher(&object, 10, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_higher(&object, 100, &value));
+    assert_int_equal(*value, 111);
+    assert_true(seahorse_btree_map_ni_ni_higher(&object, 105, &value));
+    assert_int_equal(*value, 111);
+    assert_false(seahorse_btree_map_ni_ni_higher(&object, 9990, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_lower(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_lower((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const uintmax_t *value;
+    assert_false(seahorse_btree_map_ni_ni_lower(&object, 10, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_lower(&object, 100, &value));
+    assert_int_equal(*value, 91);
+    assert_true(seahorse_btree_map_ni_ni_lower(&object, 105, &value));
+    assert_int_equal(*value, 101);
+    assert_false(seahorse_btree_map_ni_ni_lower(&object, 0, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_first(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_first((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const uintmax_t *value;
+    assert_false(seahorse_btree_map_ni_ni_first(&object, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_first(&object, &value));
+    assert_int_equal(*value, 1);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_last(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_last((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const uintmax_t *value;
+    assert_false(seahorse_btree_map_ni_ni_last(&object, &value));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_last(&object, &value));
+    assert_int_equal(*value, 9991);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_get_entry(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_get_entry((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_false(seahorse_btree_map_ni_ni_get_entry(&object, 10, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_get_entry(&object, 100, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 100);
+    assert_false(seahorse_btree_map_ni_ni_get_entry(&object, 105, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_ceiling_entry(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_ceiling_entry((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_false(seahorse_btree_map_ni_ni_ceiling_entry(&object, 10, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_ceiling_entry(&object, 100, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 100);
+    assert_true(seahorse_btree_map_ni_ni_ceiling_entry(&object, 105, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 110);
+    assert_true(seahorse_btree_map_ni_ni_ceiling_entry(&object, 0, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 0);
+    assert_false(seahorse_btree_map_ni_ni_ceiling_entry(&object, 9991, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void search(const bool avx2_is_disabled) {
+    avx2_is_overridden = avx2_is_disabled;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    /* keys spread over the whole range, also above INTMAX_MAX */
+    const uintmax_t limit = 5000;
+    const uintmax_t step = UINTMAX_MAX / limit;
+    for (uintmax_t i = 1; i < limit; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, i * step, i));
+    }
+    for (uintmax_t i = 1; i < limit; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_btree_map_ni_ni_get(&object, i * step, &out));
+        assert_int_equal(*out, i);
+        assert_true(seahorse_btree_map_ni_ni_ceiling(
+                &object, i * step - 1, &out));
+        assert_int_equal(*out, i);
+        assert_true(seahorse_btree_map_ni_ni_floor(
+                &object, i * step + 1, &out));
+        assert_int_equal(*out, i);
+        if (i + 1 < limit) {
+            assert_true(seahorse_btree_map_ni_ni_higher(
+                    &object, i * step, &out));
+            assert_int_equal(*out, i + 1);
+        }
+        if (i > 1) {
+            assert_true(seahorse_btree_map_ni_ni_lower(
+                    &object, i * step, &out));
+            assert_int_equal(*out, i - 1);
+        }
+    }
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    avx2_is_overridden = false;
+}
+
+static void check_search_with_and_without_avx2(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    search(false);
+    search(true);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_floor_entry(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_floor_entry((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_false(seahorse_btree_map_ni_ni_floor_entry(&object, 10, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_floor_entry(&object, 100, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 100);
+    assert_true(seahorse_btree_map_ni_ni_floor_entry(&object, 105, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 100);
+    assert_true(seahorse_btree_map_ni_ni_floor_entry(&object, 9990, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 9990);
+    assert_true(seahorse_btree_map_ni_ni_floor_entry(&object, 9999, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 9990);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_higher_entry(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_higher_entry((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_false(seahorse_btree_map_ni_ni_higher_entry(&object, 10, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_higher_entry(&object, 100, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 110);
+    assert_true(seahorse_btree_map_ni_ni_higher_entry(&object, 105, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 110);
+    assert_false(seahorse_btree_map_ni_ni_higher_entry(&object, 9990, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_lower_entry(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_lower_entry((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_false(seahorse_btree_map_ni_ni_lower_entry(&object, 10, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_lower_entry(&object, 100, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 90);
+    assert_true(seahorse_btree_map_ni_ni_lower_entry(&object, 105, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 100);
+    assert_false(seahorse_btree_map_ni_ni_lower_entry(&object, 0, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_first_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_first_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_false(seahorse_btree_map_ni_ni_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_first_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 0);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_last_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_last_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_false(seahorse_btree_map_ni_ni_last_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_last_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 9990);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_remove_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_remove_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    while (seahorse_btree_map_ni_ni_first_entry(&object, &entry)) {
+        assert_true(seahorse_btree_map_ni_ni_remove_entry(&object, entry));
+    }
+    assert_int_equal(object.count, 0);
+    assert_null(object.root);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_next_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_next_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_first_entry(&object, &entry));
+    uintmax_t count = 1;
+    while (seahorse_btree_map_ni_ni_next_entry(entry, &entry)) {
+        count += 1;
+    }
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 1000);
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 9990);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_prev_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_prev_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_btree_map_ni_ni_add(&object, 10 * i, 1 + 10 * i));
+    }
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_last_entry(&object, &entry));
+    uintmax_t count = 1;
+    while (seahorse_btree_map_ni_ni_prev_entry(entry, &entry)) {
+        count += 1;
+    }
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 1000);
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 0);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_key(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_key(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_key(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_true(seahorse_btree_map_ni_ni_add(&object, 10, 11));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_first_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_btree_map_ni_ni_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_get_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_get_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_get_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_true(seahorse_btree_map_ni_ni_add(&object, 10, 11));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_first_entry(&object, &entry));
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_entry_get_value(
+            &object, entry, &value));
+    assert_int_equal(*value, 11);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_set_value(NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_btree_map_ni_ni_entry_set_value((void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_BTREE_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_btree_map_ni_ni object;
+    assert_true(seahorse_btree_map_ni_ni_init(&object));
+    assert_true(seahorse_btree_map_ni_ni_add(&object, 10, 11));
+    const struct seahorse_btree_map_ni_ni_entry *entry;
+    assert_true(seahorse_btree_map_ni_ni_first_entry(&object, &entry));
+    assert_true(seahorse_btree_map_ni_ni_entry_set_value(&object, entry, 12));
+    const uintmax_t *value;
+    assert_true(seahorse_btree_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(*value, 12);
+    assert_true(seahorse_btree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_btree_map_ni_ni_error_on_object_is_null),
+            cmocka_unit_test(check_init_btree_map_ni_ni_error_on_other_is_null),
+            cmocka_unit_test(check_init_btree_map_ni_ni),
+            cmocka_unit_test(check_init_btree_map_ni_ni_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_ceiling_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling),
+            cmocka_unit_test(check_floor_error_on_object_is_null),
+            cmocka_unit_test(check_floor_error_on_out_is_null),
+            cmocka_unit_test(check_floor_error_on_key_not_found),
+            cmocka_unit_test(check_floor),
+            cmocka_unit_test(check_higher_error_on_object_is_null),
+            cmocka_unit_test(check_higher_error_on_out_is_null),
+            cmocka_unit_test(check_higher_error_on_key_not_found),
+            cmocka_unit_test(check_higher),
+            cmocka_unit_test(check_lower_error_on_object_is_null),
+            cmocka_unit_test(check_lower_error_on_out_is_null),
+            cmocka_unit_test(check_lower_error_on_key_not_found),
+            cmocka_unit_test(check_lower),
+            cmocka_unit_test(check_first_error_on_object_is_null),
+            cmocka_unit_test(check_first_error_on_out_is_null),
+            cmocka_unit_test(check_first_error_on_map_is_empty),
+            cmocka_unit_test(check_first),
+            cmocka_unit_test(check_last_error_on_object_is_null),
+            cmocka_unit_test(check_last_error_on_out_is_null),
+            cmocka_unit_test(check_last_error_on_map_is_empty),
+            cmocka_unit_test(check_last),
+            cmocka_unit_test(check_get_entry_error_on_object_is_null),
+            cmocka_unit_test(check_get_entry_error_on_out_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_not_found),
+            cmocka_unit_test(check_get_entry),
+            cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling_entry),
+            cmocka_unit_test(check_search_with_and_without_avx2),
+            cmocka_unit_test(check_floor_entry_error_on_object_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_out_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_key_not_found),
+            cmocka_unit_test(check_floor_entry),
+            cmocka_unit_test(check_higher_entry_error_on_object_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_out_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_key_not_found),
+            cmocka_unit_test(check_higher_entry),
+            cmocka_unit_test(check_lower_entry_error_on_object_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_out_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_key_not_found),
+            cmocka_unit_test(check_lower_entry),
+            cmocka_unit_test(check_first_entry_error_on_object_is_null),
+            cmocka_unit_test(check_first_entry_error_on_out_is_null),
+            cmocka_unit_test(check_first_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_first_entry),
+            cmocka_unit_test(check_last_entry_error_on_object_is_null),
+            cmocka_unit_test(check_last_entry_error_on_out_is_null),
+            cmocka_unit_test(check_last_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_last_entry),
+            cmocka_unit_test(check_remove_entry_error_on_object_is_null),
+            cmocka_unit_test(check_remove_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_remove_entry),
+            cmocka_unit_test(check_next_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_next_entry_error_on_out_is_null),
+            cmocka_unit_test(check_next_entry),
+            cmocka_unit_test(check_prev_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_prev_entry_error_on_out_is_null),
+            cmocka_unit_test(check_prev_entry),
+            cmocka_unit_test(check_entry_key_error_on_object_is_null),
+            cmocka_unit_test(check_entry_key_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_key_error_on_out_is_null),
+            cmocka_unit_test(check_entry_key),
+            cmocka_unit_test(check_entry_get_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_out_is_null),
+            cmocka_unit_test(check_entry_get_value),
+            cmocka_unit_test(check_entry_set_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_set_value),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
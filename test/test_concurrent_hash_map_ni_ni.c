@@ -0,0 +1,510 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <pthread.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+/* coprime with 7919 so that multiplying by it permutes the keys */
+#define LIMIT                           1000
+#define WRITERS                         4
+#define ROUNDS                          50
+
+static void *increment_all(void *argument) {
+    struct seahorse_concurrent_hash_map_ni_ni *const object = argument;
+    uintmax_t failures = 0;
+    for (uintmax_t round = 0; round < ROUNDS; round++) {
+        for (uintmax_t i = 0; i < LIMIT; i++) {
+            if (!seahorse_concurrent_hash_map_ni_ni_add_to(object, i, 1)) {
+                failures++;
+            }
+        }
+    }
+    return (void *) (uintptr_t) failures;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object = {};
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_init(NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_non_null(object.data);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_add(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 100));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    uintmax_t value;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(value, 100);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 100));
+    assert_false(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 200));
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS,
+            seahorse_error);
+    uintmax_t value;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(value, 100);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 100));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_to_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_add_to(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_to(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add_to(&object, 10, 5));
+    uintmax_t value;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(value, 5);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add_to(&object, 10, 7));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(value, 12);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_to_error_on_result_is_inconsistent(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add(
+            &object, 10, UINTMAX_MAX));
+    assert_false(seahorse_concurrent_hash_map_ni_ni_add_to(&object, 10, 1));
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_RESULT_IS_INCONSISTENT,
+            seahorse_error);
+    uintmax_t value;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(value, UINTMAX_MAX);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_to_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_add_to(&object, 10, 1));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_or_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_get_or_add(
+            NULL, 0, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_or_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_get_or_add(
+            (void *) 1, 0, 0, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_or_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    uintmax_t out;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get_or_add(
+            &object, 10, 100, &out));
+    assert_int_equal(out, 100);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get_or_add(
+            &object, 10, 200, &out));
+    assert_int_equal(out, 100);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_or_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_get_or_add(
+            &object, 10, 100, &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_set(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_false(seahorse_concurrent_hash_map_ni_ni_set(&object, 10, 100));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 100));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_set(&object, 10, 200));
+    uintmax_t value;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(value, 200);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_remove(NULL, 0));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_false(seahorse_concurrent_hash_map_ni_ni_remove(&object, 10));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 100));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_remove(&object, 10));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_contains(
+            NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_contains(
+            (void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    bool out;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_contains(&object, 10, &out));
+    assert_false(out);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 100));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_contains(&object, 10, &out));
+    assert_true(out);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_get(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_get((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    uintmax_t value;
+    assert_false(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(SEAHORSE_CONCURRENT_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_concurrent_hash_map_ni_ni_add(&object, 10, 100));
+    uintmax_t value;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, 10, &value));
+    assert_int_equal(value, 100);
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_remove_many(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        const uintmax_t key = (i * 7919) % LIMIT;
+        assert_true(seahorse_concurrent_hash_map_ni_ni_add(
+                &object, key, key * 2));
+    }
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, LIMIT);
+    for (uintmax_t i = 0; i < LIMIT; i += 2) {
+        assert_true(seahorse_concurrent_hash_map_ni_ni_remove(&object, i));
+    }
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, LIMIT / 2);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        uintmax_t value;
+        const bool result = seahorse_concurrent_hash_map_ni_ni_get(
+                &object, i, &value);
+        assert_true(result == (i % 2));
+        if (result) {
+            assert_int_equal(value, i * 2);
+        }
+    }
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_concurrent_add_to(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_hash_map_ni_ni object;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_init(&object));
+    pthread_t threads[WRITERS];
+    for (uintmax_t i = 0; i < WRITERS; i++) {
+        assert_int_equal(pthread_create(
+                &threads[i], NULL, increment_all, &object), 0);
+    }
+    for (uintmax_t i = 0; i < WRITERS; i++) {
+        void *failures;
+        assert_int_equal(pthread_join(threads[i], &failures), 0);
+        assert_null(failures);
+    }
+    uintmax_t count;
+    assert_true(seahorse_concurrent_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, LIMIT);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        uintmax_t value;
+        assert_true(seahorse_concurrent_hash_map_ni_ni_get(&object, i, &value));
+        assert_int_equal(value, WRITERS * ROUNDS);
+    }
+    assert_true(seahorse_concurrent_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_to_error_on_object_is_null),
+            cmocka_unit_test(check_add_to),
+            cmocka_unit_test(check_add_to_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_add_to_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_or_add_error_on_object_is_null),
+            cmocka_unit_test(check_get_or_add_error_on_out_is_null),
+            cmocka_unit_test(check_get_or_add),
+            cmocka_unit_test(check_get_or_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_add_remove_many),
+            cmocka_unit_test(check_concurrent_add_to),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
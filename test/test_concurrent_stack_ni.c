@@ -0,0 +1,469 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           1000
+#define THREADS                         4
+#define ROUNDS                          10000
+#define BATCH                           4
+
+struct context {
+    struct seahorse_concurrent_stack_ni *object;
+    atomic_bool taken[LIMIT];
+    atomic_bool failed;
+};
+
+/*
+ * Use the stack as a shared free list of indices, an index being handed to
+ * two threads at the same time would show up as it already being taken.
+ */
+static void *take_and_give_back(void *argument) {
+    struct context *const context = argument;
+    for (uintmax_t i = 0; i < ROUNDS; i++) {
+        uintmax_t items[BATCH];
+        uintmax_t count = 1;
+        const bool result = i % 2
+                ? seahorse_concurrent_stack_ni_pop(context->object, items)
+                : seahorse_concurrent_stack_ni_pop_all(
+                        context->object, BATCH, items, &count);
+        if (!result) {
+            continue;
+        }
+        for (uintmax_t j = 0; j < count; j++) {
+            if (atomic_exchange(&context->taken[items[j]], true)) {
+                atomic_store(&context->failed, true);
+            }
+        }
+        for (uintmax_t j = 0; j < count; j++) {
+            atomic_store(&context->taken[items[j]], false);
+        }
+        if (!seahorse_concurrent_stack_ni_push_all(
+                context->object, count, items)) {
+            atomic_store(&context->failed, true);
+        }
+    }
+    return NULL;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object = {};
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_init(NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    assert_non_null(object.data);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_stack_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_stack_ni_push(&object, 1));
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_push(NULL, 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_stack_ni_push(&object, 1));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_concurrent_stack_ni_push(&object, i));
+    }
+    uintmax_t count;
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, LIMIT);
+    for (uintmax_t i = LIMIT; i; i--) {
+        uintmax_t out;
+        assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+        assert_int_equal(out, i - 1);
+    }
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_reuses_popped_nodes(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    assert_true(seahorse_concurrent_stack_ni_push(&object, 1));
+    uintmax_t out;
+    assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    /* the popped node is recycled rather than allocating a new one */
+    const bool result = seahorse_concurrent_stack_ni_push(&object, 2);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(result);
+    assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+    assert_int_equal(out, 2);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_push_all(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_push_all(
+            (void *) 1, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_push_all((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    /* use up the first chunk and free two of its nodes */
+    for (uintmax_t i = 0; i < 64; i++) {
+        assert_true(seahorse_concurrent_stack_ni_push(&object, i));
+    }
+    uintmax_t out;
+    assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+    assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+    const uintmax_t values[] = {1, 2, 3};
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_stack_ni_push_all(&object, 3, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_STACK_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 62);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    /* the two recycled nodes were given back */
+    const bool result = seahorse_concurrent_stack_ni_push_all(
+            &object, 2, values);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(result);
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 64);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    uintmax_t values[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        values[i] = i;
+    }
+    assert_true(seahorse_concurrent_stack_ni_push_all(&object, LIMIT, values));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, LIMIT);
+    for (uintmax_t i = LIMIT; i; i--) {
+        uintmax_t out;
+        assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+        assert_int_equal(out, i - 1);
+    }
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_pop(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_pop((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_stack_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_concurrent_stack_ni_pop(&object, &out));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_STACK_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    assert_true(seahorse_concurrent_stack_ni_push(&object, 1));
+    assert_true(seahorse_concurrent_stack_ni_push(&object, 2));
+    uintmax_t out;
+    assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+    assert_int_equal(out, 2);
+    assert_true(seahorse_concurrent_stack_ni_pop(&object, &out));
+    assert_int_equal(out, 1);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_pop_all(
+            NULL, 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_all_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_pop_all(
+            (void *) 1, 0, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_all_error_on_items_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_pop_all(
+            (void *) 1, 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_ITEMS_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_all_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_stack_ni_pop_all(
+            (void *) 1, 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_all_error_on_stack_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    uintmax_t items[1];
+    uintmax_t out;
+    assert_false(seahorse_concurrent_stack_ni_pop_all(&object, 1, items, &out));
+    assert_int_equal(SEAHORSE_CONCURRENT_STACK_NI_ERROR_STACK_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    const uintmax_t values[] = {1, 2, 3, 4, 5};
+    assert_true(seahorse_concurrent_stack_ni_push_all(&object, 5, values));
+    uintmax_t items[5];
+    uintmax_t out;
+    assert_true(seahorse_concurrent_stack_ni_pop_all(&object, 2, items, &out));
+    assert_int_equal(out, 2);
+    assert_int_equal(items[0], 5);
+    assert_int_equal(items[1], 4);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 3);
+    /* asking for more than there is pops what is left */
+    assert_true(seahorse_concurrent_stack_ni_pop_all(&object, 5, items, &out));
+    assert_int_equal(out, 3);
+    assert_int_equal(items[0], 3);
+    assert_int_equal(items[1], 2);
+    assert_int_equal(items[2], 1);
+    assert_true(seahorse_concurrent_stack_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_concurrent_push_and_pop(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_stack_ni object;
+    assert_true(seahorse_concurrent_stack_ni_init(&object));
+    struct context context = {
+            .object = &object
+    };
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_concurrent_stack_ni_push(&object, i));
+        atomic_init(&context.taken[i], false);
+    }
+    pthread_t threads[THREADS];
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        assert_int_equal(pthread_create(
+                &threads[i], NULL, take_and_give_back, &context), 0);
+    }
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+    }
+    assert_false(atomic_load(&context.failed));
+    /* every index made its way back exactly once */
+    uintmax_t items[LIMIT];
+    uintmax_t out;
+    assert_true(seahorse_concurrent_stack_ni_pop_all(
+            &object, LIMIT, items, &out));
+    assert_int_equal(out, LIMIT);
+    bool seen[LIMIT] = {false};
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_false(seen[items[i]]);
+        seen[items[i]] = true;
+    }
+    assert_true(seahorse_concurrent_stack_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_push_error_on_object_is_null),
+            cmocka_unit_test(check_push_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push),
+            cmocka_unit_test(check_push_reuses_popped_nodes),
+            cmocka_unit_test(check_push_all_error_on_object_is_null),
+            cmocka_unit_test(check_push_all_error_on_count_is_zero),
+            cmocka_unit_test(check_push_all_error_on_values_is_null),
+            cmocka_unit_test(check_push_all_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push_all),
+            cmocka_unit_test(check_pop_error_on_object_is_null),
+            cmocka_unit_test(check_pop_error_on_out_is_null),
+            cmocka_unit_test(check_pop_error_on_stack_is_empty),
+            cmocka_unit_test(check_pop),
+            cmocka_unit_test(check_pop_all_error_on_object_is_null),
+            cmocka_unit_test(check_pop_all_error_on_count_is_zero),
+            cmocka_unit_test(check_pop_all_error_on_items_is_null),
+            cmocka_unit_test(check_pop_all_error_on_out_is_null),
+            cmocka_unit_test(check_pop_all_error_on_stack_is_empty),
+            cmocka_unit_test(check_pop_all),
+            cmocka_unit_test(check_concurrent_push_and_pop),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
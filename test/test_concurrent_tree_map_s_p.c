@@ -0,0 +1,797 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+/* coprime with 7919 so that multiplying by it permutes the keys */
+#define LIMIT                           1000
+#define READERS                         4
+
+static void key_of(struct sea_turtle_string *const key, const uintmax_t i) {
+    char chars[16];
+    const int size = snprintf(chars, sizeof(chars), "%04ju", i);
+    size_t out;
+    assert_true(sea_turtle_string_init(key, chars, size, &out));
+}
+
+static uintmax_t destroyed;
+
+static void on_destroy(void *value) {
+    destroyed += (uintptr_t) value;
+}
+
+struct context {
+    struct seahorse_concurrent_tree_map_s_p *object;
+    const struct sea_turtle_string *key;
+    atomic_bool done;
+};
+
+/*
+ * Even keys are never removed, so every lookup of them must succeed no
+ * matter which version of the tree the reader happens to search.
+ */
+static void *read_stable_keys(void *argument) {
+    struct context *const context = argument;
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    if (!seahorse_concurrent_tree_map_s_p_register(context->object, &reader)) {
+        return (void *) 1;
+    }
+    uintmax_t failures = 0;
+    while (!atomic_load(&context->done)) {
+        for (uintmax_t i = 0; i < LIMIT; i += 2) {
+            const void *out;
+            if (!seahorse_concurrent_tree_map_s_p_get(
+                    context->object, &reader, &context->key[i], &out)
+                || out != (void *) (i + 1)) {
+                failures++;
+            }
+        }
+    }
+    seahorse_concurrent_tree_map_s_p_unregister(context->object, &reader);
+    return (void *) (uintptr_t) failures;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_invalidate(NULL, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_tree_map_s_p object = {};
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_init(NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    assert_non_null(object.data);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_tree_map_s_p object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_tree_map_s_p_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_register_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_register(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_register_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_register((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_register_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_unregister_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_unregister(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_unregister_error_on_reader_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_unregister((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_register_unregister(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    assert_non_null(reader.data);
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_null(reader.data);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_register_readers_on_own_cache_lines(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    struct seahorse_concurrent_tree_map_s_p_reader readers[4];
+    for (uintmax_t i = 0; i < 4; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_register(&object,
+                                                              &readers[i]));
+        assert_int_equal((uintptr_t) readers[i].data % 64, 0);
+    }
+    for (uintmax_t i = 0; i < 4; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object,
+                                                                &readers[i]));
+    }
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_add(NULL, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_add((void *) 1, NULL, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_concurrent_tree_map_s_p_add(&object, &key[0], NULL));
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    assert_true(seahorse_concurrent_tree_map_s_p_add(&object, &key[0], NULL));
+    assert_false(seahorse_concurrent_tree_map_s_p_add(&object, &key[0], NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    assert_true(seahorse_concurrent_tree_map_s_p_add(&object, &key[0], NULL));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_tree_map_s_p_add(&object, &key[1], NULL));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_set(NULL, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_set((void *) 1, NULL, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    assert_false(seahorse_concurrent_tree_map_s_p_set(&object, &key[0], NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[i], (void *) (i + 1)));
+    }
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_set(
+            &object, &key[1], (void *) 9));
+    const void *out;
+    assert_true(seahorse_concurrent_tree_map_s_p_get(
+            &object, &reader, &key[1], &out));
+    assert_ptr_equal(out, (void *) 9);
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[i], (void *) (i + 1)));
+    }
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_tree_map_s_p_set(
+            &object, &key[1], (void *) 9));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    const void *out;
+    assert_true(seahorse_concurrent_tree_map_s_p_get(
+            &object, &reader, &key[1], &out));
+    assert_ptr_equal(out, (void *) 2);
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    assert_false(seahorse_concurrent_tree_map_s_p_remove(&object, &key[0]));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[i], (void *) (i + 1)));
+    }
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_remove(&object, &key[1]));
+    uintmax_t count;
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 2);
+    bool out;
+    assert_true(seahorse_concurrent_tree_map_s_p_contains(
+            &object, &reader, &key[1], &out));
+    assert_false(out);
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[i], (void *) (i + 1)));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_concurrent_tree_map_s_p_remove(&object, &key[1]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 3);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_contains(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_reader_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_contains(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_contains(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_contains(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    assert_true(seahorse_concurrent_tree_map_s_p_add(&object, &key[0], NULL));
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    bool out;
+    assert_true(seahorse_concurrent_tree_map_s_p_contains(
+            &object, &reader, &key[0], &out));
+    assert_true(out);
+    assert_true(seahorse_concurrent_tree_map_s_p_contains(
+            &object, &reader, &key[1], &out));
+    assert_false(out);
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_get(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_reader_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_get(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_READER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_get(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_concurrent_tree_map_s_p_get(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    const void *out;
+    assert_false(seahorse_concurrent_tree_map_s_p_get(
+            &object, &reader, &key[0], &out));
+    assert_int_equal(SEAHORSE_CONCURRENT_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[i], (void *) (i + 1)));
+    }
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    for (uintmax_t i = 0; i < 3; i++) {
+        const void *out;
+        assert_true(seahorse_concurrent_tree_map_s_p_get(
+                &object, &reader, &key[i], &out));
+        assert_ptr_equal(out, (void *) (i + 1));
+    }
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate_with_on_destroy(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[i], (void *) (i + 1)));
+    }
+    destroyed = 0;
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(
+            &object, on_destroy));
+    assert_int_equal(destroyed, 1 + 2 + 3);
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_remove_many(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    struct seahorse_concurrent_tree_map_s_p_reader reader;
+    assert_true(seahorse_concurrent_tree_map_s_p_register(&object, &reader));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        const uintmax_t k = (i * 7919) % LIMIT;
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[k], (void *) (k + 1)));
+    }
+    for (uintmax_t i = 0; i < LIMIT; i += 2) {
+        assert_true(seahorse_concurrent_tree_map_s_p_remove(&object, &key[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, LIMIT / 2);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        const void *out;
+        const bool result = seahorse_concurrent_tree_map_s_p_get(
+                &object, &reader, &key[i], &out);
+        assert_true(result == (i % 2));
+        if (result) {
+            assert_ptr_equal(out, (void *) (i + 1));
+        }
+    }
+    assert_true(seahorse_concurrent_tree_map_s_p_unregister(&object, &reader));
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_concurrent_readers(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_concurrent_tree_map_s_p object;
+    assert_true(seahorse_concurrent_tree_map_s_p_init(&object));
+    /* even keys stay put while odd keys come and go */
+    for (uintmax_t i = 0; i < LIMIT; i += 2) {
+        assert_true(seahorse_concurrent_tree_map_s_p_add(
+                &object, &key[i], (void *) (i + 1)));
+    }
+    struct context context = {
+            .object = &object,
+            .key = key
+    };
+    atomic_init(&context.done, false);
+    pthread_t threads[READERS];
+    for (uintmax_t i = 0; i < READERS; i++) {
+        assert_int_equal(pthread_create(
+                &threads[i], NULL, read_stable_keys, &context), 0);
+    }
+    for (uintmax_t round = 0; round < 20; round++) {
+        for (uintmax_t i = 1; i < LIMIT; i += 2) {
+            assert_true(seahorse_concurrent_tree_map_s_p_add(
+                    &object, &key[i], (void *) (i + 1)));
+        }
+        for (uintmax_t i = 0; i < LIMIT; i += 2) {
+            assert_true(seahorse_concurrent_tree_map_s_p_set(
+                    &object, &key[i], (void *) (i + 1)));
+        }
+        for (uintmax_t i = 1; i < LIMIT; i += 2) {
+            assert_true(seahorse_concurrent_tree_map_s_p_remove(
+                    &object, &key[i]));
+        }
+    }
+    atomic_store(&context.done, true);
+    for (uintmax_t i = 0; i < READERS; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+    }
+    uintmax_t count;
+    assert_true(seahorse_concurrent_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, LIMIT / 2);
+    assert_true(seahorse_concurrent_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_register_error_on_object_is_null),
+            cmocka_unit_test(check_register_error_on_out_is_null),
+            cmocka_unit_test(check_register_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_unregister_error_on_object_is_null),
+            cmocka_unit_test(check_unregister_error_on_reader_is_null),
+            cmocka_unit_test(check_register_unregister),
+            cmocka_unit_test(check_register_readers_on_own_cache_lines),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_key_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_reader_is_null),
+            cmocka_unit_test(check_contains_error_on_key_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_reader_is_null),
+            cmocka_unit_test(check_get_error_on_key_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_invalidate_with_on_destroy),
+            cmocka_unit_test(check_add_remove_many),
+            cmocka_unit_test(check_concurrent_readers),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
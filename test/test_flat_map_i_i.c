@@ -0,0 +1,1789 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_invalidate(NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object = {};
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_init(NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.capacity, 0);
+    assert_null(object.keys);
+    assert_null(object.values);
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_flat_map_i_i_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_init_flat_map_i_i(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_flat_map_i_i_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_init_flat_map_i_i((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OTHER_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_flat_map_i_i(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_flat_map_i_i copy;
+    assert_true(seahorse_flat_map_i_i_init_flat_map_i_i(&copy, &object));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    assert_int_equal(copy.count, 3);
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_get(&copy, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 11));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 20));
+    assert_true(seahorse_flat_map_i_i_get(&copy, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 21));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_true(seahorse_flat_map_i_i_get(&copy, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 31));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&copy));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_flat_map_i_i_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_flat_map_i_i copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_flat_map_i_i_init_flat_map_i_i(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_red_black_tree_map_i_i_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_init_red_black_tree_map_i_i(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_red_black_tree_map_i_i_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_init_red_black_tree_map_i_i(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OTHER_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_red_black_tree_map_i_i(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i tree;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&tree));
+    const uintmax_t KEYS[] = {50, 20, 40, 10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_red_black_tree_map_i_i_add(&tree, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init_red_black_tree_map_i_i(
+            &object, &tree));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&tree));
+    assert_int_equal(object.count, 5);
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_true(seahorse_flat_map_i_i_first_entry(&object, &entry));
+    for (uintmax_t i = 1; i <= 5; i++) {
+        const struct sea_turtle_integer *key;
+        assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+        assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10 * i));
+        assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+        if (i < 5) {
+            assert_true(seahorse_flat_map_i_i_next_entry(
+                    &object, entry, &entry));
+        }
+    }
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_red_black_tree_map_i_i_error_on_memory_allocation_failed(
+        void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i tree;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&tree));
+    const uintmax_t KEYS[] = {10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_red_black_tree_map_i_i_add(&tree, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_flat_map_i_i object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_flat_map_i_i_init_red_black_tree_map_i_i(
+            &object, &tree));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&tree));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_flat_map_i_i_count(&object, &count));
+    assert_int_equal(count, 0);
+    const uintmax_t KEYS[] = {10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(seahorse_flat_map_i_i_count(&object, &count));
+    assert_int_equal(count, 2);
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_add(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_add((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_add((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const uintmax_t k = (i * 7919) % 1000;
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, k));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &key));
+        assert_true(sea_turtle_integer_invalidate(&key));
+    }
+    assert_int_equal(object.count, 1000);
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_integer_set_uintmax_t(&expected, i));
+        assert_int_equal(sea_turtle_integer_compare(&object.keys[i], &expected),
+                         0);
+    }
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(&key, 10));
+    assert_false(seahorse_flat_map_i_i_add(&object, &key, &key));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(&key, 10));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_flat_map_i_i_add(&object, &key, &key));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_false(seahorse_flat_map_i_i_remove(&object, &query));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {10, 20, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 20));
+    assert_true(seahorse_flat_map_i_i_remove(&object, &query));
+    assert_int_equal(object.count, 2);
+    bool result;
+    assert_true(seahorse_flat_map_i_i_contains(&object, &query, &result));
+    assert_false(result);
+    struct sea_turtle_integer *out;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_true(seahorse_flat_map_i_i_get(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 31));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_contains(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_contains((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_contains((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    bool result;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 0));
+    assert_true(seahorse_flat_map_i_i_contains(&object, &query, &result));
+    assert_false(result);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_contains(&object, &query, &result));
+    assert_true(result);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 20));
+    assert_true(seahorse_flat_map_i_i_contains(&object, &query, &result));
+    assert_false(result);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_true(seahorse_flat_map_i_i_contains(&object, &query, &result));
+    assert_true(result);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 40));
+    assert_true(seahorse_flat_map_i_i_contains(&object, &query, &result));
+    assert_false(result);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_get(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_get((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_get((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *out;
+    assert_false(seahorse_flat_map_i_i_get(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 20));
+    assert_true(seahorse_flat_map_i_i_get(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 21));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 25));
+    assert_false(seahorse_flat_map_i_i_get(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_ceiling(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_ceiling((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_ceiling((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *out;
+    assert_false(seahorse_flat_map_i_i_ceiling(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_ceiling(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 11));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 15));
+    assert_true(seahorse_flat_map_i_i_ceiling(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 21));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_true(seahorse_flat_map_i_i_ceiling(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 31));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 35));
+    assert_false(seahorse_flat_map_i_i_ceiling(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_floor(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_floor((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_floor((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *out;
+    assert_false(seahorse_flat_map_i_i_floor(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 5));
+    assert_false(seahorse_flat_map_i_i_floor(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_floor(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 11));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 25));
+    assert_true(seahorse_flat_map_i_i_floor(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 21));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 99));
+    assert_true(seahorse_flat_map_i_i_floor(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 31));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_higher(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_higher((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_higher((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *out;
+    assert_false(seahorse_flat_map_i_i_higher(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 5));
+    assert_true(seahorse_flat_map_i_i_higher(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 11));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_higher(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 21));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 25));
+    assert_true(seahorse_flat_map_i_i_higher(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 31));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_false(seahorse_flat_map_i_i_higher(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_lower(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_lower((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_lower((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    struct sea_turtle_integer *out;
+    assert_false(seahorse_flat_map_i_i_lower(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_false(seahorse_flat_map_i_i_lower(&object, &query, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 11));
+    assert_true(seahorse_flat_map_i_i_lower(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 11));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_true(seahorse_flat_map_i_i_lower(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 21));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 99));
+    assert_true(seahorse_flat_map_i_i_lower(&object, &query, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 31));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_first(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_first((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer *out;
+    assert_false(seahorse_flat_map_i_i_first(&object, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(seahorse_flat_map_i_i_first(&object, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 11));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_last(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_last((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    struct sea_turtle_integer *out;
+    assert_false(seahorse_flat_map_i_i_last(&object, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    struct sea_turtle_integer *out;
+    assert_true(seahorse_flat_map_i_i_last(&object, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 31));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_get_entry(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_get_entry((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_get_entry((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 20));
+    assert_true(seahorse_flat_map_i_i_get_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 25));
+    assert_false(seahorse_flat_map_i_i_get_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_ceiling_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_ceiling_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_ceiling_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 15));
+    assert_true(seahorse_flat_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_true(seahorse_flat_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 30));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 35));
+    assert_false(seahorse_flat_map_i_i_ceiling_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_floor_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_floor_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_floor_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 5));
+    assert_false(seahorse_flat_map_i_i_floor_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_floor_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 25));
+    assert_true(seahorse_flat_map_i_i_floor_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 99));
+    assert_true(seahorse_flat_map_i_i_floor_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 30));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_higher_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_higher_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_higher_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 5));
+    assert_true(seahorse_flat_map_i_i_higher_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_true(seahorse_flat_map_i_i_higher_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 25));
+    assert_true(seahorse_flat_map_i_i_higher_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 30));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_false(seahorse_flat_map_i_i_higher_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_lower_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_lower_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_lower_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    const struct sea_turtle_integer *key;
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 10));
+    assert_false(seahorse_flat_map_i_i_lower_entry(&object, &query, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 11));
+    assert_true(seahorse_flat_map_i_i_lower_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 30));
+    assert_true(seahorse_flat_map_i_i_lower_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_set_uintmax_t(&query, 99));
+    assert_true(seahorse_flat_map_i_i_lower_entry(&object, &query, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 30));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_first_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_first_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_false(seahorse_flat_map_i_i_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_true(seahorse_flat_map_i_i_first_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_last_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_last_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_false(seahorse_flat_map_i_i_last_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_true(seahorse_flat_map_i_i_last_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 30));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_remove_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_remove_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {10, 20, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_true(seahorse_flat_map_i_i_first_entry(&object, &entry));
+    assert_true(seahorse_flat_map_i_i_remove_entry(&object, entry));
+    assert_int_equal(object.count, 2);
+    assert_true(seahorse_flat_map_i_i_first_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_next_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_next_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_next_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {20, 10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_true(seahorse_flat_map_i_i_first_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(seahorse_flat_map_i_i_next_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(seahorse_flat_map_i_i_next_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 30));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_false(seahorse_flat_map_i_i_next_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_prev_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_prev_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_prev_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {20, 10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_true(seahorse_flat_map_i_i_last_entry(&object, &entry));
+    const struct sea_turtle_integer *key;
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 30));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(seahorse_flat_map_i_i_prev_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 20));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_true(seahorse_flat_map_i_i_prev_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_i_i_entry_key(&object, entry, &key));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 10));
+    assert_int_equal(sea_turtle_integer_compare(key, &expected), 0);
+    assert_false(seahorse_flat_map_i_i_prev_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_entry_key(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_entry_key((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_entry_key((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_entry_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_entry_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_i_i_entry_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_I_I_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_i_i object;
+    assert_true(seahorse_flat_map_i_i_init(&object));
+    const uintmax_t KEYS[] = {10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        struct sea_turtle_integer key;
+        assert_true(sea_turtle_integer_init_uintmax_t(&key, KEYS[i]));
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_uintmax_t(&value, 1 + KEYS[i]));
+        assert_true(seahorse_flat_map_i_i_add(&object, &key, &value));
+        assert_true(sea_turtle_integer_invalidate(&key));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct sea_turtle_integer query;
+    assert_true(sea_turtle_integer_init(&query));
+    struct sea_turtle_integer expected;
+    assert_true(sea_turtle_integer_init(&expected));
+    const struct seahorse_flat_map_i_i_entry *entry;
+    assert_true(seahorse_flat_map_i_i_last_entry(&object, &entry));
+    struct sea_turtle_integer *out;
+    assert_true(seahorse_flat_map_i_i_entry_value(&object, entry, &out));
+    assert_true(sea_turtle_integer_set_uintmax_t(&expected, 21));
+    assert_int_equal(sea_turtle_integer_compare(out, &expected), 0);
+    assert_true(sea_turtle_integer_invalidate(&query));
+    assert_true(sea_turtle_integer_invalidate(&expected));
+    assert_true(seahorse_flat_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_flat_map_i_i_error_on_object_is_null),
+            cmocka_unit_test(check_init_flat_map_i_i_error_on_other_is_null),
+            cmocka_unit_test(check_init_flat_map_i_i),
+            cmocka_unit_test(check_init_flat_map_i_i_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_red_black_tree_map_i_i_error_on_object_is_null),
+            cmocka_unit_test(check_init_red_black_tree_map_i_i_error_on_other_is_null),
+            cmocka_unit_test(check_init_red_black_tree_map_i_i),
+            cmocka_unit_test(check_init_red_black_tree_map_i_i_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_key_is_null),
+            cmocka_unit_test(check_add_error_on_value_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_key_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_key_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_ceiling_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_error_on_key_is_null),
+            cmocka_unit_test(check_ceiling_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling),
+            cmocka_unit_test(check_floor_error_on_object_is_null),
+            cmocka_unit_test(check_floor_error_on_key_is_null),
+            cmocka_unit_test(check_floor_error_on_out_is_null),
+            cmocka_unit_test(check_floor_error_on_key_not_found),
+            cmocka_unit_test(check_floor),
+            cmocka_unit_test(check_higher_error_on_object_is_null),
+            cmocka_unit_test(check_higher_error_on_key_is_null),
+            cmocka_unit_test(check_higher_error_on_out_is_null),
+            cmocka_unit_test(check_higher_error_on_key_not_found),
+            cmocka_unit_test(check_higher),
+            cmocka_unit_test(check_lower_error_on_object_is_null),
+            cmocka_unit_test(check_lower_error_on_key_is_null),
+            cmocka_unit_test(check_lower_error_on_out_is_null),
+            cmocka_unit_test(check_lower_error_on_key_not_found),
+            cmocka_unit_test(check_lower),
+            cmocka_unit_test(check_first_error_on_object_is_null),
+            cmocka_unit_test(check_first_error_on_out_is_null),
+            cmocka_unit_test(check_first_error_on_map_is_empty),
+            cmocka_unit_test(check_first),
+            cmocka_unit_test(check_last_error_on_object_is_null),
+            cmocka_unit_test(check_last_error_on_out_is_null),
+            cmocka_unit_test(check_last_error_on_map_is_empty),
+            cmocka_unit_test(check_last),
+            cmocka_unit_test(check_get_entry_error_on_object_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_is_null),
+            cmocka_unit_test(check_get_entry_error_on_out_is_null),
+            cmocka_unit_test(check_get_entry),
+            cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_key_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_entry),
+            cmocka_unit_test(check_floor_entry_error_on_object_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_key_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_out_is_null),
+            cmocka_unit_test(check_floor_entry),
+            cmocka_unit_test(check_higher_entry_error_on_object_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_key_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_out_is_null),
+            cmocka_unit_test(check_higher_entry),
+            cmocka_unit_test(check_lower_entry_error_on_object_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_key_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_out_is_null),
+            cmocka_unit_test(check_lower_entry),
+            cmocka_unit_test(check_first_entry_error_on_object_is_null),
+            cmocka_unit_test(check_first_entry_error_on_out_is_null),
+            cmocka_unit_test(check_first_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_first_entry),
+            cmocka_unit_test(check_last_entry_error_on_object_is_null),
+            cmocka_unit_test(check_last_entry_error_on_out_is_null),
+            cmocka_unit_test(check_last_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_last_entry),
+            cmocka_unit_test(check_remove_entry_error_on_object_is_null),
+            cmocka_unit_test(check_remove_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_remove_entry),
+            cmocka_unit_test(check_next_entry_error_on_object_is_null),
+            cmocka_unit_test(check_next_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_next_entry_error_on_out_is_null),
+            cmocka_unit_test(check_next_entry),
+            cmocka_unit_test(check_prev_entry_error_on_object_is_null),
+            cmocka_unit_test(check_prev_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_prev_entry_error_on_out_is_null),
+            cmocka_unit_test(check_prev_entry),
+            cmocka_unit_test(check_entry_key_error_on_object_is_null),
+            cmocka_unit_test(check_entry_key_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_key_error_on_out_is_null),
+            cmocka_unit_test(check_entry_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_value_error_on_out_is_null),
+            cmocka_unit_test(check_entry_value),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,1375 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static uintmax_t destroyed;
+
+static void on_destroy(void *value) {
+    destroyed += (uintmax_t) value;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_invalidate(NULL, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10, 20, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    destroyed = 0;
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, on_destroy));
+    assert_int_equal(destroyed, 63);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_init(NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.capacity, 0);
+    assert_null(object.keys);
+    assert_null(object.values);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_flat_map_ni_p_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_init_flat_map_ni_p(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_flat_map_ni_p_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_init_flat_map_ni_p((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_flat_map_ni_p(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    struct seahorse_flat_map_ni_p copy;
+    assert_true(seahorse_flat_map_ni_p_init_flat_map_ni_p(&copy, &object));
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    assert_int_equal(copy.count, 3);
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_get(&copy, 10, &out));
+    assert_ptr_equal(out, (void *) 11);
+    assert_true(seahorse_flat_map_ni_p_get(&copy, 20, &out));
+    assert_ptr_equal(out, (void *) 21);
+    assert_true(seahorse_flat_map_ni_p_get(&copy, 30, &out));
+    assert_ptr_equal(out, (void *) 31);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&copy, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_flat_map_ni_p_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    struct seahorse_flat_map_ni_p copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_flat_map_ni_p_init_flat_map_ni_p(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_red_black_tree_map_ni_p_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_init_red_black_tree_map_ni_p(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_red_black_tree_map_ni_p_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_init_red_black_tree_map_ni_p(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_red_black_tree_map_ni_p(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_p tree;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&tree));
+    const uintmax_t KEYS[] = {50, 20, 40, 10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &tree, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init_red_black_tree_map_ni_p(
+            &object, &tree));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&tree, NULL));
+    assert_int_equal(object.count, 5);
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_first_entry(&object, &entry));
+    for (uintmax_t i = 1; i <= 5; i++) {
+        const uintmax_t *key;
+        assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+        assert_int_equal(*key, 10 * i);
+        if (i < 5) {
+            assert_true(seahorse_flat_map_ni_p_next_entry(
+                    &object, entry, &entry));
+        }
+    }
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_red_black_tree_map_ni_p_error_on_memory_allocation_failed(
+        void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_p tree;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&tree));
+    const uintmax_t KEYS[] = {10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &tree, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    struct seahorse_flat_map_ni_p object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_flat_map_ni_p_init_red_black_tree_map_ni_p(
+            &object, &tree));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&tree, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_flat_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    const uintmax_t KEYS[] = {10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    assert_true(seahorse_flat_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 2);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_add(NULL, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const uintmax_t k = (i * 7919) % 1000;
+        assert_true(seahorse_flat_map_ni_p_add(&object, k, (void *) k));
+    }
+    assert_int_equal(object.count, 1000);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_int_equal(object.keys[i], i);
+        assert_ptr_equal(object.values[i], (void *) i);
+    }
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    assert_false(seahorse_flat_map_ni_p_add(&object, 10, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_flat_map_ni_p_add(&object, 10, NULL));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_remove(NULL, 0));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    assert_false(seahorse_flat_map_ni_p_remove(&object, 10));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10, 20, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    assert_true(seahorse_flat_map_ni_p_remove(&object, 20));
+    assert_int_equal(object.count, 2);
+    bool result;
+    assert_true(seahorse_flat_map_ni_p_contains(&object, 20, &result));
+    assert_false(result);
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_get(&object, 30, &out));
+    assert_ptr_equal(out, (void *) 31);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_contains(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_contains((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    bool result;
+    assert_true(seahorse_flat_map_ni_p_contains(&object, 0, &result));
+    assert_false(result);
+    assert_true(seahorse_flat_map_ni_p_contains(&object, 10, &result));
+    assert_true(result);
+    assert_true(seahorse_flat_map_ni_p_contains(&object, 20, &result));
+    assert_false(result);
+    assert_true(seahorse_flat_map_ni_p_contains(&object, 30, &result));
+    assert_true(result);
+    assert_true(seahorse_flat_map_ni_p_contains(&object, 40, &result));
+    assert_false(result);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_set(NULL, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    assert_false(seahorse_flat_map_ni_p_set(&object, 10, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    assert_true(seahorse_flat_map_ni_p_set(&object, 10, (void *) 99));
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_get(&object, 10, &out));
+    assert_ptr_equal(out, (void *) 99);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_get(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_get((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_get(&object, 10, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_get(&object, 20, &out));
+    assert_ptr_equal(out, (void *) 21);
+    assert_false(seahorse_flat_map_ni_p_get(&object, 25, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_ceiling(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_ceiling((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_ceiling(&object, 10, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_ceiling(&object, 10, &out));
+    assert_ptr_equal(out, (void *) 11);
+    assert_true(seahorse_flat_map_ni_p_ceiling(&object, 15, &out));
+    assert_ptr_equal(out, (void *) 21);
+    assert_true(seahorse_flat_map_ni_p_ceiling(&object, 30, &out));
+    assert_ptr_equal(out, (void *) 31);
+    assert_false(seahorse_flat_map_ni_p_ceiling(&object, 35, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_floor(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_floor((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_floor(&object, 10, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_floor(&object, 5, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_floor(&object, 10, &out));
+    assert_ptr_equal(out, (void *) 11);
+    assert_true(seahorse_flat_map_ni_p_floor(&object, 25, &out));
+    assert_ptr_equal(out, (void *) 21);
+    assert_true(seahorse_flat_map_ni_p_floor(&object, 99, &out));
+    assert_ptr_equal(out, (void *) 31);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_higher(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_higher((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_higher(&object, 10, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_higher(&object, 5, &out));
+    assert_ptr_equal(out, (void *) 11);
+    assert_true(seahorse_flat_map_ni_p_higher(&object, 10, &out));
+    assert_ptr_equal(out, (void *) 21);
+    assert_true(seahorse_flat_map_ni_p_higher(&object, 25, &out));
+    assert_ptr_equal(out, (void *) 31);
+    assert_false(seahorse_flat_map_ni_p_higher(&object, 30, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_lower(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_lower((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_lower(&object, 10, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_lower(&object, 10, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_lower(&object, 11, &out));
+    assert_ptr_equal(out, (void *) 11);
+    assert_true(seahorse_flat_map_ni_p_lower(&object, 30, &out));
+    assert_ptr_equal(out, (void *) 21);
+    assert_true(seahorse_flat_map_ni_p_lower(&object, 99, &out));
+    assert_ptr_equal(out, (void *) 31);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_first(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_first((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_first(&object, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_first(&object, &out));
+    assert_ptr_equal(out, (void *) 11);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_last(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_last((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const void *out;
+    assert_false(seahorse_flat_map_ni_p_last(&object, &out));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_last(&object, &out));
+    assert_ptr_equal(out, (void *) 31);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_get_entry(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_get_entry((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_get_entry(&object, 20, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_false(seahorse_flat_map_ni_p_get_entry(&object, 25, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_ceiling_entry(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_ceiling_entry((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_ceiling_entry(&object, 10, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_true(seahorse_flat_map_ni_p_ceiling_entry(&object, 15, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_true(seahorse_flat_map_ni_p_ceiling_entry(&object, 30, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 30);
+    assert_false(seahorse_flat_map_ni_p_ceiling_entry(&object, 35, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_floor_entry(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_floor_entry((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    const uintmax_t *key;
+    assert_false(seahorse_flat_map_ni_p_floor_entry(&object, 5, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_floor_entry(&object, 10, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_true(seahorse_flat_map_ni_p_floor_entry(&object, 25, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_true(seahorse_flat_map_ni_p_floor_entry(&object, 99, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 30);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_higher_entry(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_higher_entry((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_higher_entry(&object, 5, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_true(seahorse_flat_map_ni_p_higher_entry(&object, 10, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_true(seahorse_flat_map_ni_p_higher_entry(&object, 25, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 30);
+    assert_false(seahorse_flat_map_ni_p_higher_entry(&object, 30, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_lower_entry(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_lower_entry((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {30, 10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    const uintmax_t *key;
+    assert_false(seahorse_flat_map_ni_p_lower_entry(&object, 10, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_lower_entry(&object, 11, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_true(seahorse_flat_map_ni_p_lower_entry(&object, 30, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_true(seahorse_flat_map_ni_p_lower_entry(&object, 99, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 30);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_first_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_first_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_false(seahorse_flat_map_ni_p_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_first_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_last_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_last_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_false(seahorse_flat_map_ni_p_last_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {20, 30, 10};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_last_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 30);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_remove_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_remove_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10, 20, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_first_entry(&object, &entry));
+    assert_true(seahorse_flat_map_ni_p_remove_entry(&object, entry));
+    assert_int_equal(object.count, 2);
+    assert_true(seahorse_flat_map_ni_p_first_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_next_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_next_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_next_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {20, 10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_first_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_true(seahorse_flat_map_ni_p_next_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_true(seahorse_flat_map_ni_p_next_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 30);
+    assert_false(seahorse_flat_map_ni_p_next_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_prev_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_prev_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_prev_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {20, 10, 30};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_last_entry(&object, &entry));
+    const uintmax_t *key;
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 30);
+    assert_true(seahorse_flat_map_ni_p_prev_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 20);
+    assert_true(seahorse_flat_map_ni_p_prev_entry(&object, entry, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_key(&object, entry, &key));
+    assert_int_equal(*key, 10);
+    assert_false(seahorse_flat_map_ni_p_prev_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_key(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_key(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_key(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_get_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_get_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_get_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_last_entry(&object, &entry));
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_entry_get_value(&object, entry, &out));
+    assert_ptr_equal(out, (void *) 21);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_set_value(
+            NULL, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_flat_map_ni_p_entry_set_value(
+            (void *) 1, NULL, NULL));
+    assert_int_equal(SEAHORSE_FLAT_MAP_NI_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_flat_map_ni_p object;
+    assert_true(seahorse_flat_map_ni_p_init(&object));
+    const uintmax_t KEYS[] = {10, 20};
+    for (uintmax_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        assert_true(seahorse_flat_map_ni_p_add(
+                &object, KEYS[i], (void *) (1 + KEYS[i])));
+    }
+    const struct seahorse_flat_map_ni_p_entry *entry;
+    assert_true(seahorse_flat_map_ni_p_first_entry(&object, &entry));
+    assert_true(seahorse_flat_map_ni_p_entry_set_value(
+            &object, entry, (void *) 99));
+    const void *out;
+    assert_true(seahorse_flat_map_ni_p_get(&object, 10, &out));
+    assert_ptr_equal(out, (void *) 99);
+    assert_true(seahorse_flat_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_flat_map_ni_p_error_on_object_is_null),
+            cmocka_unit_test(check_init_flat_map_ni_p_error_on_other_is_null),
+            cmocka_unit_test(check_init_flat_map_ni_p),
+            cmocka_unit_test(check_init_flat_map_ni_p_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_red_black_tree_map_ni_p_error_on_object_is_null),
+            cmocka_unit_test(check_init_red_black_tree_map_ni_p_error_on_other_is_null),
+            cmocka_unit_test(check_init_red_black_tree_map_ni_p),
+            cmocka_unit_test(check_init_red_black_tree_map_ni_p_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_ceiling_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling),
+            cmocka_unit_test(check_floor_error_on_object_is_null),
+            cmocka_unit_test(check_floor_error_on_out_is_null),
+            cmocka_unit_test(check_floor_error_on_key_not_found),
+            cmocka_unit_test(check_floor),
+            cmocka_unit_test(check_higher_error_on_object_is_null),
+            cmocka_unit_test(check_higher_error_on_out_is_null),
+            cmocka_unit_test(check_higher_error_on_key_not_found),
+            cmocka_unit_test(check_higher),
+            cmocka_unit_test(check_lower_error_on_object_is_null),
+            cmocka_unit_test(check_lower_error_on_out_is_null),
+            cmocka_unit_test(check_lower_error_on_key_not_found),
+            cmocka_unit_test(check_lower),
+            cmocka_unit_test(check_first_error_on_object_is_null),
+            cmocka_unit_test(check_first_error_on_out_is_null),
+            cmocka_unit_test(check_first_error_on_map_is_empty),
+            cmocka_unit_test(check_first),
+            cmocka_unit_test(check_last_error_on_object_is_null),
+            cmocka_unit_test(check_last_error_on_out_is_null),
+            cmocka_unit_test(check_last_error_on_map_is_empty),
+            cmocka_unit_test(check_last),
+            cmocka_unit_test(check_get_entry_error_on_object_is_null),
+            cmocka_unit_test(check_get_entry_error_on_out_is_null),
+            cmocka_unit_test(check_get_entry),
+            cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_entry),
+            cmocka_unit_test(check_floor_entry_error_on_object_is_null),
+            cmocka_unit_test(check_floor_entry_error_on_out_is_null),
+            cmocka_unit_test(check_floor_entry),
+            cmocka_unit_test(check_higher_entry_error_on_object_is_null),
+            cmocka_unit_test(check_higher_entry_error_on_out_is_null),
+            cmocka_unit_test(check_higher_entry),
+            cmocka_unit_test(check_lower_entry_error_on_object_is_null),
+            cmocka_unit_test(check_lower_entry_error_on_out_is_null),
+            cmocka_unit_test(check_lower_entry),
+            cmocka_unit_test(check_first_entry_error_on_object_is_null),
+            cmocka_unit_test(check_first_entry_error_on_out_is_null),
+            cmocka_unit_test(check_first_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_first_entry),
+            cmocka_unit_test(check_last_entry_error_on_object_is_null),
+            cmocka_unit_test(check_last_entry_error_on_out_is_null),
+            cmocka_unit_test(check_last_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_last_entry),
+            cmocka_unit_test(check_remove_entry_error_on_object_is_null),
+            cmocka_unit_test(check_remove_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_remove_entry),
+            cmocka_unit_test(check_next_entry_error_on_object_is_null),
+            cmocka_unit_test(check_next_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_next_entry_error_on_out_is_null),
+            cmocka_unit_test(check_next_entry),
+            cmocka_unit_test(check_prev_entry_error_on_object_is_null),
+            cmocka_unit_test(check_prev_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_prev_entry_error_on_out_is_null),
+            cmocka_unit_test(check_prev_entry),
+            cmocka_unit_test(check_entry_key_error_on_object_is_null),
+            cmocka_unit_test(check_entry_key_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_key_error_on_out_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_out_is_null),
+            cmocka_unit_test(check_entry_get_value),
+            cmocka_unit_test(check_entry_set_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_set_value),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,792 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object = {};
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_init(NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_int_equal(object.table.count, 0);
+    assert_int_equal(object.table.capacity, 0);
+    assert_null(object.table.entries);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_ni_ni_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_init_hash_map_ni_ni(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_ni_ni_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_init_hash_map_ni_ni((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_ni_ni(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 100; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i, 100 + i));
+    }
+    struct seahorse_hash_map_ni_ni copy;
+    assert_true(seahorse_hash_map_ni_ni_init_hash_map_ni_ni(&copy, &object));
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    uintmax_t count;
+    assert_true(seahorse_hash_map_ni_ni_count(&copy, &count));
+    assert_int_equal(count, 100);
+    for (uintmax_t i = 0; i < 100; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_hash_map_ni_ni_get(&copy, i, &out));
+        assert_int_equal(*out, 100 + i);
+    }
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&copy));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_hash_map_ni_ni_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    struct seahorse_hash_map_ni_ni copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_ni_ni_init_hash_map_ni_ni(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    assert_true(seahorse_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_add(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    assert_false(seahorse_hash_map_ni_ni_add(&object, 1, 3));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_get(&object, 1, &out));
+    assert_int_equal(*out, 2);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const uintmax_t limit = 10000;
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i * 7919, i));
+    }
+    uintmax_t count;
+    assert_true(seahorse_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_hash_map_ni_ni_get(&object, i * 7919, &out));
+        assert_int_equal(*out, i);
+    }
+    bool out;
+    assert_true(seahorse_hash_map_ni_ni_contains(&object, 1, &out));
+    assert_false(out);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_try_add(NULL, 0, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_try_add((void *) 1, 0, 0, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_try_add(&object, 1, 2, &entry));
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_entry_key(&object, entry, &out));
+    assert_int_equal(*out, 1);
+    assert_true(seahorse_hash_map_ni_ni_entry_get_value(&object, entry, &out));
+    assert_int_equal(*out, 2);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_try_add(&object, 1, 2, &entry));
+    const struct seahorse_hash_map_ni_ni_entry *other;
+    assert_false(seahorse_hash_map_ni_ni_try_add(&object, 1, 3, &other));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_ni_ni_try_add(&object, 1, 2, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_remove(NULL, 0));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_false(seahorse_hash_map_ni_ni_remove(&object, 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 2, 2));
+    assert_false(seahorse_hash_map_ni_ni_remove(&object, 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const uintmax_t limit = 10000;
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i, i));
+    }
+    for (uintmax_t i = 0; i < limit; i += 2) {
+        assert_true(seahorse_hash_map_ni_ni_remove(&object, i));
+    }
+    uintmax_t count;
+    assert_true(seahorse_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, limit / 2);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        assert_true(seahorse_hash_map_ni_ni_contains(&object, i, &out));
+        assert_int_equal(out, i % 2);
+    }
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_reuses_deleted_slots(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 0, 0));
+    const uintmax_t capacity = object.table.capacity;
+    for (uintmax_t i = 1; i < 100000; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i, i));
+        assert_true(seahorse_hash_map_ni_ni_remove(&object, i - 1));
+    }
+    assert_int_equal(object.table.count, 1);
+    assert_int_equal(object.table.capacity, capacity);
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_get(&object, 99999, &out));
+    assert_int_equal(*out, 99999);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rehash_in_place(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const uintmax_t window = 100;
+    for (uintmax_t i = 0; i < 10 * window; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i, i));
+    }
+    for (uintmax_t i = 0; i < 9 * window; i++) {
+        assert_true(seahorse_hash_map_ni_ni_remove(&object, i));
+    }
+    const struct seahorse_hash_map_ni_ni_entry *const entries
+            = object.table.entries;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    for (uintmax_t i = 10 * window; i < 1000 * window; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i, i));
+        assert_true(seahorse_hash_map_ni_ni_remove(&object, i - window));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_ptr_equal(object.table.entries, entries);
+    assert_int_equal(object.table.count, window);
+    for (uintmax_t i = 0; i < 1000 * window; i++) {
+        bool out;
+        assert_true(seahorse_hash_map_ni_ni_contains(&object, i, &out));
+        assert_int_equal(out, i >= 999 * window);
+    }
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_contains(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_contains((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    bool out;
+    assert_true(seahorse_hash_map_ni_ni_contains(&object, 1, &out));
+    assert_false(out);
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    assert_true(seahorse_hash_map_ni_ni_contains(&object, 1, &out));
+    assert_true(out);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_set(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_false(seahorse_hash_map_ni_ni_set(&object, 1, 2));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    assert_true(seahorse_hash_map_ni_ni_set(&object, 1, 3));
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_get(&object, 1, &out));
+    assert_int_equal(*out, 3);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_get(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_get((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const uintmax_t *out;
+    assert_false(seahorse_hash_map_ni_ni_get(&object, 1, &out));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_get(&object, 1, &out));
+    assert_int_equal(*out, 2);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_get_entry(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_get_entry((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_false(seahorse_hash_map_ni_ni_get_entry(&object, 1, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_get_entry(&object, 1, &entry));
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_entry_key(&object, entry, &out));
+    assert_int_equal(*out, 1);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_first_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_first_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_false(seahorse_hash_map_ni_ni_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    assert_true(seahorse_hash_map_ni_ni_remove(&object, 1));
+    assert_false(seahorse_hash_map_ni_ni_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_first_entry(&object, &entry));
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_entry_get_value(&object, entry, &out));
+    assert_int_equal(*out, 2);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_next_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_next_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_next_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_end_of_sequence(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    assert_true(seahorse_hash_map_ni_ni_add(&object, 1, 2));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_first_entry(&object, &entry));
+    assert_false(seahorse_hash_map_ni_ni_next_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const uintmax_t limit = 1000;
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i, i));
+    }
+    uintmax_t sum = 0;
+    uintmax_t count = 0;
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_first_entry(&object, &entry));
+    do {
+        const uintmax_t *key;
+        assert_true(seahorse_hash_map_ni_ni_entry_key(&object, entry, &key));
+        sum += *key;
+        count++;
+    } while (seahorse_hash_map_ni_ni_next_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, limit);
+    assert_int_equal(sum, limit * (limit - 1) / 2);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_remove_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_remove_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const uintmax_t limit = 1000;
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(seahorse_hash_map_ni_ni_add(&object, i, i));
+    }
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_first_entry(&object, &entry));
+    do {
+        const uintmax_t *key;
+        assert_true(seahorse_hash_map_ni_ni_entry_key(&object, entry, &key));
+        if (*key % 2) {
+            assert_true(seahorse_hash_map_ni_ni_remove_entry(&object, entry));
+        }
+    } while (seahorse_hash_map_ni_ni_next_entry(&object, entry, &entry));
+    uintmax_t count;
+    assert_true(seahorse_hash_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, limit / 2);
+    bool out;
+    assert_true(seahorse_hash_map_ni_ni_contains(&object, 1, &out));
+    assert_false(out);
+    assert_true(seahorse_hash_map_ni_ni_contains(&object, 2, &out));
+    assert_true(out);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_key(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_key(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_key(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_get_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_get_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_get_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_set_value(NULL, (void *) 1, 0));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_ni_ni_entry_set_value((void *) 1, NULL, 0));
+    assert_int_equal(SEAHORSE_HASH_MAP_NI_NI_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_ni_ni object;
+    assert_true(seahorse_hash_map_ni_ni_init(&object));
+    const struct seahorse_hash_map_ni_ni_entry *entry;
+    assert_true(seahorse_hash_map_ni_ni_try_add(&object, 1, 2, &entry));
+    assert_true(seahorse_hash_map_ni_ni_entry_set_value(&object, entry, 3));
+    const uintmax_t *out;
+    assert_true(seahorse_hash_map_ni_ni_get(&object, 1, &out));
+    assert_int_equal(*out, 3);
+    assert_true(seahorse_hash_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_hash_map_ni_ni_error_on_object_is_null),
+            cmocka_unit_test(check_init_hash_map_ni_ni_error_on_other_is_null),
+            cmocka_unit_test(check_init_hash_map_ni_ni),
+            cmocka_unit_test(check_init_hash_map_ni_ni_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_remove_reuses_deleted_slots),
+            cmocka_unit_test(check_rehash_in_place),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_get_entry_error_on_object_is_null),
+            cmocka_unit_test(check_get_entry_error_on_out_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_not_found),
+            cmocka_unit_test(check_get_entry),
+            cmocka_unit_test(check_first_entry_error_on_object_is_null),
+            cmocka_unit_test(check_first_entry_error_on_out_is_null),
+            cmocka_unit_test(check_first_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_first_entry),
+            cmocka_unit_test(check_next_entry_error_on_object_is_null),
+            cmocka_unit_test(check_next_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_next_entry_error_on_out_is_null),
+            cmocka_unit_test(check_next_entry_error_on_end_of_sequence),
+            cmocka_unit_test(check_next_entry),
+            cmocka_unit_test(check_remove_entry_error_on_object_is_null),
+            cmocka_unit_test(check_remove_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_remove_entry),
+            cmocka_unit_test(check_entry_key_error_on_object_is_null),
+            cmocka_unit_test(check_entry_key_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_key_error_on_out_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_out_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_set_value),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
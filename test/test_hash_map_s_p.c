@@ -0,0 +1,1150 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static uintmax_t destroyed;
+
+static void on_destroy(void *value) {
+    destroyed += (uintmax_t) value;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_invalidate(NULL, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 10; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) i));
+        assert_true(sea_turtle_string_invalidate(&key));
+    }
+    destroyed = 0;
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, on_destroy));
+    assert_int_equal(destroyed, 45);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_init(NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    assert_int_equal(object.table.count, 0);
+    assert_int_equal(object.table.capacity, 0);
+    assert_null(object.table.entries);
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_s_p_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_init_hash_map_s_p(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_s_p_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_init_hash_map_s_p((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OTHER_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_s_p(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) i));
+        assert_true(sea_turtle_string_invalidate(&key));
+    }
+    struct seahorse_hash_map_s_p copy;
+    assert_true(seahorse_hash_map_s_p_init_hash_map_s_p(&copy, &object));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_p_count(&copy, &count));
+    assert_int_equal(count, 100);
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        const void *out;
+        assert_true(seahorse_hash_map_s_p_get_chars(
+                &copy, chars, length, &out));
+        assert_ptr_equal(out, (void *) i);
+    }
+    assert_true(seahorse_hash_map_s_p_invalidate(&copy, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_hash_map_s_p_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    assert_true(sea_turtle_string_invalidate(&key));
+    struct seahorse_hash_map_s_p copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_s_p_init_hash_map_s_p(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    assert_true(seahorse_hash_map_s_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_add(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_add((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) i));
+        assert_true(sea_turtle_string_invalidate(&key));
+    }
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_p_count(&object, &count));
+    assert_int_equal(count, 1000);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        const void *out;
+        assert_true(seahorse_hash_map_s_p_get_chars(
+                &object, chars, length, &out));
+        assert_ptr_equal(out, (void *) i);
+    }
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    assert_false(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_try_add(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_try_add(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_try_add(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_true(seahorse_hash_map_s_p_try_add(
+            &object, &key, (void *) 2, &entry));
+    assert_non_null(entry);
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_p_entry_key(&object, entry, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_true(seahorse_hash_map_s_p_try_add(
+            &object, &key, (void *) 2, &entry));
+    const struct seahorse_hash_map_s_p_entry *other;
+    assert_false(seahorse_hash_map_s_p_try_add(
+            &object, &key, (void *) 2, &other));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_add_take(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_add_take((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add_take(&object, &key, (void *) 2));
+    assert_true(sea_turtle_string_invalidate(&key));
+    bool result;
+    assert_true(seahorse_hash_map_s_p_contains_chars(
+            &object, KEY, sizeof(KEY), &result));
+    assert_true(result);
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    assert_false(seahorse_hash_map_s_p_add_take(&object, &key, (void *) 2));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_false(seahorse_hash_map_s_p_remove(&object, &key));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    bool result;
+    assert_true(seahorse_hash_map_s_p_contains(&object, &key, &result));
+    assert_true(result);
+    assert_true(seahorse_hash_map_s_p_remove(&object, &key));
+    assert_true(seahorse_hash_map_s_p_contains(&object, &key, &result));
+    assert_false(result);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_remove_chars(NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_remove_chars((void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    assert_false(seahorse_hash_map_s_p_remove_chars(&object, KEY, sizeof(KEY)));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) i));
+        assert_true(sea_turtle_string_invalidate(&key));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        assert_true(seahorse_hash_map_s_p_remove_chars(&object, chars, length));
+    }
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_p_count(&object, &count));
+    assert_int_equal(count, 500);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        bool result;
+        assert_true(seahorse_hash_map_s_p_contains_chars(
+                &object, chars, length, &result));
+        assert_int_equal(result, i % 2);
+    }
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rehash_in_place(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    const uintmax_t window = 100;
+    const uintmax_t limit = 100 * window;
+    struct sea_turtle_string *const keys = calloc(limit, sizeof(*keys));
+    assert_non_null(keys);
+    for (uintmax_t i = 0; i < limit; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        size_t size;
+        assert_true(sea_turtle_string_init(&keys[i], chars, length, &size));
+    }
+    char chars[32];
+    for (uintmax_t i = 0; i < 10 * window; i++) {
+        assert_true(seahorse_hash_map_s_p_add_take(
+                &object, &keys[i], (void *) (uintptr_t) i));
+    }
+    for (uintmax_t i = 0; i < 9 * window; i++) {
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        assert_true(seahorse_hash_map_s_p_remove_chars(&object, chars, length));
+    }
+    const void *const entries = object.table.entries;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    for (uintmax_t i = 10 * window; i < limit; i++) {
+        assert_true(seahorse_hash_map_s_p_add_take(
+                &object, &keys[i], (void *) (uintptr_t) i));
+        const int length = snprintf(chars, sizeof(chars), "%ju", i - window);
+        assert_true(seahorse_hash_map_s_p_remove_chars(&object, chars, length));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_ptr_equal(object.table.entries, entries);
+    assert_int_equal(object.table.count, window);
+    for (uintmax_t i = 0; i < limit; i++) {
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        bool out;
+        assert_true(seahorse_hash_map_s_p_contains_chars(
+                &object, chars, length, &out));
+        assert_int_equal(out, i >= limit - window);
+    }
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    free(keys);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_contains(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_contains((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_contains((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    bool result;
+    assert_true(seahorse_hash_map_s_p_contains(&object, &key, &result));
+    assert_false(result);
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    assert_true(seahorse_hash_map_s_p_contains(&object, &key, &result));
+    assert_true(result);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_contains_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_contains_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_contains_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    bool result;
+    assert_true(seahorse_hash_map_s_p_contains_chars(
+            &object, KEY, sizeof(KEY), &result));
+    assert_true(result);
+    assert_true(seahorse_hash_map_s_p_contains_chars(
+            &object, KEY, sizeof(KEY) - 1, &result));
+    assert_false(result);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_set(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_set((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_false(seahorse_hash_map_s_p_set(&object, &key, (void *) 3));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    assert_true(seahorse_hash_map_s_p_set(&object, &key, (void *) 3));
+    const void *out;
+    assert_true(seahorse_hash_map_s_p_get(&object, &key, &out));
+    assert_ptr_equal(out, (void *) 3);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const void *out;
+    assert_false(seahorse_hash_map_s_p_get(&object, &key, &out));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    const void *out;
+    assert_true(seahorse_hash_map_s_p_get(&object, &key, &out));
+    assert_ptr_equal(out, (void *) 2);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    const void *out;
+    assert_false(seahorse_hash_map_s_p_get_chars(
+            &object, KEY, sizeof(KEY), &out));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    const void *out;
+    assert_true(seahorse_hash_map_s_p_get_chars(
+            &object, KEY, sizeof(KEY), &out));
+    assert_ptr_equal(out, (void *) 2);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get_entry(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get_entry((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_get_entry((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_false(seahorse_hash_map_s_p_get_entry(&object, &key, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_true(seahorse_hash_map_s_p_get_entry(&object, &key, &entry));
+    const void *out;
+    assert_true(seahorse_hash_map_s_p_entry_get_value(&object, entry, &out));
+    assert_ptr_equal(out, (void *) 2);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_first_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_first_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_false(seahorse_hash_map_s_p_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_next_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_next_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_next_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) i));
+        assert_true(sea_turtle_string_invalidate(&key));
+    }
+    uintmax_t count = 0;
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_true(seahorse_hash_map_s_p_first_entry(&object, &entry));
+    do {
+        count += 1;
+    } while (seahorse_hash_map_s_p_next_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 100);
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_remove_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_remove_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) i));
+        assert_true(sea_turtle_string_invalidate(&key));
+    }
+    const struct seahorse_hash_map_s_p_entry *entry;
+    while (seahorse_hash_map_s_p_first_entry(&object, &entry)) {
+        assert_true(seahorse_hash_map_s_p_remove_entry(&object, entry));
+    }
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_int_equal(object.table.count, 0);
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) i));
+        assert_true(sea_turtle_string_invalidate(&key));
+    }
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        const void *out;
+        assert_true(seahorse_hash_map_s_p_get_chars(
+                &object, chars, length, &out));
+        assert_ptr_equal(out, (void *) i);
+    }
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_key(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_key((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_key((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_true(seahorse_hash_map_s_p_first_entry(&object, &entry));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_p_entry_key(&object, entry, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_get_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_get_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_get_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_set_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_p_entry_set_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_P_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_p object;
+    assert_true(seahorse_hash_map_s_p_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_true(seahorse_hash_map_s_p_add(&object, &key, (void *) 2));
+    const struct seahorse_hash_map_s_p_entry *entry;
+    assert_true(seahorse_hash_map_s_p_first_entry(&object, &entry));
+    assert_true(seahorse_hash_map_s_p_entry_set_value(
+            &object, entry, (void *) 3));
+    const void *out;
+    assert_true(seahorse_hash_map_s_p_entry_get_value(&object, entry, &out));
+    assert_ptr_equal(out, (void *) 3);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_hash_map_s_p_error_on_object_is_null),
+            cmocka_unit_test(check_init_hash_map_s_p_error_on_other_is_null),
+            cmocka_unit_test(check_init_hash_map_s_p),
+            cmocka_unit_test(check_init_hash_map_s_p_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_key_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_key_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_key_is_null),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_key_already_exists),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_remove_chars_error_on_object_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_not_found),
+            cmocka_unit_test(check_remove_chars),
+            cmocka_unit_test(check_rehash_in_place),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_key_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_contains_chars_error_on_object_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_key_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_out_is_null),
+            cmocka_unit_test(check_contains_chars),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_key_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_get_chars_error_on_object_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_is_null),
+            cmocka_unit_test(check_get_chars_error_on_out_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_not_found),
+            cmocka_unit_test(check_get_chars),
+            cmocka_unit_test(check_get_entry_error_on_object_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_is_null),
+            cmocka_unit_test(check_get_entry_error_on_out_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_not_found),
+            cmocka_unit_test(check_get_entry),
+            cmocka_unit_test(check_first_entry_error_on_object_is_null),
+            cmocka_unit_test(check_first_entry_error_on_out_is_null),
+            cmocka_unit_test(check_first_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_next_entry_error_on_object_is_null),
+            cmocka_unit_test(check_next_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_next_entry_error_on_out_is_null),
+            cmocka_unit_test(check_next_entry),
+            cmocka_unit_test(check_remove_entry_error_on_object_is_null),
+            cmocka_unit_test(check_remove_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_remove_entry),
+            cmocka_unit_test(check_entry_key_error_on_object_is_null),
+            cmocka_unit_test(check_entry_key_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_key_error_on_out_is_null),
+            cmocka_unit_test(check_entry_key),
+            cmocka_unit_test(check_entry_get_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_out_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_set_value),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
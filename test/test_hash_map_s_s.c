@@ -0,0 +1,1414 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_invalidate(NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object = {};
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_init(NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    assert_int_equal(object.table.count, 0);
+    assert_int_equal(object.table.capacity, 0);
+    assert_null(object.table.entries);
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_s_s_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_init_hash_map_s_s(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_s_s_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_init_hash_map_s_s((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OTHER_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_hash_map_s_s(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+        assert_true(sea_turtle_string_invalidate(&key));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_hash_map_s_s copy;
+    assert_true(seahorse_hash_map_s_s_init_hash_map_s_s(&copy, &object));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_s_count(&copy, &count));
+    assert_int_equal(count, 100);
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        const struct sea_turtle_string *out;
+        assert_true(seahorse_hash_map_s_s_get_chars(
+                &copy, chars, length, &out));
+        struct sea_turtle_string value;
+        size_t size;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_int_equal(sea_turtle_string_compare(out, &value), 0);
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    assert_true(seahorse_hash_map_s_s_invalidate(&copy));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_hash_map_s_s_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    struct seahorse_hash_map_s_s copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_s_s_init_hash_map_s_s(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_s_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    assert_true(seahorse_hash_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_add(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_add((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_add((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+        assert_true(sea_turtle_string_invalidate(&key));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1000);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        const struct sea_turtle_string *out;
+        assert_true(seahorse_hash_map_s_s_get_chars(
+                &object, chars, length, &out));
+        struct sea_turtle_string value;
+        size_t size;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_int_equal(sea_turtle_string_compare(out, &value), 0);
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    assert_false(seahorse_hash_map_s_s_add(&object, &key, &value));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_s_s_add(&object, &key, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_s_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_try_add(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_try_add(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_try_add(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_try_add(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_true(seahorse_hash_map_s_s_try_add(&object, &key, &value, &entry));
+    assert_non_null(entry);
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_entry_key(&object, entry, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_true(seahorse_hash_map_s_s_try_add(&object, &key, &value, &entry));
+    const struct seahorse_hash_map_s_s_entry *other;
+    assert_false(seahorse_hash_map_s_s_try_add(&object, &key, &value, &other));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_add_take(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_add_take((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_add_take((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add_take(&object, &key, &value));
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    bool result;
+    assert_true(seahorse_hash_map_s_s_contains_chars(
+            &object, KEY, sizeof(KEY), &result));
+    assert_true(result);
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    assert_false(seahorse_hash_map_s_s_add_take(&object, &key, &value));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    assert_false(seahorse_hash_map_s_s_remove(&object, &key));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    bool result;
+    assert_true(seahorse_hash_map_s_s_contains(&object, &key, &result));
+    assert_true(result);
+    assert_true(seahorse_hash_map_s_s_remove(&object, &key));
+    assert_true(seahorse_hash_map_s_s_contains(&object, &key, &result));
+    assert_false(result);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_remove_chars(NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_remove_chars((void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    const char KEY[] = u8"key";
+    assert_false(seahorse_hash_map_s_s_remove_chars(&object, KEY, sizeof(KEY)));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+        assert_true(sea_turtle_string_invalidate(&key));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        assert_true(seahorse_hash_map_s_s_remove_chars(&object, chars, length));
+    }
+    uintmax_t count;
+    assert_true(seahorse_hash_map_s_s_count(&object, &count));
+    assert_int_equal(count, 500);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        bool result;
+        assert_true(seahorse_hash_map_s_s_contains_chars(
+                &object, chars, length, &result));
+        assert_int_equal(result, i % 2);
+    }
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rehash_in_place(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    const uintmax_t window = 100;
+    const uintmax_t limit = 100 * window;
+    struct sea_turtle_string *const keys = calloc(limit, sizeof(*keys));
+    struct sea_turtle_string *const values = calloc(limit, sizeof(*values));
+    assert_non_null(keys);
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < limit; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        size_t size;
+        assert_true(sea_turtle_string_init(&keys[i], chars, length, &size));
+        assert_true(sea_turtle_string_init(&values[i], chars, length, &size));
+    }
+    char chars[32];
+    for (uintmax_t i = 0; i < 10 * window; i++) {
+        assert_true(seahorse_hash_map_s_s_add_take(
+                &object, &keys[i], &values[i]));
+    }
+    for (uintmax_t i = 0; i < 9 * window; i++) {
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        assert_true(seahorse_hash_map_s_s_remove_chars(&object, chars, length));
+    }
+    const void *const entries = object.table.entries;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    for (uintmax_t i = 10 * window; i < limit; i++) {
+        assert_true(seahorse_hash_map_s_s_add_take(
+                &object, &keys[i], &values[i]));
+        const int length = snprintf(chars, sizeof(chars), "%ju", i - window);
+        assert_true(seahorse_hash_map_s_s_remove_chars(&object, chars, length));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_ptr_equal(object.table.entries, entries);
+    assert_int_equal(object.table.count, window);
+    for (uintmax_t i = 0; i < limit; i++) {
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        bool out;
+        assert_true(seahorse_hash_map_s_s_contains_chars(
+                &object, chars, length, &out));
+        assert_int_equal(out, i >= limit - window);
+    }
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    free(keys);
+    free(values);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_contains(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_contains((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_contains((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    bool result;
+    assert_true(seahorse_hash_map_s_s_contains(&object, &key, &result));
+    assert_false(result);
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    assert_true(seahorse_hash_map_s_s_contains(&object, &key, &result));
+    assert_true(result);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_contains_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_contains_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_contains_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    bool result;
+    assert_true(seahorse_hash_map_s_s_contains_chars(
+            &object, KEY, sizeof(KEY), &result));
+    assert_true(result);
+    assert_true(seahorse_hash_map_s_s_contains_chars(
+            &object, KEY, sizeof(KEY) - 1, &result));
+    assert_false(result);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_set(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_set((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_set((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_false(seahorse_hash_map_s_s_set(&object, &key, &value));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    struct sea_turtle_string other;
+    const char OTHER[] = u8"other";
+    assert_true(sea_turtle_string_init(&other, OTHER, sizeof(OTHER), &size));
+    assert_true(seahorse_hash_map_s_s_set(&object, &key, &other));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_get(&object, &key, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &other), 0);
+    assert_true(sea_turtle_string_invalidate(&other));
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_s_s_set(&object, &key, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_set_take(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_take_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_set_take((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_set_take((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_take_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_false(seahorse_hash_map_s_s_set_take(&object, &key, &value));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_take(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    struct sea_turtle_string other;
+    const char OTHER[] = u8"other";
+    assert_true(sea_turtle_string_init(&other, OTHER, sizeof(OTHER), &size));
+    assert_true(seahorse_hash_map_s_s_set_take(&object, &key, &other));
+    assert_true(sea_turtle_string_invalidate(&other));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_get_chars(
+            &object, KEY, sizeof(KEY), &out));
+    const char *chars;
+    assert_true(sea_turtle_string_char(out, &chars));
+    assert_memory_equal(chars, OTHER, sizeof(OTHER));
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_hash_map_s_s_get(&object, &key, &out));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_get(&object, &key, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &value), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    const char KEY[] = u8"key";
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_hash_map_s_s_get_chars(
+            &object, KEY, sizeof(KEY), &out));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_get_chars(
+            &object, KEY, sizeof(KEY), &out));
+    assert_int_equal(sea_turtle_string_compare(out, &value), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get_entry(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get_entry((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_get_entry((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_false(seahorse_hash_map_s_s_get_entry(&object, &key, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_KEY_NOT_FOUND, seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_true(seahorse_hash_map_s_s_get_entry(&object, &key, &entry));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_entry_get_value(&object, entry, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &value), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_first_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_first_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_entry_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_false(seahorse_hash_map_s_s_first_entry(&object, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_next_entry(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_next_entry(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_next_entry(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+        assert_true(sea_turtle_string_invalidate(&key));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    uintmax_t count = 0;
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_true(seahorse_hash_map_s_s_first_entry(&object, &entry));
+    do {
+        count += 1;
+    } while (seahorse_hash_map_s_s_next_entry(&object, entry, &entry));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 100);
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_remove_entry(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_remove_entry((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+        assert_true(sea_turtle_string_invalidate(&key));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    const struct seahorse_hash_map_s_s_entry *entry;
+    while (seahorse_hash_map_s_s_first_entry(&object, &entry)) {
+        assert_true(seahorse_hash_map_s_s_remove_entry(&object, entry));
+    }
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_MAP_IS_EMPTY, seahorse_error);
+    assert_int_equal(object.table.count, 0);
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        struct sea_turtle_string key;
+        size_t size;
+        assert_true(sea_turtle_string_init(&key, chars, length, &size));
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+        assert_true(sea_turtle_string_invalidate(&key));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    for (uintmax_t i = 0; i < 100; i++) {
+        char chars[32];
+        const int length = snprintf(chars, sizeof(chars), "%ju", i);
+        const struct sea_turtle_string *out;
+        assert_true(seahorse_hash_map_s_s_get_chars(
+                &object, chars, length, &out));
+        struct sea_turtle_string value;
+        size_t size;
+        assert_true(sea_turtle_string_init(&value, chars, length, &size));
+        assert_int_equal(sea_turtle_string_compare(out, &value), 0);
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_key(NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_key((void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_key((void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_key(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_true(seahorse_hash_map_s_s_first_entry(&object, &entry));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_entry_key(&object, entry, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_get_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_get_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_get_value_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_get_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_set_value(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_set_value(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_ENTRY_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_hash_map_s_s_entry_set_value(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_VALUE_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_set_value(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_true(seahorse_hash_map_s_s_first_entry(&object, &entry));
+    struct sea_turtle_string other;
+    const char OTHER[] = u8"other";
+    assert_true(sea_turtle_string_init(&other, OTHER, sizeof(OTHER), &size));
+    assert_true(seahorse_hash_map_s_s_entry_set_value(&object, entry, &other));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_hash_map_s_s_entry_get_value(&object, entry, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &other), 0);
+    assert_true(sea_turtle_string_invalidate(&other));
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_entry_set_value_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_hash_map_s_s object;
+    assert_true(seahorse_hash_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_hash_map_s_s_add(&object, &key, &value));
+    const struct seahorse_hash_map_s_s_entry *entry;
+    assert_true(seahorse_hash_map_s_s_first_entry(&object, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_hash_map_s_s_entry_set_value(&object, entry, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HASH_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_hash_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_hash_map_s_s_error_on_object_is_null),
+            cmocka_unit_test(check_init_hash_map_s_s_error_on_other_is_null),
+            cmocka_unit_test(check_init_hash_map_s_s),
+            cmocka_unit_test(check_init_hash_map_s_s_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_key_is_null),
+            cmocka_unit_test(check_add_error_on_value_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_key_is_null),
+            cmocka_unit_test(check_try_add_error_on_value_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_key_is_null),
+            cmocka_unit_test(check_add_take_error_on_value_is_null),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_key_already_exists),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_remove_chars_error_on_object_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_not_found),
+            cmocka_unit_test(check_remove_chars),
+            cmocka_unit_test(check_rehash_in_place),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_key_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_contains_chars_error_on_object_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_key_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_out_is_null),
+            cmocka_unit_test(check_contains_chars),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_is_null),
+            cmocka_unit_test(check_set_error_on_value_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_take_error_on_object_is_null),
+            cmocka_unit_test(check_set_take_error_on_key_is_null),
+            cmocka_unit_test(check_set_take_error_on_value_is_null),
+            cmocka_unit_test(check_set_take_error_on_key_not_found),
+            cmocka_unit_test(check_set_take),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_key_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_get_chars_error_on_object_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_is_null),
+            cmocka_unit_test(check_get_chars_error_on_out_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_not_found),
+            cmocka_unit_test(check_get_chars),
+            cmocka_unit_test(check_get_entry_error_on_object_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_is_null),
+            cmocka_unit_test(check_get_entry_error_on_out_is_null),
+            cmocka_unit_test(check_get_entry_error_on_key_not_found),
+            cmocka_unit_test(check_get_entry),
+            cmocka_unit_test(check_first_entry_error_on_object_is_null),
+            cmocka_unit_test(check_first_entry_error_on_out_is_null),
+            cmocka_unit_test(check_first_entry_error_on_map_is_empty),
+            cmocka_unit_test(check_next_entry_error_on_object_is_null),
+            cmocka_unit_test(check_next_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_next_entry_error_on_out_is_null),
+            cmocka_unit_test(check_next_entry),
+            cmocka_unit_test(check_remove_entry_error_on_object_is_null),
+            cmocka_unit_test(check_remove_entry_error_on_entry_is_null),
+            cmocka_unit_test(check_remove_entry),
+            cmocka_unit_test(check_entry_key_error_on_object_is_null),
+            cmocka_unit_test(check_entry_key_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_key_error_on_out_is_null),
+            cmocka_unit_test(check_entry_key),
+            cmocka_unit_test(check_entry_get_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_get_value_error_on_out_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_object_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_set_value_error_on_value_is_null),
+            cmocka_unit_test(check_entry_set_value),
+            cmocka_unit_test(check_entry_set_value_error_on_memory_allocation_failed),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,346 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           1000
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object = {};
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_init(NULL));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_null(object.items);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_heap_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_heap_ni_push(&object, 1));
+    assert_true(seahorse_heap_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_push(NULL, 1));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_heap_ni_push(&object, 1));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    /* push in descending order so that every item sifts to the top */
+    for (uintmax_t i = LIMIT; i; i--) {
+        assert_true(seahorse_heap_ni_push(&object, i - 1));
+        uintmax_t out;
+        assert_true(seahorse_heap_ni_peek(&object, &out));
+        assert_int_equal(out, i - 1);
+    }
+    assert_int_equal(object.count, LIMIT);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        uintmax_t out;
+        assert_true(seahorse_heap_ni_pop(&object, &out));
+        assert_int_equal(out, i);
+    }
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_duplicates(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    const uintmax_t values[] = {3, 1, 3, 2, 1};
+    for (uintmax_t i = 0; i < 5; i++) {
+        assert_true(seahorse_heap_ni_push(&object, values[i]));
+    }
+    const uintmax_t sorted[] = {1, 1, 2, 3, 3};
+    for (uintmax_t i = 0; i < 5; i++) {
+        uintmax_t out;
+        assert_true(seahorse_heap_ni_pop(&object, &out));
+        assert_int_equal(out, sorted[i]);
+    }
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_push_all(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_push_all((void *) 1, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_push_all((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    const uintmax_t values[] = {1, 2, 3};
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_heap_ni_push_all(&object, 3, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    /* a permutation of 0 .. LIMIT - 1 since 7 and LIMIT are coprime */
+    uintmax_t values[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        values[i] = (i * 7) % LIMIT;
+    }
+    assert_true(seahorse_heap_ni_push_all(&object, LIMIT, values));
+    assert_int_equal(object.count, LIMIT);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        uintmax_t out;
+        assert_true(seahorse_heap_ni_pop(&object, &out));
+        assert_int_equal(out, i);
+    }
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_onto_larger_heap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    for (uintmax_t i = 3; i < LIMIT; i++) {
+        assert_true(seahorse_heap_ni_push(&object, i));
+    }
+    const uintmax_t values[] = {2, 0, 1};
+    assert_true(seahorse_heap_ni_push_all(&object, 3, values));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        uintmax_t out;
+        assert_true(seahorse_heap_ni_pop(&object, &out));
+        assert_int_equal(out, i);
+    }
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_single(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    const uintmax_t values[] = {4};
+    assert_true(seahorse_heap_ni_push_all(&object, 1, values));
+    uintmax_t out;
+    assert_true(seahorse_heap_ni_pop(&object, &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_pop(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_pop((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_heap_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_heap_ni_pop(&object, &out));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_HEAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    assert_true(seahorse_heap_ni_push(&object, 2));
+    assert_true(seahorse_heap_ni_push(&object, 1));
+    uintmax_t out;
+    assert_true(seahorse_heap_ni_pop(&object, &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_heap_ni_pop(&object, &out));
+    assert_int_equal(out, 2);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_peek(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_ni_peek((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_heap_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_heap_ni_peek(&object, &out));
+    assert_int_equal(SEAHORSE_HEAP_NI_ERROR_HEAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_ni object;
+    assert_true(seahorse_heap_ni_init(&object));
+    assert_true(seahorse_heap_ni_push(&object, 2));
+    assert_true(seahorse_heap_ni_push(&object, 1));
+    uintmax_t out;
+    assert_true(seahorse_heap_ni_peek(&object, &out));
+    assert_int_equal(out, 1);
+    assert_int_equal(object.count, 2);
+    assert_true(seahorse_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_push_error_on_object_is_null),
+            cmocka_unit_test(check_push_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push),
+            cmocka_unit_test(check_push_duplicates),
+            cmocka_unit_test(check_push_all_error_on_object_is_null),
+            cmocka_unit_test(check_push_all_error_on_count_is_zero),
+            cmocka_unit_test(check_push_all_error_on_values_is_null),
+            cmocka_unit_test(check_push_all_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push_all),
+            cmocka_unit_test(check_push_all_onto_larger_heap),
+            cmocka_unit_test(check_push_all_single),
+            cmocka_unit_test(check_pop_error_on_object_is_null),
+            cmocka_unit_test(check_pop_error_on_out_is_null),
+            cmocka_unit_test(check_pop_error_on_heap_is_empty),
+            cmocka_unit_test(check_pop),
+            cmocka_unit_test(check_peek_error_on_object_is_null),
+            cmocka_unit_test(check_peek_error_on_out_is_null),
+            cmocka_unit_test(check_peek_error_on_heap_is_empty),
+            cmocka_unit_test(check_peek),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,348 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           1000
+
+static uintmax_t destroyed;
+
+static void on_destroy(void *item) {
+    destroyed++;
+}
+
+/* compare is handed where the items are stored */
+static int compare(const void *const a, const void *const b) {
+    const uintptr_t first = (uintptr_t) *(void *const *) a;
+    const uintptr_t second = (uintptr_t) *(void *const *) b;
+    return first < second ? -1 : first > second;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_invalidate(NULL, NULL));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object = {};
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate_with_on_destroy(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_heap_p_push(&object, (void *) i));
+    }
+    destroyed = 0;
+    assert_true(seahorse_heap_p_invalidate(&object, on_destroy));
+    assert_int_equal(destroyed, 3);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_init(NULL, compare));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_compare_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_false(seahorse_heap_p_init(&object, NULL));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_COMPARE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    assert_int_equal(object.count, 0);
+    assert_ptr_equal(object.compare, compare);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    uintmax_t count;
+    assert_true(seahorse_heap_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_heap_p_push(&object, NULL));
+    assert_true(seahorse_heap_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_push(NULL, NULL));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_heap_p_push(&object, NULL));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    for (uintmax_t i = LIMIT; i; i--) {
+        assert_true(seahorse_heap_p_push(&object, (void *) (i - 1)));
+        void *out;
+        assert_true(seahorse_heap_p_peek(&object, &out));
+        assert_ptr_equal(out, (void *) (i - 1));
+    }
+    assert_int_equal(object.count, LIMIT);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        void *out;
+        assert_true(seahorse_heap_p_pop(&object, &out));
+        assert_ptr_equal(out, (void *) i);
+    }
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_push_all(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_push_all((void *) 1, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_push_all((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    void *const values[] = {NULL, NULL};
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_heap_p_push_all(&object, 2, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    void *values[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        values[i] = (void *) ((i * 7) % LIMIT);
+    }
+    assert_true(seahorse_heap_p_push_all(&object, LIMIT, values));
+    assert_int_equal(object.count, LIMIT);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        void *out;
+        assert_true(seahorse_heap_p_pop(&object, &out));
+        assert_ptr_equal(out, (void *) i);
+    }
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_all_onto_larger_heap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    for (uintmax_t i = 3; i < LIMIT; i++) {
+        assert_true(seahorse_heap_p_push(&object, (void *) i));
+    }
+    void *const values[] = {(void *) 2, (void *) 0, (void *) 1};
+    assert_true(seahorse_heap_p_push_all(&object, 3, values));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        void *out;
+        assert_true(seahorse_heap_p_pop(&object, &out));
+        assert_ptr_equal(out, (void *) i);
+    }
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_pop(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_pop((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_heap_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    void *out;
+    assert_false(seahorse_heap_p_pop(&object, &out));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_HEAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    assert_true(seahorse_heap_p_push(&object, (void *) 2));
+    assert_true(seahorse_heap_p_push(&object, (void *) 1));
+    void *out;
+    assert_true(seahorse_heap_p_pop(&object, &out));
+    assert_ptr_equal(out, (void *) 1);
+    assert_true(seahorse_heap_p_pop(&object, &out));
+    assert_ptr_equal(out, (void *) 2);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_peek(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_heap_p_peek((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_heap_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    void *out;
+    assert_false(seahorse_heap_p_peek(&object, &out));
+    assert_int_equal(SEAHORSE_HEAP_P_ERROR_HEAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_heap_p object;
+    assert_true(seahorse_heap_p_init(&object, compare));
+    assert_true(seahorse_heap_p_push(&object, (void *) 2));
+    assert_true(seahorse_heap_p_push(&object, (void *) 1));
+    void *out;
+    assert_true(seahorse_heap_p_peek(&object, &out));
+    assert_ptr_equal(out, (void *) 1);
+    assert_int_equal(object.count, 2);
+    assert_true(seahorse_heap_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_invalidate_with_on_destroy),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init_error_on_compare_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_push_error_on_object_is_null),
+            cmocka_unit_test(check_push_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push),
+            cmocka_unit_test(check_push_all_error_on_object_is_null),
+            cmocka_unit_test(check_push_all_error_on_count_is_zero),
+            cmocka_unit_test(check_push_all_error_on_values_is_null),
+            cmocka_unit_test(check_push_all_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push_all),
+            cmocka_unit_test(check_push_all_onto_larger_heap),
+            cmocka_unit_test(check_pop_error_on_object_is_null),
+            cmocka_unit_test(check_pop_error_on_out_is_null),
+            cmocka_unit_test(check_pop_error_on_heap_is_empty),
+            cmocka_unit_test(check_pop),
+            cmocka_unit_test(check_peek_error_on_object_is_null),
+            cmocka_unit_test(check_peek_error_on_out_is_null),
+            cmocka_unit_test(check_peek_error_on_heap_is_empty),
+            cmocka_unit_test(check_peek),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,451 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           1000
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object = {};
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_init(NULL));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.limit, 0);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_indexed_heap_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_indexed_heap_ni_push(&object, 1, 1));
+    assert_true(seahorse_indexed_heap_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_push(NULL, 1, 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_true(seahorse_indexed_heap_ni_push(&object, 1, 1));
+    assert_false(seahorse_indexed_heap_ni_push(&object, 1, 2));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_indexed_heap_ni_push(&object, 1, 1));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_key_is_too_large(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_false(seahorse_indexed_heap_ni_push(&object, UINTMAX_MAX, 1));
+    assert_int_equal(
+            SEAHORSE_INDEXED_HEAP_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_indexed_heap_ni_push(&object, i, LIMIT - i));
+        uintmax_t out;
+        assert_true(seahorse_indexed_heap_ni_peek(&object, &out));
+        assert_int_equal(out, i);
+    }
+    assert_int_equal(object.count, LIMIT);
+    for (uintmax_t i = LIMIT; i; i--) {
+        uintmax_t out;
+        assert_true(seahorse_indexed_heap_ni_pop(&object, &out));
+        assert_int_equal(out, i - 1);
+    }
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_pop(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_pop((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_heap_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_indexed_heap_ni_pop(&object, &out));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_HEAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_true(seahorse_indexed_heap_ni_push(&object, 7, 2));
+    assert_true(seahorse_indexed_heap_ni_push(&object, 3, 1));
+    uintmax_t out;
+    assert_true(seahorse_indexed_heap_ni_pop(&object, &out));
+    assert_int_equal(out, 3);
+    bool contains;
+    assert_true(seahorse_indexed_heap_ni_contains(&object, 3, &contains));
+    assert_false(contains);
+    /* a popped key may be pushed again */
+    assert_true(seahorse_indexed_heap_ni_push(&object, 3, 5));
+    assert_true(seahorse_indexed_heap_ni_pop(&object, &out));
+    assert_int_equal(out, 7);
+    assert_true(seahorse_indexed_heap_ni_pop(&object, &out));
+    assert_int_equal(out, 3);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_peek(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_peek((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_heap_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_indexed_heap_ni_peek(&object, &out));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_HEAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_true(seahorse_indexed_heap_ni_push(&object, 7, 2));
+    assert_true(seahorse_indexed_heap_ni_push(&object, 3, 1));
+    uintmax_t out;
+    assert_true(seahorse_indexed_heap_ni_peek(&object, &out));
+    assert_int_equal(out, 3);
+    assert_int_equal(object.count, 2);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_contains(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_contains((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    bool out;
+    assert_true(seahorse_indexed_heap_ni_contains(&object, 4, &out));
+    assert_false(out);
+    assert_true(seahorse_indexed_heap_ni_push(&object, 4, 1));
+    assert_true(seahorse_indexed_heap_ni_contains(&object, 4, &out));
+    assert_true(out);
+    assert_true(seahorse_indexed_heap_ni_contains(&object, 3, &out));
+    assert_false(out);
+    assert_true(seahorse_indexed_heap_ni_contains(&object, UINTMAX_MAX, &out));
+    assert_false(out);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_get(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_get((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_indexed_heap_ni_get(&object, 1, &out));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_true(seahorse_indexed_heap_ni_push(&object, 1, 10));
+    uintmax_t out;
+    assert_true(seahorse_indexed_heap_ni_get(&object, 1, &out));
+    assert_int_equal(out, 10);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_decrease_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_decrease(NULL, 1, 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_decrease_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_false(seahorse_indexed_heap_ni_decrease(&object, 1, 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_decrease_error_on_priority_is_out_of_bounds(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_true(seahorse_indexed_heap_ni_push(&object, 1, 10));
+    assert_false(seahorse_indexed_heap_ni_decrease(&object, 1, 11));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_PRIORITY_IS_OUT_OF_BOUNDS,
+                     seahorse_error);
+    uintmax_t out;
+    assert_true(seahorse_indexed_heap_ni_get(&object, 1, &out));
+    assert_int_equal(out, 10);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_decrease(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_indexed_heap_ni_push(&object, i, LIMIT + i));
+    }
+    /* move the keys to the front one at a time from the back */
+    for (uintmax_t i = LIMIT; i; i--) {
+        assert_true(seahorse_indexed_heap_ni_decrease(&object, i - 1, i - 1));
+        uintmax_t out;
+        assert_true(seahorse_indexed_heap_ni_peek(&object, &out));
+        assert_int_equal(out, i - 1);
+    }
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        uintmax_t out;
+        assert_true(seahorse_indexed_heap_ni_pop(&object, &out));
+        assert_int_equal(out, i);
+    }
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_indexed_heap_ni_remove(NULL, 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    assert_false(seahorse_indexed_heap_ni_remove(&object, 1));
+    assert_int_equal(SEAHORSE_INDEXED_HEAP_NI_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_indexed_heap_ni object;
+    assert_true(seahorse_indexed_heap_ni_init(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_indexed_heap_ni_push(&object, i, (i * 7) % LIMIT));
+    }
+    /* remove every odd priority, wherever it sits in the heap */
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        if ((i * 7) % LIMIT % 2) {
+            assert_true(seahorse_indexed_heap_ni_remove(&object, i));
+        }
+    }
+    assert_int_equal(object.count, LIMIT / 2);
+    for (uintmax_t i = 0; i < LIMIT / 2; i++) {
+        uintmax_t key;
+        assert_true(seahorse_indexed_heap_ni_peek(&object, &key));
+        uintmax_t priority;
+        assert_true(seahorse_indexed_heap_ni_get(&object, key, &priority));
+        assert_int_equal(priority, 2 * i);
+        assert_true(seahorse_indexed_heap_ni_pop(&object, &key));
+    }
+    assert_true(seahorse_indexed_heap_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_push_error_on_object_is_null),
+            cmocka_unit_test(check_push_error_on_key_already_exists),
+            cmocka_unit_test(check_push_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push_error_on_key_is_too_large),
+            cmocka_unit_test(check_push),
+            cmocka_unit_test(check_pop_error_on_object_is_null),
+            cmocka_unit_test(check_pop_error_on_out_is_null),
+            cmocka_unit_test(check_pop_error_on_heap_is_empty),
+            cmocka_unit_test(check_pop),
+            cmocka_unit_test(check_peek_error_on_object_is_null),
+            cmocka_unit_test(check_peek_error_on_out_is_null),
+            cmocka_unit_test(check_peek_error_on_heap_is_empty),
+            cmocka_unit_test(check_peek),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_decrease_error_on_object_is_null),
+            cmocka_unit_test(check_decrease_error_on_key_not_found),
+            cmocka_unit_test(check_decrease_error_on_priority_is_out_of_bounds),
+            cmocka_unit_test(check_decrease),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
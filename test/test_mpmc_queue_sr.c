@@ -0,0 +1,517 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <seagrass.h>
+#include <triggerfish.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           1000
+#define THREADS                         4
+
+static uintmax_t instances[LIMIT];
+static atomic_uintmax_t destroyed;
+
+static void on_destroy(void *instance) {
+    assert_non_null(instance);
+    atomic_fetch_add(&destroyed, 1);
+}
+
+struct context {
+    struct seahorse_mpmc_queue_sr *object;
+    struct triggerfish_strong **item;
+    atomic_uintmax_t *sum;
+};
+
+static void *produce(void *argument) {
+    struct context *const context = argument;
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        seagrass_required_true(seahorse_mpmc_queue_sr_add(
+                context->object, context->item[i]));
+    }
+    return NULL;
+}
+
+static void *consume(void *argument) {
+    struct context *const context = argument;
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        struct triggerfish_strong *out;
+        seagrass_required_true(seahorse_mpmc_queue_sr_remove(
+                context->object, &out));
+        void *instance;
+        seagrass_required_true(triggerfish_strong_instance(out, &instance));
+        atomic_fetch_add(context->sum, *(uintmax_t *) instance);
+        seagrass_required_true(triggerfish_strong_release(out));
+    }
+    return NULL;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_invalidate(NULL));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object = {};
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate_releases_items(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    struct triggerfish_strong *item[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(triggerfish_strong_of(&instances[i], on_destroy, &item[i]));
+    }
+    assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[0]));
+    assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[1]));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(triggerfish_strong_release(item[i]));
+    }
+    destroyed = 0;
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    assert_int_equal(destroyed, 2);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_init(NULL, 1));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_capacity_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_false(seahorse_mpmc_queue_sr_init(&object, 0));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_CAPACITY_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_mpmc_queue_sr_init(&object, 4));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    assert_non_null(object.data);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_capacity_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_capacity(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_capacity_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_capacity((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_capacity(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    uintmax_t capacity;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 1));
+    assert_true(seahorse_mpmc_queue_sr_capacity(&object, &capacity));
+    assert_int_equal(capacity, 2);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 2));
+    assert_true(seahorse_mpmc_queue_sr_capacity(&object, &capacity));
+    assert_int_equal(capacity, 2);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 3));
+    assert_true(seahorse_mpmc_queue_sr_capacity(&object, &capacity));
+    assert_int_equal(capacity, 4);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 100));
+    assert_true(seahorse_mpmc_queue_sr_capacity(&object, &capacity));
+    assert_int_equal(capacity, 128);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    struct triggerfish_strong *item[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(triggerfish_strong_of(&instances[i], on_destroy, &item[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[0]));
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(triggerfish_strong_release(item[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_try_add(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_item_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_try_add((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_item_is_invalid(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    /* exploiting knowledge that the first field of strong reference is the
+     * atomic counter for reference counting */
+    atomic_uintmax_t counter;
+    atomic_store(&counter, 0);
+    assert_false(seahorse_mpmc_queue_sr_try_add(
+            (void *) 1, (struct triggerfish_strong *) &counter));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_INVALID,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    struct triggerfish_strong *item[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(triggerfish_strong_of(&instances[i], on_destroy, &item[i]));
+    }
+    assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[0]));
+    uintmax_t count;
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 1);
+    struct triggerfish_strong *out;
+    assert_true(seahorse_mpmc_queue_sr_try_remove(&object, &out));
+    assert_ptr_equal(out, item[0]);
+    assert_true(triggerfish_strong_release(out));
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(triggerfish_strong_release(item[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_add(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_item_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_add((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_item_is_invalid(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    /* exploiting knowledge that the first field of strong reference is the
+     * atomic counter for reference counting */
+    atomic_uintmax_t counter;
+    atomic_store(&counter, 0);
+    assert_false(seahorse_mpmc_queue_sr_add(
+            (void *) 1, (struct triggerfish_strong *) &counter));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_ITEM_IS_INVALID,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    struct triggerfish_strong *item[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(triggerfish_strong_of(&instances[i], on_destroy, &item[i]));
+    }
+    assert_true(seahorse_mpmc_queue_sr_add(&object, item[0]));
+    uintmax_t count;
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 1);
+    struct triggerfish_strong *out;
+    assert_true(seahorse_mpmc_queue_sr_try_remove(&object, &out));
+    assert_ptr_equal(out, item[0]);
+    assert_true(triggerfish_strong_release(out));
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(triggerfish_strong_release(item[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_queue_is_full(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 2));
+    struct triggerfish_strong *item[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(triggerfish_strong_of(&instances[i], on_destroy, &item[i]));
+    }
+    assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[0]));
+    assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[1]));
+    assert_false(seahorse_mpmc_queue_sr_try_add(&object, item[2]));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_FULL,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 2);
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(triggerfish_strong_release(item[i]));
+    }
+    destroyed = 0;
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    assert_int_equal(destroyed, 2);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_try_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_remove_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_try_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_mpmc_queue_sr_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_remove_error_on_queue_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    struct triggerfish_strong *out;
+    assert_false(seahorse_mpmc_queue_sr_try_remove(&object, &out));
+    assert_int_equal(SEAHORSE_MPMC_QUEUE_SR_ERROR_QUEUE_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    struct triggerfish_strong *item[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(triggerfish_strong_of(&instances[i], on_destroy, &item[i]));
+    }
+    for (uintmax_t round = 0; round < 3; round++) {
+        for (uintmax_t i = 0; i < 3; i++) {
+            assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[i]));
+        }
+        for (uintmax_t i = 0; i < 3; i++) {
+            struct triggerfish_strong *out;
+            assert_true(seahorse_mpmc_queue_sr_try_remove(&object, &out));
+            assert_ptr_equal(out, item[i]);
+            assert_true(triggerfish_strong_release(out));
+        }
+    }
+    uintmax_t count;
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(triggerfish_strong_release(item[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 4));
+    struct triggerfish_strong *item[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(triggerfish_strong_of(&instances[i], on_destroy, &item[i]));
+    }
+    for (uintmax_t round = 0; round < 3; round++) {
+        for (uintmax_t i = 0; i < 3; i++) {
+            assert_true(seahorse_mpmc_queue_sr_try_add(&object, item[i]));
+        }
+        for (uintmax_t i = 0; i < 3; i++) {
+            struct triggerfish_strong *out;
+            assert_true(seahorse_mpmc_queue_sr_remove(&object, &out));
+            assert_ptr_equal(out, item[i]);
+            assert_true(triggerfish_strong_release(out));
+        }
+    }
+    uintmax_t count;
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(triggerfish_strong_release(item[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_concurrent_add_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_mpmc_queue_sr object;
+    assert_true(seahorse_mpmc_queue_sr_init(&object, 8));
+    static struct triggerfish_strong *item[THREADS][LIMIT];
+    for (uintmax_t j = 0; j < LIMIT; j++) {
+        instances[j] = j;
+    }
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        for (uintmax_t j = 0; j < LIMIT; j++) {
+            assert_true(triggerfish_strong_of(
+                    &instances[j], on_destroy, &item[i][j]));
+        }
+    }
+    pthread_t producers[THREADS];
+    pthread_t consumers[THREADS];
+    atomic_uintmax_t sum;
+    atomic_init(&sum, 0);
+    struct context context[THREADS];
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        context[i] = (struct context) {
+                .object = &object,
+                .item = item[i],
+                .sum = &sum
+        };
+        assert_int_equal(pthread_create(
+                &producers[i], NULL, produce, &context[i]), 0);
+        assert_int_equal(pthread_create(
+                &consumers[i], NULL, consume, &context[i]), 0);
+    }
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        assert_int_equal(pthread_join(producers[i], NULL), 0);
+        assert_int_equal(pthread_join(consumers[i], NULL), 0);
+    }
+    /* every instance was handed over once per producer */
+    assert_int_equal(atomic_load(&sum),
+                     THREADS * (LIMIT * (LIMIT - 1) / 2));
+    uintmax_t count;
+    assert_true(seahorse_mpmc_queue_sr_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_mpmc_queue_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        for (uintmax_t j = 0; j < LIMIT; j++) {
+            assert_true(triggerfish_strong_release(item[i][j]));
+        }
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_invalidate_releases_items),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init_error_on_capacity_is_zero),
+            cmocka_unit_test(check_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_capacity_error_on_object_is_null),
+            cmocka_unit_test(check_capacity_error_on_out_is_null),
+            cmocka_unit_test(check_capacity),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_item_is_null),
+            cmocka_unit_test(check_try_add_error_on_item_is_invalid),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_item_is_null),
+            cmocka_unit_test(check_add_error_on_item_is_invalid),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_try_add_error_on_queue_is_full),
+            cmocka_unit_test(check_try_remove_error_on_object_is_null),
+            cmocka_unit_test(check_try_remove_error_on_out_is_null),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_out_is_null),
+            cmocka_unit_test(check_try_remove_error_on_queue_is_empty),
+            cmocka_unit_test(check_try_remove),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_concurrent_add_remove),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,923 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+#include <sea-turtle.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+/* coprime with 7919 so that multiplying by it permutes the keys */
+#define LIMIT                           1000
+
+static void key_of(struct sea_turtle_string *const key, const uintmax_t i) {
+    char chars[16];
+    const int size = snprintf(chars, sizeof(chars), "%04ju", i);
+    size_t out;
+    assert_true(sea_turtle_string_init(key, chars, size, &out));
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_invalidate(NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_persistent_tree_map_s_s object = {};
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_init(NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_null(object.root);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_snapshot_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_snapshot(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_snapshot_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_snapshot((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_add(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_add(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_add(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    assert_false(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[1], &key[1]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_set(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_set(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_set(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_false(seahorse_persistent_tree_map_s_s_set(
+            &object, &key[0], &key[0]));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    assert_true(seahorse_persistent_tree_map_s_s_set(
+            &object, &key[0], &key[1]));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_get(&object, &key[0], &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key[1]), 0);
+    uintmax_t count;
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_set_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_persistent_tree_map_s_s_set(
+            &object, &key[0], &key[1]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_get(&object, &key[0], &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key[0]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_false(seahorse_persistent_tree_map_s_s_remove(&object, &key[0]));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    assert_true(seahorse_persistent_tree_map_s_s_remove(&object, &key[1]));
+    uintmax_t count;
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 2);
+    bool out;
+    assert_true(seahorse_persistent_tree_map_s_s_contains(
+            &object, &key[1], &out));
+    assert_false(out);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_persistent_tree_map_s_s_remove(&object, &key[1]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 3);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_contains(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_contains(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_contains(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    bool out;
+    assert_true(seahorse_persistent_tree_map_s_s_contains(
+            &object, &key[0], &out));
+    assert_true(out);
+    assert_true(seahorse_persistent_tree_map_s_s_contains(
+            &object, &key[1], &out));
+    assert_false(out);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_get(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_get(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_get(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[1];
+    for (uintmax_t i = 0; i < 1; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_persistent_tree_map_s_s_get(&object, &key[0], &out));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 1; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[2];
+    for (uintmax_t i = 0; i < 2; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[1]));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_get(&object, &key[0], &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key[1]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 2; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_first(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_first((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_persistent_tree_map_s_s_first(&object, &out));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    for (uintmax_t i = 3; i; i--) {
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[i - 1], &key[i - 1]));
+    }
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_first(&object, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key[0]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_last(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_last((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_map_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_persistent_tree_map_s_s_last(&object, &out));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_MAP_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    for (uintmax_t i = 3; i; i--) {
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[i - 1], &key[i - 1]));
+    }
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_last(&object, &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key[2]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_higher(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_higher(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_higher(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_persistent_tree_map_s_s_higher(
+            &object, &key[2], &out));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[2], &key[2]));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_higher(
+            &object, &key[1], &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key[2]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_lower(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_lower(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_persistent_tree_map_s_s_lower(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_persistent_tree_map_s_s_lower(
+            &object, &key[0], &out));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[3];
+    for (uintmax_t i = 0; i < 3; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[0], &key[0]));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[2], &key[2]));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_lower(&object, &key[1], &out));
+    assert_int_equal(sea_turtle_string_compare(out, &key[0]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_snapshot(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[4];
+    for (uintmax_t i = 0; i < 4; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 3; i++) {
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    struct seahorse_persistent_tree_map_s_s snapshot;
+    assert_true(seahorse_persistent_tree_map_s_s_snapshot(&object, &snapshot));
+    assert_true(seahorse_persistent_tree_map_s_s_add(
+            &object, &key[3], &key[3]));
+    assert_true(seahorse_persistent_tree_map_s_s_set(
+            &object, &key[0], &key[3]));
+    assert_true(seahorse_persistent_tree_map_s_s_remove(&object, &key[1]));
+    uintmax_t count;
+    assert_true(seahorse_persistent_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 3);
+    assert_true(seahorse_persistent_tree_map_s_s_count(&snapshot, &count));
+    assert_int_equal(count, 3);
+    bool out;
+    assert_true(seahorse_persistent_tree_map_s_s_contains(
+            &snapshot, &key[1], &out));
+    assert_true(out);
+    assert_true(seahorse_persistent_tree_map_s_s_contains(
+            &snapshot, &key[3], &out));
+    assert_false(out);
+    const struct sea_turtle_string *value;
+    assert_true(seahorse_persistent_tree_map_s_s_get(
+            &snapshot, &key[0], &value));
+    assert_int_equal(sea_turtle_string_compare(value, &key[0]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_get(&object, &key[0], &value));
+    assert_int_equal(sea_turtle_string_compare(value, &key[3]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    assert_true(seahorse_persistent_tree_map_s_s_get(
+            &snapshot, &key[2], &value));
+    assert_int_equal(sea_turtle_string_compare(value, &key[2]), 0);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&snapshot));
+    for (uintmax_t i = 0; i < 4; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_snapshot_of_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    struct seahorse_persistent_tree_map_s_s snapshot;
+    assert_true(seahorse_persistent_tree_map_s_s_snapshot(&object, &snapshot));
+    assert_null(snapshot.root);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&snapshot));
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_snapshot_stress(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_string key[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        key_of(&key[i], i);
+    }
+    struct seahorse_persistent_tree_map_s_s object;
+    assert_true(seahorse_persistent_tree_map_s_s_init(&object));
+    struct seahorse_persistent_tree_map_s_s snapshot[LIMIT / 100];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        if (!(i % 100)) {
+            assert_true(seahorse_persistent_tree_map_s_s_snapshot(
+                    &object, &snapshot[i / 100]));
+        }
+        const uintmax_t k = (i * 7919) % LIMIT;
+        assert_true(seahorse_persistent_tree_map_s_s_add(
+                &object, &key[k], &key[k]));
+    }
+    for (uintmax_t i = 0; i < LIMIT; i += 2) {
+        const uintmax_t k = (i * 7919) % LIMIT;
+        assert_true(seahorse_persistent_tree_map_s_s_remove(&object, &key[k]));
+    }
+    for (uintmax_t i = 0; i < LIMIT / 100; i++) {
+        uintmax_t count;
+        assert_true(seahorse_persistent_tree_map_s_s_count(
+                &snapshot[i], &count));
+        assert_int_equal(count, i * 100);
+        for (uintmax_t j = 0; j < LIMIT; j++) {
+            const uintmax_t k = (j * 7919) % LIMIT;
+            bool out;
+            assert_true(seahorse_persistent_tree_map_s_s_contains(
+                    &snapshot[i], &key[k], &out));
+            assert_true(out == (j < i * 100));
+        }
+        assert_true(seahorse_persistent_tree_map_s_s_invalidate(&snapshot[i]));
+    }
+    uintmax_t count = 0;
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_persistent_tree_map_s_s_first(&object, &out));
+    do {
+        count++;
+    } while (seahorse_persistent_tree_map_s_s_higher(&object, out, &out));
+    assert_int_equal(SEAHORSE_PERSISTENT_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_int_equal(count, LIMIT / 2);
+    assert_true(seahorse_persistent_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_snapshot_error_on_object_is_null),
+            cmocka_unit_test(check_snapshot_error_on_out_is_null),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_key_is_null),
+            cmocka_unit_test(check_add_error_on_value_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_error_on_object_is_null),
+            cmocka_unit_test(check_set_error_on_key_is_null),
+            cmocka_unit_test(check_set_error_on_value_is_null),
+            cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set),
+            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_key_is_null),
+            cmocka_unit_test(check_remove_error_on_key_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_key_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_key_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_key_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_first_error_on_object_is_null),
+            cmocka_unit_test(check_first_error_on_out_is_null),
+            cmocka_unit_test(check_first_error_on_map_is_empty),
+            cmocka_unit_test(check_first),
+            cmocka_unit_test(check_last_error_on_object_is_null),
+            cmocka_unit_test(check_last_error_on_out_is_null),
+            cmocka_unit_test(check_last_error_on_map_is_empty),
+            cmocka_unit_test(check_last),
+            cmocka_unit_test(check_higher_error_on_object_is_null),
+            cmocka_unit_test(check_higher_error_on_key_is_null),
+            cmocka_unit_test(check_higher_error_on_out_is_null),
+            cmocka_unit_test(check_higher_error_on_key_not_found),
+            cmocka_unit_test(check_higher),
+            cmocka_unit_test(check_lower_error_on_object_is_null),
+            cmocka_unit_test(check_lower_error_on_key_is_null),
+            cmocka_unit_test(check_lower_error_on_out_is_null),
+            cmocka_unit_test(check_lower_error_on_key_not_found),
+            cmocka_unit_test(check_lower),
+            cmocka_unit_test(check_snapshot),
+            cmocka_unit_test(check_snapshot_of_empty),
+            cmocka_unit_test(check_snapshot_stress),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
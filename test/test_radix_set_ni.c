@@ -0,0 +1,738 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object = {};
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_init(NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_null(object.root);
+    assert_null(object.first);
+    assert_null(object.last);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_radix_set_ni_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_init_radix_set_ni(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_radix_set_ni_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_init_radix_set_ni((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OTHER_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_radix_set_ni(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, (i * 7919) % 1000));
+    }
+    struct seahorse_radix_set_ni copy;
+    assert_true(seahorse_radix_set_ni_init_radix_set_ni(&copy, &object));
+    assert_int_equal(copy.count, 1000);
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_first(&copy, &item));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_int_equal(*item, i);
+        if (i < 999) {
+            assert_true(seahorse_radix_set_ni_next(item, &item));
+        }
+    }
+    assert_true(seahorse_radix_set_ni_invalidate(&copy));
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void
+check_init_radix_set_ni_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 10; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    struct seahorse_radix_set_ni copy;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_radix_set_ni_init_radix_set_ni(&copy, &object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_radix_set_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 100; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    assert_true(seahorse_radix_set_ni_count(&object, &count));
+    assert_int_equal(count, 100);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_add(NULL, 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, (i * 7919) % 1000));
+    }
+    assert_int_equal(object.count, 1000);
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_first(&object, &item));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_int_equal(*item, i);
+        if (i < 999) {
+            assert_true(seahorse_radix_set_ni_next(item, &item));
+        }
+    }
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_value_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    assert_true(seahorse_radix_set_ni_add(&object, 10));
+    assert_false(seahorse_radix_set_ni_add(&object, 10));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_VALUE_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_radix_set_ni_add(&object, 10));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_remove(NULL, 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_value_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    assert_false(seahorse_radix_set_ni_remove(&object, 10));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_radix_set_ni_remove(&object, 10 * i));
+    }
+    assert_int_equal(object.count, 500);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        bool result;
+        assert_true(seahorse_radix_set_ni_contains(&object, 10 * i, &result));
+        assert_int_equal(result, i % 2);
+    }
+    for (uintmax_t i = 1; i < 1000; i += 2) {
+        assert_true(seahorse_radix_set_ni_remove(&object, 10 * i));
+    }
+    assert_int_equal(object.count, 0);
+    assert_null(object.root);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_contains(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_contains((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    bool result;
+    assert_true(seahorse_radix_set_ni_contains(&object, 10, &result));
+    assert_false(result);
+    assert_true(seahorse_radix_set_ni_add(&object, 10));
+    assert_true(seahorse_radix_set_ni_contains(&object, 10, &result));
+    assert_true(result);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_get(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_get((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_radix_set_ni_get(&object, 10, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_get(&object, 100, &item));
+    assert_int_equal(*item, 100);
+    assert_false(seahorse_radix_set_ni_get(&object, 105, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_ceiling(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_ceiling((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_radix_set_ni_ceiling(&object, 10, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_ceiling(&object, 100, &item));
+    assert_int_equal(*item, 100);
+    assert_true(seahorse_radix_set_ni_ceiling(&object, 105, &item));
+    assert_int_equal(*item, 110);
+    assert_true(seahorse_radix_set_ni_ceiling(&object, 0, &item));
+    assert_int_equal(*item, 0);
+    assert_false(seahorse_radix_set_ni_ceiling(&object, 9991, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_floor(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_floor((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_radix_set_ni_floor(&object, 10, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_floor(&object, 100, &item));
+    assert_int_equal(*item, 100);
+    assert_true(seahorse_radix_set_ni_floor(&object, 105, &item));
+    assert_int_equal(*item, 100);
+    assert_true(seahorse_radix_set_ni_floor(&object, 9990, &item));
+    assert_int_equal(*item, 9990);
+    assert_true(seahorse_radix_set_ni_floor(&object, 9999, &item));
+    assert_int_equal(*item, 9990);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_higher(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_higher((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_radix_set_ni_higher(&object, 10, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_higher(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_higher(&object, 100, &item));
+    assert_int_equal(*item, 110);
+    assert_true(seahorse_radix_set_ni_higher(&object, 105, &item));
+    assert_int_equal(*item, 110);
+    assert_false(seahorse_radix_set_ni_higher(&object, 9990, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_lower(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_lower((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_radix_set_ni_lower(&object, 10, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_lower(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_lower(&object, 100, &item));
+    assert_int_equal(*item, 90);
+    assert_true(seahorse_radix_set_ni_lower(&object, 105, &item));
+    assert_int_equal(*item, 100);
+    assert_false(seahorse_radix_set_ni_lower(&object, 0, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_first(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_first((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first_error_on_set_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_radix_set_ni_first(&object, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_SET_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_first(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_first(&object, &item));
+    assert_int_equal(*item, 0);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_last(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_last((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last_error_on_set_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_radix_set_ni_last(&object, &item));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_SET_IS_EMPTY, seahorse_error);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_last(&object, &item));
+    assert_int_equal(*item, 9990);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_item_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_remove_item(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_item_error_on_item_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_remove_item((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_item(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    while (seahorse_radix_set_ni_first(&object, &item)) {
+        assert_true(seahorse_radix_set_ni_remove_item(&object, item));
+    }
+    assert_int_equal(object.count, 0);
+    assert_null(object.root);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_error_on_item_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_next(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_next((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_next(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_first(&object, &item));
+    uintmax_t count = 1;
+    while (seahorse_radix_set_ni_next(item, &item)) {
+        count += 1;
+    }
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 1000);
+    assert_int_equal(*item, 9990);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_error_on_item_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_prev(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_ITEM_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_radix_set_ni_prev((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_OUT_IS_NULL, seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_prev(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_radix_set_ni object;
+    assert_true(seahorse_radix_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_radix_set_ni_add(&object, 10 * i));
+    }
+    const uintmax_t *item;
+    assert_true(seahorse_radix_set_ni_last(&object, &item));
+    uintmax_t count = 1;
+    while (seahorse_radix_set_ni_prev(item, &item)) {
+        count += 1;
+    }
+    assert_int_equal(SEAHORSE_RADIX_SET_NI_ERROR_END_OF_SEQUENCE,
+                     seahorse_error);
+    assert_int_equal(count, 1000);
+    assert_int_equal(*item, 0);
+    assert_true(seahorse_radix_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_radix_set_ni_error_on_object_is_null),
+            cmocka_unit_test(check_init_radix_set_ni_error_on_other_is_null),
+            cmocka_unit_test(check_init_radix_set_ni),
+            cmocka_unit_test(check_init_radix_set_ni_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_error_on_value_already_exists),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_value_not_found),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_contains_error_on_object_is_null),
+            cmocka_unit_test(check_contains_error_on_out_is_null),
+            cmocka_unit_test(check_contains),
+            cmocka_unit_test(check_get_error_on_object_is_null),
+            cmocka_unit_test(check_get_error_on_out_is_null),
+            cmocka_unit_test(check_get_error_on_item_not_found),
+            cmocka_unit_test(check_get),
+            cmocka_unit_test(check_ceiling_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_error_on_item_not_found),
+            cmocka_unit_test(check_ceiling),
+            cmocka_unit_test(check_floor_error_on_object_is_null),
+            cmocka_unit_test(check_floor_error_on_out_is_null),
+            cmocka_unit_test(check_floor_error_on_item_not_found),
+            cmocka_unit_test(check_floor),
+            cmocka_unit_test(check_higher_error_on_object_is_null),
+            cmocka_unit_test(check_higher_error_on_out_is_null),
+            cmocka_unit_test(check_higher_error_on_item_not_found),
+            cmocka_unit_test(check_higher),
+            cmocka_unit_test(check_lower_error_on_object_is_null),
+            cmocka_unit_test(check_lower_error_on_out_is_null),
+            cmocka_unit_test(check_lower_error_on_item_not_found),
+            cmocka_unit_test(check_lower),
+            cmocka_unit_test(check_first_error_on_object_is_null),
+            cmocka_unit_test(check_first_error_on_out_is_null),
+            cmocka_unit_test(check_first_error_on_set_is_empty),
+            cmocka_unit_test(check_first),
+            cmocka_unit_test(check_last_error_on_object_is_null),
+            cmocka_unit_test(check_last_error_on_out_is_null),
+            cmocka_unit_test(check_last_error_on_set_is_empty),
+            cmocka_unit_test(check_last),
+            cmocka_unit_test(check_remove_item_error_on_object_is_null),
+            cmocka_unit_test(check_remove_item_error_on_item_is_null),
+            cmocka_unit_test(check_remove_item),
+            cmocka_unit_test(check_next_error_on_item_is_null),
+            cmocka_unit_test(check_next_error_on_out_is_null),
+            cmocka_unit_test(check_next),
+            cmocka_unit_test(check_prev_error_on_item_is_null),
+            cmocka_unit_test(check_prev_error_on_out_is_null),
+            cmocka_unit_test(check_prev),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,255 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include "private/red_black_tree.h"
+#include <test/cmocka.h>
+
+static int compare(const void *const a, const void *const b) {
+    const uintmax_t A = *(const uintmax_t *) a;
+    const uintmax_t B = *(const uintmax_t *) b;
+    return A < B ? -1 : A > B;
+}
+
+static bool fill(void *const data, void *const context) {
+    uintmax_t *const next = context;
+    *(uintmax_t *) data = *next;
+    *next += 2;
+    return true;
+}
+
+/*
+ * Confirm that the tree keeps its red black invariants, then walk it in order
+ * and confirm that it holds count values, that each value is ascending and
+ * that each node knows its own index and is the one found at that index.
+ */
+static void check_order(const struct seahorse_red_black_tree *const object,
+                        const uintmax_t count) {
+    assert_int_equal(object->count, count);
+    assert_true(seahorse_red_black_tree_is_valid(object));
+    uintmax_t i = 0;
+    const uintmax_t *prev = NULL;
+    const uintmax_t *item = seahorse_red_black_tree_first(object);
+    for (; item; item = seahorse_red_black_tree_next(item), i++) {
+        assert_int_equal(seahorse_red_black_tree_index(item), i);
+        assert_ptr_equal(seahorse_red_black_tree_at(object, i), item);
+        if (prev) {
+            assert_true(*prev < *item);
+        }
+        prev = item;
+    }
+    assert_int_equal(i, count);
+    assert_ptr_equal(prev, seahorse_red_black_tree_last(object));
+}
+
+static void check_pool_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_pool_init(NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pool_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool object;
+    assert_true(seahorse_red_black_tree_pool_init(&object));
+    assert_null(object.slabs);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_red_black_tree_pool_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pool_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_pool_invalidate(NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pool_invalidate_error_on_pool_is_in_use(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree object;
+    seahorse_red_black_tree_init(&object, sizeof(uintmax_t), compare, &pool);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    seahorse_red_black_tree_invalidate(&object, NULL);
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pool_reuses_released_nodes(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree object;
+    seahorse_red_black_tree_init(&object, sizeof(uintmax_t), compare, &pool);
+    void *first;
+    assert_true(seahorse_red_black_tree_alloc(&object, &first));
+    seahorse_red_black_tree_free(&object, first);
+    void *second;
+    assert_true(seahorse_red_black_tree_alloc(&object, &second));
+    assert_ptr_equal(first, second);
+    seahorse_red_black_tree_free(&object, second);
+    seahorse_red_black_tree_invalidate(&object, NULL);
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_link(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree object;
+    seahorse_red_black_tree_init(&object, sizeof(uintmax_t), compare, NULL);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const uintmax_t key = (i * 7919) % 1000;
+        struct seahorse_red_black_tree_position position;
+        assert_null(seahorse_red_black_tree_locate(&object, &key, &position));
+        uintmax_t *data;
+        assert_true(seahorse_red_black_tree_alloc(&object, (void **) &data));
+        *data = key;
+        seahorse_red_black_tree_link(&object, &position, data);
+    }
+    check_order(&object, 1000);
+    for (uintmax_t i = 0; i < 1000; i += 3) {
+        uintmax_t *const data = seahorse_red_black_tree_get(
+                &object, &i, compare);
+        assert_non_null(data);
+        seahorse_red_black_tree_remove(&object, data);
+    }
+    check_order(&object, 666);
+    seahorse_red_black_tree_invalidate(&object, NULL);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_build(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    for (uintmax_t count = 0; count < 130; count++) {
+        struct seahorse_red_black_tree object;
+        seahorse_red_black_tree_init(&object, sizeof(uintmax_t), compare,
+                                     NULL);
+        uintmax_t next = 0;
+        assert_true(seahorse_red_black_tree_build(
+                &object, count, fill, NULL, &next));
+        check_order(&object, count);
+        const uintmax_t key = 2 * count;
+        struct seahorse_red_black_tree_position position;
+        assert_null(seahorse_red_black_tree_locate(&object, &key, &position));
+        uintmax_t *data;
+        assert_true(seahorse_red_black_tree_alloc(&object, (void **) &data));
+        *data = key;
+        seahorse_red_black_tree_link(&object, &position, data);
+        check_order(&object, 1 + count);
+        seahorse_red_black_tree_invalidate(&object, NULL);
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_and_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    for (uintmax_t at = 0; at < 100; at++) {
+        struct seahorse_red_black_tree object;
+        seahorse_red_black_tree_init(&object, sizeof(uintmax_t), compare,
+                                     &pool);
+        uintmax_t next = 0;
+        assert_true(seahorse_red_black_tree_build(
+                &object, 100, fill, NULL, &next));
+        const uintmax_t key = 2 * at;
+        const uintmax_t *const item = seahorse_red_black_tree_get(
+                &object, &key, compare);
+        struct seahorse_red_black_tree out;
+        seahorse_red_black_tree_init(&out, sizeof(uintmax_t), compare,
+                                     &pool);
+        seahorse_red_black_tree_split(&object, item, &out);
+        check_order(&object, at);
+        check_order(&out, 100 - at);
+        assert_ptr_equal(seahorse_red_black_tree_first(&out), item);
+        assert_true(seahorse_red_black_tree_precedes(&object, &out));
+        assert_true(!at || !seahorse_red_black_tree_precedes(&out, &object));
+        assert_true(seahorse_red_black_tree_join(&object, &out));
+        check_order(&object, 100);
+        check_order(&out, 0);
+        assert_ptr_equal(seahorse_red_black_tree_get(&object, &key, compare),
+                         item);
+        seahorse_red_black_tree_invalidate(&out, NULL);
+        seahorse_red_black_tree_invalidate(&object, NULL);
+    }
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    for (uintmax_t low = 0; low < 40; low++) {
+        for (uintmax_t high = low; high < 40; high++) {
+            struct seahorse_red_black_tree object;
+            seahorse_red_black_tree_init(&object, sizeof(uintmax_t), compare,
+                                         NULL);
+            uintmax_t next = 0;
+            assert_true(seahorse_red_black_tree_build(
+                    &object, 40, fill, NULL, &next));
+            const uintmax_t first = 2 * low;
+            const uintmax_t last = 2 * high;
+            seahorse_red_black_tree_remove_range(
+                    &object,
+                    seahorse_red_black_tree_get(&object, &first, compare),
+                    seahorse_red_black_tree_get(&object, &last, compare),
+                    NULL);
+            check_order(&object, 40 - (1 + high - low));
+            for (uintmax_t i = 0; i < 40; i++) {
+                const uintmax_t key = 2 * i;
+                const bool removed = low <= i && i <= high;
+                assert_true(removed == !seahorse_red_black_tree_get(
+                        &object, &key, compare));
+            }
+            seahorse_red_black_tree_invalidate(&object, NULL);
+        }
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_across_pools(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree object;
+    seahorse_red_black_tree_init(&object, sizeof(uintmax_t), compare, NULL);
+    uintmax_t next = 0;
+    assert_true(seahorse_red_black_tree_build(
+            &object, 10, fill, NULL, &next));
+    struct seahorse_red_black_tree other;
+    seahorse_red_black_tree_init(&other, sizeof(uintmax_t), compare, &pool);
+    assert_true(seahorse_red_black_tree_build(
+            &other, 20, fill, NULL, &next));
+    assert_true(seahorse_red_black_tree_join(&object, &other));
+    check_order(&object, 30);
+    check_order(&other, 0);
+    seahorse_red_black_tree_invalidate(&other, NULL);
+    seahorse_red_black_tree_invalidate(&object, NULL);
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_pool_init_error_on_object_is_null),
+            cmocka_unit_test(check_pool_init),
+            cmocka_unit_test(check_pool_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_pool_invalidate_error_on_pool_is_in_use),
+            cmocka_unit_test(check_pool_reuses_released_nodes),
+            cmocka_unit_test(check_link),
+            cmocka_unit_test(check_build),
+            cmocka_unit_test(check_split_and_join),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_join_across_pools),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -36,10 +36,66 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
     assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    struct sea_turtle_integer key[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_integer_init_uintmax_t(&key[i], i));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_i_i_remove(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_i_i_count(NULL, (void *) 1));
@@ -61,7 +117,7 @@ static void check_count(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object = {};
     const uintmax_t check = (rand() % UINTMAX_MAX);
-    object.map.tree.count = check;
+    object.tree.count = check;
     uintmax_t count;
     assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
     assert_int_equal(count, check);
@@ -150,9 +206,205 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_integer value;
     assert_true(sea_turtle_integer_init_uintmax_t(
             &value, rand() % UINTMAX_MAX));
-    posix_memalign_is_overridden = true;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
     assert_false(seahorse_red_black_tree_map_i_i_add(&object, &key, &value));
-    posix_memalign_is_overridden = false;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_add_take(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_add_take(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_add_take(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 0);
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &key, rand() % UINTMAX_MAX));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
+    assert_true(seahorse_red_black_tree_map_i_i_add_take(
+            &object, &key, &value));
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &key, rand() % UINTMAX_MAX));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
+    assert_true(seahorse_red_black_tree_map_i_i_add(&object, &key, &value));
+    assert_false(seahorse_red_black_tree_map_i_i_add_take(
+            &object, &key, &value));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &key, rand() % UINTMAX_MAX));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_i_i_add_take(
+            &object, &key, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_try_add(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_try_add(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &key, rand() % UINTMAX_MAX));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
+    const struct seahorse_red_black_tree_map_i_i_entry *entry;
+    assert_true(seahorse_red_black_tree_map_i_i_try_add(
+            &object, &key, &value, &entry));
+    const struct seahorse_red_black_tree_map_i_i_entry *other;
+    assert_true(seahorse_red_black_tree_map_i_i_get_entry(
+            &object, &key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &key, rand() % UINTMAX_MAX));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
+    const struct seahorse_red_black_tree_map_i_i_entry *entry;
+    assert_true(seahorse_red_black_tree_map_i_i_try_add(
+            &object, &key, &value, &entry));
+    const struct seahorse_red_black_tree_map_i_i_entry *other;
+    assert_false(seahorse_red_black_tree_map_i_i_try_add(
+            &object, &key, &value, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(sea_turtle_integer_invalidate(&key));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &key, rand() % UINTMAX_MAX));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_i_i_entry *entry;
+    assert_false(seahorse_red_black_tree_map_i_i_try_add(
+            &object, &key, &value, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
     assert_int_equal(
             SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
             seahorse_error);
@@ -220,7 +472,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -239,12 +491,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_int_equal(count, 1);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_remove(&object, &key));
+    assert_true(seahorse_red_black_tree_map_i_i_remove(&object, &key));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -303,7 +552,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -321,13 +570,10 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_map_i_i_add(&object, &key, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_contains(
+    assert_true(seahorse_red_black_tree_map_i_i_contains(
             &object, &key, &result));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -400,7 +646,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -415,12 +661,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_integer *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_get(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_i_i_get(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -502,7 +745,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -516,12 +759,9 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_integer *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_ceiling(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_i_i_ceiling(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -603,7 +843,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -617,12 +857,9 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_integer *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_floor(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_i_i_floor(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -706,7 +943,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -723,12 +960,9 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_integer *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_higher(&object, &query, &out));
+    assert_true(seahorse_red_black_tree_map_i_i_higher(&object, &query, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&query));
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
@@ -747,7 +981,8 @@ static void check_lower_error_on_object_is_null(void **state) {
 
 static void check_lower_error_on_key_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
-    assert_false(seahorse_red_black_tree_map_i_i_lower((void *)1, NULL, (void *)1));
+    assert_false(seahorse_red_black_tree_map_i_i_lower(
+            (void *)1, NULL, (void *)1));
     assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
                      seahorse_error);
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -795,7 +1030,8 @@ static void check_lower(void **state) {
     struct sea_turtle_integer key;
     assert_true(sea_turtle_integer_init_uintmax_t(&key, 10));
     struct sea_turtle_integer value;
-    assert_true(sea_turtle_integer_init_uintmax_t(&value, rand() % UINTMAX_MAX));
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
     assert_true(seahorse_red_black_tree_map_i_i_add(&object, &key, &value));
     struct sea_turtle_integer query;
     assert_true(sea_turtle_integer_init_uintmax_t(&query, 100));
@@ -810,7 +1046,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -818,19 +1054,17 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_integer key;
     assert_true(sea_turtle_integer_init_uintmax_t(&key, 10));
     struct sea_turtle_integer value;
-    assert_true(sea_turtle_integer_init_uintmax_t(&value, rand() % UINTMAX_MAX));
+    assert_true(sea_turtle_integer_init_uintmax_t(
+            &value, rand() % UINTMAX_MAX));
     assert_true(seahorse_red_black_tree_map_i_i_add(&object, &key, &value));
     struct sea_turtle_integer query;
     assert_true(sea_turtle_integer_init_uintmax_t(&query, 100));
     struct sea_turtle_integer *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_lower(&object, &query, &out));
+    assert_true(seahorse_red_black_tree_map_i_i_lower(&object, &query, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&query));
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
@@ -1025,7 +1259,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -1040,13 +1274,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_i_i_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_get_entry(
+    assert_true(seahorse_red_black_tree_map_i_i_get_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -1146,8 +1377,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -1162,13 +1392,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_i_i_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_i_i_ceiling_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -1268,7 +1495,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -1283,13 +1510,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_i_i_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_floor_entry(
+    assert_true(seahorse_red_black_tree_map_i_i_floor_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
@@ -1368,7 +1592,8 @@ static void check_higher_entry(void **state) {
     assert_true(seahorse_red_black_tree_map_i_i_higher_entry(
             &object, &query, &entry));
     const struct sea_turtle_integer *out;
-    assert_true(seahorse_red_black_tree_map_i_i_entry_key(&object, entry, &out));
+    assert_true(seahorse_red_black_tree_map_i_i_entry_key(
+            &object, entry, &out));
     assert_ptr_not_equal(out, &key);
     assert_int_equal(sea_turtle_integer_compare(&key, out), 0);
     assert_true(seahorse_red_black_tree_map_i_i_entry_value(
@@ -1382,8 +1607,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -1400,13 +1624,10 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_i_i_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_higher_entry(
+    assert_true(seahorse_red_black_tree_map_i_i_higher_entry(
             &object, &query, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&query));
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
@@ -1486,8 +1707,9 @@ static void check_lower_entry(void **state) {
     assert_true(seahorse_red_black_tree_map_i_i_lower_entry(
             &object, &query, &entry));
     const struct sea_turtle_integer *out;
-    assert_true(seahorse_red_black_tree_map_i_i_entry_key(&object, entry, &out));
-    assert_ptr_not_equal(out, &key);
+    assert_true(seahorse_red_black_tree_map_i_i_entry_key(
+            &object, entry, &out));
+    assert_ptr_not_equal(out, &key);
     assert_int_equal(sea_turtle_integer_compare(&key, out), 0);
     assert_true(seahorse_red_black_tree_map_i_i_entry_value(
             &object, entry, (struct sea_turtle_integer **) &out));
@@ -1500,7 +1722,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_i_i object;
@@ -1517,13 +1739,10 @@ static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_i_i_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_i_i_lower_entry(
+    assert_true(seahorse_red_black_tree_map_i_i_lower_entry(
             &object, &query, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&query));
     assert_true(sea_turtle_integer_invalidate(&key));
     assert_true(sea_turtle_integer_invalidate(&value));
@@ -2065,12 +2284,599 @@ check_init_red_black_tree_map_i_i_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_remove_range(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_i_i_remove_range(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_remove_range(
+            &object, &key[2], &key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_i_i_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_remove_range(
+            &object, &key[7], &key[0]));
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_i_i_remove_range(
+            &object, &key[2], &key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_count_range(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_i_i_count_range(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_i_i_count_range(
+            &object, &key[2], &key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_i_i_count_range(
+            &object, &key[0], &key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_i_i_count_range(
+            &object, &key[4], &key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_i_i_count_range(
+            &object, &key[5], &key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_i_i_count_range(
+            &object, &key[2], &key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_at_rank(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_at_rank((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank_error_on_rank_is_out_of_bounds(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    const struct seahorse_red_black_tree_map_i_i_entry *entry;
+    assert_false(seahorse_red_black_tree_map_i_i_at_rank(&object, 0, &entry));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_RANK_IS_OUT_OF_BOUNDS,
+            seahorse_error);
+    struct sea_turtle_integer key;
+    assert_true(sea_turtle_integer_init_intmax_t(&key, 8));
+    assert_true(seahorse_red_black_tree_map_i_i_add(&object, &key, &key));
+    assert_false(seahorse_red_black_tree_map_i_i_at_rank(&object, 1, &entry));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_RANK_IS_OUT_OF_BOUNDS,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    assert_true(sea_turtle_integer_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const uintmax_t j = (5 * i) % 8;
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[j], &key[j]));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_i_i_entry *entry;
+        assert_true(seahorse_red_black_tree_map_i_i_at_rank(
+                &object, i, &entry));
+        const struct sea_turtle_integer *out;
+        assert_true(seahorse_red_black_tree_map_i_i_entry_key(
+                &object, entry, &out));
+        assert_int_equal(sea_turtle_integer_compare(&key[i], out), 0);
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rank_of_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_rank_of(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rank_of_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_rank_of(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rank_of_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_rank_of(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rank_of(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    struct sea_turtle_integer gap[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &gap[i], (intmax_t) (10 * (i + 1) + 5)));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_i_i_rank_of(
+            &object, &key[0], &out));
+    assert_int_equal(out, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_rank_of(
+                &object, &key[i], &out));
+        assert_int_equal(out, i);
+        assert_true(seahorse_red_black_tree_map_i_i_rank_of(
+                &object, &gap[i], &out));
+        assert_int_equal(out, i + 1);
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+        assert_true(sea_turtle_integer_invalidate(&gap[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_split_at(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    struct seahorse_red_black_tree_map_i_i other;
+    assert_true(seahorse_red_black_tree_map_i_i_split_at(
+            &object, &key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_i_i_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_i_i_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_i_i_contains(
+                &other, &key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_remove(&object, &key[7]));
+    struct seahorse_red_black_tree_map_i_i other;
+    assert_true(seahorse_red_black_tree_map_i_i_split_at(
+            &object, &key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_i_i_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    const struct seahorse_red_black_tree_map_i_i_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_get_entry(
+                &object, &key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_i_i other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_i_i_split_at(
+            &object, &key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_i_i_entry *out;
+        assert_true(seahorse_red_black_tree_map_i_i_get_entry(
+                i < 4 ? &object : &other, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_i_i_entry *out;
+        assert_true(seahorse_red_black_tree_map_i_i_get_entry(
+                &object, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_i_i_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    struct seahorse_red_black_tree_map_i_i other;
+    assert_true(seahorse_red_black_tree_map_i_i_split_at(
+            &object, &key[4], &other));
+    assert_true(seahorse_red_black_tree_map_i_i_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_i_i_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_i_i_contains(
+                &object, &key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_i_i_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    struct seahorse_red_black_tree_map_i_i other;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_i_i_add(
+                    &other, &key[i], &key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_map_i_i_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_i_i_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_map_i_i object;
+    assert_true(seahorse_red_black_tree_map_i_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_i_i_add(
+                &object, &key[i], &key[i]));
+    }
+    struct seahorse_red_black_tree_map_i_i other;
+    assert_true(seahorse_red_black_tree_map_i_i_split_at(
+            &object, &key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_i_i target;
+    assert_true(seahorse_red_black_tree_map_i_i_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_i_i_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_I_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_i_i_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_i_i_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&target));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_i_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
@@ -2080,46 +2886,57 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_key_already_exists),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_key_is_null),
+            cmocka_unit_test(check_add_take_error_on_value_is_null),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_key_already_exists),
+            cmocka_unit_test(check_add_take_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_key_is_null),
             cmocka_unit_test(check_remove_error_on_key_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_key_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_key_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_key_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_key_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_key_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -2133,31 +2950,31 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_error_on_out_is_null),
             cmocka_unit_test(check_get_entry_error_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -2189,6 +3006,34 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_i_i_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_i_i),
             cmocka_unit_test(check_init_red_black_tree_map_i_i_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range_error_on_key_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_key_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_at_rank_error_on_object_is_null),
+            cmocka_unit_test(check_at_rank_error_on_out_is_null),
+            cmocka_unit_test(check_at_rank_error_on_rank_is_out_of_bounds),
+            cmocka_unit_test(check_at_rank),
+            cmocka_unit_test(check_rank_of_error_on_object_is_null),
+            cmocka_unit_test(check_rank_of_error_on_key_is_null),
+            cmocka_unit_test(check_rank_of_error_on_out_is_null),
+            cmocka_unit_test(check_rank_of),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_key_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
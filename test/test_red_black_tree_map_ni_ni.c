@@ -34,12 +34,86 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
     assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
-    assert_int_equal(object.map.key, sizeof(uintmax_t));
-    assert_int_equal(object.map.value, sizeof(uintmax_t));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(&object, i, i));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_remove(&object, i));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(&object, i, i));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_get(&object, i, &out));
+        assert_int_equal(*out, i);
+    }
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_shared(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init_pool(&object, &pool));
+    for (uintmax_t i = 0; i < 100; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(&object, i, i));
+    }
+    struct seahorse_red_black_tree_map_ni_ni copy;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init_red_black_tree_map_ni_ni(
+            &copy, &object));
+    assert_ptr_equal(copy.tree.pool, &pool);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&copy, &count));
+    assert_int_equal(count, 100);
+    for (uintmax_t i = 0; i < 100; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_get(&copy, i, &out));
+        assert_int_equal(*out, i);
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&copy));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_ni_ni_count(NULL, (void *) 1));
@@ -62,7 +136,7 @@ static void check_count(void **state) {
     struct seahorse_red_black_tree_map_ni_ni object;
     assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
     const uintmax_t check = (rand() % UINTMAX_MAX);
-    object.map.tree.count = check;
+    object.tree.count = check;
     uintmax_t out;
     assert_true(seahorse_red_black_tree_map_ni_ni_count(
             &object, (uintmax_t *) &out));
@@ -86,12 +160,92 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
     const uintmax_t key = (rand() % UINTMAX_MAX);
     const uintmax_t value = (rand() % UINTMAX_MAX);
-    posix_memalign_is_overridden = true;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
     assert_false(seahorse_red_black_tree_map_ni_ni_add(&object, key, value));
     assert_int_equal(
             SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
             seahorse_error);
-    posix_memalign_is_overridden = false;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_try_add(
+            NULL, 0, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_try_add(
+            (void *) 1, 0, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    const uintmax_t key = (rand() % UINTMAX_MAX);
+    uintmax_t value = (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
+    assert_true(seahorse_red_black_tree_map_ni_ni_try_add(
+            &object, key, value, &entry));
+    const struct seahorse_red_black_tree_map_ni_ni_entry *other;
+    assert_true(seahorse_red_black_tree_map_ni_ni_get_entry(
+            &object, key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    const uintmax_t key = (rand() % UINTMAX_MAX);
+    uintmax_t value = (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
+    assert_true(seahorse_red_black_tree_map_ni_ni_try_add(
+            &object, key, value, &entry));
+    value += (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_ni_ni_entry *other;
+    assert_false(seahorse_red_black_tree_map_ni_ni_try_add(
+            &object, key, value, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    const uintmax_t key = (rand() % UINTMAX_MAX);
+    const uintmax_t value = (rand() % UINTMAX_MAX);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
+    assert_false(seahorse_red_black_tree_map_ni_ni_try_add(
+            &object, key, value, &entry));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -163,7 +317,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -176,12 +330,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_int_equal(count, 1);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_remove(&object, key));
+    assert_true(seahorse_red_black_tree_map_ni_ni_remove(&object, key));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -221,7 +372,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -230,13 +381,10 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_contains(&object, key,
+    assert_true(seahorse_red_black_tree_map_ni_ni_contains(&object, key,
                                                             &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -272,21 +420,17 @@ static void check_set(void **state) {
     uintmax_t value = (rand() % UINTMAX_MAX);
     assert_true(seahorse_red_black_tree_map_ni_ni_add(&object, key, value));
     const uintmax_t *out;
-    assert_true(coral_red_black_tree_map_get(&object.map,
-                                             &key,
-                                             (const void **) &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_get(&object, key, &out));
     assert_int_equal(*out, value);
     value += (rand() % UINTMAX_MAX);
     assert_true(seahorse_red_black_tree_map_ni_ni_set(&object, key, value));
-    assert_true(coral_red_black_tree_map_get(&object.map,
-                                             &key,
-                                             (const void **) &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_get(&object, key, &out));
     assert_int_equal(*out, value);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_set_error_on_memory_allocation_failed(void **state) {
+static void check_set_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -295,19 +439,14 @@ static void check_set_error_on_memory_allocation_failed(void **state) {
     uintmax_t value = (rand() % UINTMAX_MAX);
     assert_true(seahorse_red_black_tree_map_ni_ni_add(&object, key, value));
     const uintmax_t *out;
-    assert_true(coral_red_black_tree_map_get(&object.map,
-                                             &key,
-                                             (const void **) &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_get(&object, key, &out));
     assert_int_equal(*out, value);
     value += (rand() % UINTMAX_MAX);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_set(&object, key, value));
+    assert_true(seahorse_red_black_tree_map_ni_ni_set(&object, key, value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -358,7 +497,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -369,12 +508,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_get(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_get(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -439,7 +575,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -450,12 +586,9 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_ceiling(&object, 10, &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_ceiling(&object, 10, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -518,7 +651,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failure(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -529,12 +662,9 @@ static void check_floor_error_on_memory_allocation_failure(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_floor(&object, 100, &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_floor(&object, 100, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -592,7 +722,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -603,12 +733,9 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_higher(&object, 10, &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_higher(&object, 10, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -666,7 +793,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -677,12 +804,9 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_lower(&object, 100, &out));
+    assert_true(seahorse_red_black_tree_map_ni_ni_lower(&object, 100, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -832,7 +956,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -843,13 +967,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_get_entry(
+    assert_true(seahorse_red_black_tree_map_ni_ni_get_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -928,8 +1049,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -941,13 +1061,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_ni_ni_ceiling_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1026,7 +1143,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -1037,13 +1154,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_floor_entry(
+    assert_true(seahorse_red_black_tree_map_ni_ni_floor_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1111,8 +1225,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -1123,13 +1236,10 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_higher_entry(
+    assert_true(seahorse_red_black_tree_map_ni_ni_higher_entry(
             &object, 10, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1197,7 +1307,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_ni object;
@@ -1208,13 +1318,10 @@ static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_ni_floor_entry(
+    assert_true(seahorse_red_black_tree_map_ni_ni_floor_entry(
             &object, 100, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1726,56 +1833,546 @@ check_init_red_black_tree_map_ni_ni_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_sorted_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            NULL, 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            (void *) 1, 0, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_keys_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            (void *) 1, 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEYS_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            (void *) 1, 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_keys_are_not_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 3, 2};
+    const uintmax_t values[] = {10, 20, 30};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            &object, 3, keys, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEYS_ARE_NOT_SORTED,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_duplicate_keys(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 2, 2};
+    const uintmax_t values[] = {10, 20, 30};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            &object, 3, keys, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEYS_ARE_NOT_SORTED,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 2, 3};
+    const uintmax_t values[] = {10, 20, 30};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            &object, 3, keys, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 2, 3};
+    const uintmax_t values[] = {10, 20, 30};
+    const uintmax_t limit = sizeof(keys) / sizeof(uintmax_t);
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            &object, limit, keys, values));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_get(
+                &object, keys[i], &out));
+        assert_int_equal(*out, values[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_many(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    uintmax_t keys[1000];
+    uintmax_t values[1000];
+    const uintmax_t limit = sizeof(keys) / sizeof(uintmax_t);
+    for (uintmax_t i = 0; i < limit; i++) {
+        keys[i] = 3 * i;
+        values[i] = i;
+    }
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init_sorted(
+            &object, limit, keys, values));
+    const struct seahorse_red_black_tree_map_ni_ni_entry *entry;
+    assert_true(seahorse_red_black_tree_map_ni_ni_first_entry(
+            &object, &entry));
+    uintmax_t i = 0;
+    do {
+        const uintmax_t *key;
+        assert_true(seahorse_red_black_tree_map_ni_ni_entry_key(
+                &object, entry, &key));
+        assert_int_equal(*key, keys[i++]);
+    } while (seahorse_red_black_tree_map_ni_ni_next_entry(entry, &entry));
+    assert_int_equal(i, limit);
+    for (i = 0; i < limit; i++) {
+        const uintmax_t key = keys[i] + 1;
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key, values[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 2 * limit);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_remove_range(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_remove_range(
+            &object, key[2], key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_remove_range(
+            &object, key[7], key[0]));
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_ni_ni_remove_range(
+            &object, key[2], key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_count_range(
+            NULL, 0, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_count_range(
+            (void *) 1, 0, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count_range(
+            &object, key[2], key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count_range(
+            &object, key[0], key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count_range(
+            &object, key[4], key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count_range(
+            &object, key[5], key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count_range(
+            &object, key[2], key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_split_at(
+            NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_split_at(
+            (void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_ni_ni other;
+    assert_true(seahorse_red_black_tree_map_ni_ni_split_at(
+            &object, key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_contains(
+                &other, key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_remove(&object, key[7]));
+    struct seahorse_red_black_tree_map_ni_ni other;
+    assert_true(seahorse_red_black_tree_map_ni_ni_split_at(
+            &object, key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    const struct seahorse_red_black_tree_map_ni_ni_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_get_entry(
+                &object, key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_ni_ni other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_ni_ni_split_at(
+            &object, key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_ni_ni_entry *out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_get_entry(
+                i < 4 ? &object : &other, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_ni_ni_entry *out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_get_entry(
+                &object, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_ni_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_ni_ni other;
+    assert_true(seahorse_red_black_tree_map_ni_ni_split_at(
+            &object, key[4], &other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_ni_contains(
+                &object, key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_ni_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    struct seahorse_red_black_tree_map_ni_ni other;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                    &other, key[i], key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_map_ni_ni_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_ni object;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_ni_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_ni_ni other;
+    assert_true(seahorse_red_black_tree_map_ni_ni_split_at(
+            &object, key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_ni_ni target;
+    assert_true(seahorse_red_black_tree_map_ni_ni_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_ni_ni_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_NI_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_ni_ni_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&target));
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_ni_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
+            cmocka_unit_test(check_init_pool_shared),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
             cmocka_unit_test(check_add_error_on_object_is_null),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_key_already_exists),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_key_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_set_error_on_object_is_null),
             cmocka_unit_test(check_set_error_on_key_on_found),
             cmocka_unit_test(check_set),
-            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failure),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -1788,27 +2385,27 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_error_on_out_is_null),
             cmocka_unit_test(check_get_entry_error_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -1843,6 +2440,32 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_ni_ni_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_ni_ni),
             cmocka_unit_test(check_init_red_black_tree_map_ni_ni_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted_error_on_object_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_count_is_zero),
+            cmocka_unit_test(check_init_sorted_error_on_keys_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_values_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_keys_are_not_sorted),
+            cmocka_unit_test(check_init_sorted_error_on_duplicate_keys),
+            cmocka_unit_test(check_init_sorted_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted),
+            cmocka_unit_test(check_init_sorted_many),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -40,6 +40,51 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(&object, i, NULL));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_ni_p_remove(&object, i));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(&object, i, NULL));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_ni_p_count(NULL, (void *) 1));
@@ -62,7 +107,7 @@ static void check_count(void **state) {
     struct seahorse_red_black_tree_map_ni_p object;
     assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
     const uintmax_t check = (rand() % UINTMAX_MAX);
-    object.map.tree.count = check;
+    object.tree.count = check;
     uintmax_t out;
     assert_true(seahorse_red_black_tree_map_ni_p_count(
             &object, (uintmax_t *) &out));
@@ -98,6 +143,84 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_try_add(
+            NULL, 0, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_try_add(
+            (void *) 1, 0, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    const uintmax_t key = (rand() % UINTMAX_MAX);
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_ni_p_entry *entry;
+    assert_true(seahorse_red_black_tree_map_ni_p_try_add(
+            &object, key, value, &entry));
+    const struct seahorse_red_black_tree_map_ni_p_entry *other;
+    assert_true(seahorse_red_black_tree_map_ni_p_get_entry(
+            &object, key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    const uintmax_t key = (rand() % UINTMAX_MAX);
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_ni_p_entry *entry;
+    assert_true(seahorse_red_black_tree_map_ni_p_try_add(
+            &object, key, value, &entry));
+    value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_ni_p_entry *other;
+    assert_false(seahorse_red_black_tree_map_ni_p_try_add(
+            &object, key, value, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    const uintmax_t key = (rand() % UINTMAX_MAX);
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_ni_p_entry *entry;
+    assert_false(seahorse_red_black_tree_map_ni_p_try_add(
+            &object, key, value, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_add(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -165,7 +288,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -178,12 +301,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_int_equal(count, 1);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_remove(&object, key));
+    assert_true(seahorse_red_black_tree_map_ni_p_remove(&object, key));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -223,7 +343,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -232,12 +352,9 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_contains(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_ni_p_contains(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -283,7 +400,7 @@ static void check_set(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_set_error_on_memory_allocation_failed(void **state) {
+static void check_set_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -297,12 +414,9 @@ static void check_set_error_on_memory_allocation_failed(void **state) {
     value = (void *) (uintptr_t) (rand() % UINTMAX_MAX);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_set(&object, key, value));
+    assert_true(seahorse_red_black_tree_map_ni_p_set(&object, key, value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -352,7 +466,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -363,12 +477,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_get(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_ni_p_get(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -429,7 +540,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -440,12 +551,9 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_ceiling(&object, 10, &out));
+    assert_true(seahorse_red_black_tree_map_ni_p_ceiling(&object, 10, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -506,7 +614,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -517,12 +625,9 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_floor(&object, 100, &out));
+    assert_true(seahorse_red_black_tree_map_ni_p_floor(&object, 100, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -579,7 +684,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -590,12 +695,9 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_higher(&object, 10, &out));
+    assert_true(seahorse_red_black_tree_map_ni_p_higher(&object, 10, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -652,7 +754,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -663,12 +765,9 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_lower(&object, 100, &out));
+    assert_true(seahorse_red_black_tree_map_ni_p_lower(&object, 100, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -816,7 +915,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -827,13 +926,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_get_entry(
+    assert_true(seahorse_red_black_tree_map_ni_p_get_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -913,8 +1009,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -925,13 +1020,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_ni_p_ceiling_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1011,7 +1103,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -1022,13 +1114,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_floor_entry(
+    assert_true(seahorse_red_black_tree_map_ni_p_floor_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1097,8 +1186,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -1109,13 +1197,10 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_higher_entry(
+    assert_true(seahorse_red_black_tree_map_ni_p_higher_entry(
             &object, 10, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1184,7 +1269,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_ni_p object;
@@ -1195,13 +1280,10 @@ static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_ni_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_ni_p_floor_entry(
+    assert_true(seahorse_red_black_tree_map_ni_p_floor_entry(
             &object, 100, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1712,56 +1794,583 @@ check_init_red_black_tree_map_ni_p_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_sorted_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_sorted(
+            NULL, 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_sorted(
+            (void *) 1, 0, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_keys_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_sorted(
+            (void *) 1, 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_sorted(
+            (void *) 1, 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_keys_are_not_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 3, 2};
+    const void *values[] = {(void *) 10, (void *) 20, (void *) 30};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_sorted(
+            &object, 3, keys, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_ARE_NOT_SORTED,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_duplicate_keys(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 2, 2};
+    const void *values[] = {(void *) 10, (void *) 20, (void *) 30};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_sorted(
+            &object, 3, keys, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_ARE_NOT_SORTED,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 2, 3};
+    const void *values[] = {(void *) 10, (void *) 20, (void *) 30};
+    struct seahorse_red_black_tree_map_ni_p object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_ni_p_init_sorted(
+            &object, 3, keys, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t keys[] = {1, 2, 3};
+    const void *values[] = {(void *) 10, (void *) 20, (void *) 30};
+    const uintmax_t limit = sizeof(keys) / sizeof(uintmax_t);
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init_sorted(
+            &object, limit, keys, values));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        const void *out;
+        assert_true(seahorse_red_black_tree_map_ni_p_get(
+                &object, keys[i], &out));
+        assert_ptr_equal(out, values[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_remove_range(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_remove_range(
+            &object, key[2], key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_p_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_remove_range(
+            &object, key[7], key[0]));
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_many(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, 10 * i, (void *) 1));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, 2005, 6995, &out));
+    assert_int_equal(out, 499);
+    assert_true(seahorse_red_black_tree_map_ni_p_remove_range(
+            &object, 2005, 6995));
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &out));
+    assert_int_equal(out, 501);
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, 0, 9990, &out));
+    assert_int_equal(out, 501);
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, 2005, 6995, &out));
+    assert_int_equal(out, 0);
+    const struct seahorse_red_black_tree_map_ni_p_entry *entry;
+    assert_true(seahorse_red_black_tree_map_ni_p_first_entry(
+            &object, &entry));
+    uintmax_t expected = 0;
+    do {
+        const uintmax_t *key;
+        assert_true(seahorse_red_black_tree_map_ni_p_entry_key(
+                &object, entry, &key));
+        assert_int_equal(*key, expected);
+        expected += expected == 2000 ? 5000 : 10;
+    } while (seahorse_red_black_tree_map_ni_p_next_entry(entry, &entry));
+    assert_int_equal(expected, 10000);
+    assert_true(seahorse_red_black_tree_map_ni_p_add(
+            &object, 4000, (void *) 1));
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, 2000, 7000, &out));
+    assert_int_equal(out, 3);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_ni_p_remove_range(
+            &object, key[2], key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_count_range(
+            NULL, 0, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_count_range(
+            (void *) 1, 0, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, key[2], key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, key[0], key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, key[4], key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, key[5], key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_ni_p_count_range(
+            &object, key[2], key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_split_at(
+            NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_split_at(
+            (void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    struct seahorse_red_black_tree_map_ni_p other;
+    assert_true(seahorse_red_black_tree_map_ni_p_split_at(
+            &object, key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_p_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_p_contains(
+                &other, key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_remove(&object, key[7]));
+    struct seahorse_red_black_tree_map_ni_p other;
+    assert_true(seahorse_red_black_tree_map_ni_p_split_at(
+            &object, key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    const struct seahorse_red_black_tree_map_ni_p_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_get_entry(
+                &object, key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_ni_p other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_ni_p_split_at(
+            &object, key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_ni_p_entry *out;
+        assert_true(seahorse_red_black_tree_map_ni_p_get_entry(
+                i < 4 ? &object : &other, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_ni_p_entry *out;
+        assert_true(seahorse_red_black_tree_map_ni_p_get_entry(
+                &object, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_ni_p_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    struct seahorse_red_black_tree_map_ni_p other;
+    assert_true(seahorse_red_black_tree_map_ni_p_split_at(
+            &object, key[4], &other));
+    assert_true(seahorse_red_black_tree_map_ni_p_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_ni_p_contains(
+                &object, key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_ni_p_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    struct seahorse_red_black_tree_map_ni_p other;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_ni_p_add(
+                    &other, key[i], (void *) 1));
+        }
+    }
+    assert_false(seahorse_red_black_tree_map_ni_p_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_interleaved(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    struct seahorse_red_black_tree_map_ni_p other;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                i % 2 ? &other : &object, key[i], (void *)(uintptr_t) i));
+    }
+    assert_false(seahorse_red_black_tree_map_ni_p_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    for (uintmax_t i = 0; i < 8; i++) {
+        const void *out;
+        assert_true(seahorse_red_black_tree_map_ni_p_get(
+                i % 2 ? &other : &object, key[i], &out));
+        assert_ptr_equal(out, (void *)(uintptr_t) i);
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_map_ni_p object;
+    assert_true(seahorse_red_black_tree_map_ni_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_ni_p_add(
+                &object, key[i], (void *) 1));
+    }
+    struct seahorse_red_black_tree_map_ni_p other;
+    assert_true(seahorse_red_black_tree_map_ni_p_split_at(
+            &object, key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_ni_p target;
+    assert_true(seahorse_red_black_tree_map_ni_p_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_ni_p_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_NI_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_ni_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&target, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_ni_p_invalidate(&object, NULL));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
             cmocka_unit_test(check_add_error_on_object_is_null),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_key_already_exists),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_key_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_set_error_on_object_is_null),
             cmocka_unit_test(check_set_error_on_key_on_found),
             cmocka_unit_test(check_set),
-            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -1774,27 +2383,27 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_error_on_out_is_null),
             cmocka_unit_test(check_get_entry_error_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -1825,6 +2434,33 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_ni_p_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_ni_p),
             cmocka_unit_test(check_init_red_black_tree_map_ni_p_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted_error_on_object_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_count_is_zero),
+            cmocka_unit_test(check_init_sorted_error_on_keys_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_values_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_keys_are_not_sorted),
+            cmocka_unit_test(check_init_sorted_error_on_duplicate_keys),
+            cmocka_unit_test(check_init_sorted_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_many),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_keys_interleaved),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
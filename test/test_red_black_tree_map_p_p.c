@@ -44,6 +44,8 @@ static void check_init(void **state) {
     struct seahorse_red_black_tree_map_p_p object;
     assert_true(seahorse_red_black_tree_map_p_p_init(
             &object, seagrass_void_ptr_compare));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(
             &object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -69,13 +71,74 @@ static int compare(const void *const a, const void *const b) {
     return seagrass_uintmax_t_ptr_compare(a, b);
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_init_pool(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_compare_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_init_pool(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_COMPARE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_init_pool(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init_pool(
+            &object, compare, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    uintmax_t key[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        key[i] = i;
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, &key[i], NULL));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_p_p_remove(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, &key[i], NULL));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
     assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
     const uintmax_t check = (rand() % UINTMAX_MAX);
-    object.map.tree.count = check;
+    object.tree.count = check;
     uintmax_t out;
     assert_true(seahorse_red_black_tree_map_p_p_count(
             &object, (uintmax_t *) &out));
@@ -111,6 +174,84 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_try_add(
+            NULL, 0, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_try_add(
+            (void *) 1, 0, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    const void *key = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_p_p_entry *entry;
+    assert_true(seahorse_red_black_tree_map_p_p_try_add(
+            &object, key, value, &entry));
+    const struct seahorse_red_black_tree_map_p_p_entry *other;
+    assert_true(seahorse_red_black_tree_map_p_p_get_entry(
+            &object, key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    const void *key = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_p_p_entry *entry;
+    assert_true(seahorse_red_black_tree_map_p_p_try_add(
+            &object, key, value, &entry));
+    value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_p_p_entry *other;
+    assert_false(seahorse_red_black_tree_map_p_p_try_add(
+            &object, key, value, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    const void *key = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_p_p_entry *entry;
+    assert_false(seahorse_red_black_tree_map_p_p_try_add(
+            &object, key, value, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_add(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -178,7 +319,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -191,12 +332,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_int_equal(count, 1);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_remove(&object, key));
+    assert_true(seahorse_red_black_tree_map_p_p_remove(&object, key));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -236,7 +374,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -245,12 +383,9 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_contains(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_p_p_contains(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -296,7 +431,7 @@ static void check_set(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_set_error_on_memory_allocation_failed(void **state) {
+static void check_set_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -310,12 +445,9 @@ static void check_set_error_on_memory_allocation_failed(void **state) {
     value = (void *) (uintptr_t) (rand() % UINTMAX_MAX);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_set(&object, key, value));
+    assert_true(seahorse_red_black_tree_map_p_p_set(&object, key, value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -365,7 +497,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -376,12 +508,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_get(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_p_p_get(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -445,7 +574,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -456,13 +585,10 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_ceiling(
+    assert_true(seahorse_red_black_tree_map_p_p_ceiling(
             &object, (const void *) (uintptr_t) 10, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -526,7 +652,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -537,13 +663,10 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_floor(
+    assert_true(seahorse_red_black_tree_map_p_p_floor(
             &object, (const void *) (uintptr_t) 100, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -602,7 +725,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -613,13 +736,10 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_higher(
+    assert_true(seahorse_red_black_tree_map_p_p_higher(
             &object, (void *)(uintptr_t) 10, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -684,7 +804,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -695,13 +815,10 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_lower(
+    assert_true(seahorse_red_black_tree_map_p_p_lower(
             &object, (void *)(uintptr_t) 100, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -849,7 +966,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -860,13 +977,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_p_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_get_entry(
+    assert_true(seahorse_red_black_tree_map_p_p_get_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -946,8 +1060,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -958,13 +1071,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_p_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_p_p_ceiling_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1044,7 +1154,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -1055,13 +1165,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_p_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_floor_entry(
+    assert_true(seahorse_red_black_tree_map_p_p_floor_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1130,8 +1237,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -1142,13 +1248,10 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_p_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_higher_entry(
+    assert_true(seahorse_red_black_tree_map_p_p_higher_entry(
             &object, (void *)(uintptr_t) 10, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1217,7 +1320,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_p_p object;
@@ -1228,13 +1331,10 @@ static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_p_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_p_p_floor_entry(
+    assert_true(seahorse_red_black_tree_map_p_p_floor_entry(
             &object, (void *)(uintptr_t) 100, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -1760,6 +1860,386 @@ check_init_red_black_tree_map_p_p_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_p_p_remove_range(
+            &object, key[2], key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_p_p_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_p_p_remove_range(
+            &object, key[7], key[0]));
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_p_p_remove_range(
+            &object, key[2], key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_p_p_count_range(
+            &object, key[2], key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_p_p_count_range(
+            &object, key[0], key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_p_p_count_range(
+            &object, key[4], key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_p_p_count_range(
+            &object, key[5], key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_p_p_count_range(
+            &object, key[2], key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_p_p other;
+    assert_true(seahorse_red_black_tree_map_p_p_split_at(
+            &object, key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_p_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_p_p_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_p_p_contains(
+                &other, key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_p_p_remove(&object, key[7]));
+    struct seahorse_red_black_tree_map_p_p other;
+    assert_true(seahorse_red_black_tree_map_p_p_split_at(
+            &object, key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_p_p_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    const struct seahorse_red_black_tree_map_p_p_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_get_entry(
+                &object, key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_p_p other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_p_p_split_at(
+            &object, key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_p_p_entry *out;
+        assert_true(seahorse_red_black_tree_map_p_p_get_entry(
+                i < 4 ? &object : &other, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_p_p_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_p_p_entry *out;
+        assert_true(seahorse_red_black_tree_map_p_p_get_entry(
+                &object, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_p_p_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_p_p other;
+    assert_true(seahorse_red_black_tree_map_p_p_split_at(
+            &object, key[4], &other));
+    assert_true(seahorse_red_black_tree_map_p_p_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_p_p_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_p_p_contains(
+                &object, key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_p_p_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    struct seahorse_red_black_tree_map_p_p other;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&other, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_p_p_add(
+                    &other, key[i], key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_map_p_p_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_p_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const void *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        key[i] = (void *)(uintptr_t) (10 * (i + 1));
+    }
+    struct seahorse_red_black_tree_map_p_p object;
+    assert_true(seahorse_red_black_tree_map_p_p_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_p_p_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_p_p other;
+    assert_true(seahorse_red_black_tree_map_p_p_split_at(
+            &object, key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_p_p target;
+    assert_true(seahorse_red_black_tree_map_p_p_init_pool(
+            &target, compare, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_p_p_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_P_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_p_p_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_p_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&target, NULL));
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_p_p_invalidate(&object, NULL));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
@@ -1767,50 +2247,59 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init_error_on_compare_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_compare_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
             cmocka_unit_test(check_add_error_on_object_is_null),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_key_already_exists),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_key_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_set_error_on_object_is_null),
             cmocka_unit_test(check_set_error_on_key_on_found),
             cmocka_unit_test(check_set),
-            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -1823,27 +2312,27 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_error_on_out_is_null),
             cmocka_unit_test(check_get_entry_error_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -1874,6 +2363,23 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_p_p_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_p_p),
             cmocka_unit_test(check_init_red_black_tree_map_p_p_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
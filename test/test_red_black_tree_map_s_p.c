@@ -2,6 +2,7 @@
 #include <stddef.h>
 #include <setjmp.h>
 #include <cmocka.h>
+#include <string.h>
 #include <sea-turtle.h>
 #include <seahorse.h>
 
@@ -35,11 +36,74 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
     assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(
             &object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    struct sea_turtle_string key[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const char chars[] = {
+                (char) ('0' + i / 100),
+                (char) ('0' + i / 10 % 10),
+                (char) ('0' + i % 10)
+        };
+        size_t size;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars, sizeof(chars), &size));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], NULL));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_s_p_remove(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], NULL));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_s_p_count(NULL, (void *) 1));
@@ -62,7 +126,7 @@ static void check_count(void **state) {
     struct seahorse_red_black_tree_map_s_p object;
     assert_true(seahorse_red_black_tree_map_s_p_init(&object));
     const uintmax_t check = (rand() % UINTMAX_MAX);
-    object.map.tree.count = check;
+    object.tree.count = check;
     uintmax_t out;
     assert_true(seahorse_red_black_tree_map_s_p_count(
             &object, (uintmax_t *) &out));
@@ -99,12 +163,103 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     uintmax_t size;
     assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
     const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
-    posix_memalign_is_overridden = true;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
     assert_false(seahorse_red_black_tree_map_s_p_add(&object, &key, value));
     assert_int_equal(
             SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
             seahorse_error);
-    posix_memalign_is_overridden = false;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_try_add(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_try_add(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    struct sea_turtle_string key;
+    uintmax_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_s_p_entry *entry;
+    assert_true(seahorse_red_black_tree_map_s_p_try_add(
+            &object, &key, value, &entry));
+    const struct seahorse_red_black_tree_map_s_p_entry *other;
+    assert_true(seahorse_red_black_tree_map_s_p_get_entry(
+            &object, &key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    struct sea_turtle_string key;
+    uintmax_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    const struct seahorse_red_black_tree_map_s_p_entry *entry;
+    assert_true(seahorse_red_black_tree_map_s_p_try_add(
+            &object, &key, value, &entry));
+    const struct seahorse_red_black_tree_map_s_p_entry *other;
+    assert_false(seahorse_red_black_tree_map_s_p_try_add(
+            &object, &key, NULL, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    struct sea_turtle_string key;
+    uintmax_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_s_p_entry *entry;
+    assert_false(seahorse_red_black_tree_map_s_p_try_add(
+            &object, &key, value, &entry));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -145,6 +300,83 @@ static void check_add_error_on_key_already_exists(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_add_take(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_add_take(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    struct sea_turtle_string key;
+    uintmax_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_s_p_add_take(
+            &object, &key, value));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    struct sea_turtle_string key;
+    uintmax_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    assert_true(seahorse_red_black_tree_map_s_p_add_take(&object, &key, value));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char KEY[] = u8"key";
+    struct sea_turtle_string key;
+    uintmax_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    const void *value = (void *)(uintptr_t) (rand() % UINTMAX_MAX);
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &key, value));
+    assert_false(seahorse_red_black_tree_map_s_p_add_take(&object, &key, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_remove_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_s_p_remove(NULL, (void *) 1));
@@ -201,7 +433,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -219,12 +451,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_int_equal(count, 1);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_remove(&object, &key));
+    assert_true(seahorse_red_black_tree_map_s_p_remove(&object, &key));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -280,7 +509,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -297,13 +526,10 @@ static void check_contains_error_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_map_s_p_add(&object, &key, value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_contains(
+    assert_true(seahorse_red_black_tree_map_s_p_contains(
             &object, &key, &result));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -327,7 +553,7 @@ static void check_set_error_on_key_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_set_error_on_memory_allocation_failed(void **state) {
+static void check_set_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -340,12 +566,9 @@ static void check_set_error_on_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_map_s_p_add(&object, &key, value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden =
             posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_set(&object, &key, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_set(&object, &key, NULL));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden =
             posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -452,7 +675,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -466,12 +689,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_get(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_s_p_get(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -561,7 +781,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -575,12 +795,9 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_ceiling(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_s_p_ceiling(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -670,7 +887,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -684,12 +901,9 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_floor(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_s_p_floor(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -776,7 +990,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -797,13 +1011,10 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_higher(
+    assert_true(seahorse_red_black_tree_map_s_p_higher(
             &object, &query, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
@@ -900,7 +1111,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -922,13 +1133,10 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     const void *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_lower(
+    assert_true(seahorse_red_black_tree_map_s_p_lower(
             &object, &query, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
@@ -1116,7 +1324,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -1130,13 +1338,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_get_entry(
+    assert_true(seahorse_red_black_tree_map_s_p_get_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -1247,8 +1452,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -1263,13 +1467,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_s_p_ceiling_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -1386,7 +1587,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -1400,13 +1601,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_s_p_ceiling_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -1499,8 +1697,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -1517,13 +1714,10 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_higher_entry(
+    assert_true(seahorse_red_black_tree_map_s_p_higher_entry(
             &object, &query, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
@@ -1628,7 +1822,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_p object;
@@ -1645,13 +1839,10 @@ static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_p_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_p_lower_entry(
+    assert_true(seahorse_red_black_tree_map_s_p_lower_entry(
             &object, &query, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
@@ -2217,33 +2408,988 @@ check_init_red_black_tree_map_s_p_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_remove_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_remove_chars(
+            NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_remove_chars(
+            (void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char C[] = u8"c";
+    assert_false(seahorse_red_black_tree_map_s_p_remove_chars(
+            &object, C, sizeof(C)));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(seahorse_red_black_tree_map_s_p_remove_chars(
+            &object, B, sizeof(B)));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    bool out;
+    assert_true(seahorse_red_black_tree_map_s_p_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_remove_chars(
+            &object, B, sizeof(B)));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_contains_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_contains_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_contains_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    assert_true(seahorse_red_black_tree_map_s_p_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_map_s_p_contains_chars(
+            &object, C, sizeof(C), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_contains_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_get_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_get_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_get_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char C[] = u8"c";
+    const void *out;
+    assert_false(seahorse_red_black_tree_map_s_p_get_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const void *out;
+    assert_true(seahorse_red_black_tree_map_s_p_get_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    const void *check;
+    assert_true(seahorse_red_black_tree_map_s_p_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const void *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_get_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_ceiling_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_ceiling_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_ceiling_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char C[] = u8"c";
+    const void *out;
+    assert_false(seahorse_red_black_tree_map_s_p_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const void *out;
+    assert_true(seahorse_red_black_tree_map_s_p_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    const void *check;
+    assert_true(seahorse_red_black_tree_map_s_p_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const void *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_ceiling_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_floor_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_floor_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_floor_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char C[] = u8"c";
+    const void *out;
+    assert_false(seahorse_red_black_tree_map_s_p_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const void *out;
+    assert_true(seahorse_red_black_tree_map_s_p_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    const void *check;
+    assert_true(seahorse_red_black_tree_map_s_p_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, B));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_p_add(&object, &string, D));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const void *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_floor_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_remove_range(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_s_p_remove_range(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    assert_true(seahorse_red_black_tree_map_s_p_remove_range(
+            &object, &key[2], &key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_p_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_s_p_remove_range(
+            &object, &key[7], &key[0]));
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_remove_range(
+            &object, &key[2], &key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_count_range(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_s_p_count_range(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_s_p_count_range(
+            &object, &key[2], &key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_s_p_count_range(
+            &object, &key[0], &key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_s_p_count_range(
+            &object, &key[4], &key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_s_p_count_range(
+            &object, &key[5], &key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_count_range(
+            &object, &key[2], &key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_split_at(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    struct seahorse_red_black_tree_map_s_p other;
+    assert_true(seahorse_red_black_tree_map_s_p_split_at(
+            &object, &key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_p_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_p_contains(
+                &other, &key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    assert_true(seahorse_red_black_tree_map_s_p_remove(&object, &key[7]));
+    struct seahorse_red_black_tree_map_s_p other;
+    assert_true(seahorse_red_black_tree_map_s_p_split_at(
+            &object, &key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_s_p_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    const struct seahorse_red_black_tree_map_s_p_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_get_entry(
+                &object, &key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_s_p other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_p_split_at(
+            &object, &key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_s_p_entry *out;
+        assert_true(seahorse_red_black_tree_map_s_p_get_entry(
+                i < 4 ? &object : &other, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_s_p_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_s_p_entry *out;
+        assert_true(seahorse_red_black_tree_map_s_p_get_entry(
+                &object, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_p_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    struct seahorse_red_black_tree_map_s_p other;
+    assert_true(seahorse_red_black_tree_map_s_p_split_at(
+            &object, &key[4], &other));
+    assert_true(seahorse_red_black_tree_map_s_p_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_p_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_p_contains(
+                &object, &key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_s_p_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    struct seahorse_red_black_tree_map_s_p other;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_s_p_add(
+                    &other, &key[i], (void *) 1));
+        }
+    }
+    assert_false(seahorse_red_black_tree_map_s_p_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_p object;
+    assert_true(seahorse_red_black_tree_map_s_p_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_p_add(
+                &object, &key[i], (void *) 1));
+    }
+    struct seahorse_red_black_tree_map_s_p other;
+    assert_true(seahorse_red_black_tree_map_s_p_split_at(
+            &object, &key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_s_p target;
+    assert_true(seahorse_red_black_tree_map_s_p_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_s_p_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_p_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_s_p_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&target, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&other, NULL));
+    assert_true(seahorse_red_black_tree_map_s_p_invalidate(&object, NULL));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
             cmocka_unit_test(check_add_error_on_object_is_null),
             cmocka_unit_test(check_add_error_on_key_is_null),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_key_already_exists),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_key_is_null),
+            cmocka_unit_test(check_add_take_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_key_already_exists),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_key_is_null),
             cmocka_unit_test(check_remove_error_on_key_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_key_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_set_error_on_object_is_null),
             cmocka_unit_test(check_set_error_on_key_is_null),
-            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_without_memory_allocation),
             cmocka_unit_test(check_set),
             cmocka_unit_test(check_set_error_on_key_not_found),
             cmocka_unit_test(check_get_error_on_object_is_null),
@@ -2251,31 +3397,31 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_key_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_key_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_key_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -2289,31 +3435,31 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_error_on_out_is_null),
             cmocka_unit_test(check_get_entry_error_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -2348,6 +3494,54 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_s_p_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_s_p),
             cmocka_unit_test(check_init_red_black_tree_map_s_p_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_chars_error_on_object_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_not_found),
+            cmocka_unit_test(check_remove_chars),
+            cmocka_unit_test(check_remove_chars_without_memory_allocation),
+            cmocka_unit_test(check_contains_chars_error_on_object_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_key_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_out_is_null),
+            cmocka_unit_test(check_contains_chars),
+            cmocka_unit_test(check_contains_chars_without_memory_allocation),
+            cmocka_unit_test(check_get_chars_error_on_object_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_is_null),
+            cmocka_unit_test(check_get_chars_error_on_out_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_not_found),
+            cmocka_unit_test(check_get_chars),
+            cmocka_unit_test(check_get_chars_without_memory_allocation),
+            cmocka_unit_test(check_ceiling_chars_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_key_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling_chars),
+            cmocka_unit_test(check_ceiling_chars_without_memory_allocation),
+            cmocka_unit_test(check_floor_chars_error_on_object_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_key_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_out_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_key_not_found),
+            cmocka_unit_test(check_floor_chars),
+            cmocka_unit_test(check_floor_chars_without_memory_allocation),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range_error_on_key_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_key_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_key_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -2,11 +2,13 @@
 #include <stddef.h>
 #include <setjmp.h>
 #include <cmocka.h>
+#include <string.h>
 #include <time.h>
 #include <seagrass.h>
 #include <sea-turtle.h>
 #include <seahorse.h>
 
+#include "private/chars.h"
 #include <test/cmocka.h>
 
 static void check_invalidate_error_on_object_is_null(void **state) {
@@ -36,10 +38,73 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    struct sea_turtle_string key[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const char chars[] = {
+                (char) ('0' + i / 100),
+                (char) ('0' + i / 10 % 10),
+                (char) ('0' + i % 10)
+        };
+        size_t size;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars, sizeof(chars), &size));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_s_s_remove(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_s_s_count(NULL, (void *) 1));
@@ -61,7 +126,7 @@ static void check_count(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object = {};
     const uintmax_t check = (rand() % UINTMAX_MAX);
-    object.map.tree.count = check;
+    object.tree.count = check;
     uintmax_t count;
     assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
     assert_int_equal(count, check);
@@ -150,9 +215,205 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_string value;
     const char VALUE[] = u8"value";
     assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
-    posix_memalign_is_overridden = true;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
     assert_false(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
-    posix_memalign_is_overridden = false;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_add_take(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_add_take(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_add_take(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 0);
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add_take(
+            &object, &key, &value));
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
+    assert_false(seahorse_red_black_tree_map_s_s_add_take(
+            &object, &key, &value));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_s_s_add_take(
+            &object, &key, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_try_add(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_try_add(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    const struct seahorse_red_black_tree_map_s_s_entry *entry;
+    assert_true(seahorse_red_black_tree_map_s_s_try_add(
+            &object, &key, &value, &entry));
+    const struct seahorse_red_black_tree_map_s_s_entry *other;
+    assert_true(seahorse_red_black_tree_map_s_s_get_entry(
+            &object, &key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    const struct seahorse_red_black_tree_map_s_s_entry *entry;
+    assert_true(seahorse_red_black_tree_map_s_s_try_add(
+            &object, &key, &value, &entry));
+    const struct seahorse_red_black_tree_map_s_s_entry *other;
+    assert_false(seahorse_red_black_tree_map_s_s_try_add(
+            &object, &key, &value, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_s_s_entry *entry;
+    assert_false(seahorse_red_black_tree_map_s_s_try_add(
+            &object, &key, &value, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
     assert_int_equal(
             SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
             seahorse_error);
@@ -220,7 +481,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -239,12 +500,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_int_equal(count, 1);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_remove(&object, &key));
+    assert_true(seahorse_red_black_tree_map_s_s_remove(&object, &key));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
@@ -303,7 +561,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -321,13 +579,10 @@ static void check_contains_error_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_contains(
+    assert_true(seahorse_red_black_tree_map_s_s_contains(
             &object, &key, &result));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
@@ -434,34 +689,34 @@ static void check_set_error_on_key_not_found(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_object_is_null(void **state) {
+static void check_set_take_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
-    assert_false(seahorse_red_black_tree_map_s_s_get(
+    assert_false(seahorse_red_black_tree_map_s_s_set_take(
             NULL, (void *) 1, (void *) 1));
     assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
                      seahorse_error);
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_key_is_null(void **state) {
+static void check_set_take_error_on_key_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
-    assert_false(seahorse_red_black_tree_map_s_s_get(
+    assert_false(seahorse_red_black_tree_map_s_s_set_take(
             (void *) 1, NULL, (void *) 1));
     assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
                      seahorse_error);
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_out_is_null(void **state) {
+static void check_set_take_error_on_value_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
-    assert_false(seahorse_red_black_tree_map_s_s_get(
+    assert_false(seahorse_red_black_tree_map_s_s_set_take(
             (void *) 1, (void *) 1, NULL));
-    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_VALUE_IS_NULL,
                      seahorse_error);
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_key_not_found(void **state) {
+static void check_set_take_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -469,16 +724,24 @@ static void check_get_error_on_key_not_found(void **state) {
     const char KEY[] = u8"key";
     size_t size;
     assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
-    struct sea_turtle_string *out;
-    assert_false(seahorse_red_black_tree_map_s_s_get(&object, &key, &out));
-    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
-                     seahorse_error);
+    struct sea_turtle_string value;
+    const char VALUE0[] = u8"value0";
+    assert_true(sea_turtle_string_init(&value, VALUE0, sizeof(VALUE0), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
+    assert_true(sea_turtle_string_invalidate(&value));
+    const char VALUE1[] = u8"value1";
+    assert_true(sea_turtle_string_init(&value, VALUE1, sizeof(VALUE1), &size));
+    malloc_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_set_take(
+            &object, &key, &value));
+    malloc_is_overridden = false;
     assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get(void **state) {
+static void check_set_take(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -487,20 +750,27 @@ static void check_get(void **state) {
     size_t size;
     assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
     struct sea_turtle_string value;
-    const char VALUE[] = u8"value";
-    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    const char VALUE0[] = u8"value0";
+    assert_true(sea_turtle_string_init(&value, VALUE0, sizeof(VALUE0), &size));
     assert_true(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
+    assert_true(sea_turtle_string_invalidate(&value));
+    const char VALUE1[] = u8"value1";
+    assert_true(sea_turtle_string_init(&value, VALUE1, sizeof(VALUE1), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_set_take(
+            &object, &key, &value));
     struct sea_turtle_string *out;
     assert_true(seahorse_red_black_tree_map_s_s_get(&object, &key, &out));
-    assert_ptr_not_equal(out, &value);
-    assert_int_equal(sea_turtle_string_compare(&value, out), 0);
+    struct sea_turtle_string check;
+    assert_true(sea_turtle_string_init(&check, VALUE1, sizeof(VALUE1), &size));
+    assert_int_equal(sea_turtle_string_compare(&check, out), 0);
+    assert_true(sea_turtle_string_invalidate(&check));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_set_take_error_on_key_not_found(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -511,25 +781,109 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_string value;
     const char VALUE[] = u8"value";
     assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
-    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
-    struct sea_turtle_string *out;
-    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
-            = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_get(&object, &key, &out));
-    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
-            = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
-    assert_true(sea_turtle_string_invalidate(&key));
+    assert_false(seahorse_red_black_tree_map_s_s_set_take(
+            &object, &key, &value));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
     assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_object_is_null(void **state) {
+static void check_get_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
-    assert_false(seahorse_red_black_tree_map_s_s_ceiling(
+    assert_false(seahorse_red_black_tree_map_s_s_get(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_get(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_get(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string *out;
+    assert_false(seahorse_red_black_tree_map_s_s_get(&object, &key, &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
+    struct sea_turtle_string *out;
+    assert_true(seahorse_red_black_tree_map_s_s_get(&object, &key, &out));
+    assert_ptr_not_equal(out, &value);
+    assert_int_equal(sea_turtle_string_compare(&value, out), 0);
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct sea_turtle_string key;
+    const char KEY[] = u8"key";
+    size_t size;
+    assert_true(sea_turtle_string_init(&key, KEY, sizeof(KEY), &size));
+    struct sea_turtle_string value;
+    const char VALUE[] = u8"value";
+    assert_true(sea_turtle_string_init(&value, VALUE, sizeof(VALUE), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &key, &value));
+    struct sea_turtle_string *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_get(&object, &key, &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(sea_turtle_string_invalidate(&key));
+    assert_true(sea_turtle_string_invalidate(&value));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_ceiling(
             NULL, (void *) 1, (void *) 1));
     assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
                      seahorse_error);
@@ -619,7 +973,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -634,12 +988,9 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_string *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_ceiling(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_s_s_ceiling(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
@@ -738,7 +1089,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -753,12 +1104,9 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_string *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_floor(&object, &key, &out));
+    assert_true(seahorse_red_black_tree_map_s_s_floor(&object, &key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
@@ -853,7 +1201,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -877,13 +1225,10 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_string *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_higher(
+    assert_true(seahorse_red_black_tree_map_s_s_higher(
             &object, &query, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(sea_turtle_string_invalidate(&value));
@@ -980,7 +1325,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -1005,13 +1350,10 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     struct sea_turtle_string *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_lower(
+    assert_true(seahorse_red_black_tree_map_s_s_lower(
             &object, &query, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(sea_turtle_string_invalidate(&value));
@@ -1214,7 +1556,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -1229,13 +1571,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_s_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_get_entry(
+    assert_true(seahorse_red_black_tree_map_s_s_get_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
@@ -1354,8 +1693,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -1371,13 +1709,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_s_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_s_s_ceiling_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
@@ -1496,7 +1831,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -1512,13 +1847,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_s_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_s_s_ceiling_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(sea_turtle_string_invalidate(&key));
     assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
@@ -1616,8 +1948,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -1635,13 +1966,10 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_s_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_higher_entry(
+    assert_true(seahorse_red_black_tree_map_s_s_higher_entry(
             &object, &query, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(sea_turtle_string_invalidate(&key));
@@ -1740,7 +2068,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_s object;
     assert_true(seahorse_red_black_tree_map_s_s_init(&object));
@@ -1758,13 +2086,10 @@ static void check_lower_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_s_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_s_lower_entry(
+    assert_true(seahorse_red_black_tree_map_s_s_lower_entry(
             &object, &query, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&query));
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(sea_turtle_string_invalidate(&key));
@@ -2363,6 +2688,55 @@ static void check_init_red_black_tree_map_s_s(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_red_black_tree_map_s_s_many(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 200; i++) {
+        const uintmax_t n = (i * 7) % 200;
+        const char chars[] = {
+                '0' + n / 100, '0' + n / 10 % 10, '0' + n % 10
+        };
+        struct sea_turtle_string string;
+        size_t size;
+        assert_true(sea_turtle_string_init(
+                &string, chars, sizeof(chars), &size));
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &string, &string));
+        assert_true(sea_turtle_string_invalidate(&string));
+    }
+    struct seahorse_red_black_tree_map_s_s copy;
+    assert_true(seahorse_red_black_tree_map_s_s_init_red_black_tree_map_s_s(
+            &copy, &object));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&copy, &count));
+    assert_int_equal(count, 200);
+    const struct seahorse_red_black_tree_map_s_s_entry *a;
+    assert_true(seahorse_red_black_tree_map_s_s_first_entry(&object, &a));
+    const struct seahorse_red_black_tree_map_s_s_entry *b;
+    assert_true(seahorse_red_black_tree_map_s_s_first_entry(&copy, &b));
+    bool more;
+    do {
+        assert_ptr_not_equal(a, b);
+        const struct sea_turtle_string *x;
+        assert_true(seahorse_red_black_tree_map_s_s_entry_key(
+                &object, a, &x));
+        const struct sea_turtle_string *y;
+        assert_true(seahorse_red_black_tree_map_s_s_entry_key(
+                &copy, b, &y));
+        assert_int_equal(sea_turtle_string_compare(x, y), 0);
+        struct sea_turtle_string *out;
+        assert_true(seahorse_red_black_tree_map_s_s_get(&copy, y, &out));
+        assert_int_equal(sea_turtle_string_compare(out, y), 0);
+        more = seahorse_red_black_tree_map_s_s_next_entry(a, &a);
+        assert_int_equal(more,
+                         seahorse_red_black_tree_map_s_s_next_entry(b, &b));
+    } while (more);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&copy));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void
 check_init_red_black_tree_map_s_s_error_on_memory_allocation_failed(
         void **state) {
@@ -2393,12 +2767,1046 @@ check_init_red_black_tree_map_s_s_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_remove_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_remove_chars(
+            NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_remove_chars(
+            (void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char C[] = u8"c";
+    assert_false(seahorse_red_black_tree_map_s_s_remove_chars(
+            &object, C, sizeof(C)));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(seahorse_red_black_tree_map_s_s_remove_chars(
+            &object, B, sizeof(B)));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    bool out;
+    assert_true(seahorse_red_black_tree_map_s_s_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_remove_chars(
+            &object, B, sizeof(B)));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_contains_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_contains_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_contains_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    assert_true(seahorse_red_black_tree_map_s_s_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_map_s_s_contains_chars(
+            &object, C, sizeof(C), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_contains_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_get_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_get_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_get_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char C[] = u8"c";
+    struct sea_turtle_string *out;
+    assert_false(seahorse_red_black_tree_map_s_s_get_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    struct sea_turtle_string *out;
+    assert_true(seahorse_red_black_tree_map_s_s_get_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    struct sea_turtle_string *check;
+    assert_true(seahorse_red_black_tree_map_s_s_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    struct sea_turtle_string *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_get_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char C[] = u8"c";
+    struct sea_turtle_string *out;
+    assert_false(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    struct sea_turtle_string *out;
+    assert_true(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    struct sea_turtle_string *check;
+    assert_true(seahorse_red_black_tree_map_s_s_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    struct sea_turtle_string *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_floor_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_floor_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_floor_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char C[] = u8"c";
+    struct sea_turtle_string *out;
+    assert_false(seahorse_red_black_tree_map_s_s_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    struct sea_turtle_string *out;
+    assert_true(seahorse_red_black_tree_map_s_s_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    struct sea_turtle_string *check;
+    assert_true(seahorse_red_black_tree_map_s_s_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_s_add(&object, &string, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    struct sea_turtle_string *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_floor_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_chars_order_matches_string_order(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    const char *const chars[] = {
+            u8"abc", u8"", u8"\u00e9", u8"ab", u8"z", u8"a", u8"b",
+            u8"\u00e9a", u8"\u00e9\u00e9", u8"\u00ff", u8"~", u8"\u4e2d",
+            u8"\u4e2d\u6587", u8"\U0001F600", u8"\u00e9\U0001F600"
+    };
+    const uintmax_t count = sizeof(chars) / sizeof(chars[0]);
+    struct sea_turtle_string string[sizeof(chars) / sizeof(chars[0])];
+    for (uintmax_t i = 0; i < count; i++) {
+        size_t size;
+        assert_true(sea_turtle_string_init(
+                &string[i], chars[i], strlen(chars[i]), &size));
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &string[i], &string[i]));
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        const struct seahorse_chars key = {
+                .data = chars[i],
+                .size = strlen(chars[i])
+        };
+        for (uintmax_t j = 0; j < count; j++) {
+            const int expected = sea_turtle_string_compare(
+                    &string[i], &string[j]);
+            const int result = seahorse_chars_compare(&key, &string[j]);
+            assert_int_equal((expected > 0) - (expected < 0),
+                             (result > 0) - (result < 0));
+        }
+    }
+    const struct sea_turtle_string *prev = NULL;
+    uintmax_t visited = 0;
+    const struct seahorse_red_black_tree_map_s_s_entry *entry;
+    assert_true(seahorse_red_black_tree_map_s_s_first_entry(&object, &entry));
+    do {
+        const struct sea_turtle_string *key;
+        assert_true(seahorse_red_black_tree_map_s_s_entry_key(
+                &object, entry, &key));
+        if (prev) {
+            assert_true(sea_turtle_string_compare(prev, key) < 0);
+        }
+        prev = key;
+        visited++;
+        struct sea_turtle_string *value;
+        assert_true(seahorse_red_black_tree_map_s_s_entry_get_value(
+                &object, entry, &value));
+        uintmax_t size;
+        assert_true(sea_turtle_string_size(key, &size));
+        const char *data;
+        assert_true(sea_turtle_string_char(key, &data));
+        struct sea_turtle_string *out;
+        assert_true(seahorse_red_black_tree_map_s_s_get_chars(
+                &object, data, size, &out));
+        assert_ptr_equal(out, value);
+        assert_true(seahorse_red_black_tree_map_s_s_ceiling_chars(
+                &object, data, size, &out));
+        assert_ptr_equal(out, value);
+        assert_true(seahorse_red_black_tree_map_s_s_floor_chars(
+                &object, data, size, &out));
+        assert_ptr_equal(out, value);
+    } while (seahorse_red_black_tree_map_s_s_next_entry(entry, &entry));
+    assert_int_equal(visited, count);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_true(sea_turtle_string_invalidate(&string[i]));
+    }
+    struct sea_turtle_string *out;
+    const char *data;
+    assert_true(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            &object, u8"aa", strlen(u8"aa"), &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"ab");
+    assert_true(seahorse_red_black_tree_map_s_s_floor_chars(
+            &object, u8"abd", strlen(u8"abd"), &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"abc");
+    assert_true(seahorse_red_black_tree_map_s_s_ceiling_chars(
+            &object, u8"\u00e8", strlen(u8"\u00e8"), &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"\u00e9");
+    assert_true(seahorse_red_black_tree_map_s_s_remove_chars(
+            &object, u8"", 0));
+    assert_true(seahorse_red_black_tree_map_s_s_first(&object, &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"a");
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_remove_range(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_s_s_remove_range(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_s_s_remove_range(
+            &object, &key[2], &key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_s_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_s_s_remove_range(
+            &object, &key[7], &key[0]));
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_remove_range(
+            &object, &key[2], &key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_count_range(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_s_s_count_range(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_s_s_count_range(
+            &object, &key[2], &key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_s_s_count_range(
+            &object, &key[0], &key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_s_s_count_range(
+            &object, &key[4], &key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_s_s_count_range(
+            &object, &key[5], &key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_count_range(
+            &object, &key[2], &key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_split_at(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    struct seahorse_red_black_tree_map_s_s other;
+    assert_true(seahorse_red_black_tree_map_s_s_split_at(
+            &object, &key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_s_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_s_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_s_contains(
+                &other, &key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_s_s_remove(&object, &key[7]));
+    struct seahorse_red_black_tree_map_s_s other;
+    assert_true(seahorse_red_black_tree_map_s_s_split_at(
+            &object, &key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_s_s_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    const struct seahorse_red_black_tree_map_s_s_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_get_entry(
+                &object, &key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_s_s other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_s_split_at(
+            &object, &key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_s_s_entry *out;
+        assert_true(seahorse_red_black_tree_map_s_s_get_entry(
+                i < 4 ? &object : &other, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_s_s_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_s_s_entry *out;
+        assert_true(seahorse_red_black_tree_map_s_s_get_entry(
+                &object, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_s_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    struct seahorse_red_black_tree_map_s_s other;
+    assert_true(seahorse_red_black_tree_map_s_s_split_at(
+            &object, &key[4], &other));
+    assert_true(seahorse_red_black_tree_map_s_s_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_s_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_s_contains(
+                &object, &key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_s_s_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    struct seahorse_red_black_tree_map_s_s other;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_s_s_add(
+                    &other, &key[i], &key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_map_s_s_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_s_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_s object;
+    assert_true(seahorse_red_black_tree_map_s_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_s_add(
+                &object, &key[i], &key[i]));
+    }
+    struct seahorse_red_black_tree_map_s_s other;
+    assert_true(seahorse_red_black_tree_map_s_s_split_at(
+            &object, &key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_s_s target;
+    assert_true(seahorse_red_black_tree_map_s_s_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_s_s_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_s_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_s_s_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&target));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_s_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
@@ -2408,52 +3816,69 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_key_already_exists),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_key_is_null),
+            cmocka_unit_test(check_add_take_error_on_value_is_null),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_key_already_exists),
+            cmocka_unit_test(check_add_take_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_key_is_null),
             cmocka_unit_test(check_remove_error_on_key_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_key_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_set_error_on_object_is_null),
             cmocka_unit_test(check_set_error_on_key_is_null),
             cmocka_unit_test(check_set_error_on_value_is_null),
             cmocka_unit_test(check_set_error_on_memory_allocation_failed),
             cmocka_unit_test(check_set),
             cmocka_unit_test(check_set_error_on_key_not_found),
+            cmocka_unit_test(check_set_take_error_on_object_is_null),
+            cmocka_unit_test(check_set_take_error_on_key_is_null),
+            cmocka_unit_test(check_set_take_error_on_value_is_null),
+            cmocka_unit_test(check_set_take_without_memory_allocation),
+            cmocka_unit_test(check_set_take),
+            cmocka_unit_test(check_set_take_error_on_key_not_found),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_key_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_key_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_key_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_key_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -2467,31 +3892,31 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_error_on_out_is_null),
             cmocka_unit_test(check_get_entry_error_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -2526,7 +3951,57 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_s_s_error_on_object_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_s_s_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_s_s),
+            cmocka_unit_test(check_init_red_black_tree_map_s_s_many),
             cmocka_unit_test(check_init_red_black_tree_map_s_s_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_chars_error_on_object_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_not_found),
+            cmocka_unit_test(check_remove_chars),
+            cmocka_unit_test(check_remove_chars_without_memory_allocation),
+            cmocka_unit_test(check_contains_chars_error_on_object_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_key_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_out_is_null),
+            cmocka_unit_test(check_contains_chars),
+            cmocka_unit_test(check_contains_chars_without_memory_allocation),
+            cmocka_unit_test(check_get_chars_error_on_object_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_is_null),
+            cmocka_unit_test(check_get_chars_error_on_out_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_not_found),
+            cmocka_unit_test(check_get_chars),
+            cmocka_unit_test(check_get_chars_without_memory_allocation),
+            cmocka_unit_test(check_ceiling_chars_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_key_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling_chars),
+            cmocka_unit_test(check_ceiling_chars_without_memory_allocation),
+            cmocka_unit_test(check_floor_chars_error_on_object_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_key_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_out_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_key_not_found),
+            cmocka_unit_test(check_floor_chars),
+            cmocka_unit_test(check_floor_chars_without_memory_allocation),
+            cmocka_unit_test(check_chars_order_matches_string_order),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range_error_on_key_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_key_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_key_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -2,6 +2,7 @@
 #include <stddef.h>
 #include <setjmp.h>
 #include <cmocka.h>
+#include <string.h>
 #include <time.h>
 #include <sea-turtle.h>
 #include <triggerfish.h>
@@ -36,6 +37,8 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_wr object;
     assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -60,11 +63,11 @@ static void check_count(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_wr object = {
-            .map.tree.count = 1 + (rand() + (UINTMAX_MAX - 1))
+            .tree.count = 1 + (rand() + (UINTMAX_MAX - 1))
     };
     uintmax_t out;
     assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &out));
-    assert_int_equal(out, object.map.tree.count);
+    assert_int_equal(out, object.tree.count);
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
@@ -99,6 +102,73 @@ static void on_destroy(void *instance) {
     assert_non_null(instance);
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    struct sea_turtle_string key[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const char chars[] = {
+                (char) ('0' + i / 100),
+                (char) ('0' + i / 10 % 10),
+                (char) ('0' + i % 10)
+        };
+        size_t size;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars, sizeof(chars), &size));
+    }
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], value));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_s_wr_remove(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], value));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_add_error_on_key_already_exists(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"add";
@@ -170,6 +240,209 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_add_take(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_add_take(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_add_take(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[] = u8"add";
+    struct sea_turtle_string key;
+    size_t out;
+    assert_true(sea_turtle_string_init(&key, chars, sizeof(chars), &out));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &key, value));
+    assert_false(seahorse_red_black_tree_map_s_wr_add_take(
+            &object, &key, value));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_ALREADY_EXISTS,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[] = u8"add";
+    struct sea_turtle_string key;
+    size_t out;
+    assert_true(sea_turtle_string_init(&key, chars, sizeof(chars), &out));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    assert_true(seahorse_red_black_tree_map_s_wr_add_take(
+            &object, &key, value));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[] = u8"add";
+    struct sea_turtle_string key;
+    size_t out;
+    assert_true(sea_turtle_string_init(&key, chars, sizeof(chars), &out));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_s_wr_add_take(
+            &object, &key, value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_try_add(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_try_add(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[] = u8"add";
+    struct sea_turtle_string key;
+    size_t out;
+    assert_true(sea_turtle_string_init(&key, chars, sizeof(chars), &out));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    const struct seahorse_red_black_tree_map_s_wr_entry *entry;
+    assert_true(seahorse_red_black_tree_map_s_wr_try_add(
+            &object, &key, value, &entry));
+    const struct seahorse_red_black_tree_map_s_wr_entry *other;
+    assert_true(seahorse_red_black_tree_map_s_wr_get_entry(
+            &object, &key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[] = u8"add";
+    struct sea_turtle_string key;
+    size_t out;
+    assert_true(sea_turtle_string_init(&key, chars, sizeof(chars), &out));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    const struct seahorse_red_black_tree_map_s_wr_entry *entry;
+    assert_true(seahorse_red_black_tree_map_s_wr_try_add(
+            &object, &key, value, &entry));
+    const struct seahorse_red_black_tree_map_s_wr_entry *other;
+    assert_false(seahorse_red_black_tree_map_s_wr_try_add(
+            &object, &key, value, &other));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_ALREADY_EXISTS,
+            seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[] = u8"add";
+    struct sea_turtle_string key;
+    size_t out;
+    assert_true(sea_turtle_string_init(&key, chars, sizeof(chars), &out));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_s_wr_entry *entry;
+    assert_false(seahorse_red_black_tree_map_s_wr_try_add(
+            &object, &key, value, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(sea_turtle_string_invalidate(&key));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_remove_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_s_wr_remove(NULL, (void *) 1));
@@ -269,7 +542,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"contains";
     struct sea_turtle_string key;
@@ -284,13 +557,10 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool result;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_wr_contains(
+    assert_true(seahorse_red_black_tree_map_s_wr_contains(
             &object, &key, &result));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
     assert_true(triggerfish_weak_destroy(value));
     assert_true(triggerfish_strong_release(strong));
@@ -450,7 +720,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"get";
     struct sea_turtle_string key;
@@ -466,12 +736,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const struct triggerfish_weak *value;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_wr_get(&object, &key, &value));
+    assert_true(seahorse_red_black_tree_map_s_wr_get(&object, &key, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -568,7 +835,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"ceiling";
     struct sea_turtle_string key;
@@ -584,13 +851,10 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const struct triggerfish_weak *value;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_wr_ceiling(
+    assert_true(seahorse_red_black_tree_map_s_wr_ceiling(
             &object, &key, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -687,7 +951,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"floor";
     struct sea_turtle_string key;
@@ -703,13 +967,10 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     const struct triggerfish_weak *value;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_wr_floor(
+    assert_true(seahorse_red_black_tree_map_s_wr_floor(
             &object, &key, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -799,7 +1060,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"higher";
     struct sea_turtle_string key;
@@ -819,9 +1080,8 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
             &object, &key, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -911,7 +1171,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"lower";
     struct sea_turtle_string key;
@@ -931,9 +1191,8 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
             &object, &key, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -1124,7 +1383,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"get entry";
     struct sea_turtle_string key;
@@ -1140,13 +1399,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_wr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_wr_get_entry(
+    assert_true(seahorse_red_black_tree_map_s_wr_get_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -1248,8 +1504,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"ceiling entry";
     struct sea_turtle_string key;
@@ -1265,13 +1520,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_wr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_wr_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_s_wr_ceiling_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -1373,7 +1625,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"floor entry";
     struct sea_turtle_string key;
@@ -1389,13 +1641,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_s_wr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_s_wr_floor_entry(
+    assert_true(seahorse_red_black_tree_map_s_wr_floor_entry(
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -1488,8 +1737,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"higher entry";
     struct sea_turtle_string key;
@@ -1509,9 +1757,8 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -1604,8 +1851,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const char chars[] = u8"lower entry";
     struct sea_turtle_string key;
@@ -1625,9 +1871,8 @@ check_lower_entry_error_on_memory_allocation_failed(void **state) {
             &object, &key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
     assert_true(triggerfish_strong_release(strong));
     assert_true(triggerfish_weak_destroy(weak));
     assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
@@ -2222,12 +2467,1101 @@ check_init_red_black_tree_map_s_wr_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_remove_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_remove_chars(
+            NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_remove_chars(
+            (void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char C[] = u8"c";
+    assert_false(seahorse_red_black_tree_map_s_wr_remove_chars(
+            &object, C, sizeof(C)));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(seahorse_red_black_tree_map_s_wr_remove_chars(
+            &object, B, sizeof(B)));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 1);
+    bool out;
+    assert_true(seahorse_red_black_tree_map_s_wr_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_remove_chars(
+            &object, B, sizeof(B)));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_contains_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_contains_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_contains_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    assert_true(seahorse_red_black_tree_map_s_wr_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_map_s_wr_contains_chars(
+            &object, C, sizeof(C), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_contains_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_get_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_get_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_get_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char C[] = u8"c";
+    const struct triggerfish_weak *out;
+    assert_false(seahorse_red_black_tree_map_s_wr_get_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct triggerfish_weak *out;
+    assert_true(seahorse_red_black_tree_map_s_wr_get_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    const struct triggerfish_weak *check;
+    assert_true(seahorse_red_black_tree_map_s_wr_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct triggerfish_weak *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_get_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_ceiling_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_ceiling_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_ceiling_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char C[] = u8"c";
+    const struct triggerfish_weak *out;
+    assert_false(seahorse_red_black_tree_map_s_wr_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct triggerfish_weak *out;
+    assert_true(seahorse_red_black_tree_map_s_wr_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    const struct triggerfish_weak *check;
+    assert_true(seahorse_red_black_tree_map_s_wr_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct triggerfish_weak *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_ceiling_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_floor_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_floor_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_floor_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_key_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char C[] = u8"c";
+    const struct triggerfish_weak *out;
+    assert_false(seahorse_red_black_tree_map_s_wr_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct triggerfish_weak *out;
+    assert_true(seahorse_red_black_tree_map_s_wr_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    const struct triggerfish_weak *check;
+    assert_true(seahorse_red_black_tree_map_s_wr_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &strong));
+    struct triggerfish_weak *value;
+    assert_true(triggerfish_weak_of(strong, &value));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_map_s_wr_add(&object, &string, value));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct triggerfish_weak *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_floor_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(triggerfish_weak_destroy(value));
+    assert_true(triggerfish_strong_release(strong));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_remove_range(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_s_wr_remove_range(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(seahorse_red_black_tree_map_s_wr_remove_range(
+            &object, &key[2], &key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_wr_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_s_wr_remove_range(
+            &object, &key[7], &key[0]));
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_remove_range(
+            &object, &key[2], &key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_count_range(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_s_wr_count_range(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_s_wr_count_range(
+            &object, &key[2], &key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_s_wr_count_range(
+            &object, &key[0], &key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_s_wr_count_range(
+            &object, &key[4], &key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_s_wr_count_range(
+            &object, &key[5], &key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_count_range(
+            &object, &key[2], &key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_split_at(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    struct seahorse_red_black_tree_map_s_wr other;
+    assert_true(seahorse_red_black_tree_map_s_wr_split_at(
+            &object, &key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_wr_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_wr_contains(
+                &other, &key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    assert_true(seahorse_red_black_tree_map_s_wr_remove(&object, &key[7]));
+    struct seahorse_red_black_tree_map_s_wr other;
+    assert_true(seahorse_red_black_tree_map_s_wr_split_at(
+            &object, &key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    const struct seahorse_red_black_tree_map_s_wr_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_get_entry(
+                &object, &key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_s_wr other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_s_wr_split_at(
+            &object, &key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_s_wr_entry *out;
+        assert_true(seahorse_red_black_tree_map_s_wr_get_entry(
+                i < 4 ? &object : &other, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_s_wr_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_s_wr_entry *out;
+        assert_true(seahorse_red_black_tree_map_s_wr_get_entry(
+                &object, &key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_s_wr_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    struct seahorse_red_black_tree_map_s_wr other;
+    assert_true(seahorse_red_black_tree_map_s_wr_split_at(
+            &object, &key[4], &other));
+    assert_true(seahorse_red_black_tree_map_s_wr_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_s_wr_contains(
+                &object, &key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_s_wr_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct seahorse_red_black_tree_map_s_wr other;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&other));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_s_wr_add(
+                    &other, &key[i], weak));
+        }
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    assert_false(seahorse_red_black_tree_map_s_wr_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_map_s_wr object;
+    assert_true(seahorse_red_black_tree_map_s_wr_init(&object));
+    struct triggerfish_strong *strong;
+    assert_true(triggerfish_strong_of((void *) 1, on_destroy, &strong));
+    struct triggerfish_weak *weak;
+    assert_true(triggerfish_weak_of(strong, &weak));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_s_wr_add(
+                &object, &key[i], weak));
+    }
+    assert_true(triggerfish_weak_destroy(weak));
+    assert_true(triggerfish_strong_release(strong));
+    struct seahorse_red_black_tree_map_s_wr other;
+    assert_true(seahorse_red_black_tree_map_s_wr_split_at(
+            &object, &key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_s_wr target;
+    assert_true(seahorse_red_black_tree_map_s_wr_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_s_wr_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_S_WR_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_s_wr_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&target));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_s_wr_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
@@ -2237,6 +3571,17 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add_error_on_key_already_exists),
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_key_is_null),
+            cmocka_unit_test(check_add_take_error_on_value_is_null),
+            cmocka_unit_test(check_add_take_error_on_key_already_exists),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_out_is_null),
             cmocka_unit_test(check_remove),
@@ -2244,7 +3589,7 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_contains_error_on_key_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_set_error_on_object_is_null),
             cmocka_unit_test(check_set_error_on_key_is_null),
             cmocka_unit_test(check_set_error_on_value_is_null),
@@ -2255,31 +3600,31 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_key_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_key_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_key_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -2293,31 +3638,31 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_on_out_is_null),
             cmocka_unit_test(check_get_entry_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -2353,6 +3698,54 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_s_wr_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_s_wr),
             cmocka_unit_test(check_init_red_black_tree_map_s_wr_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_chars_error_on_object_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_key_not_found),
+            cmocka_unit_test(check_remove_chars),
+            cmocka_unit_test(check_remove_chars_without_memory_allocation),
+            cmocka_unit_test(check_contains_chars_error_on_object_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_key_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_out_is_null),
+            cmocka_unit_test(check_contains_chars),
+            cmocka_unit_test(check_contains_chars_without_memory_allocation),
+            cmocka_unit_test(check_get_chars_error_on_object_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_is_null),
+            cmocka_unit_test(check_get_chars_error_on_out_is_null),
+            cmocka_unit_test(check_get_chars_error_on_key_not_found),
+            cmocka_unit_test(check_get_chars),
+            cmocka_unit_test(check_get_chars_without_memory_allocation),
+            cmocka_unit_test(check_ceiling_chars_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_key_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_key_not_found),
+            cmocka_unit_test(check_ceiling_chars),
+            cmocka_unit_test(check_ceiling_chars_without_memory_allocation),
+            cmocka_unit_test(check_floor_chars_error_on_object_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_key_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_out_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_key_not_found),
+            cmocka_unit_test(check_floor_chars),
+            cmocka_unit_test(check_floor_chars_without_memory_allocation),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range_error_on_key_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_key_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_key_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
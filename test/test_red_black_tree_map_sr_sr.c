@@ -45,11 +45,11 @@ static void check_count(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_s_wr object = {
-            .map.tree.count = 1 + (rand() + (UINTMAX_MAX - 1))
+            .tree.count = 1 + (rand() + (UINTMAX_MAX - 1))
     };
     uintmax_t out;
     assert_true(seahorse_red_black_tree_map_s_wr_count(&object, &out));
-    assert_int_equal(out, object.map.tree.count);
+    assert_int_equal(out, object.tree.count);
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
@@ -129,6 +129,70 @@ static void check_add(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_init_pool(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_compare_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_init_pool(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_COMPARE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_init_pool(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init_pool(
+            &object, compare, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    struct triggerfish_strong *key[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(triggerfish_strong_of(malloc(1), on_destroy, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], NULL));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_remove(&object, key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], NULL));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_add_error_on_key_already_exists(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
@@ -164,6 +228,84 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_try_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_try_add(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_try_add(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    struct triggerfish_strong *key;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &key));
+    const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
+    assert_true(seahorse_red_black_tree_map_sr_sr_try_add(
+            &object, key, NULL, &entry));
+    const struct seahorse_red_black_tree_map_sr_sr_entry *other;
+    assert_true(seahorse_red_black_tree_map_sr_sr_get_entry(
+            &object, key, &other));
+    assert_ptr_equal(entry, other);
+    assert_true(triggerfish_strong_release(key));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_key_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    struct triggerfish_strong *key;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &key));
+    const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
+    assert_true(seahorse_red_black_tree_map_sr_sr_try_add(
+            &object, key, NULL, &entry));
+    const struct seahorse_red_black_tree_map_sr_sr_entry *other;
+    assert_false(seahorse_red_black_tree_map_sr_sr_try_add(
+            &object, key, NULL, &other));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_ALREADY_EXISTS,
+            seahorse_error);
+    assert_ptr_equal(entry, other);
+    assert_true(triggerfish_strong_release(key));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_try_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    struct triggerfish_strong *key;
+    assert_true(triggerfish_strong_of(malloc(1), on_destroy, &key));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
+    assert_false(seahorse_red_black_tree_map_sr_sr_try_add(
+            &object, key, NULL, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(triggerfish_strong_release(key));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_remove_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_map_sr_sr_remove(NULL, (void *) 1));
@@ -227,7 +369,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -236,10 +378,7 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_map_sr_sr_add(&object, key, NULL));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_remove(&object, key));
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
+    assert_true(seahorse_red_black_tree_map_sr_sr_remove(&object, key));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
@@ -306,7 +445,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -315,13 +454,10 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_contains(
+    assert_true(seahorse_red_black_tree_map_sr_sr_contains(
             &object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     assert_true(triggerfish_strong_release(key));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -410,7 +546,7 @@ static void check_set(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_set_error_on_memory_allocation_failed(void **state) {
+static void check_set_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -422,12 +558,9 @@ static void check_set_error_on_memory_allocation_failed(void **state) {
     assert_true(triggerfish_strong_release(value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_set(&object, key, NULL));
+    assert_true(seahorse_red_black_tree_map_sr_sr_set(&object, key, NULL));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(triggerfish_strong_release(key));
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -511,7 +644,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -523,12 +656,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     struct triggerfish_strong *out = NULL;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_get(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_sr_sr_get(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     assert_true(triggerfish_strong_release(key));
     assert_true(triggerfish_strong_release(value));
@@ -610,7 +740,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -622,12 +752,9 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     struct triggerfish_strong *out = NULL;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_ceiling(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_sr_sr_ceiling(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     assert_true(triggerfish_strong_release(key));
     assert_true(triggerfish_strong_release(value));
@@ -709,7 +836,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -721,12 +848,9 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     struct triggerfish_strong *out = NULL;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_floor(&object, key, &out));
+    assert_true(seahorse_red_black_tree_map_sr_sr_floor(&object, key, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     assert_true(triggerfish_strong_release(key));
     assert_true(triggerfish_strong_release(value));
@@ -825,7 +949,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     void *data[4] = {
             malloc(1), malloc(1), malloc(1), malloc(1)
@@ -847,13 +971,10 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     struct triggerfish_strong *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_higher(
+    assert_true(seahorse_red_black_tree_map_sr_sr_higher(
             &object, key[0], &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     for (uintmax_t i = 0; i < 2; i++) {
         assert_true(triggerfish_strong_release(key[i]));
@@ -950,7 +1071,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     void *data[4] = {
             malloc(1), malloc(1), malloc(1), malloc(1)
@@ -972,13 +1093,10 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     struct triggerfish_strong *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_lower(
+    assert_true(seahorse_red_black_tree_map_sr_sr_lower(
             &object, key[1], &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     for (uintmax_t i = 0; i < 2; i++) {
         assert_true(triggerfish_strong_release(key[i]));
@@ -1164,7 +1282,7 @@ static void check_get_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_entry_error_on_memory_allocation_failed(void **state) {
+static void check_get_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -1176,13 +1294,10 @@ static void check_get_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_get_entry(
+    assert_true(seahorse_red_black_tree_map_sr_sr_get_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     assert_true(triggerfish_strong_release(value));
     assert_true(triggerfish_strong_release(key));
@@ -1273,8 +1388,7 @@ static void check_ceiling_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -1286,13 +1400,10 @@ check_ceiling_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_ceiling_entry(
+    assert_true(seahorse_red_black_tree_map_sr_sr_ceiling_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     assert_true(triggerfish_strong_release(value));
     assert_true(triggerfish_strong_release(key));
@@ -1383,7 +1494,7 @@ static void check_floor_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
+static void check_floor_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_map_sr_sr object;
     assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
@@ -1395,13 +1506,10 @@ static void check_floor_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_floor_entry(
+    assert_true(seahorse_red_black_tree_map_sr_sr_floor_entry(
             &object, key, &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     assert_true(triggerfish_strong_release(value));
     assert_true(triggerfish_strong_release(key));
@@ -1504,8 +1612,7 @@ static void check_higher_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_higher_entry_error_on_memory_allocation_failed(void **state) {
+static void check_higher_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     void *data[4] = {
             malloc(1), malloc(1), malloc(1), malloc(1)
@@ -1527,13 +1634,10 @@ check_higher_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_higher_entry(
+    assert_true(seahorse_red_black_tree_map_sr_sr_higher_entry(
             &object, key[0], &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     for (uintmax_t i = 0; i < 2; i++) {
         assert_true(triggerfish_strong_release(key[i]));
@@ -1638,8 +1742,7 @@ static void check_lower_entry(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void
-check_lower_entry_error_on_memory_allocation_failed(void **state) {
+static void check_lower_entry_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     void *data[4] = {
             malloc(1), malloc(1), malloc(1), malloc(1)
@@ -1661,13 +1764,10 @@ check_lower_entry_error_on_memory_allocation_failed(void **state) {
     const struct seahorse_red_black_tree_map_sr_sr_entry *entry;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_map_sr_sr_lower_entry(
+    assert_true(seahorse_red_black_tree_map_sr_sr_lower_entry(
             &object, key[1], &entry));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
     for (uintmax_t i = 0; i < 2; i++) {
         assert_true(triggerfish_strong_release(key[i]));
@@ -2207,6 +2307,482 @@ check_init_red_black_tree_map_sr_sr_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_remove_range(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_sr_sr_remove_range(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_key_is_invalid(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t counter = 0;
+    struct triggerfish_strong *key = (void *) &counter;
+    assert_false(seahorse_red_black_tree_map_sr_sr_remove_range(
+            (void *) 1, key, key));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_INVALID,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_sr_sr_remove_range(
+            &object, key[2], key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_sr_sr_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_map_sr_sr_remove_range(
+            &object, key[7], key[0]));
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_sr_sr_remove_range(
+            &object, key[2], key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_count_range(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_map_sr_sr_count_range(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count_range(
+            &object, key[2], key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count_range(
+            &object, key[0], key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count_range(
+            &object, key[4], key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count_range(
+            &object, key[5], key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count_range(
+            &object, key[2], key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_key_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_split_at(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr other;
+    assert_true(seahorse_red_black_tree_map_sr_sr_split_at(
+            &object, key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_sr_sr_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_sr_sr_contains(
+                &other, key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    assert_true(seahorse_red_black_tree_map_sr_sr_remove(&object, key[7]));
+    struct seahorse_red_black_tree_map_sr_sr other;
+    assert_true(seahorse_red_black_tree_map_sr_sr_split_at(
+            &object, key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    const struct seahorse_red_black_tree_map_sr_sr_entry *entry[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_get_entry(
+                &object, key[i], &entry[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_map_sr_sr_split_at(
+            &object, key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_sr_sr_entry *out;
+        assert_true(seahorse_red_black_tree_map_sr_sr_get_entry(
+                i < 4 ? &object : &other, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_sr_sr_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct seahorse_red_black_tree_map_sr_sr_entry *out;
+        assert_true(seahorse_red_black_tree_map_sr_sr_get_entry(
+                &object, key[i], &out));
+        assert_ptr_equal(out, entry[i]);
+    }
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_map_sr_sr_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr other;
+    assert_true(seahorse_red_black_tree_map_sr_sr_split_at(
+            &object, key[4], &other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_map_sr_sr_contains(
+                &object, key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_map_sr_sr_join(&object, &other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_keys_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    struct seahorse_red_black_tree_map_sr_sr other;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&other, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                    &other, key[i], key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_map_sr_sr_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_KEYS_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct triggerfish_strong *key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_of(
+                (void *)(uintptr_t) (10 * (i + 1)), on_destroy,
+                &key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr object;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init(&object, compare));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_map_sr_sr_add(
+                &object, key[i], key[i]));
+    }
+    struct seahorse_red_black_tree_map_sr_sr other;
+    assert_true(seahorse_red_black_tree_map_sr_sr_split_at(
+            &object, key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_map_sr_sr target;
+    assert_true(seahorse_red_black_tree_map_sr_sr_init_pool(
+            &target, compare, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_map_sr_sr_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_MAP_SR_SR_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_map_sr_sr_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&target));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&other));
+    assert_true(seahorse_red_black_tree_map_sr_sr_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(triggerfish_strong_release(key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
@@ -2219,62 +2795,71 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add_error_on_key_is_invalid),
             cmocka_unit_test(check_add_error_on_value_is_invalid),
             cmocka_unit_test(check_add),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_compare_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_add_error_on_key_already_exists),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_try_add_error_on_object_is_null),
+            cmocka_unit_test(check_try_add_error_on_out_is_null),
+            cmocka_unit_test(check_try_add),
+            cmocka_unit_test(check_try_add_error_on_key_already_exists),
+            cmocka_unit_test(check_try_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_key_is_null),
             cmocka_unit_test(check_remove_error_on_key_is_invalid),
             cmocka_unit_test(check_remove_error_on_key_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_key_is_null),
             cmocka_unit_test(check_contains_error_on_key_is_invalid),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_set_error_on_object_is_null),
             cmocka_unit_test(check_set_error_on_key_is_null),
             cmocka_unit_test(check_set_error_on_key_is_invalid),
             cmocka_unit_test(check_set_error_on_value_is_invalid),
             cmocka_unit_test(check_set_error_on_key_not_found),
             cmocka_unit_test(check_set),
-            cmocka_unit_test(check_set_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_set_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_key_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_key_is_invalid),
             cmocka_unit_test(check_get_error_on_key_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_key_is_invalid),
             cmocka_unit_test(check_ceiling_error_on_key_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_key_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_key_is_invalid),
             cmocka_unit_test(check_floor_error_on_key_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_key_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_key_is_invalid),
             cmocka_unit_test(check_higher_error_on_key_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_key_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_key_is_invalid),
             cmocka_unit_test(check_lower_error_on_key_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_map_is_empty),
@@ -2289,35 +2874,35 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_get_entry_error_on_key_is_invalid),
             cmocka_unit_test(check_get_entry_error_on_key_not_found),
             cmocka_unit_test(check_get_entry),
-            cmocka_unit_test(check_get_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_entry_without_memory_allocation),
             cmocka_unit_test(check_ceiling_entry_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_entry_error_on_key_is_invalid),
             cmocka_unit_test(check_ceiling_entry_error_on_key_not_found),
             cmocka_unit_test(check_ceiling_entry),
-            cmocka_unit_test(check_ceiling_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_entry_without_memory_allocation),
             cmocka_unit_test(check_floor_entry_error_on_object_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_is_null),
             cmocka_unit_test(check_floor_entry_error_on_out_is_null),
             cmocka_unit_test(check_floor_entry_error_on_key_is_invalid),
             cmocka_unit_test(check_floor_entry_error_on_key_not_found),
             cmocka_unit_test(check_floor_entry),
-            cmocka_unit_test(check_floor_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_entry_without_memory_allocation),
             cmocka_unit_test(check_higher_entry_error_on_object_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_is_null),
             cmocka_unit_test(check_higher_entry_error_on_out_is_null),
             cmocka_unit_test(check_higher_entry_error_on_key_is_invalid),
             cmocka_unit_test(check_higher_entry_error_on_key_not_found),
             cmocka_unit_test(check_higher_entry),
-            cmocka_unit_test(check_higher_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_entry_without_memory_allocation),
             cmocka_unit_test(check_lower_entry_error_on_object_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_is_null),
             cmocka_unit_test(check_lower_entry_error_on_out_is_null),
             cmocka_unit_test(check_lower_entry_error_on_key_is_invalid),
             cmocka_unit_test(check_lower_entry_error_on_key_not_found),
             cmocka_unit_test(check_lower_entry),
-            cmocka_unit_test(check_lower_entry_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_entry_without_memory_allocation),
             cmocka_unit_test(check_first_entry_error_on_object_is_null),
             cmocka_unit_test(check_first_entry_error_on_out_is_null),
             cmocka_unit_test(check_first_entry_error_on_map_is_empty),
@@ -2353,6 +2938,27 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_map_sr_sr_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_map_sr_sr),
             cmocka_unit_test(check_init_red_black_tree_map_sr_sr_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range_error_on_key_is_null),
+            cmocka_unit_test(check_remove_range_error_on_key_is_invalid),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_key_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_key_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_keys_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
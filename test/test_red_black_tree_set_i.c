@@ -35,10 +35,64 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_i object;
     assert_true(seahorse_red_black_tree_set_i_init(&object));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    struct sea_turtle_integer value[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_integer_init_uintmax_t(&value[i], i));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_set_i_remove(&object, &value[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_integer_invalidate(&value[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_set_i_count(NULL, (void *) 1));
@@ -60,7 +114,7 @@ static void check_count(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const uintmax_t check = (rand() % UINTMAX_MAX);
     struct seahorse_red_black_tree_set_i object = {
-            .set.tree.count = check
+            .tree.count = check
     };
     uintmax_t count;
     assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
@@ -141,6 +195,79 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_add_take(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_add_take((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 0);
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_intmax_t(
+            &value, rand() % INTMAX_MAX));
+    assert_true(seahorse_red_black_tree_set_i_add_take(&object, &value));
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_already_exists(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_intmax_t(
+            &value, rand() % INTMAX_MAX));
+    assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
+    assert_false(seahorse_red_black_tree_set_i_add_take(&object, &value));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_memory_allocation_failed(void **state) {
+    srand(time(NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    struct sea_turtle_integer value;
+    assert_true(sea_turtle_integer_init_intmax_t(
+            &value, rand() % INTMAX_MAX));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_i_add_take(&object, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(sea_turtle_integer_invalidate(&value));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 
 static void check_remove_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -194,7 +321,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct sea_turtle_integer value;
@@ -205,12 +332,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_i_remove(&object, &value));
+    assert_true(seahorse_red_black_tree_set_i_remove(&object, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_integer_invalidate(&value));
     assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -264,7 +388,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct sea_turtle_integer value;
@@ -275,13 +399,10 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool result;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_i_contains(
+    assert_true(seahorse_red_black_tree_set_i_contains(
             &object, &value, &result));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
     assert_true(sea_turtle_integer_invalidate(&value));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -349,7 +470,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct sea_turtle_integer value;
@@ -361,12 +482,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_integer *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_i_get(&object, &value, &item));
+    assert_true(seahorse_red_black_tree_set_i_get(&object, &value, &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
     assert_true(sea_turtle_integer_invalidate(&value));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -444,7 +562,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const intmax_t values[] = {736, 8912};
     const uintmax_t limit = sizeof(values) / sizeof(intmax_t);
@@ -458,13 +576,10 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_integer *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_i_ceiling(
+    assert_true(seahorse_red_black_tree_set_i_ceiling(
             &object, &value[0], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_integer_invalidate(&value[i]));
     }
@@ -544,7 +659,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const intmax_t values[] = {736, 8912};
     const uintmax_t limit = sizeof(values) / sizeof(intmax_t);
@@ -558,13 +673,10 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_integer *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_i_floor(
+    assert_true(seahorse_red_black_tree_set_i_floor(
             &object, &value[1], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_integer_invalidate(&value[i]));
     }
@@ -644,7 +756,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const intmax_t values[] = {736, 8912};
     const uintmax_t limit = sizeof(values) / sizeof(intmax_t);
@@ -658,13 +770,10 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_integer *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_i_higher(
+    assert_true(seahorse_red_black_tree_set_i_higher(
             &object, &value[0], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_integer_invalidate(&value[i]));
     }
@@ -744,7 +853,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const intmax_t values[] = {736, 8912};
     const uintmax_t limit = sizeof(values) / sizeof(intmax_t);
@@ -758,13 +867,10 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_integer *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_i_lower(
+    assert_true(seahorse_red_black_tree_set_i_lower(
             &object, &value[1], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_integer_invalidate(&value[i]));
     }
@@ -1115,6 +1221,122 @@ static void check_init_set_i_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_sorted_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_sorted(
+            NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_sorted(
+            (void *) 1, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_sorted(
+            (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_values_are_not_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t integers[] = {1, 3, 2};
+    const uintmax_t limit = sizeof(integers) / sizeof(intmax_t);
+    struct sea_turtle_integer values[3];
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(&values[i], integers[i]));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_false(seahorse_red_black_tree_set_i_init_sorted(
+            &object, 3, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_ARE_NOT_SORTED,
+                     seahorse_error);
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_invalidate(&values[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_duplicate_values(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t integers[] = {1, 2, 2};
+    const uintmax_t limit = sizeof(integers) / sizeof(intmax_t);
+    struct sea_turtle_integer values[3];
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(&values[i], integers[i]));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_false(seahorse_red_black_tree_set_i_init_sorted(
+            &object, 3, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_ARE_NOT_SORTED,
+                     seahorse_error);
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_invalidate(&values[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t integers[] = {1, 2, 3};
+    const uintmax_t limit = sizeof(integers) / sizeof(intmax_t);
+    struct sea_turtle_integer values[3];
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(&values[i], integers[i]));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_i_init_sorted(
+            &object, 3, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_invalidate(&values[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t integers[] = {1, 2, 3};
+    const uintmax_t limit = sizeof(integers) / sizeof(intmax_t);
+    struct sea_turtle_integer values[3];
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(&values[i], integers[i]));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init_sorted(
+            &object, limit, values));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &values[i], &out));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(sea_turtle_integer_invalidate(&values[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_as_count(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_i object;
@@ -1588,12 +1810,1066 @@ static void check_as_prev(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_union_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_union(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_union(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_union(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i left;
+    assert_true(seahorse_red_black_tree_set_i_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&left, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i right;
+    assert_true(seahorse_red_black_tree_set_i_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&right, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_i_init_union(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i left;
+    assert_true(seahorse_red_black_tree_set_i_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&left, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i right;
+    assert_true(seahorse_red_black_tree_set_i_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&right, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init_union(
+            &object, &left, &right));
+    const intmax_t c[] = {-3, 1, 2, 4, 5, 9};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, c[i]));
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_integer_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_intersection(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_intersection(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_intersection(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i left;
+    assert_true(seahorse_red_black_tree_set_i_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&left, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i right;
+    assert_true(seahorse_red_black_tree_set_i_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&right, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_i_init_intersection(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i left;
+    assert_true(seahorse_red_black_tree_set_i_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&left, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i right;
+    assert_true(seahorse_red_black_tree_set_i_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&right, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init_intersection(
+            &object, &left, &right));
+    const intmax_t c[] = {1, 5};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, c[i]));
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_integer_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_difference(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_difference(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_init_difference(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i left;
+    assert_true(seahorse_red_black_tree_set_i_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&left, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i right;
+    assert_true(seahorse_red_black_tree_set_i_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&right, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_i_init_difference(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i left;
+    assert_true(seahorse_red_black_tree_set_i_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&left, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i right;
+    assert_true(seahorse_red_black_tree_set_i_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&right, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init_difference(
+            &object, &left, &right));
+    const intmax_t c[] = {-3, 2};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, c[i]));
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_integer_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_is_subset(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_is_subset(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_is_subset(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    const intmax_t c[] = {1, 5};
+    struct seahorse_red_black_tree_set_i left;
+    assert_true(seahorse_red_black_tree_set_i_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&left, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i right;
+    assert_true(seahorse_red_black_tree_set_i_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&right, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i inner;
+    assert_true(seahorse_red_black_tree_set_i_init(&inner));
+    for (uintmax_t i = 0; i < sizeof(c) / sizeof(c[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, c[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&inner, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i empty;
+    assert_true(seahorse_red_black_tree_set_i_init(&empty));
+    bool out;
+    assert_true(seahorse_red_black_tree_set_i_is_subset(&inner, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_i_is_subset(&inner, &right, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_i_is_subset(&left, &inner, &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_i_is_subset(&left, &right, &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_i_is_subset(&empty, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_i_is_subset(&left, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&right));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&inner));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&empty));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_as_add_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_init(&other));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&other, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(seahorse_sorted_set_i_add_all(
+            (struct seahorse_sorted_set_i *) &object,
+            (const struct seahorse_sorted_set_i *) &other));
+    const intmax_t c[] = {-3, 1, 2, 4, 5, 9};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, c[i]));
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_integer_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_as_retain_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_init(&other));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&other, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(seahorse_sorted_set_i_retain_all(
+            (struct seahorse_sorted_set_i *) &object,
+            (const struct seahorse_sorted_set_i *) &other));
+    const intmax_t c[] = {1, 5};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, c[i]));
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_integer_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_as_remove_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_init(&other));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&other, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(seahorse_sorted_set_i_remove_all(
+            (struct seahorse_sorted_set_i *) &object,
+            (const struct seahorse_sorted_set_i *) &other));
+    const intmax_t c[] = {-3, 2};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, c[i]));
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_integer_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_as_add_all_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 4, 5, 9};
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_init(&other));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&other, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_sorted_set_i_add_all(
+            (struct seahorse_sorted_set_i *) &object,
+            (const struct seahorse_sorted_set_i *) &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_as_remove_all_of_itself(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    assert_true(seahorse_sorted_set_i_remove_all(
+            (struct seahorse_sorted_set_i *) &object,
+            (const struct seahorse_sorted_set_i *) &object));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_as_is_subset(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const intmax_t a[] = {-3, 1, 2, 5};
+    const intmax_t b[] = {1, 5};
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, a[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_init(&other));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        struct sea_turtle_integer value;
+        assert_true(sea_turtle_integer_init_intmax_t(&value, b[i]));
+        assert_true(seahorse_red_black_tree_set_i_add(&other, &value));
+        assert_true(sea_turtle_integer_invalidate(&value));
+    }
+    bool out;
+    assert_true(seahorse_sorted_set_i_is_subset(
+            (const struct seahorse_sorted_set_i *) &other,
+            (const struct seahorse_sorted_set_i *) &object, &out));
+    assert_true(out);
+    assert_true(seahorse_sorted_set_i_is_subset(
+            (const struct seahorse_sorted_set_i *) &object,
+            (const struct seahorse_sorted_set_i *) &other, &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_remove_range(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_set_i_remove_range(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_set_i_remove_range(
+            &object, &key[2], &key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_set_i_remove_range(
+            &object, &key[7], &key[0]));
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_i_remove_range(
+            &object, &key[2], &key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_count_range(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_set_i_count_range(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_set_i_count_range(
+            &object, &key[2], &key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_set_i_count_range(
+            &object, &key[0], &key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_set_i_count_range(
+            &object, &key[4], &key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_set_i_count_range(
+            &object, &key[5], &key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_i_count_range(
+            &object, &key[2], &key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_split_at(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_split_at(
+            &object, &key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_i_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &other, &key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_set_i_remove(&object, &key[7]));
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_split_at(
+            &object, &key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_set_i_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    const struct sea_turtle_integer *item[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_get(
+                &object, &key[i], &item[i]));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_i_split_at(
+            &object, &key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct sea_turtle_integer *out;
+        assert_true(seahorse_red_black_tree_set_i_get(
+                i < 4 ? &object : &other, &key[i], &out));
+        assert_ptr_equal(out, item[i]);
+    }
+    assert_true(seahorse_red_black_tree_set_i_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct sea_turtle_integer *out;
+        assert_true(seahorse_red_black_tree_set_i_get(&object, &key[i], &out));
+        assert_ptr_equal(out, item[i]);
+    }
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_i_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_split_at(
+            &object, &key[4], &other));
+    assert_true(seahorse_red_black_tree_set_i_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_i_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_i_contains(
+                &object, &key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_set_i_join(&object, &other));
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_values_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_set_i_add(&other, &key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_set_i_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_VALUES_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_i_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct sea_turtle_integer key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_init_intmax_t(
+                &key[i], (intmax_t) (10 * (i + 1))));
+    }
+    struct seahorse_red_black_tree_set_i object;
+    assert_true(seahorse_red_black_tree_set_i_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_i_add(&object, &key[i]));
+    }
+    struct seahorse_red_black_tree_set_i other;
+    assert_true(seahorse_red_black_tree_set_i_split_at(
+            &object, &key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_set_i target;
+    assert_true(seahorse_red_black_tree_set_i_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_i_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_I_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_i_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_set_i_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&target));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_i_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_integer_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
@@ -1602,46 +2878,51 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_value_already_exists),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_value_is_null),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_value_already_exists),
+            cmocka_unit_test(check_add_take_error_on_memory_allocation_failed),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_value_is_null),
             cmocka_unit_test(check_remove_error_on_value_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_value_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_value_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_item_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_value_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_item_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_value_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_item_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_value_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_item_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_value_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_item_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_set_is_empty),
@@ -1666,6 +2947,13 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_set_i_case_empty_set),
             cmocka_unit_test(check_init_set_i),
             cmocka_unit_test(check_init_set_i_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted_error_on_object_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_count_is_zero),
+            cmocka_unit_test(check_init_sorted_error_on_values_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_values_are_not_sorted),
+            cmocka_unit_test(check_init_sorted_error_on_duplicate_values),
+            cmocka_unit_test(check_init_sorted_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted),
             cmocka_unit_test(check_as_count),
             cmocka_unit_test(check_as_add),
             cmocka_unit_test(check_as_remove),
@@ -1680,6 +2968,51 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_as_remove_item),
             cmocka_unit_test(check_as_next),
             cmocka_unit_test(check_as_prev),
+            cmocka_unit_test(check_init_union_error_on_object_is_null),
+            cmocka_unit_test(check_init_union_error_on_left_is_null),
+            cmocka_unit_test(check_init_union_error_on_right_is_null),
+            cmocka_unit_test(check_init_union_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_union),
+            cmocka_unit_test(check_init_intersection_error_on_object_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_left_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_right_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_intersection),
+            cmocka_unit_test(check_init_difference_error_on_object_is_null),
+            cmocka_unit_test(check_init_difference_error_on_left_is_null),
+            cmocka_unit_test(check_init_difference_error_on_right_is_null),
+            cmocka_unit_test(check_init_difference_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_difference),
+            cmocka_unit_test(check_is_subset_error_on_object_is_null),
+            cmocka_unit_test(check_is_subset_error_on_other_is_null),
+            cmocka_unit_test(check_is_subset_error_on_out_is_null),
+            cmocka_unit_test(check_is_subset),
+            cmocka_unit_test(check_as_add_all),
+            cmocka_unit_test(check_as_retain_all),
+            cmocka_unit_test(check_as_remove_all),
+            cmocka_unit_test(check_as_add_all_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_as_remove_all_of_itself),
+            cmocka_unit_test(check_as_is_subset),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range_error_on_value_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_value_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_value_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_values_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -34,10 +34,57 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
     assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, i));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_set_ni_remove(&object, i));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, i));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_set_ni_count(NULL, (void *)1));
@@ -59,7 +106,7 @@ static void check_count(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const uintmax_t check = (rand() % UINTMAX_MAX);
     struct seahorse_red_black_tree_set_ni object = {
-            .set.tree.count = check
+            .tree.count = check
     };
     uintmax_t count;
     assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
@@ -110,10 +157,12 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
     assert_true(seahorse_red_black_tree_set_ni_init(&object));
-    posix_memalign_is_overridden = true;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
     assert_false(seahorse_red_black_tree_set_ni_add(
             &object, rand() & UINTMAX_MAX));
-    posix_memalign_is_overridden = false;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -156,7 +205,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
@@ -168,12 +217,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_int_equal(count, 1);
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_ni_remove(&object, value));
+    assert_true(seahorse_red_black_tree_set_ni_remove(&object, value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -210,7 +256,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
@@ -219,12 +265,9 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_ni_contains(&object, value, &out));
+    assert_true(seahorse_red_black_tree_set_ni_contains(&object, value, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -274,7 +317,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
@@ -284,12 +327,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_ni_get(&object, value, &out));
+    assert_true(seahorse_red_black_tree_set_ni_get(&object, value, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -347,7 +387,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
     assert_true(seahorse_red_black_tree_set_ni_init(&object));
@@ -356,12 +396,9 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_ni_ceiling(&object, value, &out));
+    assert_true(seahorse_red_black_tree_set_ni_ceiling(&object, value, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -419,7 +456,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
     assert_true(seahorse_red_black_tree_set_ni_init(&object));
@@ -428,12 +465,9 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_ni_floor(&object, value, &out));
+    assert_true(seahorse_red_black_tree_set_ni_floor(&object, value, &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -479,14 +513,15 @@ static void check_higher(void **state) {
     const uintmax_t value = 1 + (rand() % UINTMAX_MAX);
     assert_true(seahorse_red_black_tree_set_ni_add(&object, value));
     const uintmax_t *out;
-    assert_true(seahorse_red_black_tree_set_ni_higher(&object, value - 1, &out));
+    assert_true(seahorse_red_black_tree_set_ni_higher(
+            &object, value - 1, &out));
     assert_ptr_not_equal(out, &value);
     assert_int_equal(*out, value);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
@@ -496,13 +531,10 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_ni_higher(&object, value - 1,
+    assert_true(seahorse_red_black_tree_set_ni_higher(&object, value - 1,
                                                       &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -555,7 +587,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     srand(time(NULL));
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_ni object;
@@ -565,13 +597,10 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     const uintmax_t *out;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_ni_lower(&object, 1 + value,
+    assert_true(seahorse_red_black_tree_set_ni_lower(&object, 1 + value,
                                                       &out));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
@@ -855,12 +884,936 @@ check_init_red_black_tree_set_ni_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_sorted_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_sorted(
+            NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_sorted(
+            (void *) 1, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_sorted(
+            (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_values_are_not_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t values[] = {1, 3, 2};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_false(seahorse_red_black_tree_set_ni_init_sorted(
+            &object, 3, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUES_ARE_NOT_SORTED,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_duplicate_values(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t values[] = {1, 2, 2};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_false(seahorse_red_black_tree_set_ni_init_sorted(
+            &object, 3, values));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUES_ARE_NOT_SORTED,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t values[] = {1, 2, 3};
+    struct seahorse_red_black_tree_set_ni object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_ni_init_sorted(
+            &object, 3, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_sorted(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t values[] = {1, 2, 3};
+    const uintmax_t limit = sizeof(values) / sizeof(uintmax_t);
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init_sorted(
+            &object, limit, values));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &object, values[i], &out));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_union(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_union(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_union(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t a[] = {1, 2, 3, 5};
+    const uintmax_t b[] = {2, 4, 5, 6};
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, a[i]));
+    }
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, b[i]));
+    }
+    struct seahorse_red_black_tree_set_ni object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_ni_init_union(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t a[] = {1, 2, 3, 5};
+    const uintmax_t b[] = {2, 4, 5, 6};
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, a[i]));
+    }
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, b[i]));
+    }
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init_union(
+            &object, &left, &right));
+    const uintmax_t c[] = {1, 2, 3, 4, 5, 6};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &object, c[i], &out));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_intersection(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_intersection(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_intersection(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t a[] = {1, 2, 3, 5};
+    const uintmax_t b[] = {2, 4, 5, 6};
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, a[i]));
+    }
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, b[i]));
+    }
+    struct seahorse_red_black_tree_set_ni object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_ni_init_intersection(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t a[] = {1, 2, 3, 5};
+    const uintmax_t b[] = {2, 4, 5, 6};
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, a[i]));
+    }
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, b[i]));
+    }
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init_intersection(
+            &object, &left, &right));
+    const uintmax_t c[] = {2, 5};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &object, c[i], &out));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_difference(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_difference(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_init_difference(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t a[] = {1, 2, 3, 5};
+    const uintmax_t b[] = {2, 4, 5, 6};
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, a[i]));
+    }
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, b[i]));
+    }
+    struct seahorse_red_black_tree_set_ni object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_ni_init_difference(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t a[] = {1, 2, 3, 5};
+    const uintmax_t b[] = {2, 4, 5, 6};
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, a[i]));
+    }
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, b[i]));
+    }
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init_difference(
+            &object, &left, &right));
+    const uintmax_t c[] = {1, 3};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &object, c[i], &out));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+/*
+ * Walk object in order and confirm that it holds exactly the values below
+ * limit for which is_member is true.
+ */
+static void check_members(
+        const struct seahorse_red_black_tree_set_ni *const object,
+        const uintmax_t limit,
+        bool (*const is_member)(uintmax_t)) {
+    const uintmax_t *item = NULL;
+    for (uintmax_t i = 0; i < limit; i++) {
+        if (!is_member(i)) {
+            continue;
+        }
+        if (!item) {
+            assert_true(seahorse_red_black_tree_set_ni_first(object, &item));
+        } else {
+            assert_true(seahorse_red_black_tree_set_ni_next(item, &item));
+        }
+        assert_int_equal(*item, i);
+    }
+    if (item) {
+        assert_false(seahorse_red_black_tree_set_ni_next(item, &item));
+    } else {
+        assert_false(seahorse_red_black_tree_set_ni_first(object, &item));
+    }
+}
+
+static bool is_in_union(const uintmax_t value) {
+    return !(value % 2) || !(value % 3);
+}
+
+static bool is_in_intersection(const uintmax_t value) {
+    return !(value % 2) && !(value % 3);
+}
+
+static bool is_in_difference(const uintmax_t value) {
+    return !(value % 2) && value % 3;
+}
+
+static void check_init_union_intersection_difference_many(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < 2000; i += 2) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, i));
+    }
+    for (uintmax_t i = 0; i < 2000; i += 3) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, i));
+    }
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init_union(
+            &object, &left, &right));
+    check_members(&object, 2000, is_in_union);
+    assert_true(seahorse_red_black_tree_set_ni_add(&object, 1));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_ni_init_intersection(
+            &object, &left, &right));
+    check_members(&object, 2000, is_in_intersection);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_ni_init_difference(
+            &object, &left, &right));
+    check_members(&object, 2000, is_in_difference);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_is_subset(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_is_subset(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_is_subset(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t a[] = {1, 2, 3, 5};
+    const uintmax_t b[] = {2, 4, 5, 6};
+    const uintmax_t c[] = {2, 5};
+    struct seahorse_red_black_tree_set_ni left;
+    assert_true(seahorse_red_black_tree_set_ni_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&left, a[i]));
+    }
+    struct seahorse_red_black_tree_set_ni right;
+    assert_true(seahorse_red_black_tree_set_ni_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&right, b[i]));
+    }
+    struct seahorse_red_black_tree_set_ni inner;
+    assert_true(seahorse_red_black_tree_set_ni_init(&inner));
+    for (uintmax_t i = 0; i < sizeof(c) / sizeof(c[0]); i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&inner, c[i]));
+    }
+    struct seahorse_red_black_tree_set_ni empty;
+    assert_true(seahorse_red_black_tree_set_ni_init(&empty));
+    bool out;
+    assert_true(seahorse_red_black_tree_set_ni_is_subset(&inner, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_ni_is_subset(&inner, &right, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_ni_is_subset(&left, &inner, &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_ni_is_subset(&left, &right, &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_ni_is_subset(&empty, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_ni_is_subset(&left, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&right));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&inner));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&empty));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_remove_range(NULL, 0, 0));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    assert_true(seahorse_red_black_tree_set_ni_remove_range(
+            &object, key[2], key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_set_ni_remove_range(
+            &object, key[7], key[0]));
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_ni_remove_range(
+            &object, key[2], key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_count_range(
+            NULL, 0, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_count_range(
+            (void *) 1, 0, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_set_ni_count_range(
+            &object, key[2], key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_set_ni_count_range(
+            &object, key[0], key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_set_ni_count_range(
+            &object, key[4], key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_set_ni_count_range(
+            &object, key[5], key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_ni_count_range(
+            &object, key[2], key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_at_rank(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_at_rank((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank_error_on_rank_is_out_of_bounds(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    const uintmax_t *item;
+    assert_false(seahorse_red_black_tree_set_ni_at_rank(&object, 0, &item));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_RANK_IS_OUT_OF_BOUNDS,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_ni_add(&object, 8));
+    assert_false(seahorse_red_black_tree_set_ni_at_rank(&object, 1, &item));
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_RANK_IS_OUT_OF_BOUNDS,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_at_rank(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t limit = 1000;
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(
+                &object, 2 * ((i * 7919) % limit)));
+    }
+    for (uintmax_t i = 0; i < limit; i++) {
+        const uintmax_t *item;
+        assert_true(seahorse_red_black_tree_set_ni_at_rank(
+                &object, i, &item));
+        assert_int_equal(*item, 2 * i);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rank_of_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_rank_of(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rank_of_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_rank_of((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_rank_of(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t limit = 1000;
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_set_ni_rank_of(&object, 8, &out));
+    assert_int_equal(out, 0);
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(
+                &object, 2 * ((i * 7919) % limit)));
+    }
+    for (uintmax_t i = 0; i < limit; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_rank_of(
+                &object, 2 * i, &out));
+        assert_int_equal(out, i);
+        assert_true(seahorse_red_black_tree_set_ni_rank_of(
+                &object, 2 * i + 1, &out));
+        assert_int_equal(out, i + 1);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_split_at(NULL, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_split_at((void *) 1, 0, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    struct seahorse_red_black_tree_set_ni other;
+    assert_true(seahorse_red_black_tree_set_ni_split_at(
+            &object, key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_ni_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &object, key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &other, key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    assert_true(seahorse_red_black_tree_set_ni_remove(&object, key[7]));
+    struct seahorse_red_black_tree_set_ni other;
+    assert_true(seahorse_red_black_tree_set_ni_split_at(
+            &object, key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_set_ni_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    const uintmax_t *item[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_get(
+                &object, key[i], &item[i]));
+    }
+    struct seahorse_red_black_tree_set_ni other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_ni_split_at(
+            &object, key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_red_black_tree_set_ni_get(
+                i < 4 ? &object : &other, key[i], &out));
+        assert_ptr_equal(out, item[i]);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const uintmax_t *out;
+        assert_true(seahorse_red_black_tree_set_ni_get(&object, key[i], &out));
+        assert_ptr_equal(out, item[i]);
+    }
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_ni_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    struct seahorse_red_black_tree_set_ni other;
+    assert_true(seahorse_red_black_tree_set_ni_split_at(
+            &object, key[4], &other));
+    assert_true(seahorse_red_black_tree_set_ni_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_ni_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_ni_contains(
+                &object, key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_set_ni_join(&object, &other));
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_values_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    struct seahorse_red_black_tree_set_ni other;
+    assert_true(seahorse_red_black_tree_set_ni_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_set_ni_add(&other, key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_set_ni_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_VALUES_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_ni_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const uintmax_t key[] = {10, 20, 30, 40, 50, 60, 70, 80};
+    struct seahorse_red_black_tree_set_ni object;
+    assert_true(seahorse_red_black_tree_set_ni_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_ni_add(&object, key[i]));
+    }
+    struct seahorse_red_black_tree_set_ni other;
+    assert_true(seahorse_red_black_tree_set_ni_split_at(
+            &object, key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_set_ni target;
+    assert_true(seahorse_red_black_tree_set_ni_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_ni_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_ni_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_set_ni_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&target));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_ni_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
@@ -870,36 +1823,36 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
             cmocka_unit_test(check_remove_error_on_value_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_item_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_item_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_item_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_item_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_item_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_set_is_empty),
@@ -923,6 +1876,57 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_set_ni_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_set_ni),
             cmocka_unit_test(check_init_red_black_tree_set_ni_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted_error_on_object_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_count_is_zero),
+            cmocka_unit_test(check_init_sorted_error_on_values_is_null),
+            cmocka_unit_test(check_init_sorted_error_on_values_are_not_sorted),
+            cmocka_unit_test(check_init_sorted_error_on_duplicate_values),
+            cmocka_unit_test(check_init_sorted_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_sorted),
+            cmocka_unit_test(check_init_union_error_on_object_is_null),
+            cmocka_unit_test(check_init_union_error_on_left_is_null),
+            cmocka_unit_test(check_init_union_error_on_right_is_null),
+            cmocka_unit_test(check_init_union_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_union),
+            cmocka_unit_test(check_init_intersection_error_on_object_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_left_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_right_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_intersection),
+            cmocka_unit_test(check_init_difference_error_on_object_is_null),
+            cmocka_unit_test(check_init_difference_error_on_left_is_null),
+            cmocka_unit_test(check_init_difference_error_on_right_is_null),
+            cmocka_unit_test(check_init_difference_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_difference),
+            cmocka_unit_test(check_init_union_intersection_difference_many),
+            cmocka_unit_test(check_is_subset_error_on_object_is_null),
+            cmocka_unit_test(check_is_subset_error_on_other_is_null),
+            cmocka_unit_test(check_is_subset_error_on_out_is_null),
+            cmocka_unit_test(check_is_subset),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_at_rank_error_on_object_is_null),
+            cmocka_unit_test(check_at_rank_error_on_out_is_null),
+            cmocka_unit_test(check_at_rank_error_on_rank_is_out_of_bounds),
+            cmocka_unit_test(check_at_rank),
+            cmocka_unit_test(check_rank_of_error_on_object_is_null),
+            cmocka_unit_test(check_rank_of_error_on_out_is_null),
+            cmocka_unit_test(check_rank_of),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_values_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -36,10 +36,71 @@ static void check_init(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     struct seahorse_red_black_tree_set_s object;
     assert_true(seahorse_red_black_tree_set_s_init(&object));
+    assert_int_equal(object.tree.count, 0);
+    assert_null(object.tree.pool);
     assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_init_pool_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_pool(
+            NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool_error_on_pool_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_pool(
+            (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_POOL_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_pool(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init_pool(&object, &pool));
+    assert_ptr_equal(object.tree.pool, &pool);
+    struct sea_turtle_string key[1000];
+    for (uintmax_t i = 0; i < 1000; i++) {
+        const char chars[] = {
+                (char) ('0' + i / 100),
+                (char) ('0' + i / 10 % 10),
+                (char) ('0' + i % 10)
+        };
+        size_t size;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars, sizeof(chars), &size));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_set_s_remove(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i += 2) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    for (uintmax_t i = 0; i < 1000; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 1000);
+    assert_false(seahorse_red_black_tree_pool_invalidate(&pool));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_POOL_ERROR_POOL_IS_IN_USE,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_count_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_set_s_count(NULL, (void *) 1));
@@ -61,7 +122,7 @@ static void check_count(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     const uintmax_t check = (rand() % UINTMAX_MAX);
     struct seahorse_red_black_tree_set_s object = {
-            .set.tree.count = check
+            .tree.count = check
     };
     uintmax_t count;
     assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
@@ -142,6 +203,79 @@ static void check_add_error_on_memory_allocation_failed(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_add_take_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_add_take(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_add_take((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 0);
+    const char chars[] = u8"add";
+    struct sea_turtle_string value;
+    size_t out;
+    assert_true(sea_turtle_string_init(&value, chars, strlen(chars), &out));
+    assert_true(seahorse_red_black_tree_set_s_add_take(&object, &value));
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(sea_turtle_string_invalidate(&value));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_value_already_exists(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char chars[] = u8"add";
+    struct sea_turtle_string value;
+    size_t out;
+    assert_true(sea_turtle_string_init(&value, chars, strlen(chars), &out));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &value));
+    assert_false(seahorse_red_black_tree_set_s_add_take(&object, &value));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_ALREADY_EXISTS,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(sea_turtle_string_invalidate(&value));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_take_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char chars[] = u8"add";
+    struct sea_turtle_string value;
+    size_t out;
+    assert_true(sea_turtle_string_init(&value, chars, strlen(chars), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_s_add_take(&object, &value));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(sea_turtle_string_invalidate(&value));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 static void check_remove_error_on_object_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     assert_false(seahorse_red_black_tree_set_s_remove(NULL, (void *) 1));
@@ -194,7 +328,7 @@ static void check_remove(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_remove_error_on_memory_allocation_failed(void **state) {
+static void check_remove_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     size_t out;
     const char chars[] = u8"remove";
@@ -205,12 +339,9 @@ static void check_remove_error_on_memory_allocation_failed(void **state) {
     assert_true(seahorse_red_black_tree_set_s_add(&object, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_s_remove(&object, &value));
+    assert_true(seahorse_red_black_tree_set_s_remove(&object, &value));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(sea_turtle_string_invalidate(&value));
     assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -264,7 +395,7 @@ static void check_contains(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_contains_error_on_memory_allocation_failed(void **state) {
+static void check_contains_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     size_t out;
     const char chars[] = u8"contains";
@@ -275,13 +406,10 @@ static void check_contains_error_on_memory_allocation_failed(void **state) {
     bool result;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_s_contains(
+    assert_true(seahorse_red_black_tree_set_s_contains(
             &object, &value, &result));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
     assert_true(sea_turtle_string_invalidate(&value));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -349,7 +477,7 @@ static void check_get(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_get_error_on_memory_allocation_failed(void **state) {
+static void check_get_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     size_t out;
     const char chars[] = u8"get";
@@ -361,12 +489,9 @@ static void check_get_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_string *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_s_get(&object, &value, &item));
+    assert_true(seahorse_red_black_tree_set_s_get(&object, &value, &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
     assert_true(sea_turtle_string_invalidate(&value));
     seahorse_error = SEAHORSE_ERROR_NONE;
@@ -448,7 +573,7 @@ static void check_ceiling(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_ceiling_error_on_memory_allocation_failed(void **state) {
+static void check_ceiling_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     size_t out;
     const char *chars[] = {
@@ -466,13 +591,10 @@ static void check_ceiling_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_string *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_s_ceiling(
+    assert_true(seahorse_red_black_tree_set_s_ceiling(
             &object, &value[0], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_string_invalidate(&value[i]));
     }
@@ -556,7 +678,7 @@ static void check_floor(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_floor_error_on_memory_allocation_failed(void **state) {
+static void check_floor_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     size_t out;
     const char *chars[] = {
@@ -574,13 +696,10 @@ static void check_floor_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_string *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_s_floor(
+    assert_true(seahorse_red_black_tree_set_s_floor(
             &object, &value[1], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_string_invalidate(&value[i]));
     }
@@ -664,7 +783,7 @@ static void check_higher(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_higher_error_on_memory_allocation_failed(void **state) {
+static void check_higher_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     size_t out;
     const char *chars[] = {
@@ -682,13 +801,10 @@ static void check_higher_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_string *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_s_higher(
+    assert_true(seahorse_red_black_tree_set_s_higher(
             &object, &value[0], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_string_invalidate(&value[i]));
     }
@@ -772,7 +888,7 @@ static void check_lower(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
-static void check_lower_error_on_memory_allocation_failed(void **state) {
+static void check_lower_without_memory_allocation(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
     size_t out;
     const char *chars[] = {
@@ -790,13 +906,10 @@ static void check_lower_error_on_memory_allocation_failed(void **state) {
     const struct sea_turtle_string *item;
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = true;
-    assert_false(seahorse_red_black_tree_set_s_lower(
+    assert_true(seahorse_red_black_tree_set_s_lower(
             &object, &value[1], &item));
     malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
             = posix_memalign_is_overridden = false;
-    assert_int_equal(
-            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
-            seahorse_error);
     for (uintmax_t i = 0; i < limit; i++) {
         assert_true(sea_turtle_string_invalidate(&value[i]));
     }
@@ -1153,12 +1266,1442 @@ check_init_red_black_tree_set_s_error_on_memory_allocation_failed(
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_remove_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_remove_chars(
+            NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_remove_chars(
+            (void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_error_on_value_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char C[] = u8"c";
+    assert_false(seahorse_red_black_tree_set_s_remove_chars(
+            &object, C, sizeof(C)));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(seahorse_red_black_tree_set_s_remove_chars(
+            &object, B, sizeof(B)));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 1);
+    bool out;
+    assert_true(seahorse_red_black_tree_set_s_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_remove_chars(
+            &object, B, sizeof(B)));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_contains_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_contains_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_contains_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    assert_true(seahorse_red_black_tree_set_s_contains_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_s_contains_chars(
+            &object, C, sizeof(C), &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_contains_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    bool out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_contains_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_get_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_get_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_get_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char C[] = u8"c";
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_red_black_tree_set_s_get_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_red_black_tree_set_s_get_chars(
+            &object, B, sizeof(B), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    const struct sea_turtle_string *check;
+    assert_true(seahorse_red_black_tree_set_s_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_get_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct sea_turtle_string *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_get_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_ceiling_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_ceiling_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_ceiling_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char C[] = u8"c";
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_red_black_tree_set_s_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_red_black_tree_set_s_ceiling_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    const struct sea_turtle_string *check;
+    assert_true(seahorse_red_black_tree_set_s_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_ceiling_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct sea_turtle_string *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_ceiling_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_floor_chars(
+            NULL, (void *) 1, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_floor_chars(
+            (void *) 1, NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_floor_chars(
+            (void *) 1, (void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_error_on_item_not_found(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char C[] = u8"c";
+    const struct sea_turtle_string *out;
+    assert_false(seahorse_red_black_tree_set_s_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_ITEM_NOT_FOUND,
+                     seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char C[] = u8"c";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct sea_turtle_string *out;
+    assert_true(seahorse_red_black_tree_set_s_floor_chars(
+            &object, C, sizeof(C), &out));
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    const struct sea_turtle_string *check;
+    assert_true(seahorse_red_black_tree_set_s_get(&object, &string, &check));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_ptr_equal(out, check);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_floor_chars_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char B[] = u8"b";
+    const char D[] = u8"d";
+    struct sea_turtle_string string;
+    size_t size;
+    assert_true(sea_turtle_string_init(&string, B, sizeof(B), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    assert_true(sea_turtle_string_init(&string, D, sizeof(D), &size));
+    assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+    assert_true(sea_turtle_string_invalidate(&string));
+    const struct sea_turtle_string *out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_floor_chars(
+            &object, B, sizeof(B), &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_chars_order_matches_string_order(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    const char *const chars[] = {
+            u8"abc", u8"", u8"\u00e9", u8"ab", u8"z", u8"a", u8"b",
+            u8"\u00e9a", u8"\u00ff", u8"\u4e2d", u8"\u4e2d\u6587",
+            u8"\U0001F600"
+    };
+    for (uintmax_t i = 0; i < sizeof(chars) / sizeof(chars[0]); i++) {
+        struct sea_turtle_string string;
+        size_t size;
+        assert_true(sea_turtle_string_init(
+                &string, chars[i], strlen(chars[i]), &size));
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &string));
+        assert_true(sea_turtle_string_invalidate(&string));
+    }
+    const struct sea_turtle_string *prev = NULL;
+    uintmax_t visited = 0;
+    const struct sea_turtle_string *item;
+    assert_true(seahorse_red_black_tree_set_s_first(&object, &item));
+    do {
+        if (prev) {
+            assert_true(sea_turtle_string_compare(prev, item) < 0);
+        }
+        prev = item;
+        visited++;
+        uintmax_t size;
+        assert_true(sea_turtle_string_size(item, &size));
+        const char *data;
+        assert_true(sea_turtle_string_char(item, &data));
+        const struct sea_turtle_string *out;
+        assert_true(seahorse_red_black_tree_set_s_get_chars(
+                &object, data, size, &out));
+        assert_ptr_equal(out, item);
+        assert_true(seahorse_red_black_tree_set_s_ceiling_chars(
+                &object, data, size, &out));
+        assert_ptr_equal(out, item);
+        assert_true(seahorse_red_black_tree_set_s_floor_chars(
+                &object, data, size, &out));
+        assert_ptr_equal(out, item);
+    } while (seahorse_red_black_tree_set_s_next(item, &item));
+    assert_int_equal(visited, sizeof(chars) / sizeof(chars[0]));
+    const struct sea_turtle_string *out;
+    const char *data;
+    assert_true(seahorse_red_black_tree_set_s_ceiling_chars(
+            &object, u8"aa", strlen(u8"aa"), &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"ab");
+    assert_true(seahorse_red_black_tree_set_s_floor_chars(
+            &object, u8"abd", strlen(u8"abd"), &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"abc");
+    assert_true(seahorse_red_black_tree_set_s_ceiling_chars(
+            &object, u8"{", strlen(u8"{"), &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"\u00e9");
+    assert_true(seahorse_red_black_tree_set_s_remove_chars(
+            &object, u8"", 0));
+    assert_true(seahorse_red_black_tree_set_s_first(&object, &out));
+    assert_true(sea_turtle_string_char(out, &data));
+    assert_string_equal(data, u8"a");
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_union(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_union(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_union(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char *a[] = {u8"apple", u8"banana", u8"cherry", u8"grape"};
+    const char *b[] = {u8"banana", u8"fig", u8"grape", u8"kiwi"};
+    struct seahorse_red_black_tree_set_s left;
+    assert_true(seahorse_red_black_tree_set_s_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, a[i], strlen(a[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&left, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s right;
+    assert_true(seahorse_red_black_tree_set_s_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, b[i], strlen(b[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&right, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_s_init_union(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_union(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char *a[] = {u8"apple", u8"banana", u8"cherry", u8"grape"};
+    const char *b[] = {u8"banana", u8"fig", u8"grape", u8"kiwi"};
+    struct seahorse_red_black_tree_set_s left;
+    assert_true(seahorse_red_black_tree_set_s_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, a[i], strlen(a[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&left, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s right;
+    assert_true(seahorse_red_black_tree_set_s_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, b[i], strlen(b[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&right, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init_union(
+            &object, &left, &right));
+    const char *c[] = {
+            u8"apple", u8"banana", u8"cherry", u8"fig", u8"grape", u8"kiwi"
+    };
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        size_t size;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, c[i], strlen(c[i]), &size));
+        assert_true(seahorse_red_black_tree_set_s_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_string_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_intersection(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_intersection(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_intersection(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char *a[] = {u8"apple", u8"banana", u8"cherry", u8"grape"};
+    const char *b[] = {u8"banana", u8"fig", u8"grape", u8"kiwi"};
+    struct seahorse_red_black_tree_set_s left;
+    assert_true(seahorse_red_black_tree_set_s_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, a[i], strlen(a[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&left, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s right;
+    assert_true(seahorse_red_black_tree_set_s_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, b[i], strlen(b[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&right, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_s_init_intersection(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_intersection(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char *a[] = {u8"apple", u8"banana", u8"cherry", u8"grape"};
+    const char *b[] = {u8"banana", u8"fig", u8"grape", u8"kiwi"};
+    struct seahorse_red_black_tree_set_s left;
+    assert_true(seahorse_red_black_tree_set_s_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, a[i], strlen(a[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&left, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s right;
+    assert_true(seahorse_red_black_tree_set_s_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, b[i], strlen(b[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&right, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init_intersection(
+            &object, &left, &right));
+    const char *c[] = {u8"banana", u8"grape"};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        size_t size;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, c[i], strlen(c[i]), &size));
+        assert_true(seahorse_red_black_tree_set_s_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_string_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_difference(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_left_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_difference(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_LEFT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_right_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_init_difference(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_RIGHT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char *a[] = {u8"apple", u8"banana", u8"cherry", u8"grape"};
+    const char *b[] = {u8"banana", u8"fig", u8"grape", u8"kiwi"};
+    struct seahorse_red_black_tree_set_s left;
+    assert_true(seahorse_red_black_tree_set_s_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, a[i], strlen(a[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&left, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s right;
+    assert_true(seahorse_red_black_tree_set_s_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, b[i], strlen(b[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&right, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_s_init_difference(
+            &object, &left, &right));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_difference(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char *a[] = {u8"apple", u8"banana", u8"cherry", u8"grape"};
+    const char *b[] = {u8"banana", u8"fig", u8"grape", u8"kiwi"};
+    struct seahorse_red_black_tree_set_s left;
+    assert_true(seahorse_red_black_tree_set_s_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, a[i], strlen(a[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&left, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s right;
+    assert_true(seahorse_red_black_tree_set_s_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, b[i], strlen(b[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&right, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init_difference(
+            &object, &left, &right));
+    const char *c[] = {u8"apple", u8"cherry"};
+    const uintmax_t limit = sizeof(c) / sizeof(c[0]);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, limit);
+    for (uintmax_t i = 0; i < limit; i++) {
+        bool out;
+        size_t size;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, c[i], strlen(c[i]), &size));
+        assert_true(seahorse_red_black_tree_set_s_contains(
+                &object, &value, &out));
+        assert_true(sea_turtle_string_invalidate(&value));
+        assert_true(out);
+    }
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&right));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_is_subset(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_is_subset(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_is_subset(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char *a[] = {u8"apple", u8"banana", u8"cherry", u8"grape"};
+    const char *b[] = {u8"banana", u8"fig", u8"grape", u8"kiwi"};
+    const char *c[] = {u8"banana", u8"grape"};
+    struct seahorse_red_black_tree_set_s left;
+    assert_true(seahorse_red_black_tree_set_s_init(&left));
+    for (uintmax_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, a[i], strlen(a[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&left, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s right;
+    assert_true(seahorse_red_black_tree_set_s_init(&right));
+    for (uintmax_t i = 0; i < sizeof(b) / sizeof(b[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, b[i], strlen(b[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&right, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s inner;
+    assert_true(seahorse_red_black_tree_set_s_init(&inner));
+    for (uintmax_t i = 0; i < sizeof(c) / sizeof(c[0]); i++) {
+        size_t out;
+        struct sea_turtle_string value;
+        assert_true(sea_turtle_string_init(
+                &value, c[i], strlen(c[i]), &out));
+        assert_true(seahorse_red_black_tree_set_s_add(&inner, &value));
+        assert_true(sea_turtle_string_invalidate(&value));
+    }
+    struct seahorse_red_black_tree_set_s empty;
+    assert_true(seahorse_red_black_tree_set_s_init(&empty));
+    bool out;
+    assert_true(seahorse_red_black_tree_set_s_is_subset(&inner, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_s_is_subset(&inner, &right, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_s_is_subset(&left, &inner, &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_s_is_subset(&left, &right, &out));
+    assert_false(out);
+    assert_true(seahorse_red_black_tree_set_s_is_subset(&empty, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_s_is_subset(&left, &left, &out));
+    assert_true(out);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&left));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&right));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&inner));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&empty));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_remove_range(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_remove_range(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_set_s_remove_range(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_set_s_remove_range(
+            &object, &key[2], &key[5]));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_s_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 2 || i > 5));
+    }
+    assert_true(seahorse_red_black_tree_set_s_remove_range(
+            &object, &key[7], &key[0]));
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_remove_range(
+            &object, &key[2], &key[5]));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_count_range(
+            NULL, (void *) 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_count_range(
+            (void *) 1, NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    assert_false(seahorse_red_black_tree_set_s_count_range(
+            (void *) 1, (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_count_range(
+            (void *) 1, (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    uintmax_t out;
+    assert_true(seahorse_red_black_tree_set_s_count_range(
+            &object, &key[2], &key[5], &out));
+    assert_int_equal(out, 4);
+    assert_true(seahorse_red_black_tree_set_s_count_range(
+            &object, &key[0], &key[7], &out));
+    assert_int_equal(out, 8);
+    assert_true(seahorse_red_black_tree_set_s_count_range(
+            &object, &key[4], &key[4], &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_red_black_tree_set_s_count_range(
+            &object, &key[5], &key[2], &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_range_without_memory_allocation(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    uintmax_t out;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_count_range(
+            &object, &key[2], &key[5], &out));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_split_at(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_value_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_split_at(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUE_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_split_at(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    struct seahorse_red_black_tree_set_s other;
+    assert_true(seahorse_red_black_tree_set_s_split_at(
+            &object, &key[4], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_s_count(&other, &count));
+    assert_int_equal(count, 4);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_s_contains(
+                &object, &key[i], &out));
+        assert_true(out == (i < 4));
+    }
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_s_contains(
+                &other, &key[i], &out));
+        assert_true(out == (i >= 4));
+    }
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_past_last(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    assert_true(seahorse_red_black_tree_set_s_remove(&object, &key[7]));
+    struct seahorse_red_black_tree_set_s other;
+    assert_true(seahorse_red_black_tree_set_s_split_at(
+            &object, &key[7], &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 7);
+    assert_true(seahorse_red_black_tree_set_s_count(&other, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_split_at_relinks_entries(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    const struct sea_turtle_string *item[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_get(
+                &object, &key[i], &item[i]));
+    }
+    struct seahorse_red_black_tree_set_s other;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_true(seahorse_red_black_tree_set_s_split_at(
+            &object, &key[4], &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct sea_turtle_string *out;
+        assert_true(seahorse_red_black_tree_set_s_get(
+                i < 4 ? &object : &other, &key[i], &out));
+        assert_ptr_equal(out, item[i]);
+    }
+    assert_true(seahorse_red_black_tree_set_s_join(&object, &other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        const struct sea_turtle_string *out;
+        assert_true(seahorse_red_black_tree_set_s_get(&object, &key[i], &out));
+        assert_ptr_equal(out, item[i]);
+    }
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_join(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_red_black_tree_set_s_join((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    struct seahorse_red_black_tree_set_s other;
+    assert_true(seahorse_red_black_tree_set_s_split_at(
+            &object, &key[4], &other));
+    assert_true(seahorse_red_black_tree_set_s_join(&object, &other));
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_s_count(&other, &count));
+    assert_int_equal(count, 0);
+    for (uintmax_t i = 0; i < 8; i++) {
+        bool out;
+        assert_true(seahorse_red_black_tree_set_s_contains(
+                &object, &key[i], &out));
+        assert_true(out == (true));
+    }
+    assert_true(seahorse_red_black_tree_set_s_join(&object, &other));
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_values_overlap(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    struct seahorse_red_black_tree_set_s other;
+    assert_true(seahorse_red_black_tree_set_s_init(&other));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+        if (i >= 4) {
+            assert_true(seahorse_red_black_tree_set_s_add(&other, &key[i]));
+        }
+    }
+    assert_false(seahorse_red_black_tree_set_s_join(&object, &other));
+    assert_int_equal(SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_VALUES_OVERLAP,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&object, &count));
+    assert_int_equal(count, 8);
+    assert_true(seahorse_red_black_tree_set_s_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_join_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    const char chars[][5] = {
+            u8"key1", u8"key2", u8"key3", u8"key4",
+            u8"key5", u8"key6", u8"key7", u8"key8"
+    };
+    struct sea_turtle_string key[8];
+    for (uintmax_t i = 0; i < 8; i++) {
+        size_t out;
+        assert_true(sea_turtle_string_init(
+                &key[i], chars[i], strlen(chars[i]), &out));
+    }
+    struct seahorse_red_black_tree_set_s object;
+    assert_true(seahorse_red_black_tree_set_s_init(&object));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(seahorse_red_black_tree_set_s_add(&object, &key[i]));
+    }
+    struct seahorse_red_black_tree_set_s other;
+    assert_true(seahorse_red_black_tree_set_s_split_at(
+            &object, &key[4], &other));
+    struct seahorse_red_black_tree_pool pool;
+    assert_true(seahorse_red_black_tree_pool_init(&pool));
+    struct seahorse_red_black_tree_set_s target;
+    assert_true(seahorse_red_black_tree_set_s_init_pool(&target, &pool));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_red_black_tree_set_s_join(&target, &other));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_RED_BLACK_TREE_SET_S_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_red_black_tree_set_s_count(&target, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_red_black_tree_set_s_count(&other, &count));
+    assert_int_equal(count, 4);
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&target));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&other));
+    assert_true(seahorse_red_black_tree_set_s_invalidate(&object));
+    assert_true(seahorse_red_black_tree_pool_invalidate(&pool));
+    for (uintmax_t i = 0; i < 8; i++) {
+        assert_true(sea_turtle_string_invalidate(&key[i]));
+    }
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_invalidate_error_on_object_is_null),
             cmocka_unit_test(check_invalidate),
             cmocka_unit_test(check_init_error_on_object_is_null),
             cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_pool_error_on_object_is_null),
+            cmocka_unit_test(check_init_pool_error_on_pool_is_null),
+            cmocka_unit_test(check_init_pool),
             cmocka_unit_test(check_count_error_on_object_is_null),
             cmocka_unit_test(check_count_error_on_out_is_null),
             cmocka_unit_test(check_count),
@@ -1167,46 +2710,51 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_add),
             cmocka_unit_test(check_add_error_on_value_already_exists),
             cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_take_error_on_object_is_null),
+            cmocka_unit_test(check_add_take_error_on_value_is_null),
+            cmocka_unit_test(check_add_take),
+            cmocka_unit_test(check_add_take_error_on_value_already_exists),
+            cmocka_unit_test(check_add_take_error_on_memory_allocation_failed),
             cmocka_unit_test(check_remove_error_on_object_is_null),
             cmocka_unit_test(check_remove_error_on_value_is_null),
             cmocka_unit_test(check_remove_error_on_value_not_found),
             cmocka_unit_test(check_remove),
-            cmocka_unit_test(check_remove_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_without_memory_allocation),
             cmocka_unit_test(check_contains_error_on_object_is_null),
             cmocka_unit_test(check_contains_error_on_value_is_null),
             cmocka_unit_test(check_contains_error_on_out_is_null),
             cmocka_unit_test(check_contains),
-            cmocka_unit_test(check_contains_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_contains_without_memory_allocation),
             cmocka_unit_test(check_get_error_on_object_is_null),
             cmocka_unit_test(check_get_error_on_value_is_null),
             cmocka_unit_test(check_get_error_on_out_is_null),
             cmocka_unit_test(check_get_error_on_item_not_found),
             cmocka_unit_test(check_get),
-            cmocka_unit_test(check_get_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_get_without_memory_allocation),
             cmocka_unit_test(check_ceiling_error_on_object_is_null),
             cmocka_unit_test(check_ceiling_error_on_value_is_null),
             cmocka_unit_test(check_ceiling_error_on_out_is_null),
             cmocka_unit_test(check_ceiling_error_on_item_not_found),
             cmocka_unit_test(check_ceiling),
-            cmocka_unit_test(check_ceiling_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_ceiling_without_memory_allocation),
             cmocka_unit_test(check_floor_error_on_object_is_null),
             cmocka_unit_test(check_floor_error_on_value_is_null),
             cmocka_unit_test(check_floor_error_on_out_is_null),
             cmocka_unit_test(check_floor_error_on_item_not_found),
             cmocka_unit_test(check_floor),
-            cmocka_unit_test(check_floor_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_floor_without_memory_allocation),
             cmocka_unit_test(check_higher_error_on_object_is_null),
             cmocka_unit_test(check_higher_error_on_value_is_null),
             cmocka_unit_test(check_higher_error_on_out_is_null),
             cmocka_unit_test(check_higher_error_on_item_not_found),
             cmocka_unit_test(check_higher),
-            cmocka_unit_test(check_higher_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_higher_without_memory_allocation),
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_value_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
             cmocka_unit_test(check_lower_error_on_item_not_found),
             cmocka_unit_test(check_lower),
-            cmocka_unit_test(check_lower_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_lower_without_memory_allocation),
             cmocka_unit_test(check_first_error_on_object_is_null),
             cmocka_unit_test(check_first_error_on_out_is_null),
             cmocka_unit_test(check_first_error_on_set_is_empty),
@@ -1230,6 +2778,74 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_init_red_black_tree_set_s_error_on_other_is_null),
             cmocka_unit_test(check_init_red_black_tree_set_s),
             cmocka_unit_test(check_init_red_black_tree_set_s_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_remove_chars_error_on_object_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_value_is_null),
+            cmocka_unit_test(check_remove_chars_error_on_value_not_found),
+            cmocka_unit_test(check_remove_chars),
+            cmocka_unit_test(check_remove_chars_without_memory_allocation),
+            cmocka_unit_test(check_contains_chars_error_on_object_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_value_is_null),
+            cmocka_unit_test(check_contains_chars_error_on_out_is_null),
+            cmocka_unit_test(check_contains_chars),
+            cmocka_unit_test(check_contains_chars_without_memory_allocation),
+            cmocka_unit_test(check_get_chars_error_on_object_is_null),
+            cmocka_unit_test(check_get_chars_error_on_value_is_null),
+            cmocka_unit_test(check_get_chars_error_on_out_is_null),
+            cmocka_unit_test(check_get_chars_error_on_item_not_found),
+            cmocka_unit_test(check_get_chars),
+            cmocka_unit_test(check_get_chars_without_memory_allocation),
+            cmocka_unit_test(check_ceiling_chars_error_on_object_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_value_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_out_is_null),
+            cmocka_unit_test(check_ceiling_chars_error_on_item_not_found),
+            cmocka_unit_test(check_ceiling_chars),
+            cmocka_unit_test(check_ceiling_chars_without_memory_allocation),
+            cmocka_unit_test(check_floor_chars_error_on_object_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_value_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_out_is_null),
+            cmocka_unit_test(check_floor_chars_error_on_item_not_found),
+            cmocka_unit_test(check_floor_chars),
+            cmocka_unit_test(check_floor_chars_without_memory_allocation),
+            cmocka_unit_test(check_chars_order_matches_string_order),
+            cmocka_unit_test(check_init_union_error_on_object_is_null),
+            cmocka_unit_test(check_init_union_error_on_left_is_null),
+            cmocka_unit_test(check_init_union_error_on_right_is_null),
+            cmocka_unit_test(check_init_union_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_union),
+            cmocka_unit_test(check_init_intersection_error_on_object_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_left_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_right_is_null),
+            cmocka_unit_test(check_init_intersection_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_intersection),
+            cmocka_unit_test(check_init_difference_error_on_object_is_null),
+            cmocka_unit_test(check_init_difference_error_on_left_is_null),
+            cmocka_unit_test(check_init_difference_error_on_right_is_null),
+            cmocka_unit_test(check_init_difference_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init_difference),
+            cmocka_unit_test(check_is_subset_error_on_object_is_null),
+            cmocka_unit_test(check_is_subset_error_on_other_is_null),
+            cmocka_unit_test(check_is_subset_error_on_out_is_null),
+            cmocka_unit_test(check_is_subset),
+            cmocka_unit_test(check_remove_range_error_on_object_is_null),
+            cmocka_unit_test(check_remove_range_error_on_value_is_null),
+            cmocka_unit_test(check_remove_range),
+            cmocka_unit_test(check_remove_range_without_memory_allocation),
+            cmocka_unit_test(check_count_range_error_on_object_is_null),
+            cmocka_unit_test(check_count_range_error_on_value_is_null),
+            cmocka_unit_test(check_count_range_error_on_out_is_null),
+            cmocka_unit_test(check_count_range),
+            cmocka_unit_test(check_count_range_without_memory_allocation),
+            cmocka_unit_test(check_split_at_error_on_object_is_null),
+            cmocka_unit_test(check_split_at_error_on_value_is_null),
+            cmocka_unit_test(check_split_at_error_on_out_is_null),
+            cmocka_unit_test(check_split_at),
+            cmocka_unit_test(check_split_at_past_last),
+            cmocka_unit_test(check_split_at_relinks_entries),
+            cmocka_unit_test(check_join_error_on_object_is_null),
+            cmocka_unit_test(check_join_error_on_other_is_null),
+            cmocka_unit_test(check_join),
+            cmocka_unit_test(check_join_error_on_values_overlap),
+            cmocka_unit_test(check_join_error_on_memory_allocation_failed),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,390 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           1000
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_invalidate(NULL));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object = {};
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_init(NULL));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.capacity, 0);
+    assert_null(object.items);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_ring_queue_ni_add(&object, 1));
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_add(NULL, 0));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_ring_queue_ni_add(&object, 1));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    assert_true(seahorse_ring_queue_ni_add(&object, 1));
+    assert_int_equal(object.count, 1);
+    assert_int_equal(object.capacity, 8);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_grows_wrapped(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    /* move the head so that the items wrap around before growing */
+    for (uintmax_t i = 0; i < 5; i++) {
+        assert_true(seahorse_ring_queue_ni_add(&object, i));
+    }
+    for (uintmax_t i = 0; i < 5; i++) {
+        uintmax_t out;
+        assert_true(seahorse_ring_queue_ni_remove(&object, &out));
+    }
+    for (uintmax_t i = 0; i < 20; i++) {
+        assert_true(seahorse_ring_queue_ni_add(&object, i));
+    }
+    assert_int_equal(object.capacity, 32);
+    for (uintmax_t i = 0; i < 20; i++) {
+        uintmax_t out;
+        assert_true(seahorse_ring_queue_ni_remove(&object, &out));
+        assert_int_equal(out, i);
+    }
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_add_all(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_all_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_add_all((void *) 1, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_all_error_on_values_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_add_all((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_VALUES_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_all_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    const uintmax_t values[] = {1, 2, 3};
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_ring_queue_ni_add_all(&object, 3, values));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_MEMORY_ALLOCATION_FAILED,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    uintmax_t values[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        values[i] = i;
+    }
+    assert_true(seahorse_ring_queue_ni_add(&object, LIMIT));
+    assert_true(seahorse_ring_queue_ni_add_all(&object, LIMIT, values));
+    uintmax_t count;
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 1 + LIMIT);
+    uintmax_t out;
+    assert_true(seahorse_ring_queue_ni_remove(&object, &out));
+    assert_int_equal(out, LIMIT);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_ring_queue_ni_remove(&object, &out));
+        assert_int_equal(out, i);
+    }
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_remove(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_remove((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_error_on_queue_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_ring_queue_ni_remove(&object, &out));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_QUEUE_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    for (uintmax_t round = 0; round < LIMIT; round++) {
+        for (uintmax_t i = 0; i < 3; i++) {
+            assert_true(seahorse_ring_queue_ni_add(&object, round + i));
+        }
+        for (uintmax_t i = 0; i < 3; i++) {
+            uintmax_t out;
+            assert_true(seahorse_ring_queue_ni_remove(&object, &out));
+            assert_int_equal(out, round + i);
+        }
+    }
+    /* steady state traffic never grows the buffer */
+    assert_int_equal(object.capacity, 8);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_remove_all(NULL, 1, (void *) 1));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_all_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_remove_all((void *) 1, 0, (void *) 1));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_all_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_remove_all((void *) 1, 1, NULL));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_all_error_on_count_is_out_of_bounds(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    assert_true(seahorse_ring_queue_ni_add(&object, 1));
+    uintmax_t out[2];
+    assert_false(seahorse_ring_queue_ni_remove_all(&object, 2, out));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_COUNT_IS_OUT_OF_BOUNDS,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_all(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    const uintmax_t values[] = {1, 2, 3, 4, 5, 6};
+    uintmax_t out[6];
+    for (uintmax_t round = 0; round < 10; round++) {
+        assert_true(seahorse_ring_queue_ni_add_all(&object, 6, values));
+        assert_true(seahorse_ring_queue_ni_remove_all(&object, 4, out));
+        assert_memory_equal(out, values, 4 * sizeof(uintmax_t));
+        assert_true(seahorse_ring_queue_ni_remove_all(&object, 2, out));
+        assert_memory_equal(out, &values[4], 2 * sizeof(uintmax_t));
+    }
+    uintmax_t count;
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_peek(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_ring_queue_ni_peek((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek_error_on_queue_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    uintmax_t out;
+    assert_false(seahorse_ring_queue_ni_peek(&object, &out));
+    assert_int_equal(SEAHORSE_RING_QUEUE_NI_ERROR_QUEUE_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_peek(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_ring_queue_ni object;
+    assert_true(seahorse_ring_queue_ni_init(&object));
+    assert_true(seahorse_ring_queue_ni_add(&object, 7));
+    assert_true(seahorse_ring_queue_ni_add(&object, 8));
+    uintmax_t out;
+    assert_true(seahorse_ring_queue_ni_peek(&object, &out));
+    assert_int_equal(out, 7);
+    uintmax_t count;
+    assert_true(seahorse_ring_queue_ni_count(&object, &count));
+    assert_int_equal(count, 2);
+    assert_true(seahorse_ring_queue_ni_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_add_error_on_object_is_null),
+            cmocka_unit_test(check_add_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add),
+            cmocka_unit_test(check_add_grows_wrapped),
+            cmocka_unit_test(check_add_all_error_on_object_is_null),
+            cmocka_unit_test(check_add_all_error_on_count_is_zero),
+            cmocka_unit_test(check_add_all_error_on_values_is_null),
+            cmocka_unit_test(check_add_all_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_add_all),
+            cmocka_unit_test(check_remove_error_on_object_is_null),
+            cmocka_unit_test(check_remove_error_on_out_is_null),
+            cmocka_unit_test(check_remove_error_on_queue_is_empty),
+            cmocka_unit_test(check_remove),
+            cmocka_unit_test(check_remove_all_error_on_object_is_null),
+            cmocka_unit_test(check_remove_all_error_on_count_is_zero),
+            cmocka_unit_test(check_remove_all_error_on_out_is_null),
+            cmocka_unit_test(check_remove_all_error_on_count_is_out_of_bounds),
+            cmocka_unit_test(check_remove_all),
+            cmocka_unit_test(check_peek_error_on_object_is_null),
+            cmocka_unit_test(check_peek_error_on_out_is_null),
+            cmocka_unit_test(check_peek_error_on_queue_is_empty),
+            cmocka_unit_test(check_peek),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -294,6 +294,81 @@ static void check_lower_error_on_out_is_null(void **state) {
     seahorse_error = SEAHORSE_ERROR_NONE;
 }
 
+static void check_add_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_add_all(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_add_all_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_add_all((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_retain_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_retain_all(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_retain_all_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_retain_all((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_all_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_remove_all(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_remove_all_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_remove_all((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_is_subset(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_other_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_is_subset(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OTHER_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_is_subset_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_sorted_set_i_is_subset(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_SORTED_SET_I_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_count_error_on_object_is_null),
@@ -332,6 +407,15 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_lower_error_on_object_is_null),
             cmocka_unit_test(check_lower_error_on_value_is_null),
             cmocka_unit_test(check_lower_error_on_out_is_null),
+            cmocka_unit_test(check_add_all_error_on_object_is_null),
+            cmocka_unit_test(check_add_all_error_on_other_is_null),
+            cmocka_unit_test(check_retain_all_error_on_object_is_null),
+            cmocka_unit_test(check_retain_all_error_on_other_is_null),
+            cmocka_unit_test(check_remove_all_error_on_object_is_null),
+            cmocka_unit_test(check_remove_all_error_on_other_is_null),
+            cmocka_unit_test(check_is_subset_error_on_object_is_null),
+            cmocka_unit_test(check_is_subset_error_on_other_is_null),
+            cmocka_unit_test(check_is_subset_error_on_out_is_null),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,593 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           1000
+#define BATCH                           16
+
+static uintmax_t destroyed;
+
+static void on_destroy(void *item) {
+    destroyed++;
+}
+
+/* xorshift so that every run checks the same deadlines */
+static uint64_t random_next(void) {
+    static uint64_t state = 88172645463325252ULL;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_invalidate(NULL, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object = {};
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate_with_on_destroy(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(&object, 0, NULL, &entry));
+    assert_true(seahorse_timer_wheel_p_schedule(&object, 10, NULL, &entry));
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, UINTMAX_MAX, NULL, &entry));
+    destroyed = 0;
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, on_destroy));
+    assert_int_equal(destroyed, 3);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_init(NULL, 0));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_timer_wheel_p_init(&object, 0));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_TIMER_WHEEL_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 42));
+    assert_non_null(object.data);
+    assert_int_equal(object.count, 0);
+    assert_int_equal(object.now, 42);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    uintmax_t count;
+    assert_true(seahorse_timer_wheel_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_timer_wheel_p_schedule(&object, 1, NULL, &entry));
+    assert_true(seahorse_timer_wheel_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_now_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_now(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_now_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_now((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_now(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    uintmax_t now;
+    assert_true(seahorse_timer_wheel_p_now(&object, &now));
+    assert_int_equal(now, 0);
+    void *items[1];
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_advance(&object, 100, 1, items, &out));
+    assert_true(seahorse_timer_wheel_p_now(&object, &now));
+    assert_int_equal(now, 100);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_schedule_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_schedule(NULL, 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_schedule_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_schedule((void *) 1, 1, NULL, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_schedule_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_timer_wheel_p_schedule(&object, 1, NULL, &entry));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_TIMER_WHEEL_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_schedule(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, 100, (void *) 1, &entry));
+    assert_non_null(entry);
+    void *items[2];
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_advance(&object, 99, 2, items, &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_timer_wheel_p_advance(&object, 100, 2, items, &out));
+    assert_int_equal(out, 1);
+    assert_ptr_equal(items[0], (void *) 1);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_schedule_in_the_past(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 50));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, 10, (void *) 1, &entry));
+    void *items[1];
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_advance(&object, 50, 1, items, &out));
+    assert_int_equal(out, 1);
+    assert_ptr_equal(items[0], (void *) 1);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_schedule_far_future(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, UINTMAX_MAX, (void *) 1, &entry));
+    void *items[1];
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_advance(
+            &object, UINTMAX_MAX - 1, 1, items, &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_timer_wheel_p_advance(
+            &object, UINTMAX_MAX, 1, items, &out));
+    assert_int_equal(out, 1);
+    assert_ptr_equal(items[0], (void *) 1);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_cancel_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_cancel(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_cancel_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_cancel((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_cancel(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, 100, (void *) 1, &entry));
+    assert_true(seahorse_timer_wheel_p_cancel(&object, entry));
+    assert_int_equal(object.count, 0);
+    void *items[1];
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_advance(&object, 1000, 1, items, &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_reschedule_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_reschedule(NULL, (void *) 1, 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_reschedule_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_reschedule((void *) 1, NULL, 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_reschedule(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, 100, (void *) 1, &entry));
+    assert_true(seahorse_timer_wheel_p_reschedule(&object, entry, 5000));
+    uintmax_t deadline;
+    assert_true(seahorse_timer_wheel_p_entry_deadline(
+            &object, entry, &deadline));
+    assert_int_equal(deadline, 5000);
+    void *items[1];
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_advance(&object, 4999, 1, items, &out));
+    assert_int_equal(out, 0);
+    /* pull it in again, before the current time */
+    assert_true(seahorse_timer_wheel_p_reschedule(&object, entry, 10));
+    assert_true(seahorse_timer_wheel_p_advance(&object, 4999, 1, items, &out));
+    assert_int_equal(out, 1);
+    assert_ptr_equal(items[0], (void *) 1);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_reschedule_due_entry(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, 0, (void *) 1, &entry));
+    /* due but not yet handed out */
+    assert_true(seahorse_timer_wheel_p_reschedule(&object, entry, 10));
+    void *items[1];
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_advance(&object, 9, 1, items, &out));
+    assert_int_equal(out, 0);
+    assert_true(seahorse_timer_wheel_p_advance(&object, 10, 1, items, &out));
+    assert_int_equal(out, 1);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_advance_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_advance(
+            NULL, 1, 1, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_advance_error_on_count_is_zero(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_advance(
+            (void *) 1, 1, 0, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_COUNT_IS_ZERO,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_advance_error_on_items_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_advance(
+            (void *) 1, 1, 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_ITEMS_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_advance_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_advance(
+            (void *) 1, 1, 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_advance_error_on_now_is_out_of_bounds(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 10));
+    void *items[1];
+    uintmax_t out;
+    assert_false(seahorse_timer_wheel_p_advance(&object, 9, 1, items, &out));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_NOW_IS_OUT_OF_BOUNDS,
+                     seahorse_error);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_advance_in_batches(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_timer_wheel_p_schedule(
+                &object, 1 + i % 7, (void *) i, &entry));
+    }
+    bool seen[LIMIT] = {false};
+    void *items[BATCH];
+    uintmax_t out;
+    uintmax_t total = 0;
+    do {
+        assert_true(seahorse_timer_wheel_p_advance(
+                &object, 7, BATCH, items, &out));
+        assert_true(out <= BATCH);
+        for (uintmax_t i = 0; i < out; i++) {
+            assert_false(seen[(uintptr_t) items[i]]);
+            seen[(uintptr_t) items[i]] = true;
+        }
+        total += out;
+    } while (out);
+    assert_int_equal(total, LIMIT);
+    assert_int_equal(object.count, 0);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_advance(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    /* deadlines spread over every level of the wheel */
+    uintmax_t deadlines[LIMIT];
+    bool scheduled[LIMIT];
+    const struct seahorse_timer_wheel_p_entry *entries[LIMIT];
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        deadlines[i] = random_next() >> (random_next() % 64);
+        scheduled[i] = true;
+        assert_true(seahorse_timer_wheel_p_schedule(
+                &object, deadlines[i], (void *) i, &entries[i]));
+    }
+    uintmax_t now = 0;
+    for (uintmax_t round = 0; round < 4 * 64; round++) {
+        const uintmax_t i = random_next() % LIMIT;
+        if (scheduled[i] && deadlines[i] > now) {
+            if (round % 2) {
+                assert_true(seahorse_timer_wheel_p_cancel(&object, entries[i]));
+                scheduled[i] = false;
+            } else {
+                deadlines[i] = now + (random_next() >> (random_next() % 64));
+                if (deadlines[i] < now) {
+                    deadlines[i] = UINTMAX_MAX;
+                }
+                assert_true(seahorse_timer_wheel_p_reschedule(
+                        &object, entries[i], deadlines[i]));
+            }
+        }
+        /* steps grow from single ticks to spanning the top level */
+        const uintmax_t step = random_next() >> (63 - round / 4);
+        now = UINTMAX_MAX - now > step ? now + step : UINTMAX_MAX;
+        void *items[BATCH];
+        uintmax_t out;
+        do {
+            assert_true(seahorse_timer_wheel_p_advance(
+                    &object, now, BATCH, items, &out));
+            for (uintmax_t j = 0; j < out; j++) {
+                const uintptr_t k = (uintptr_t) items[j];
+                assert_true(scheduled[k]);
+                assert_true(deadlines[k] <= now);
+                scheduled[k] = false;
+            }
+        } while (out);
+        for (uintmax_t j = 0; j < LIMIT; j++) {
+            assert_false(scheduled[j] && deadlines[j] <= now);
+        }
+    }
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_deadline_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_entry_deadline(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_deadline_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_entry_deadline(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_deadline_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_entry_deadline(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_deadline(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(&object, 123, NULL, &entry));
+    uintmax_t out;
+    assert_true(seahorse_timer_wheel_p_entry_deadline(&object, entry, &out));
+    assert_int_equal(out, 123);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_item_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_entry_item(
+            NULL, (void *) 1, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_item_error_on_entry_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_entry_item(
+            (void *) 1, NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_ENTRY_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_item_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_timer_wheel_p_entry_item(
+            (void *) 1, (void *) 1, NULL));
+    assert_int_equal(SEAHORSE_TIMER_WHEEL_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_entry_item(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_timer_wheel_p object;
+    assert_true(seahorse_timer_wheel_p_init(&object, 0));
+    const struct seahorse_timer_wheel_p_entry *entry;
+    assert_true(seahorse_timer_wheel_p_schedule(
+            &object, 123, (void *) 7, &entry));
+    void *out;
+    assert_true(seahorse_timer_wheel_p_entry_item(&object, entry, &out));
+    assert_ptr_equal(out, (void *) 7);
+    assert_true(seahorse_timer_wheel_p_invalidate(&object, NULL));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_invalidate_with_on_destroy),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_now_error_on_object_is_null),
+            cmocka_unit_test(check_now_error_on_out_is_null),
+            cmocka_unit_test(check_now),
+            cmocka_unit_test(check_schedule_error_on_object_is_null),
+            cmocka_unit_test(check_schedule_error_on_out_is_null),
+            cmocka_unit_test(check_schedule_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_schedule),
+            cmocka_unit_test(check_schedule_in_the_past),
+            cmocka_unit_test(check_schedule_far_future),
+            cmocka_unit_test(check_cancel_error_on_object_is_null),
+            cmocka_unit_test(check_cancel_error_on_entry_is_null),
+            cmocka_unit_test(check_cancel),
+            cmocka_unit_test(check_reschedule_error_on_object_is_null),
+            cmocka_unit_test(check_reschedule_error_on_entry_is_null),
+            cmocka_unit_test(check_reschedule),
+            cmocka_unit_test(check_reschedule_due_entry),
+            cmocka_unit_test(check_advance_error_on_object_is_null),
+            cmocka_unit_test(check_advance_error_on_count_is_zero),
+            cmocka_unit_test(check_advance_error_on_items_is_null),
+            cmocka_unit_test(check_advance_error_on_out_is_null),
+            cmocka_unit_test(check_advance_error_on_now_is_out_of_bounds),
+            cmocka_unit_test(check_advance_in_batches),
+            cmocka_unit_test(check_advance),
+            cmocka_unit_test(check_entry_deadline_error_on_object_is_null),
+            cmocka_unit_test(check_entry_deadline_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_deadline_error_on_out_is_null),
+            cmocka_unit_test(check_entry_deadline),
+            cmocka_unit_test(check_entry_item_error_on_object_is_null),
+            cmocka_unit_test(check_entry_item_error_on_entry_is_null),
+            cmocka_unit_test(check_entry_item_error_on_out_is_null),
+            cmocka_unit_test(check_entry_item),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
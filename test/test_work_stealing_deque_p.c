@@ -0,0 +1,356 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <seahorse.h>
+
+#include <test/cmocka.h>
+
+#define LIMIT                           10000
+#define THIEVES                         4
+
+struct context {
+    struct seahorse_work_stealing_deque_p *object;
+    atomic_uintmax_t taken[LIMIT];
+    atomic_bool done;
+};
+
+static void *steal_all(void *argument) {
+    struct context *const context = argument;
+    for (;;) {
+        /* read done first so that the deque is drained once more after */
+        const bool done = atomic_load(&context->done);
+        void *out;
+        while (seahorse_work_stealing_deque_p_steal(context->object, &out)) {
+            atomic_fetch_add(&context->taken[(uintptr_t) out], 1);
+        }
+        if (done) {
+            return NULL;
+        }
+    }
+}
+
+static void check_invalidate_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_invalidate(NULL));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_invalidate(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object = {};
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_init(NULL));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    assert_non_null(object.data);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_init_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = true;
+    assert_false(seahorse_work_stealing_deque_p_init(&object));
+    malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+            = posix_memalign_is_overridden = false;
+    assert_int_equal(
+            SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_count(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_count((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_count(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    uintmax_t count;
+    assert_true(seahorse_work_stealing_deque_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_work_stealing_deque_p_push(&object, NULL));
+    assert_true(seahorse_work_stealing_deque_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_push(NULL, NULL));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push_error_on_memory_allocation_failed(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    /* fill the initial array so that the next push has to grow it */
+    uintmax_t count = 0;
+    for (;;) {
+        malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+                = posix_memalign_is_overridden = true;
+        const bool result = seahorse_work_stealing_deque_p_push(
+                &object, (void *) count);
+        malloc_is_overridden = calloc_is_overridden = realloc_is_overridden
+                = posix_memalign_is_overridden = false;
+        if (!result) {
+            break;
+        }
+        count++;
+    }
+    assert_int_equal(
+            SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_MEMORY_ALLOCATION_FAILED,
+            seahorse_error);
+    uintmax_t out;
+    assert_true(seahorse_work_stealing_deque_p_count(&object, &out));
+    assert_int_equal(out, count);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_push(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) i));
+    }
+    uintmax_t count;
+    assert_true(seahorse_work_stealing_deque_p_count(&object, &count));
+    assert_int_equal(count, LIMIT);
+    for (uintmax_t i = LIMIT; i > 0; i--) {
+        void *out;
+        assert_true(seahorse_work_stealing_deque_p_pop(&object, &out));
+        assert_ptr_equal(out, (void *) (i - 1));
+    }
+    assert_true(seahorse_work_stealing_deque_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_pop(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_pop((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_error_on_deque_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    void *out;
+    assert_false(seahorse_work_stealing_deque_p_pop(&object, &out));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) 1));
+    assert_true(seahorse_work_stealing_deque_p_pop(&object, &out));
+    assert_false(seahorse_work_stealing_deque_p_pop(&object, &out));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY,
+                     seahorse_error);
+    uintmax_t count;
+    assert_true(seahorse_work_stealing_deque_p_count(&object, &count));
+    assert_int_equal(count, 0);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) 1));
+    assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) 2));
+    void *out;
+    assert_true(seahorse_work_stealing_deque_p_pop(&object, &out));
+    assert_ptr_equal(out, (void *) 2);
+    uintmax_t count;
+    assert_true(seahorse_work_stealing_deque_p_count(&object, &count));
+    assert_int_equal(count, 1);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_steal_error_on_object_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_steal(NULL, (void *) 1));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OBJECT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_steal_error_on_out_is_null(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    assert_false(seahorse_work_stealing_deque_p_steal((void *) 1, NULL));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_OUT_IS_NULL,
+                     seahorse_error);
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_steal_error_on_deque_is_empty(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    void *out;
+    assert_false(seahorse_work_stealing_deque_p_steal(&object, &out));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_steal(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) i));
+    }
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        void *out;
+        assert_true(seahorse_work_stealing_deque_p_steal(&object, &out));
+        assert_ptr_equal(out, (void *) i);
+    }
+    void *out;
+    assert_false(seahorse_work_stealing_deque_p_pop(&object, &out));
+    assert_int_equal(SEAHORSE_WORK_STEALING_DEQUE_P_ERROR_DEQUE_IS_EMPTY,
+                     seahorse_error);
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_pop_and_steal(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) 1));
+    assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) 2));
+    assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) 3));
+    void *out;
+    assert_true(seahorse_work_stealing_deque_p_steal(&object, &out));
+    assert_ptr_equal(out, (void *) 1);
+    assert_true(seahorse_work_stealing_deque_p_pop(&object, &out));
+    assert_ptr_equal(out, (void *) 3);
+    assert_true(seahorse_work_stealing_deque_p_steal(&object, &out));
+    assert_ptr_equal(out, (void *) 2);
+    assert_false(seahorse_work_stealing_deque_p_steal(&object, &out));
+    assert_false(seahorse_work_stealing_deque_p_pop(&object, &out));
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+static void check_concurrent_steal(void **state) {
+    seahorse_error = SEAHORSE_ERROR_NONE;
+    struct seahorse_work_stealing_deque_p object;
+    assert_true(seahorse_work_stealing_deque_p_init(&object));
+    struct context context = {
+            .object = &object
+    };
+    atomic_init(&context.done, false);
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        atomic_init(&context.taken[i], 0);
+    }
+    pthread_t threads[THIEVES];
+    for (uintmax_t i = 0; i < THIEVES; i++) {
+        assert_int_equal(pthread_create(
+                &threads[i], NULL, steal_all, &context), 0);
+    }
+    /* owner pushes in bursts and pops some back while thieves steal */
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_true(seahorse_work_stealing_deque_p_push(&object, (void *) i));
+        if (i % 3 == 2) {
+            void *out;
+            if (seahorse_work_stealing_deque_p_pop(&object, &out)) {
+                atomic_fetch_add(&context.taken[(uintptr_t) out], 1);
+            }
+        }
+    }
+    void *out;
+    while (seahorse_work_stealing_deque_p_pop(&object, &out)) {
+        atomic_fetch_add(&context.taken[(uintptr_t) out], 1);
+    }
+    atomic_store(&context.done, true);
+    for (uintmax_t i = 0; i < THIEVES; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+    }
+    /* every item was taken exactly once */
+    for (uintmax_t i = 0; i < LIMIT; i++) {
+        assert_int_equal(atomic_load(&context.taken[i]), 1);
+    }
+    assert_true(seahorse_work_stealing_deque_p_invalidate(&object));
+    seahorse_error = SEAHORSE_ERROR_NONE;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_invalidate),
+            cmocka_unit_test(check_init_error_on_object_is_null),
+            cmocka_unit_test(check_init),
+            cmocka_unit_test(check_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_count_error_on_object_is_null),
+            cmocka_unit_test(check_count_error_on_out_is_null),
+            cmocka_unit_test(check_count),
+            cmocka_unit_test(check_push_error_on_object_is_null),
+            cmocka_unit_test(check_push_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_push),
+            cmocka_unit_test(check_pop_error_on_object_is_null),
+            cmocka_unit_test(check_pop_error_on_out_is_null),
+            cmocka_unit_test(check_pop_error_on_deque_is_empty),
+            cmocka_unit_test(check_pop),
+            cmocka_unit_test(check_steal_error_on_object_is_null),
+            cmocka_unit_test(check_steal_error_on_out_is_null),
+            cmocka_unit_test(check_steal_error_on_deque_is_empty),
+            cmocka_unit_test(check_steal),
+            cmocka_unit_test(check_pop_and_steal),
+            cmocka_unit_test(check_concurrent_steal),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}